@@ -0,0 +1,109 @@
+/** @file main.c
+ *
+ * Compares the throughput of readfd and readmmap.
+ *
+ * Usage: mmapbench FILE [BUFSIZ]
+ *
+ * Scans FILE once through each readproc and prints the token count
+ * and the speed in MB/s.  Both readprocs must produce the same number
+ * of tokens and lines; the difference in speed is the cost of copying
+ * the data through the scan buffer (and of the read system calls).
+ * Use a file that's larger than a few hundred MB, and run it twice so
+ * that both passes read from the page cache.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include "libre2c/scan.h"
+#include "libre2c/readfd.h"
+#include "libre2c/readmmap.h"
+#include "wordscan.h"
+
+
+static double now()
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+
+/** Scans everything, returns the number of tokens or -1 on error. */
+
+static long scan_all(scanstate *ss, size_t *bytes, int *lines)
+{
+	long count = 0;
+	int token;
+
+	*bytes = 0;
+	wordscan_attach(ss);
+	do {
+		token = scan_next_token(ss);
+		if(token < 0) {
+			return -1;
+		}
+		*bytes += scan_token_length(ss);
+		count++;
+	} while(token);
+
+	*lines = ss->line;
+	return count;
+}
+
+
+static void report(const char *name, long count, int lines, size_t bytes, double secs)
+{
+	printf("%-10s %10ld tokens %8d lines %8.1f MB/s\n", name, count, lines,
+			secs > 0 ? bytes / secs / (1024 * 1024) : 0.0);
+}
+
+
+int main(int argc, char **argv)
+{
+	const char *filename;
+	size_t bufsiz = 64 * 1024, bytes;
+	scanstate *ss;
+	long count;
+	int lines;
+	double t;
+
+	filename = argv[1];
+	if(filename == NULL) {
+		fprintf(stderr, "Usage: %s FILE [BUFSIZ]\n", argv[0]);
+		exit(1);
+	}
+	if(argc > 2) {
+		bufsiz = strtoul(argv[2], NULL, 10);
+	}
+
+	ss = readfd_open(filename, bufsiz);
+	if(!ss) {
+		fprintf(stderr, "Could not open file %s\n", filename);
+		exit(1);
+	}
+	t = now();
+	count = scan_all(ss, &bytes, &lines);
+	t = now() - t;
+	readfd_close(ss);
+	report("readfd", count, lines, bytes, t);
+
+	ss = readmmap_open(filename, bufsiz);
+	if(!ss) {
+		fprintf(stderr, "Could not open file %s\n", filename);
+		exit(1);
+	}
+	if(!readmmap_is_mapped(ss)) {
+		printf("(%s can't be mapped, readmmap falls back to readfd)\n", filename);
+	}
+	t = now();
+	count = scan_all(ss, &bytes, &lines);
+	t = now() - t;
+	readmmap_close(ss);
+	report("readmmap", count, lines, bytes, t);
+
+	return 0;
+}
+
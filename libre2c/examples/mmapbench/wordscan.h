@@ -0,0 +1,23 @@
+/** @file wordscan.h
+ *
+ * This file defines the interface to the word scanner used by
+ * the mmapbench example.
+ */
+
+struct scanstate;
+
+
+/** These are the tokens that the word scanner recognizes. */
+enum wordscan_tokens {
+	EOFTOK,	 ///< re2c scanners always return 0 when they hit the EOF.
+	WORD,    ///< letters, digits and underscores starting with a letter.
+	NUMBER,  ///< a consecutive string of digits.
+	SPACE,   ///< a run of blanks and tabs.
+	NEWLINE, ///< a single newline.
+	OTHER,   ///< any other single character.
+};
+
+
+/** This prepares the given scanstate to be a word scanner */
+scanstate* wordscan_attach(scanstate *ss);
+
@@ -0,0 +1,123 @@
+/** @file main.c
+ *
+ * Compares the regular scan buffer with the mirrored ring buffer.
+ *
+ * Usage: ringbench shift|ring [BUFSIZ [CHUNK]] < input
+ *
+ * Scans standard input line by line, using either a buffer from
+ * dynscan_create() (read_shiftbuf() memmoves the current token to the
+ * front on every refill) or one from ringscan_create() (no data is
+ * ever moved).  Without CHUNK the input is read with readfd.
+ *
+ * Pipes and sockets return short reads (a packet, a pipe page), and
+ * every short read costs a memmove of the whole token read so far:
+ * with long tokens the copying becomes quadratic.  CHUNK caps every
+ * read() at that many bytes to reproduce this on any input, e.g.
+ *
+ * <pre>
+ *   ./ringbench shift 1048576 1500 < big.log
+ *   ./ringbench ring 1048576 1500 < big.log
+ *   cat big.log | ./ringbench ring 65536
+ * </pre>
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "libre2c/scan.h"
+#include "libre2c/scan-dyn.h"
+#include "libre2c/scan-ring.h"
+#include "libre2c/readfd.h"
+
+
+scanstate* linescan_attach(scanstate *ss);
+
+
+static double now()
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+
+/** Like readfd, but never reads more than (size_t)ss->readref bytes. */
+
+static ssize_t chunked_read(scanstate *ss)
+{
+	ssize_t n, avail;
+
+	avail = read_shiftbuf(ss);
+	if(avail > (ssize_t)(size_t)ss->readref) {
+		avail = (ssize_t)(size_t)ss->readref;
+	}
+	do {
+		n = read(0, (void*)ss->limit, avail);
+	} while(n < 0 && errno == EINTR);
+	if(n > 0) {
+		ss->limit += n;
+	}
+
+	return n;
+}
+
+
+int main(int argc, char **argv)
+{
+	size_t bufsiz = 64 * 1024, chunk = 0, bytes = 0;
+	scanstate *ss;
+	int ring, token;
+	double t;
+
+	if(argc < 2 || (strcmp(argv[1], "shift") && strcmp(argv[1], "ring"))) {
+		fprintf(stderr, "Usage: %s shift|ring [BUFSIZ [CHUNK]] < input\n", argv[0]);
+		exit(1);
+	}
+	ring = !strcmp(argv[1], "ring");
+	if(argc > 2) {
+		bufsiz = strtoul(argv[2], NULL, 10);
+	}
+	if(argc > 3) {
+		chunk = strtoul(argv[3], NULL, 10);
+	}
+
+	ss = ring ? ringscan_create(bufsiz) : dynscan_create(bufsiz);
+	if(!ss) {
+		fprintf(stderr, "Could not allocate the scanner\n");
+		exit(1);
+	}
+	readfd_attach(ss, 0);
+	if(chunk) {
+		ss->readref = (void*)chunk;
+		ss->read = chunked_read;
+	}
+	linescan_attach(ss);
+
+	t = now();
+	do {
+		token = scan_next_token(ss);
+		if(token < 0) {
+			fprintf(stderr, "Scanner's readproc returned an error: %d\n", token);
+			break;
+		}
+		bytes += scan_token_length(ss);
+	} while(token);
+	t = now() - t;
+
+	printf("%-6s %8d lines %12lu bytes %8.1f MB/s%s\n", argv[1], ss->line,
+			(unsigned long)bytes, t > 0 ? bytes / t / (1024 * 1024) : 0.0,
+			ring && !ss->bufmirror ? " (no mirror, fell back to shift)" : "");
+
+	if(ring) {
+		ringscan_free(ss);
+	} else {
+		dynscan_free(ss);
+	}
+	return 0;
+}
+
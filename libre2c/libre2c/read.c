@@ -59,6 +59,25 @@ ssize_t read_shiftbuf(scanstate *ss)
 
     // this tells how many bytes need to be shifted.
     cnt = ss->limit - min;
+
+    // A mirrored buffer has the same bytes at p and p+bufsiz, so
+    // instead of moving the data we move the pointers: the window
+    // [min, limit] is always contiguous and always starts in the
+    // first half of the mapping.  New data is read into the second
+    // half, which wraps around to the (already consumed) front.
+    if(ss->bufmirror && cnt) {
+        if(min - ss->bufptr >= (ssize_t)ss->bufsiz) {
+            ssize_t delta = ss->bufsiz;
+            ss->cursor -= delta;
+            ss->token -= delta;
+            if(ss->marker) ss->marker -= delta;
+            ss->limit -= delta;
+            min -= delta;
+        }
+        assert(ss->limit - min <= (ssize_t)ss->bufsiz);
+        return ss->bufsiz - cnt;
+    }
+
     if(cnt) {
         ssize_t delta = min - ss->bufptr;
         memmove((void*)ss->bufptr, min, cnt);
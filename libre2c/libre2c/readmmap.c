@@ -0,0 +1,171 @@
+/* readmmap.c
+ * Version VERSION
+ */
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdlib.h>
+
+#include "readmmap.h"
+#include "readfd.h"
+#include "scan-dyn.h"
+
+/** @file readmmap.c
+ *
+ * This file provides a readproc that scans memory-mapped files.
+ */
+
+
+/** Everything readmmap_close() needs to undo readmmap_open(). */
+
+struct readmmap_ref {
+    int fd;
+    void *map;        ///< Start of the reservation (== bufptr).
+    size_t maplen;    ///< File pages plus the trailing zero page.
+};
+
+
+/**
+ * The whole file is already in the buffer so there's never anything
+ * more to read.  Like readmem, this just returns EOF.
+ */
+
+static ssize_t readmmap_read(scanstate *ss)
+{
+    return 0;
+}
+
+
+/**
+ * Maps the file at fd, followed by at least one page of zeros.
+ *
+ * Pages of a file mapping that lie beyond EOF raise SIGBUS when
+ * touched, so instead of simply mapping the file we first reserve
+ * an anonymous (zero-filled) region one page larger than the file
+ * and then map the file over the front of it.  The tail of the last
+ * file page is zero-filled by the kernel, and the extra anonymous
+ * page guarantees the padding even if the file size is an exact
+ * multiple of the page size.
+ *
+ * Returns the mapping or NULL if the file can't be mapped.
+ */
+
+static void* readmmap_map(int fd, size_t len, size_t *maplen)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    void *base, *map;
+
+    *maplen = (len + page - 1) / page * page + page;
+
+    base = mmap(NULL, *maplen, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(base == MAP_FAILED) {
+        return NULL;
+    }
+
+    map = mmap(base, len, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+    if(map == MAP_FAILED) {
+        munmap(base, *maplen);
+        return NULL;
+    }
+
+#ifdef MADV_SEQUENTIAL
+    // scanners read front to back: ask for aggressive readahead
+    // and early reclaim of pages that have been scanned.
+    madvise(map, len, MADV_SEQUENTIAL);
+#endif
+
+    return map;
+}
+
+
+/* Maps the file and creates a new scanner to scan it.
+ *
+ * The scanner's buffer is the mapping itself: bufptr points at the
+ * first byte of the file and limit at the byte following the last one.
+ * Since the data is all there, the readproc simply reports EOF when
+ * the scanner asks for more.
+ *
+ * Falls back to readfd_open() if the file is not a non-empty regular
+ * file or if mapping it fails.
+ */
+
+scanstate* readmmap_open(const char *path, size_t bufsiz)
+{
+    struct readmmap_ref *ref;
+    struct stat st;
+    scanstate *ss;
+    void *map;
+    size_t maplen;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if(fd < 0) {
+        return NULL;
+    }
+
+    if(fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size <= 0
+            || (off_t)(size_t)st.st_size != st.st_size) {
+        close(fd);
+        return readfd_open(path, bufsiz);
+    }
+
+    map = readmmap_map(fd, (size_t)st.st_size, &maplen);
+    if(!map) {
+        close(fd);
+        return readfd_open(path, bufsiz);
+    }
+
+    ref = malloc(sizeof(struct readmmap_ref));
+    ss = dynscan_create(0);
+    if(!ref || !ss) {
+        free(ref);
+        if(ss) dynscan_free(ss);
+        munmap(map, maplen);
+        close(fd);
+        return NULL;
+    }
+
+    ref->fd = fd;
+    ref->map = map;
+    ref->maplen = maplen;
+
+    scanstate_init(ss, map, (size_t)st.st_size);
+    ss->limit = ss->bufptr + ss->bufsiz;
+    ss->readref = ref;
+    ss->read = readmmap_read;
+    return ss;
+}
+
+
+int readmmap_is_mapped(scanstate *ss)
+{
+    return ss->read == readmmap_read;
+}
+
+
+/**
+ * Unmaps and closes the file and deallocates the scanner.
+ */
+
+void readmmap_close(scanstate *ss)
+{
+    struct readmmap_ref *ref;
+
+    if(!readmmap_is_mapped(ss)) {
+        readfd_close(ss);
+        return;
+    }
+
+    ref = ss->readref;
+    munmap(ref->map, ref->maplen);
+    close(ref->fd);
+    free(ref);
+
+    // the buffer is the mapping: don't let dynscan_free() free it.
+    ss->bufptr = NULL;
+    dynscan_free(ss);
+}
+
@@ -0,0 +1,53 @@
+/* readmmap.h
+ * Version VERSION
+ */
+
+#include "read.h"
+
+
+/** @file readmmap.h
+ *
+ * This file provides a readproc that scans a file by mapping it into
+ * memory instead of reading it into a buffer.
+ */
+
+
+/** Creates a scanner to scan the given file without copying it.
+ *
+ * The whole file is mapped read-only and the scanner points straight
+ * at the mapping, so the data is never copied through the scan buffer
+ * (compare with readfd_open(), which memmoves every token in flight
+ * to the front of a fixed-size buffer).  The mapping is followed by at
+ * least one page of zero bytes, so a scanner that looks a few bytes
+ * past the end of the file (YYMAXFILL) always reads NULs.
+ *
+ * If the file can't be mapped (it's empty, a pipe, a device, or mmap
+ * fails), this routine falls back to readfd_open() with the given
+ * bufsiz.  The scanner works the same either way; in the fallback
+ * case no single token may be larger than bufsiz.
+ *
+ * @param path The Unix path to the file to scan.
+ * @param bufsiz The size in bytes of the scanner buffer to allocate
+ *   if the file can't be mapped.
+ */
+
+scanstate* readmmap_open(const char *path, size_t bufsiz);
+
+
+/** Disposes of the scanner created by readmmap_open().
+ *
+ * This routine unmaps and closes the file and deallocates the scanner.
+ * It works whether or not readmmap_open() had to fall back to readfd.
+ *
+ * @param ss The scanner to destroy.
+ */
+
+void readmmap_close(scanstate *ss);
+
+
+/** Returns true if the scanner created by readmmap_open() actually
+ * maps the file (rather than falling back to reading it).
+ */
+
+int readmmap_is_mapped(scanstate *ss);
+
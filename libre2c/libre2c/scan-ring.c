@@ -0,0 +1,139 @@
+/* scan-ring.c
+ *
+ * Version VERSION
+ *
+ * Routines to allocate and free scanners with mirrored ring buffers.
+ * The scanner will be initialized, but you still need to attach
+ * it to a particular type of reader.
+ */
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "scan-ring.h"
+#include "scan-dyn.h"
+
+
+static size_t ringscan_pagesize()
+{
+    return (size_t)sysconf(_SC_PAGESIZE);
+}
+
+
+/** Returns the size of the whole mirrored mapping for a buffer of
+ * bufsiz bytes: the buffer, its mirror, and one more page mirroring
+ * the start of the buffer.  The extra page lets the scanner peek a few
+ * bytes past limit (YYMAXFILL) even when limit is at the very end of
+ * the mirror.
+ */
+
+static size_t ringscan_maplen(size_t bufsiz)
+{
+    return 2 * bufsiz + ringscan_pagesize();
+}
+
+
+/** Creates an anonymous file to back the ring buffer. */
+
+static int ringscan_memfd()
+{
+    char path[] = "/tmp/libre2c-ring-XXXXXX";
+    int fd;
+
+#ifdef SYS_memfd_create
+    fd = syscall(SYS_memfd_create, "libre2c-ring", 0);
+    if(fd >= 0) {
+        return fd;
+    }
+#endif
+
+    fd = mkstemp(path);
+    if(fd >= 0) {
+        unlink(path);
+    }
+    return fd;
+}
+
+
+/** Maps the same bufsiz bytes at base, base+bufsiz and (one page of
+ * it) at base+2*bufsiz.  Returns the mapping or NULL on failure.
+ */
+
+static char* ringscan_map(size_t bufsiz)
+{
+    size_t maplen = ringscan_maplen(bufsiz);
+    char *base;
+    int fd;
+
+    fd = ringscan_memfd();
+    if(fd < 0) {
+        return NULL;
+    }
+    if(ftruncate(fd, bufsiz) < 0) {
+        close(fd);
+        return NULL;
+    }
+
+    // reserve address space, then map the file over it three times
+    base = mmap(NULL, maplen, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(base == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+    if(mmap(base, bufsiz, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED
+            || mmap(base + bufsiz, bufsiz, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED
+            || mmap(base + 2 * bufsiz, ringscan_pagesize(), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(base, maplen);
+        close(fd);
+        return NULL;
+    }
+
+    // the mappings keep the memory alive
+    close(fd);
+    return base;
+}
+
+
+scanstate* ringscan_create(size_t bufsiz)
+{
+    size_t page = ringscan_pagesize();
+    scanstate *ss;
+    char *bufptr;
+
+    bufsiz = (bufsiz + page - 1) / page * page;
+    if(!bufsiz) {
+        bufsiz = page;
+    }
+
+    bufptr = ringscan_map(bufsiz);
+    if(!bufptr) {
+        return dynscan_create(bufsiz);
+    }
+
+    ss = malloc(sizeof(scanstate));
+    if(!ss) {
+        munmap(bufptr, ringscan_maplen(bufsiz));
+        return NULL;
+    }
+
+    scanstate_init(ss, bufptr, bufsiz);
+    ss->bufmirror = 1;
+    return ss;
+}
+
+
+void ringscan_free(scanstate *ss)
+{
+    if(!ss->bufmirror) {
+        dynscan_free(ss);
+        return;
+    }
+
+    munmap((void*)ss->bufptr, ringscan_maplen(ss->bufsiz));
+    free(ss);
+}
+
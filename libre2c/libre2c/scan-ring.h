@@ -0,0 +1,35 @@
+/* scan-ring.h
+ *
+ * Version VERSION
+ *
+ * Creates a heap-allocated scanner whose buffer is a mirrored ring
+ * buffer.  You must make sure to eventually call ringscan_free for
+ * every scanner created with ringscan_create.
+ */
+
+#include "scan.h"
+
+
+/** Allocates a scanstate whose buffer is mapped twice, back to back.
+ *
+ * The bufsiz bytes following the buffer are a second virtual mapping
+ * of the same memory.  When a readproc calls read_shiftbuf() to make
+ * room for new data, the scanner pointers simply jump back by bufsiz
+ * instead of the in-flight data being memmoved to the front of the
+ * buffer, so refills cost nothing no matter how long the current
+ * token is.  Any readproc that uses read_shiftbuf() (readfd, readfp)
+ * works with it unchanged.
+ *
+ * bufsiz is rounded up to a multiple of the page size.  As with
+ * dynscan_create(), no single token may be larger than bufsiz.
+ * If the platform can't create the mirror, this falls back to
+ * dynscan_create() (check scanstate::bufmirror to find out).
+ * Returns NULL if there was a memory allocation problem.
+ */
+
+scanstate* ringscan_create(size_t bufsiz);
+
+/** Frees a scanstate allocated by ringscan_create(). */
+
+void ringscan_free(scanstate *ss);
+
@@ -51,6 +51,7 @@ void scanstate_init(scanstate *ss, const char *bufptr, size_t bufsiz)
     ss->last_read = 1;
     ss->bufptr = bufptr;
     ss->bufsiz = bufsiz;
+    ss->bufmirror = 0;
     ss->readref = NULL;
     ss->read = NULL;
     ss->scanref = NULL;
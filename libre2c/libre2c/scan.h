@@ -172,6 +172,7 @@ struct scanstate {
 
     const char *bufptr; ///< The buffer currently in use.
     size_t bufsiz;   ///< The maximum number of bytes that the buffer can hold.
+    int bufmirror;      ///< Nonzero if the bufsiz bytes following the buffer are a virtual-memory mirror of it (see ringscan_create()).  read_shiftbuf() then never moves any data.
 
     void *readref;      ///< Data specific to the ::readproc (i.e. for readfp_attach(), readref contains the FILE*).
     readproc read;      ///< Routine that refills the scan buffer.  See ::readproc.
@@ -56,6 +56,7 @@ If none of these fits your needs, see \ref writing_readprocs.
 
 - readfd_attach() -- attaches an already-open file descriptor to an already-created scanner.
 - readfd_open() -- creates a scanner and sets it up to read from a filepath.
+- readmmap_open() -- creates a scanner that scans a memory-mapped file in place (falls back to readfd_open() if the file can't be mapped).
 - readfp_attach() -- attaches an already-open FILE* to an already-created scanner.
 - readfp_open() -- creates a scanner and sets it up to read from a filepath.
 - readmem_attach() -- causes a scanner to read directly from a memory block.
@@ -2,7 +2,12 @@
 
 #include "retest.h"
 #include "libre2c/scan.h"
+#include "libre2c/readmmap.h"
+#include "libre2c/scan-ring.h"
 #include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
 
 static ssize_t test_last_readproc(scanstate *ss)
@@ -50,8 +55,157 @@ static void test_last_read()
 }
 
 
+/** Writes len bytes of data to a new temporary file, returns its fd. */
+
+static int write_temp_file(char *path, const char *data, size_t len)
+{
+	int fd = mkstemp(path);
+	if(fd < 0) {
+		Fail("could not create %s", path);
+	}
+	AssertEq(write(fd, data, len), len);
+	return fd;
+}
+
+
+/**
+ * This test ensures that readmmap points the scanner straight at the
+ * file data and that the data is followed by NULs, even if the file
+ * size is a multiple of the page size.
+ */
+
+static void test_readmmap()
+{
+	size_t sizes[] = { 1, 13, 4096, 8192, 12345 };
+	size_t i, j, len;
+	char path[64];
+	char *data;
+	scanstate *ss;
+	int fd;
+
+	for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++) {
+		len = sizes[i];
+		data = malloc(len);
+		for(j = 0; j < len; j++) {
+			data[j] = 'a' + j % 26;
+		}
+		strcpy(path, "/tmp/retest-mmap-XXXXXX");
+		fd = write_temp_file(path, data, len);
+
+		ss = readmmap_open(path, 256);
+		AssertNonNull(ss);
+		Assert(readmmap_is_mapped(ss));
+		AssertEq((ss->limit - ss->bufptr), len);
+		AssertPtrEq(ss->cursor, ss->bufptr);
+		Assert(memcmp(ss->bufptr, data, len) == 0);
+		for(j = 0; j < 16; j++) {
+			AssertEq(ss->limit[j], 0);
+		}
+		AssertEq((*ss->read)(ss), 0);
+		readmmap_close(ss);
+
+		close(fd);
+		unlink(path);
+		free(data);
+	}
+}
+
+
+/**
+ * Empty files and non-regular files can't be mapped, but the
+ * scanner should work anyway (and be closed properly).
+ */
+
+static void test_readmmap_fallback()
+{
+	char path[64];
+	scanstate *ss;
+	int fd;
+
+	strcpy(path, "/tmp/retest-mmap-XXXXXX");
+	fd = write_temp_file(path, "", 0);
+	ss = readmmap_open(path, 256);
+	AssertNonNull(ss);
+	Assert(!readmmap_is_mapped(ss));
+	AssertEq(ss->bufsiz, 256);
+	AssertEq((*ss->read)(ss), 0);
+	readmmap_close(ss);
+	close(fd);
+	unlink(path);
+
+	ss = readmmap_open("/dev/null", 256);
+	AssertNonNull(ss);
+	Assert(!readmmap_is_mapped(ss));
+	readmmap_close(ss);
+
+	AssertNull(readmmap_open("/nonexistent/file", 256));
+}
+
+
+/** Appends up to 1000 bytes of a counting pattern to the buffer. */
+
+static ssize_t test_ring_readproc(scanstate *ss)
+{
+	size_t *pos = ss->readref;
+	ssize_t i, n, avail;
+
+	avail = read_shiftbuf(ss);
+	n = avail < 1000 ? avail : 1000;
+	for(i = 0; i < n; i++) {
+		((char*)ss->limit)[i] = (char)((*pos)++ % 251);
+	}
+	ss->limit += n;
+	return n;
+}
+
+
+/**
+ * This test pushes tokens of varying length (up to nearly the whole
+ * buffer) through a mirrored ring buffer and ensures that the scanner
+ * always sees the right bytes in one contiguous window.
+ */
+
+static void test_ringscan()
+{
+	scanstate *ss;
+	size_t pos = 0, start = 0, toklen, i;
+	const char *p;
+	int wrapped = 0;
+
+	ss = ringscan_create(4096);
+	AssertNonNull(ss);
+	Assert(ss->bufmirror);
+	AssertEq(ss->bufsiz % 4096, 0);
+	ss->readref = &pos;
+	ss->read = test_ring_readproc;
+
+	for(toklen = 1; start < 20 * ss->bufsiz; toklen = (toklen * 7 + 13) % ss->bufsiz) {
+		// consume the token that starts at 'start' and is toklen bytes long
+		while((size_t)(ss->limit - ss->token) < toklen) {
+			AssertGt((*ss->read)(ss), 0);
+		}
+		Assert(ss->limit - ss->bufptr <= 2 * (ssize_t)ss->bufsiz);
+		for(i = 0, p = ss->token; i < toklen; i++, p++) {
+			AssertEq((unsigned char)*p, (start + i) % 251);
+		}
+		// tokens that straddle the end of the buffer are seen through the mirror
+		if(ss->token + toklen > ss->bufptr + ss->bufsiz) {
+			wrapped = 1;
+		}
+		start += toklen;
+		ss->cursor = ss->token = ss->token + toklen;
+	}
+	Assert(wrapped);
+
+	ringscan_free(ss);
+}
+
+
 zutest_proc re2c_tests[] = {
 	test_last_read,
+	test_readmmap,
+	test_readmmap_fallback,
+	test_ringscan,
 	NULL
 };
 
@@ -0,0 +1,76 @@
+#!/bin/sh
+
+# Compare DFA minimization algorithms (--dfa-minimization) on the same
+# inputs: time re2c with each algorithm and check that all of them
+# produce identical output.
+#
+# usage: dfa_minimization.sh [re2c] [file.re ...]
+# With no input files, synthetic specifications with large DFA are
+# generated in a temporary directory.
+
+re2c=${1:-./re2c}
+[ $# -gt 0 ] && shift
+[ -x "$re2c" ] || { echo "cannot find re2c executable ($re2c)"; exit 1; }
+
+tmpdir=`mktemp -d` || exit 1
+trap 'rm -rf "$tmpdir"' EXIT
+
+# N keywords with common prefixes and suffixes
+gen_keywords() {
+	echo "/*!re2c"
+	i=0
+	while [ $i -lt $1 ]
+	do
+		echo "\"kw_$i\" | \"pre_${i}_suf\" { return $i; }"
+		i=$((i + 1))
+	done
+	echo "[a-z_0-9]+ { return -1; }"
+	echo "* { return -2; }"
+	echo "*/"
+}
+
+# exponential DFA: N-th symbol from the end is 'a'
+gen_nth_last() {
+	echo "/*!re2c"
+	echo "[ab]* \"a\" [ab]{$1} \"\\x00\" { return 0; }"
+	echo "* { return 1; }"
+	echo "*/"
+}
+
+files="$*"
+if [ -z "$files" ]
+then
+	gen_keywords 2000 > "$tmpdir/keywords.re"
+	gen_nth_last 12 > "$tmpdir/nth_last.re"
+	files="$tmpdir/keywords.re $tmpdir/nth_last.re"
+fi
+
+time_ms() {
+	start=`date +%s%N`
+	"$@" || return 1
+	end=`date +%s%N`
+	echo $(((end - start) / 1000000))
+}
+
+status=0
+printf "%-24s %12s %12s %12s\n" "input" "table, ms" "moore, ms" "hopcroft, ms"
+for f in $files
+do
+	line=`printf "%-24s" "\`basename $f\`"`
+	for m in table moore hopcroft
+	do
+		t=`time_ms "$re2c" --no-generation-date --dfa-minimization $m -o "$tmpdir/out.c" "$f" 2>/dev/null` \
+			&& mv "$tmpdir/out.c" "$tmpdir/out.$m.c" \
+			|| t="FAIL"
+		line="$line `printf "%12s" "$t"`"
+	done
+	echo "$line"
+	for m in table hopcroft
+	do
+		[ -f "$tmpdir/out.$m.c" ] \
+			&& cmp -s "$tmpdir/out.moore.c" "$tmpdir/out.$m.c" \
+			|| { echo "  output differs: moore vs $m"; status=1; }
+	done
+	rm -f "$tmpdir"/out.*.c
+done
+exit $status
@@ -1,4 +1,4 @@
-/* Generated by re2c 0.16 on Thu Jan 21 10:47:47 2016 */
+/* Generated by re2c 0.16 on Fri Oct 16 20:46:51 2026 */
 #line 1 "../src/conf/parse_opts.re"
 #include "src/codegen/input_api.h"
 #include "src/conf/msg.h"
@@ -7,6 +7,7 @@
 #include "src/globals.h"
 #include "src/ir/regexp/empty_class_policy.h"
 #include "src/ir/regexp/encoding/enc.h"
+#include "src/util/s_to_n32_unsafe.h"
 
 namespace re2c
 {
@@ -24,7 +25,7 @@ parse_opts_t parse_opts (char ** argv, Opt & opts)
 	char * YYMARKER;
 	Warn::option_t option;
 
-#line 31 "../src/conf/parse_opts.re"
+#line 32 "../src/conf/parse_opts.re"
 
 
 opt:
@@ -33,7 +34,7 @@ opt:
 		goto end;
 	}
 
-#line 37 "src/conf/parse_opts.cc"
+#line 38 "src/conf/parse_opts.cc"
 {
 	YYCTYPE yych;
 	unsigned int yyaccept = 0;
@@ -78,12 +79,12 @@ opt:
 yy2:
 	++YYCURSOR;
 yy3:
-#line 40 "../src/conf/parse_opts.re"
+#line 41 "../src/conf/parse_opts.re"
 	{
 		error ("bad option: %s", *argv);
 		return EXIT_FAIL;
 	}
-#line 87 "src/conf/parse_opts.cc"
+#line 88 "src/conf/parse_opts.cc"
 yy4:
 	yyaccept = 0;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
@@ -96,14 +97,14 @@ yy5:
 	} else {
 		if (yych == 'W') goto yy15;
 	}
-#line 63 "../src/conf/parse_opts.re"
+#line 64 "../src/conf/parse_opts.re"
 	{ goto opt_short; }
-#line 102 "src/conf/parse_opts.cc"
+#line 103 "src/conf/parse_opts.cc"
 yy7:
 	++YYCURSOR;
-#line 61 "../src/conf/parse_opts.re"
+#line 62 "../src/conf/parse_opts.re"
 	{ if (!opts.source (*argv))     return EXIT_FAIL; goto opt; }
-#line 107 "src/conf/parse_opts.cc"
+#line 108 "src/conf/parse_opts.cc"
 yy9:
 	++YYCURSOR;
 	yych = (YYCTYPE)*YYCURSOR;
@@ -114,15 +115,15 @@ yy10:
 	goto yy7;
 yy11:
 	++YYCURSOR;
-#line 60 "../src/conf/parse_opts.re"
+#line 61 "../src/conf/parse_opts.re"
 	{ if (!opts.source ("<stdin>")) return EXIT_FAIL; goto opt; }
-#line 120 "src/conf/parse_opts.cc"
+#line 121 "src/conf/parse_opts.cc"
 yy13:
 	++YYCURSOR;
 	if ((yych = (YYCTYPE)*YYCURSOR) <= 0x00) goto yy17;
-#line 64 "../src/conf/parse_opts.re"
+#line 65 "../src/conf/parse_opts.re"
 	{ goto opt_long; }
-#line 126 "src/conf/parse_opts.cc"
+#line 127 "src/conf/parse_opts.cc"
 yy15:
 	yyaccept = 1;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
@@ -133,12 +134,12 @@ yy15:
 		if (yych == 'n') goto yy23;
 	}
 yy16:
-#line 68 "../src/conf/parse_opts.re"
+#line 69 "../src/conf/parse_opts.re"
 	{ option = Warn::W;        goto opt_warn; }
-#line 139 "src/conf/parse_opts.cc"
+#line 140 "src/conf/parse_opts.cc"
 yy17:
 	++YYCURSOR;
-#line 46 "../src/conf/parse_opts.re"
+#line 47 "../src/conf/parse_opts.re"
 	{
 		// all remaining arguments are non-options
 		// so they must be input files
@@ -152,12 +153,12 @@ yy17:
 		}
 		goto end;
 	}
-#line 156 "src/conf/parse_opts.cc"
+#line 157 "src/conf/parse_opts.cc"
 yy19:
 	++YYCURSOR;
-#line 66 "../src/conf/parse_opts.re"
+#line 67 "../src/conf/parse_opts.re"
 	{ warn.set_all ();       goto opt; }
-#line 161 "src/conf/parse_opts.cc"
+#line 162 "src/conf/parse_opts.cc"
 yy21:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych == 'r') goto yy24;
@@ -193,9 +194,9 @@ yy27:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych == 'e') goto yy30;
 yy28:
-#line 69 "../src/conf/parse_opts.re"
+#line 70 "../src/conf/parse_opts.re"
 	{ option = Warn::WNO;      goto opt_warn; }
-#line 199 "src/conf/parse_opts.cc"
+#line 200 "src/conf/parse_opts.cc"
 yy29:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych == 'r') goto yy31;
@@ -215,14 +216,14 @@ yy32:
 	goto yy22;
 yy33:
 	++YYCURSOR;
-#line 67 "../src/conf/parse_opts.re"
+#line 68 "../src/conf/parse_opts.re"
 	{ warn.set_all_error (); goto opt; }
-#line 221 "src/conf/parse_opts.cc"
+#line 222 "src/conf/parse_opts.cc"
 yy35:
 	++YYCURSOR;
-#line 70 "../src/conf/parse_opts.re"
+#line 71 "../src/conf/parse_opts.re"
 	{ option = Warn::WERROR;   goto opt_warn; }
-#line 226 "src/conf/parse_opts.cc"
+#line 227 "src/conf/parse_opts.cc"
 yy37:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych != 'o') goto yy22;
@@ -231,16 +232,16 @@ yy37:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych != '-') goto yy22;
 	++YYCURSOR;
-#line 71 "../src/conf/parse_opts.re"
+#line 72 "../src/conf/parse_opts.re"
 	{ option = Warn::WNOERROR; goto opt_warn; }
-#line 237 "src/conf/parse_opts.cc"
+#line 238 "src/conf/parse_opts.cc"
 }
-#line 72 "../src/conf/parse_opts.re"
+#line 73 "../src/conf/parse_opts.re"
 
 
 opt_warn:
 
-#line 244 "src/conf/parse_opts.cc"
+#line 245 "src/conf/parse_opts.cc"
 {
 	YYCTYPE yych;
 	yych = (YYCTYPE)*YYCURSOR;
@@ -255,12 +256,12 @@ opt_warn:
 yy44:
 	++YYCURSOR;
 yy45:
-#line 77 "../src/conf/parse_opts.re"
+#line 78 "../src/conf/parse_opts.re"
 	{
 		error ("bad warning: %s", *argv);
 		return EXIT_FAIL;
 	}
-#line 264 "src/conf/parse_opts.cc"
+#line 265 "src/conf/parse_opts.cc"
 yy46:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych == 'o') goto yy51;
@@ -631,9 +632,9 @@ yy137:
 	goto yy52;
 yy138:
 	++YYCURSOR;
-#line 84 "../src/conf/parse_opts.re"
+#line 85 "../src/conf/parse_opts.re"
 	{ warn.set (Warn::SWAPPED_RANGE,          option); goto opt; }
-#line 637 "src/conf/parse_opts.cc"
+#line 638 "src/conf/parse_opts.cc"
 yy140:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych == 'r') goto yy146;
@@ -668,14 +669,14 @@ yy147:
 	goto yy52;
 yy148:
 	++YYCURSOR;
-#line 87 "../src/conf/parse_opts.re"
+#line 88 "../src/conf/parse_opts.re"
 	{ warn.set (Warn::USELESS_ESCAPE,         option); goto opt; }
-#line 674 "src/conf/parse_opts.cc"
+#line 675 "src/conf/parse_opts.cc"
 yy150:
 	++YYCURSOR;
-#line 81 "../src/conf/parse_opts.re"
+#line 82 "../src/conf/parse_opts.re"
 	{ warn.set (Warn::CONDITION_ORDER,        option); goto opt; }
-#line 679 "src/conf/parse_opts.cc"
+#line 680 "src/conf/parse_opts.cc"
 yy152:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych == 'c') goto yy156;
@@ -722,18 +723,18 @@ yy162:
 	goto yy52;
 yy163:
 	++YYCURSOR;
-#line 86 "../src/conf/parse_opts.re"
+#line 87 "../src/conf/parse_opts.re"
 	{ warn.set (Warn::UNREACHABLE_RULES,      option); goto opt; }
-#line 728 "src/conf/parse_opts.cc"
+#line 729 "src/conf/parse_opts.cc"
 yy165:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych == 's') goto yy169;
 	goto yy52;
 yy166:
 	++YYCURSOR;
-#line 83 "../src/conf/parse_opts.re"
+#line 84 "../src/conf/parse_opts.re"
 	{ warn.set (Warn::MATCH_EMPTY_STRING,     option); goto opt; }
-#line 737 "src/conf/parse_opts.cc"
+#line 738 "src/conf/parse_opts.cc"
 yy168:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych == 'l') goto yy170;
@@ -756,83 +757,88 @@ yy172:
 	goto yy52;
 yy173:
 	++YYCURSOR;
-#line 82 "../src/conf/parse_opts.re"
+#line 83 "../src/conf/parse_opts.re"
 	{ warn.set (Warn::EMPTY_CHARACTER_CLASS,  option); goto opt; }
-#line 762 "src/conf/parse_opts.cc"
+#line 763 "src/conf/parse_opts.cc"
 yy175:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych >= 0x01) goto yy52;
 	++YYCURSOR;
-#line 85 "../src/conf/parse_opts.re"
+#line 86 "../src/conf/parse_opts.re"
 	{ warn.set (Warn::UNDEFINED_CONTROL_FLOW, option); goto opt; }
-#line 769 "src/conf/parse_opts.cc"
+#line 770 "src/conf/parse_opts.cc"
 }
-#line 88 "../src/conf/parse_opts.re"
+#line 89 "../src/conf/parse_opts.re"
 
 
 opt_short:
 
-#line 776 "src/conf/parse_opts.cc"
+#line 777 "src/conf/parse_opts.cc"
 {
 	YYCTYPE yych;
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych <= 'b') {
-		if (yych <= 'C') {
+	if (yych <= 'c') {
+		if (yych <= 'D') {
 			if (yych <= '7') {
 				if (yych <= 0x00) goto yy180;
 				if (yych == '1') goto yy184;
 				goto yy182;
 			} else {
-				if (yych <= '8') goto yy186;
-				if (yych == '?') goto yy188;
-				goto yy182;
+				if (yych <= '>') {
+					if (yych <= '8') goto yy186;
+					goto yy182;
+				} else {
+					if (yych <= '?') goto yy188;
+					if (yych <= 'C') goto yy182;
+					goto yy190;
+				}
 			}
 		} else {
-			if (yych <= 'R') {
-				if (yych <= 'D') goto yy190;
+			if (yych <= 'S') {
 				if (yych == 'F') goto yy192;
-				goto yy182;
+				if (yych <= 'R') goto yy182;
+				goto yy194;
 			} else {
-				if (yych <= 'U') {
-					if (yych <= 'S') goto yy194;
-					goto yy182;
+				if (yych <= 'V') {
+					if (yych <= 'U') goto yy182;
+					goto yy196;
 				} else {
-					if (yych <= 'V') goto yy196;
 					if (yych <= 'a') goto yy182;
-					goto yy198;
+					if (yych <= 'b') goto yy198;
+					goto yy200;
 				}
 			}
 		}
 	} else {
 		if (yych <= 'o') {
-			if (yych <= 'f') {
-				if (yych <= 'c') goto yy200;
+			if (yych <= 'g') {
 				if (yych <= 'd') goto yy202;
 				if (yych <= 'e') goto yy204;
-				goto yy206;
+				if (yych <= 'f') goto yy206;
+				goto yy208;
 			} else {
-				if (yych <= 'h') {
-					if (yych <= 'g') goto yy208;
-					goto yy188;
+				if (yych <= 'i') {
+					if (yych <= 'h') goto yy188;
+					goto yy210;
 				} else {
-					if (yych <= 'i') goto yy210;
+					if (yych <= 'j') goto yy212;
 					if (yych <= 'n') goto yy182;
-					goto yy212;
+					goto yy214;
 				}
 			}
 		} else {
 			if (yych <= 't') {
 				if (yych <= 'q') goto yy182;
-				if (yych <= 'r') goto yy214;
-				if (yych <= 's') goto yy216;
-				goto yy218;
+				if (yych <= 'r') goto yy216;
+				if (yych <= 's') goto yy218;
+				goto yy220;
 			} else {
 				if (yych <= 'v') {
-					if (yych <= 'u') goto yy220;
-					goto yy222;
+					if (yych <= 'u') goto yy222;
+					goto yy224;
 				} else {
-					if (yych <= 'w') goto yy224;
-					if (yych <= 'x') goto yy226;
+					if (yych <= 'w') goto yy226;
+					if (yych <= 'x') goto yy228;
 					goto yy182;
 				}
 			}
@@ -840,1453 +846,2085 @@ opt_short:
 	}
 yy180:
 	++YYCURSOR;
-#line 97 "../src/conf/parse_opts.re"
+#line 98 "../src/conf/parse_opts.re"
 	{ goto opt; }
-#line 846 "src/conf/parse_opts.cc"
+#line 852 "src/conf/parse_opts.cc"
 yy182:
 	++YYCURSOR;
-#line 93 "../src/conf/parse_opts.re"
+#line 94 "../src/conf/parse_opts.re"
 	{
 		error ("bad short option: %s", *argv);
 		return EXIT_FAIL;
 	}
-#line 854 "src/conf/parse_opts.cc"
+#line 860 "src/conf/parse_opts.cc"
 yy184:
 	++YYCURSOR;
-#line 121 "../src/conf/parse_opts.re"
+#line 124 "../src/conf/parse_opts.re"
 	{ goto opt_short; }
-#line 859 "src/conf/parse_opts.cc"
+#line 865 "src/conf/parse_opts.cc"
 yy186:
 	++YYCURSOR;
-#line 116 "../src/conf/parse_opts.re"
+#line 117 "../src/conf/parse_opts.re"
 	{ if (!opts.set_encoding (Enc::UTF8))   { error_encoding (); return EXIT_FAIL; } goto opt_short; }
-#line 864 "src/conf/parse_opts.cc"
+#line 870 "src/conf/parse_opts.cc"
 yy188:
 	++YYCURSOR;
-#line 98 "../src/conf/parse_opts.re"
+#line 99 "../src/conf/parse_opts.re"
 	{ usage ();   return EXIT_OK; }
-#line 869 "src/conf/parse_opts.cc"
+#line 875 "src/conf/parse_opts.cc"
 yy190:
 	++YYCURSOR;
-#line 104 "../src/conf/parse_opts.re"
+#line 105 "../src/conf/parse_opts.re"
 	{ opts.set_target (opt_t::DOT);      goto opt_short; }
-#line 874 "src/conf/parse_opts.cc"
+#line 880 "src/conf/parse_opts.cc"
 yy192:
 	++YYCURSOR;
-#line 106 "../src/conf/parse_opts.re"
+#line 107 "../src/conf/parse_opts.re"
 	{ opts.set_FFlag (true);             goto opt_short; }
-#line 879 "src/conf/parse_opts.cc"
+#line 885 "src/conf/parse_opts.cc"
 yy194:
 	++YYCURSOR;
-#line 111 "../src/conf/parse_opts.re"
+#line 112 "../src/conf/parse_opts.re"
 	{ opts.set_target (opt_t::SKELETON); goto opt_short; }
-#line 884 "src/conf/parse_opts.cc"
+#line 890 "src/conf/parse_opts.cc"
 yy196:
 	++YYCURSOR;
-#line 100 "../src/conf/parse_opts.re"
+#line 101 "../src/conf/parse_opts.re"
 	{ vernum ();  return EXIT_OK; }
-#line 889 "src/conf/parse_opts.cc"
+#line 895 "src/conf/parse_opts.cc"
 yy198:
 	++YYCURSOR;
-#line 101 "../src/conf/parse_opts.re"
+#line 102 "../src/conf/parse_opts.re"
 	{ opts.set_bFlag (true);             goto opt_short; }
-#line 894 "src/conf/parse_opts.cc"
+#line 900 "src/conf/parse_opts.cc"
 yy200:
 	++YYCURSOR;
-#line 102 "../src/conf/parse_opts.re"
+#line 103 "../src/conf/parse_opts.re"
 	{ opts.set_cFlag (true);             goto opt_short; }
-#line 899 "src/conf/parse_opts.cc"
+#line 905 "src/conf/parse_opts.cc"
 yy202:
 	++YYCURSOR;
-#line 103 "../src/conf/parse_opts.re"
+#line 104 "../src/conf/parse_opts.re"
 	{ opts.set_dFlag (true);             goto opt_short; }
-#line 904 "src/conf/parse_opts.cc"
+#line 910 "src/conf/parse_opts.cc"
 yy204:
 	++YYCURSOR;
-#line 112 "../src/conf/parse_opts.re"
+#line 113 "../src/conf/parse_opts.re"
 	{ if (!opts.set_encoding (Enc::EBCDIC)) { error_encoding (); return EXIT_FAIL; } goto opt_short; }
-#line 909 "src/conf/parse_opts.cc"
+#line 915 "src/conf/parse_opts.cc"
 yy206:
 	++YYCURSOR;
-#line 105 "../src/conf/parse_opts.re"
+#line 106 "../src/conf/parse_opts.re"
 	{ opts.set_fFlag (true);             goto opt_short; }
-#line 914 "src/conf/parse_opts.cc"
+#line 920 "src/conf/parse_opts.cc"
 yy208:
 	++YYCURSOR;
-#line 107 "../src/conf/parse_opts.re"
+#line 108 "../src/conf/parse_opts.re"
 	{ opts.set_gFlag (true);             goto opt_short; }
-#line 919 "src/conf/parse_opts.cc"
+#line 925 "src/conf/parse_opts.cc"
 yy210:
 	++YYCURSOR;
-#line 108 "../src/conf/parse_opts.re"
+#line 109 "../src/conf/parse_opts.re"
 	{ opts.set_iFlag (true);             goto opt_short; }
-#line 924 "src/conf/parse_opts.cc"
+#line 930 "src/conf/parse_opts.cc"
 yy212:
 	++YYCURSOR;
-	if ((yych = (YYCTYPE)*YYCURSOR) <= 0x00) goto yy228;
-#line 118 "../src/conf/parse_opts.re"
-	{ *argv = YYCURSOR;                                                             goto opt_output; }
-#line 930 "src/conf/parse_opts.cc"
+	if ((yych = (YYCTYPE)*YYCURSOR) <= 0x00) goto yy230;
+#line 123 "../src/conf/parse_opts.re"
+	{ *argv = YYCURSOR;                                                           goto opt_jobs; }
+#line 936 "src/conf/parse_opts.cc"
 yy214:
 	++YYCURSOR;
-#line 109 "../src/conf/parse_opts.re"
-	{ opts.set_rFlag (true);             goto opt_short; }
-#line 935 "src/conf/parse_opts.cc"
+	if ((yych = (YYCTYPE)*YYCURSOR) <= 0x00) goto yy232;
+#line 119 "../src/conf/parse_opts.re"
+	{ *argv = YYCURSOR;                                                             goto opt_output; }
+#line 942 "src/conf/parse_opts.cc"
 yy216:
 	++YYCURSOR;
 #line 110 "../src/conf/parse_opts.re"
-	{ opts.set_sFlag (true);             goto opt_short; }
-#line 940 "src/conf/parse_opts.cc"
+	{ opts.set_rFlag (true);             goto opt_short; }
+#line 947 "src/conf/parse_opts.cc"
 yy218:
 	++YYCURSOR;
-	if ((yych = (YYCTYPE)*YYCURSOR) <= 0x00) goto yy230;
-#line 120 "../src/conf/parse_opts.re"
-	{ *argv = YYCURSOR;                                                                  goto opt_header; }
-#line 946 "src/conf/parse_opts.cc"
+#line 111 "../src/conf/parse_opts.re"
+	{ opts.set_sFlag (true);             goto opt_short; }
+#line 952 "src/conf/parse_opts.cc"
 yy220:
 	++YYCURSOR;
-#line 113 "../src/conf/parse_opts.re"
-	{ if (!opts.set_encoding (Enc::UTF32))  { error_encoding (); return EXIT_FAIL; } goto opt_short; }
-#line 951 "src/conf/parse_opts.cc"
+	if ((yych = (YYCTYPE)*YYCURSOR) <= 0x00) goto yy234;
+#line 121 "../src/conf/parse_opts.re"
+	{ *argv = YYCURSOR;                                                                  goto opt_header; }
+#line 958 "src/conf/parse_opts.cc"
 yy222:
 	++YYCURSOR;
-#line 99 "../src/conf/parse_opts.re"
-	{ version (); return EXIT_OK; }
-#line 956 "src/conf/parse_opts.cc"
+#line 114 "../src/conf/parse_opts.re"
+	{ if (!opts.set_encoding (Enc::UTF32))  { error_encoding (); return EXIT_FAIL; } goto opt_short; }
+#line 963 "src/conf/parse_opts.cc"
 yy224:
 	++YYCURSOR;
-#line 114 "../src/conf/parse_opts.re"
-	{ if (!opts.set_encoding (Enc::UCS2))   { error_encoding (); return EXIT_FAIL; } goto opt_short; }
-#line 961 "src/conf/parse_opts.cc"
+#line 100 "../src/conf/parse_opts.re"
+	{ version (); return EXIT_OK; }
+#line 968 "src/conf/parse_opts.cc"
 yy226:
 	++YYCURSOR;
 #line 115 "../src/conf/parse_opts.re"
-	{ if (!opts.set_encoding (Enc::UTF16))  { error_encoding (); return EXIT_FAIL; } goto opt_short; }
-#line 966 "src/conf/parse_opts.cc"
+	{ if (!opts.set_encoding (Enc::UCS2))   { error_encoding (); return EXIT_FAIL; } goto opt_short; }
+#line 973 "src/conf/parse_opts.cc"
 yy228:
 	++YYCURSOR;
-#line 117 "../src/conf/parse_opts.re"
-	{ if (!next (YYCURSOR, argv)) { error_arg ("-o, --output"); return EXIT_FAIL; } goto opt_output; }
-#line 971 "src/conf/parse_opts.cc"
+#line 116 "../src/conf/parse_opts.re"
+	{ if (!opts.set_encoding (Enc::UTF16))  { error_encoding (); return EXIT_FAIL; } goto opt_short; }
+#line 978 "src/conf/parse_opts.cc"
 yy230:
 	++YYCURSOR;
-#line 119 "../src/conf/parse_opts.re"
+#line 122 "../src/conf/parse_opts.re"
+	{ if (!next (YYCURSOR, argv)) { error_arg ("-j, --jobs"); return EXIT_FAIL; } goto opt_jobs; }
+#line 983 "src/conf/parse_opts.cc"
+yy232:
+	++YYCURSOR;
+#line 118 "../src/conf/parse_opts.re"
+	{ if (!next (YYCURSOR, argv)) { error_arg ("-o, --output"); return EXIT_FAIL; } goto opt_output; }
+#line 988 "src/conf/parse_opts.cc"
+yy234:
+	++YYCURSOR;
+#line 120 "../src/conf/parse_opts.re"
 	{ if (!next (YYCURSOR, argv)) { error_arg ("-t, --type-header"); return EXIT_FAIL; } goto opt_header; }
-#line 976 "src/conf/parse_opts.cc"
+#line 993 "src/conf/parse_opts.cc"
 }
-#line 122 "../src/conf/parse_opts.re"
+#line 125 "../src/conf/parse_opts.re"
 
 
 opt_long:
 
-#line 983 "src/conf/parse_opts.cc"
+#line 1000 "src/conf/parse_opts.cc"
 {
 	YYCTYPE yych;
 	yych = (YYCTYPE)*YYCURSOR;
 	switch (yych) {
-	case 'b':	goto yy236;
-	case 'c':	goto yy237;
-	case 'd':	goto yy238;
-	case 'e':	goto yy239;
-	case 'f':	goto yy240;
-	case 'h':	goto yy241;
-	case 'i':	goto yy242;
-	case 'n':	goto yy243;
-	case 'o':	goto yy244;
-	case 'r':	goto yy245;
-	case 's':	goto yy246;
-	case 't':	goto yy247;
-	case 'u':	goto yy248;
-	case 'v':	goto yy249;
-	case 'w':	goto yy250;
-	default:	goto yy234;
+	case 'b':	goto yy240;
+	case 'c':	goto yy241;
+	case 'd':	goto yy242;
+	case 'e':	goto yy243;
+	case 'f':	goto yy244;
+	case 'h':	goto yy245;
+	case 'i':	goto yy246;
+	case 'j':	goto yy247;
+	case 'n':	goto yy248;
+	case 'o':	goto yy249;
+	case 'p':	goto yy250;
+	case 'r':	goto yy251;
+	case 's':	goto yy252;
+	case 't':	goto yy253;
+	case 'u':	goto yy254;
+	case 'v':	goto yy255;
+	case 'w':	goto yy256;
+	default:	goto yy238;
 	}
-yy234:
+yy238:
 	++YYCURSOR;
-yy235:
-#line 127 "../src/conf/parse_opts.re"
+yy239:
+#line 130 "../src/conf/parse_opts.re"
 	{
 		error ("bad long option: %s", *argv);
 		return EXIT_FAIL;
 	}
-#line 1013 "src/conf/parse_opts.cc"
-yy236:
-	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'i') goto yy251;
-	goto yy235;
-yy237:
-	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy253;
-	if (yych == 'o') goto yy254;
-	goto yy235;
-yy238:
-	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych <= 'd') goto yy235;
-	if (yych <= 'e') goto yy255;
-	if (yych <= 'f') goto yy256;
-	goto yy235;
-yy239:
-	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych <= 'l') {
-		if (yych == 'c') goto yy257;
-		goto yy235;
-	} else {
-		if (yych <= 'm') goto yy258;
-		if (yych <= 'n') goto yy259;
-		goto yy235;
-	}
+#line 1032 "src/conf/parse_opts.cc"
 yy240:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'l') goto yy260;
-	goto yy235;
+	if (yych == 'e') goto yy257;
+	if (yych == 'i') goto yy259;
+	goto yy239;
 yy241:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy261;
-	goto yy235;
+	if (yych <= 'g') {
+		if (yych == 'a') goto yy260;
+		goto yy239;
+	} else {
+		if (yych <= 'h') goto yy261;
+		if (yych == 'o') goto yy262;
+		goto yy239;
+	}
 yy242:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'n') goto yy262;
-	goto yy235;
+	if (yych <= 'd') goto yy239;
+	if (yych <= 'e') goto yy263;
+	if (yych <= 'f') goto yy264;
+	goto yy239;
 yy243:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy263;
-	if (yych == 'o') goto yy264;
-	goto yy235;
+	if (yych <= 'l') {
+		if (yych == 'c') goto yy265;
+		goto yy239;
+	} else {
+		if (yych <= 'm') goto yy266;
+		if (yych <= 'n') goto yy267;
+		goto yy239;
+	}
 yy244:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'u') goto yy265;
-	goto yy235;
+	if (yych == 'l') goto yy268;
+	goto yy239;
 yy245:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy266;
-	goto yy235;
+	if (yych == 'e') goto yy269;
+	goto yy239;
 yy246:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych <= 'j') {
-		if (yych == 'i') goto yy267;
-		goto yy235;
-	} else {
-		if (yych <= 'k') goto yy268;
-		if (yych == 't') goto yy269;
-		goto yy235;
-	}
+	if (yych == 'n') goto yy270;
+	goto yy239;
 yy247:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'y') goto yy270;
-	goto yy235;
+	if (yych == 'o') goto yy271;
+	goto yy239;
 yy248:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'n') goto yy271;
-	if (yych == 't') goto yy272;
-	goto yy235;
+	if (yych == 'e') goto yy272;
+	if (yych == 'o') goto yy273;
+	goto yy239;
 yy249:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy273;
-	goto yy235;
+	if (yych == 'u') goto yy274;
+	goto yy239;
 yy250:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'i') goto yy274;
-	goto yy235;
+	if (yych == 'r') goto yy275;
+	goto yy239;
 yy251:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy275;
+	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
+	if (yych == 'e') goto yy276;
+	goto yy239;
 yy252:
-	YYCURSOR = YYMARKER;
-	goto yy235;
+	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
+	if (yych <= 'j') {
+		if (yych == 'i') goto yy277;
+		goto yy239;
+	} else {
+		if (yych <= 'k') goto yy278;
+		if (yych == 't') goto yy279;
+		goto yy239;
+	}
 yy253:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy276;
-	goto yy252;
+	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
+	if (yych == 'a') goto yy280;
+	if (yych == 'y') goto yy281;
+	goto yy239;
 yy254:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'm') goto yy277;
-	goto yy252;
+	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
+	if (yych == 'n') goto yy282;
+	if (yych == 't') goto yy283;
+	goto yy239;
 yy255:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'b') goto yy278;
-	goto yy252;
+	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
+	if (yych == 'e') goto yy284;
+	goto yy239;
 yy256:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy279;
-	goto yy252;
+	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
+	if (yych == 'i') goto yy285;
+	if (yych == 'o') goto yy286;
+	goto yy239;
 yy257:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'b') goto yy280;
-	goto yy252;
+	if (yych == 'n') goto yy287;
 yy258:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy281;
-	if (yych == 'p') goto yy282;
-	goto yy252;
+	YYCURSOR = YYMARKER;
+	goto yy239;
 yy259:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy283;
-	goto yy252;
+	if (yych == 't') goto yy288;
+	goto yy258;
 yy260:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy284;
-	goto yy252;
+	if (yych == 's') goto yy289;
+	goto yy258;
 yy261:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy285;
-	goto yy252;
+	if (yych == 'a') goto yy290;
+	goto yy258;
 yy262:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'p') goto yy286;
-	goto yy252;
+	if (yych == 'm') goto yy291;
+	goto yy258;
 yy263:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy287;
-	goto yy252;
+	if (yych == 'b') goto yy292;
+	goto yy258;
 yy264:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy288;
-	goto yy252;
+	if (yych == 'a') goto yy293;
+	goto yy258;
 yy265:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy289;
-	goto yy252;
+	if (yych == 'b') goto yy294;
+	goto yy258;
 yy266:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'u') goto yy290;
-	goto yy252;
+	if (yych == 'i') goto yy295;
+	if (yych == 'p') goto yy296;
+	goto yy258;
 yy267:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy291;
-	goto yy252;
+	if (yych == 'c') goto yy297;
+	goto yy258;
 yy268:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy292;
-	goto yy252;
+	if (yych == 'e') goto yy298;
+	goto yy258;
 yy269:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy293;
-	if (yych == 'o') goto yy294;
-	goto yy252;
+	if (yych == 'l') goto yy299;
+	goto yy258;
 yy270:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'p') goto yy295;
-	goto yy252;
+	if (yych == 'p') goto yy300;
+	if (yych == 's') goto yy301;
+	goto yy258;
 yy271:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy296;
-	goto yy252;
+	if (yych == 'b') goto yy302;
+	goto yy258;
 yy272:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'f') goto yy297;
-	goto yy252;
+	if (yych == 's') goto yy303;
+	goto yy258;
 yy273:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy298;
-	goto yy252;
+	if (yych == '-') goto yy304;
+	goto yy258;
 yy274:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'd') goto yy299;
-	goto yy252;
+	if (yych == 't') goto yy305;
+	goto yy258;
 yy275:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy300;
-	goto yy252;
+	if (yych == 'o') goto yy306;
+	goto yy258;
 yy276:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy301;
-	goto yy252;
+	if (yych == 'u') goto yy307;
+	goto yy258;
 yy277:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'p') goto yy302;
-	goto yy252;
+	if (yych <= 'l') goto yy258;
+	if (yych <= 'm') goto yy308;
+	if (yych <= 'n') goto yy309;
+	goto yy258;
 yy278:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'u') goto yy303;
-	goto yy252;
+	if (yych == 'e') goto yy310;
+	goto yy258;
 yy279:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy304;
-	goto yy252;
+	if (yych == 'a') goto yy311;
+	if (yych == 'o') goto yy312;
+	goto yy258;
 yy280:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy305;
-	goto yy252;
+	if (yych == 'b') goto yy313;
+	goto yy258;
 yy281:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy307;
-	goto yy252;
+	if (yych == 'p') goto yy314;
+	goto yy258;
 yy282:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy308;
-	goto yy252;
+	if (yych == 'i') goto yy315;
+	goto yy258;
 yy283:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy309;
-	goto yy252;
+	if (yych == 'f') goto yy316;
+	goto yy258;
 yy284:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'x') goto yy310;
-	goto yy252;
+	if (yych == 'r') goto yy317;
+	goto yy258;
 yy285:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'p') goto yy311;
-	goto yy252;
+	if (yych == 'd') goto yy318;
+	goto yy258;
 yy286:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'u') goto yy312;
-	goto yy252;
+	if (yych == 'r') goto yy319;
+	goto yy258;
 yy287:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy313;
-	goto yy252;
+	if (yych == 'c') goto yy320;
+	goto yy258;
 yy288:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 'f') {
-		if (yych == 'd') goto yy314;
-		goto yy252;
-	} else {
-		if (yych <= 'g') goto yy315;
-		if (yych == 'v') goto yy316;
-		goto yy252;
-	}
+	if (yych == '-') goto yy321;
+	goto yy258;
 yy289:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'p') goto yy317;
-	goto yy252;
+	if (yych == 'e') goto yy322;
+	goto yy258;
 yy290:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy318;
-	goto yy252;
+	if (yych == 'r') goto yy323;
+	goto yy258;
 yy291:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'g') goto yy319;
-	goto yy252;
+	if (yych == 'p') goto yy324;
+	goto yy258;
 yy292:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy320;
-	goto yy252;
+	if (yych == 'u') goto yy325;
+	goto yy258;
 yy293:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy321;
-	goto yy252;
+	if (yych == '-') goto yy326;
+	goto yy258;
 yy294:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy322;
-	goto yy252;
+	if (yych <= 0x00) goto yy327;
+	goto yy258;
 yy295:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy323;
-	goto yy252;
+	if (yych == 't') goto yy329;
+	goto yy258;
 yy296:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy324;
-	goto yy252;
+	if (yych == 't') goto yy330;
+	goto yy258;
 yy297:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy325;
-	goto yy252;
+	if (yych == 'o') goto yy331;
+	goto yy258;
 yy298:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy326;
-	if (yych == 's') goto yy327;
-	goto yy252;
+	if (yych == 'x') goto yy332;
+	goto yy258;
 yy299:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy328;
-	goto yy252;
+	if (yych == 'p') goto yy333;
+	goto yy258;
 yy300:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'v') goto yy329;
-	goto yy252;
+	if (yych == 'u') goto yy334;
+	goto yy258;
 yy301:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy330;
-	goto yy252;
+	if (yych == 't') goto yy335;
+	goto yy258;
 yy302:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'u') goto yy331;
-	goto yy252;
+	if (yych == 's') goto yy336;
+	goto yy258;
 yy303:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'g') goto yy332;
-	goto yy252;
+	if (yych == 't') goto yy337;
+	goto yy258;
 yy304:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'm') goto yy333;
-	goto yy252;
+	if (yych <= 'f') {
+		if (yych == 'd') goto yy338;
+		goto yy258;
+	} else {
+		if (yych <= 'g') goto yy339;
+		if (yych == 'v') goto yy340;
+		goto yy258;
+	}
 yy305:
-	++YYCURSOR;
-#line 149 "../src/conf/parse_opts.re"
-	{ if (!opts.set_encoding (Enc::EBCDIC)) { error_encoding (); return EXIT_FAIL; } goto opt; }
-#line 1318 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'p') goto yy341;
+	goto yy258;
+yy306:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'f') goto yy342;
+	goto yy258;
 yy307:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy334;
-	goto yy252;
+	if (yych == 's') goto yy343;
+	goto yy258;
 yy308:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'y') goto yy335;
-	goto yy252;
+	if (yych == 'd') goto yy344;
+	goto yy258;
 yy309:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'd') goto yy336;
-	goto yy252;
+	if (yych == 'g') goto yy345;
+	goto yy258;
 yy310:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy337;
-	goto yy252;
+	if (yych == 'l') goto yy346;
+	goto yy258;
 yy311:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy338;
-	goto yy252;
+	if (yych == 'r') goto yy347;
+	if (yych == 't') goto yy348;
+	goto yy258;
 yy312:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy340;
-	goto yy252;
+	if (yych == 'r') goto yy349;
+	goto yy258;
 yy313:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy341;
-	goto yy252;
+	if (yych == 'l') goto yy350;
+	goto yy258;
 yy314:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy342;
-	goto yy252;
+	if (yych == 'e') goto yy351;
+	goto yy258;
 yy315:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy343;
-	goto yy252;
+	if (yych == 'c') goto yy352;
+	goto yy258;
 yy316:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy344;
-	goto yy252;
+	if (yych == '-') goto yy353;
+	goto yy258;
 yy317:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'u') goto yy345;
-	goto yy252;
+	if (yych == 'n') goto yy354;
+	if (yych == 's') goto yy355;
+	goto yy258;
 yy318:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy346;
-	goto yy252;
+	if (yych == 'e') goto yy356;
+	goto yy258;
 yy319:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy347;
-	goto yy252;
+	if (yych == 'd') goto yy357;
+	goto yy258;
 yy320:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy348;
-	goto yy252;
+	if (yych == 'h') goto yy358;
+	goto yy258;
 yy321:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy349;
-	goto yy252;
+	if (yych == 'v') goto yy359;
+	goto yy258;
 yy322:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy350;
-	goto yy252;
+	if (yych == '-') goto yy360;
+	goto yy258;
 yy323:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy351;
-	goto yy252;
+	if (yych == '-') goto yy361;
+	goto yy258;
 yy324:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy352;
-	goto yy252;
+	if (yych == 'u') goto yy362;
+	goto yy258;
 yy325:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '1') goto yy353;
-	if (yych == '8') goto yy354;
-	goto yy252;
+	if (yych == 'g') goto yy363;
+	goto yy258;
 yy326:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'u') goto yy355;
-	goto yy252;
+	if (yych == 'c') goto yy364;
+	if (yych == 'm') goto yy365;
+	goto yy258;
 yy327:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy356;
-	goto yy252;
-yy328:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy357;
-	goto yy252;
+	++YYCURSOR;
+#line 157 "../src/conf/parse_opts.re"
+	{ if (!opts.set_encoding (Enc::EBCDIC)) { error_encoding (); return EXIT_FAIL; } goto opt; }
+#line 1422 "src/conf/parse_opts.cc"
 yy329:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy358;
-	goto yy252;
+	if (yych == '-') goto yy366;
+	goto yy258;
 yy330:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy359;
-	goto yy252;
+	if (yych == 'y') goto yy367;
+	goto yy258;
 yy331:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy360;
-	goto yy252;
+	if (yych == 'd') goto yy368;
+	goto yy258;
 yy332:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy361;
-	goto yy252;
+	if (yych == '-') goto yy369;
+	goto yy258;
 yy333:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy362;
-	goto yy252;
+	if (yych <= 0x00) goto yy370;
+	goto yy258;
 yy334:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'd') goto yy363;
-	goto yy252;
+	if (yych == 't') goto yy372;
+	goto yy258;
 yy335:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy364;
-	goto yy252;
+	if (yych == 'r') goto yy373;
+	goto yy258;
 yy336:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy365;
-	goto yy252;
+	if (yych <= 0x00) goto yy374;
+	goto yy258;
 yy337:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy366;
-	goto yy252;
+	if (yych == 'e') goto yy376;
+	goto yy258;
 yy338:
-	++YYCURSOR;
-#line 131 "../src/conf/parse_opts.re"
-	{ usage ();   return EXIT_OK; }
-#line 1448 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy377;
+	goto yy258;
+yy339:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy378;
+	goto yy258;
 yy340:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy367;
-	goto yy252;
+	if (yych == 'e') goto yy379;
+	goto yy258;
 yy341:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'd') goto yy369;
-	goto yy252;
+	if (yych == 'u') goto yy380;
+	goto yy258;
 yy342:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'b') goto yy370;
-	goto yy252;
+	if (yych == 'i') goto yy381;
+	goto yy258;
 yy343:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy371;
-	goto yy252;
+	if (yych == 'a') goto yy382;
+	goto yy258;
 yy344:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy372;
-	goto yy252;
+	if (yych == '-') goto yy383;
+	goto yy258;
 yy345:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy373;
-	goto yy252;
+	if (yych == 'l') goto yy384;
+	goto yy258;
 yy346:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'b') goto yy374;
-	goto yy252;
+	if (yych == 'e') goto yy385;
+	goto yy258;
 yy347:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy375;
-	goto yy252;
+	if (yych == 't') goto yy386;
+	goto yy258;
 yy348:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy376;
-	goto yy252;
+	if (yych == 's') goto yy387;
+	goto yy258;
 yy349:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy377;
-	goto yy252;
+	if (yych == 'a') goto yy388;
+	goto yy258;
 yy350:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'b') goto yy378;
-	goto yy252;
+	if (yych == 'e') goto yy389;
+	goto yy258;
 yy351:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'h') goto yy379;
-	goto yy252;
+	if (yych == '-') goto yy390;
+	goto yy258;
 yy352:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'd') goto yy380;
-	goto yy252;
+	if (yych == 'o') goto yy391;
+	goto yy258;
 yy353:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '6') goto yy381;
-	goto yy252;
+	if (yych == '1') goto yy392;
+	if (yych == '8') goto yy393;
+	goto yy258;
 yy354:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy382;
-	goto yy252;
+	if (yych == 'u') goto yy394;
+	goto yy258;
 yy355:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'm') goto yy384;
-	goto yy252;
+	if (yych == 'i') goto yy395;
+	goto yy258;
 yy356:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy385;
-	goto yy252;
+	if (yych == '-') goto yy396;
+	goto yy258;
 yy357:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy386;
-	goto yy252;
+	if (yych == '-') goto yy397;
+	goto yy258;
 yy358:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy387;
-	goto yy252;
+	if (yych == 'm') goto yy398;
+	goto yy258;
 yy359:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy388;
-	goto yy252;
+	if (yych == 'e') goto yy399;
+	goto yy258;
 yy360:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy389;
-	goto yy252;
+	if (yych == 'i') goto yy400;
+	goto yy258;
 yy361:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy390;
-	goto yy252;
+	if (yych == 'f') goto yy401;
+	goto yy258;
 yy362:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy391;
-	goto yy252;
+	if (yych == 't') goto yy402;
+	goto yy258;
 yy363:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy392;
-	goto yy252;
+	if (yych == '-') goto yy403;
+	goto yy258;
 yy364:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy393;
-	goto yy252;
+	if (yych == 'a') goto yy404;
+	goto yy258;
 yy365:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy394;
-	goto yy252;
+	if (yych == 'i') goto yy405;
+	goto yy258;
 yy366:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'y') goto yy395;
-	goto yy252;
+	if (yych == 'd') goto yy406;
+	goto yy258;
 yy367:
-	++YYCURSOR;
-#line 157 "../src/conf/parse_opts.re"
-	{ goto opt_input; }
-#line 1561 "src/conf/parse_opts.cc"
-yy369:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy396;
-	goto yy252;
-yy370:
+	if (yych == '-') goto yy407;
+	goto yy258;
+yy368:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'u') goto yy397;
-	goto yy252;
-yy371:
+	if (yych == 'i') goto yy408;
+	goto yy258;
+yy369:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy398;
-	goto yy252;
+	if (yych == 's') goto yy409;
+	goto yy258;
+yy370:
+	++YYCURSOR;
+#line 134 "../src/conf/parse_opts.re"
+	{ usage ();   return EXIT_OK; }
+#line 1592 "src/conf/parse_opts.cc"
 yy372:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy399;
-	goto yy252;
+	if (yych <= 0x00) goto yy410;
+	goto yy258;
 yy373:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy400;
-	goto yy252;
+	if (yych == 'u') goto yy412;
+	goto yy258;
 yy374:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy402;
-	goto yy252;
-yy375:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy403;
-	goto yy252;
+	++YYCURSOR;
+#line 164 "../src/conf/parse_opts.re"
+	{ if (!next (YYCURSOR, argv)) { error_arg ("-j, --jobs"); return EXIT_FAIL; } goto opt_jobs; }
+#line 1605 "src/conf/parse_opts.cc"
 yy376:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy404;
-	goto yy252;
+	if (yych == 'd') goto yy413;
+	goto yy258;
 yy377:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy405;
-	goto yy252;
+	if (yych == 'b') goto yy414;
+	goto yy258;
 yy378:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy406;
-	goto yy252;
+	if (yych == 'n') goto yy415;
+	goto yy258;
 yy379:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy407;
-	goto yy252;
+	if (yych == 'r') goto yy416;
+	goto yy258;
 yy380:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy408;
-	goto yy252;
+	if (yych == 't') goto yy417;
+	goto yy258;
 yy381:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy409;
-	goto yy252;
+	if (yych == 'l') goto yy418;
+	goto yy258;
 yy382:
-	++YYCURSOR;
-#line 153 "../src/conf/parse_opts.re"
-	{ if (!opts.set_encoding (Enc::UTF8))   { error_encoding (); return EXIT_FAIL; } goto opt; }
-#line 1618 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'b') goto yy419;
+	goto yy258;
+yy383:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'l') goto yy420;
+	goto yy258;
 yy384:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy411;
-	goto yy252;
+	if (yych == 'e') goto yy421;
+	goto yy258;
 yy385:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy413;
-	goto yy252;
+	if (yych == 't') goto yy422;
+	goto yy258;
 yy386:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'h') goto yy414;
-	goto yy252;
+	if (yych == '-') goto yy423;
+	goto yy258;
 yy387:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy415;
-	goto yy252;
+	if (yych <= 0x00) goto yy424;
+	goto yy258;
 yy388:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy416;
-	if (yych == 'v') goto yy417;
-	goto yy252;
+	if (yych == 'b') goto yy426;
+	goto yy258;
 yy389:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'd') goto yy418;
-	goto yy252;
+	if (yych <= 0x00) goto yy427;
+	goto yy258;
 yy390:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'u') goto yy419;
-	goto yy252;
+	if (yych == 'h') goto yy429;
+	goto yy258;
 yy391:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy420;
-	goto yy252;
+	if (yych == 'd') goto yy430;
+	goto yy258;
 yy392:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy421;
-	goto yy252;
+	if (yych == '6') goto yy431;
+	goto yy258;
 yy393:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy422;
-	goto yy252;
+	if (yych <= 0x00) goto yy432;
+	goto yy258;
 yy394:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'g') goto yy423;
-	goto yy252;
+	if (yych == 'm') goto yy434;
+	goto yy258;
 yy395:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy424;
-	goto yy252;
+	if (yych == 'o') goto yy435;
+	goto yy258;
 yy396:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy425;
-	goto yy252;
+	if (yych == 'c') goto yy436;
+	goto yy258;
 yy397:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'g') goto yy426;
-	goto yy252;
+	if (yych == 'c') goto yy437;
+	goto yy258;
 yy398:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy427;
-	goto yy252;
+	if (yych == 'a') goto yy438;
+	goto yy258;
 yy399:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy428;
-	goto yy252;
+	if (yych == 'c') goto yy439;
+	goto yy258;
 yy400:
-	++YYCURSOR;
-#line 154 "../src/conf/parse_opts.re"
-	{ if (!next (YYCURSOR, argv)) { error_arg ("-o, --output"); return EXIT_FAIL; } goto opt_output; }
-#line 1688 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'n') goto yy440;
+	goto yy258;
+yy401:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'r') goto yy441;
+	goto yy258;
 yy402:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy429;
-	goto yy252;
+	if (yych == 'e') goto yy442;
+	goto yy258;
 yy403:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'p') goto yy430;
-	goto yy252;
+	if (yych == 'o') goto yy443;
+	goto yy258;
 yy404:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy431;
-	goto yy252;
+	if (yych == 'c') goto yy444;
+	goto yy258;
 yy405:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy432;
-	goto yy252;
+	if (yych == 'n') goto yy445;
+	goto yy258;
 yy406:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy433;
-	goto yy252;
+	if (yych == 'o') goto yy446;
+	goto yy258;
 yy407:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy434;
-	goto yy252;
+	if (yych == 'c') goto yy447;
+	goto yy258;
 yy408:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy435;
-	goto yy252;
+	if (yych == 'n') goto yy448;
+	goto yy258;
 yy409:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'y') goto yy449;
+	goto yy258;
+yy410:
 	++YYCURSOR;
-#line 152 "../src/conf/parse_opts.re"
-	{ if (!opts.set_encoding (Enc::UTF16))  { error_encoding (); return EXIT_FAIL; } goto opt; }
-#line 1721 "src/conf/parse_opts.cc"
-yy411:
-	++YYCURSOR;
-#line 133 "../src/conf/parse_opts.re"
-	{ vernum ();  return EXIT_OK; }
-#line 1726 "src/conf/parse_opts.cc"
+#line 168 "../src/conf/parse_opts.re"
+	{ goto opt_input; }
+#line 1746 "src/conf/parse_opts.cc"
+yy412:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'm') goto yy450;
+	goto yy258;
 yy413:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy437;
-	goto yy252;
+	if (yych == '-') goto yy451;
+	goto yy258;
 yy414:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy439;
-	goto yy252;
+	if (yych == 'u') goto yy452;
+	goto yy258;
 yy415:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy440;
-	goto yy252;
+	if (yych == 'e') goto yy453;
+	goto yy258;
 yy416:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy441;
-	goto yy252;
+	if (yych == 's') goto yy454;
+	goto yy258;
 yy417:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy442;
-	goto yy252;
+	if (yych <= 0x00) goto yy455;
+	goto yy258;
 yy418:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy443;
-	goto yy252;
+	if (yych == 'e') goto yy457;
+	goto yy258;
 yy419:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy444;
-	goto yy252;
+	if (yych == 'l') goto yy458;
+	goto yy258;
 yy420:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'm') goto yy445;
-	goto yy252;
+	if (yych == 'o') goto yy459;
+	goto yy258;
 yy421:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy446;
-	goto yy252;
+	if (yych == '-') goto yy460;
+	goto yy258;
 yy422:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy448;
-	goto yy252;
+	if (yych == 'o') goto yy461;
+	goto yy258;
 yy423:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy449;
-	goto yy252;
+	if (yych == 'c') goto yy462;
+	goto yy258;
 yy424:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy450;
-	goto yy252;
-yy425:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'f') goto yy451;
-	goto yy252;
+	++YYCURSOR;
+#line 171 "../src/conf/parse_opts.re"
+	{ if (!next (YYCURSOR, argv)) { error_arg ("--stats"); return EXIT_FAIL; } goto opt_stats; }
+#line 1799 "src/conf/parse_opts.cc"
 yy426:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy452;
-	goto yy252;
+	if (yych == 'l') goto yy463;
+	goto yy258;
 yy427:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy453;
-	goto yy252;
-yy428:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy454;
-	goto yy252;
+	++YYCURSOR;
+#line 153 "../src/conf/parse_opts.re"
+	{ opts.set_target (opt_t::TABLE);    goto opt; }
+#line 1808 "src/conf/parse_opts.cc"
 yy429:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy455;
-	goto yy252;
+	if (yych == 'e') goto yy464;
+	goto yy258;
 yy430:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy457;
-	goto yy252;
+	if (yych == 'e') goto yy465;
+	goto yy258;
 yy431:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy458;
-	goto yy252;
+	if (yych <= 0x00) goto yy466;
+	goto yy258;
 yy432:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy460;
-	goto yy252;
-yy433:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy461;
-	goto yy252;
+	++YYCURSOR;
+#line 161 "../src/conf/parse_opts.re"
+	{ if (!opts.set_encoding (Enc::UTF8))   { error_encoding (); return EXIT_FAIL; } goto opt; }
+#line 1825 "src/conf/parse_opts.cc"
 yy434:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'd') goto yy462;
-	goto yy252;
+	if (yych <= 0x00) goto yy468;
+	goto yy258;
 yy435:
-	++YYCURSOR;
-#line 150 "../src/conf/parse_opts.re"
-	{ if (!opts.set_encoding (Enc::UTF32))  { error_encoding (); return EXIT_FAIL; } goto opt; }
-#line 1819 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'n') goto yy470;
+	goto yy258;
+yy436:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'h') goto yy471;
+	goto yy258;
 yy437:
-	++YYCURSOR;
-#line 132 "../src/conf/parse_opts.re"
-	{ version (); return EXIT_OK; }
-#line 1824 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'o') goto yy472;
+	goto yy258;
+yy438:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'r') goto yy473;
+	goto yy258;
 yy439:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy463;
-	goto yy252;
+	if (yych == 't') goto yy474;
+	goto yy258;
 yy440:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy464;
-	goto yy252;
+	if (yych == 's') goto yy475;
+	if (yych == 'v') goto yy476;
+	goto yy258;
 yy441:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy465;
-	goto yy252;
+	if (yych == 'e') goto yy477;
+	goto yy258;
 yy442:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy466;
-	goto yy252;
+	if (yych == 'd') goto yy478;
+	goto yy258;
 yy443:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'g') goto yy467;
-	goto yy252;
+	if (yych == 'u') goto yy479;
+	goto yy258;
 yy444:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'p') goto yy468;
-	goto yy252;
+	if (yych == 'h') goto yy480;
+	goto yy258;
 yy445:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy469;
-	goto yy252;
+	if (yych == 'i') goto yy481;
+	goto yy258;
 yy446:
-	++YYCURSOR;
-#line 137 "../src/conf/parse_opts.re"
-	{ opts.set_target (opt_t::DOT);      goto opt; }
-#line 1857 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy482;
+	goto yy258;
+yy447:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'l') goto yy483;
+	goto yy258;
 yy448:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy470;
-	goto yy252;
+	if (yych == 'g') goto yy484;
+	goto yy258;
 yy449:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'p') goto yy471;
-	goto yy252;
+	if (yych == 'n') goto yy485;
+	goto yy258;
 yy450:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy472;
-	goto yy252;
+	if (yych == 'e') goto yy486;
+	goto yy258;
 yy451:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy473;
-	goto yy252;
+	if (yych == 'i') goto yy487;
+	goto yy258;
 yy452:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy474;
-	goto yy252;
+	if (yych == 'g') goto yy488;
+	goto yy258;
 yy453:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy475;
-	goto yy252;
+	if (yych == 'r') goto yy489;
+	goto yy258;
 yy454:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy476;
-	goto yy252;
+	if (yych == 'i') goto yy490;
+	goto yy258;
 yy455:
 	++YYCURSOR;
-#line 142 "../src/conf/parse_opts.re"
-	{ opts.set_rFlag (true);             goto opt; }
-#line 1890 "src/conf/parse_opts.cc"
+#line 162 "../src/conf/parse_opts.re"
+	{ if (!next (YYCURSOR, argv)) { error_arg ("-o, --output"); return EXIT_FAIL; } goto opt_output; }
+#line 1915 "src/conf/parse_opts.cc"
 yy457:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy477;
-	goto yy252;
+	if (yych == '-') goto yy491;
+	goto yy258;
 yy458:
-	++YYCURSOR;
-#line 148 "../src/conf/parse_opts.re"
-	{ opts.set_target (opt_t::SKELETON); goto opt; }
-#line 1899 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy492;
+	goto yy258;
+yy459:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'o') goto yy493;
+	goto yy258;
 yy460:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'd') goto yy478;
-	goto yy252;
+	if (yych == 'p') goto yy494;
+	goto yy258;
 yy461:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy479;
-	goto yy252;
+	if (yych == 'n') goto yy495;
+	goto yy258;
 yy462:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy480;
-	goto yy252;
+	if (yych == 'o') goto yy496;
+	goto yy258;
 yy463:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy481;
-	goto yy252;
+	if (yych == 'e') goto yy497;
+	goto yy258;
 yy464:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy482;
-	goto yy252;
+	if (yych == 'a') goto yy498;
+	goto yy258;
 yy465:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy483;
-	goto yy252;
+	if (yych <= 0x00) goto yy499;
+	goto yy258;
 yy466:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy484;
-	goto yy252;
-yy467:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy485;
-	goto yy252;
+	++YYCURSOR;
+#line 160 "../src/conf/parse_opts.re"
+	{ if (!opts.set_encoding (Enc::UTF16))  { error_encoding (); return EXIT_FAIL; } goto opt; }
+#line 1956 "src/conf/parse_opts.cc"
 yy468:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'u') goto yy486;
-	goto yy252;
-yy469:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'z') goto yy487;
-	goto yy252;
+	++YYCURSOR;
+#line 136 "../src/conf/parse_opts.re"
+	{ vernum ();  return EXIT_OK; }
+#line 1961 "src/conf/parse_opts.cc"
 yy470:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy488;
-	goto yy252;
+	if (yych <= 0x00) goto yy501;
+	goto yy258;
 yy471:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy489;
-	goto yy252;
+	if (yych == 'a') goto yy503;
+	goto yy258;
 yy472:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'x') goto yy490;
-	goto yy252;
+	if (yych == 'm') goto yy504;
+	goto yy258;
 yy473:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy491;
-	goto yy252;
+	if (yych == 'k') goto yy505;
+	goto yy258;
 yy474:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy493;
-	goto yy252;
+	if (yych == 'o') goto yy506;
+	goto yy258;
 yy475:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy494;
-	goto yy252;
+	if (yych == 'e') goto yy507;
+	goto yy258;
 yy476:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy495;
-	goto yy252;
+	if (yych == 'e') goto yy508;
+	goto yy258;
 yy477:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy497;
-	goto yy252;
+	if (yych == 'q') goto yy509;
+	goto yy258;
 yy478:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy498;
-	goto yy252;
+	if (yych == '-') goto yy510;
+	goto yy258;
 yy479:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy499;
-	goto yy252;
+	if (yych == 't') goto yy511;
+	goto yy258;
 yy480:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy500;
-	goto yy252;
+	if (yych == 'e') goto yy512;
+	goto yy258;
 yy481:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy501;
-	goto yy252;
+	if (yych == 'm') goto yy513;
+	goto yy258;
 yy482:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy503;
-	goto yy252;
+	if (yych <= 0x00) goto yy514;
+	goto yy258;
 yy483:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy505;
-	goto yy252;
+	if (yych == 'a') goto yy516;
+	goto yy258;
 yy484:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy506;
-	goto yy252;
+	if (yych == '-') goto yy517;
+	goto yy258;
 yy485:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy507;
-	goto yy252;
+	if (yych == 't') goto yy518;
+	goto yy258;
 yy486:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy508;
-	goto yy252;
+	if (yych == 'n') goto yy519;
+	goto yy258;
 yy487:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy509;
-	goto yy252;
+	if (yych == 'f') goto yy520;
+	goto yy258;
 yy488:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy510;
-	goto yy252;
+	if (yych == '-') goto yy521;
+	goto yy258;
 yy489:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy512;
-	goto yy252;
+	if (yych == 'a') goto yy522;
+	goto yy258;
 yy490:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy513;
-	goto yy252;
+	if (yych == 'o') goto yy523;
+	goto yy258;
 yy491:
-	++YYCURSOR;
-#line 143 "../src/conf/parse_opts.re"
-	{ opts.set_sFlag (true);             goto opt; }
-#line 2028 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'u') goto yy524;
+	goto yy258;
+yy492:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy525;
+	goto yy258;
 yy493:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'f') goto yy515;
-	goto yy252;
+	if (yych == 'p') goto yy527;
+	goto yy258;
 yy494:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy516;
-	goto yy252;
+	if (yych == 'a') goto yy528;
+	goto yy258;
 yy495:
-	++YYCURSOR;
-#line 145 "../src/conf/parse_opts.re"
-	{ opts.set_version (false);          goto opt; }
-#line 2041 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy529;
+	goto yy258;
+yy496:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'n') goto yy531;
+	goto yy258;
 yy497:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy517;
-	goto yy252;
+	if (yych == '-') goto yy532;
+	goto yy258;
 yy498:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy519;
-	goto yy252;
+	if (yych == 'd') goto yy533;
+	goto yy258;
 yy499:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy520;
-	goto yy252;
-yy500:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy521;
-	goto yy252;
+	++YYCURSOR;
+#line 158 "../src/conf/parse_opts.re"
+	{ if (!opts.set_encoding (Enc::UTF32))  { error_encoding (); return EXIT_FAIL; } goto opt; }
+#line 2082 "src/conf/parse_opts.cc"
 yy501:
 	++YYCURSOR;
-#line 151 "../src/conf/parse_opts.re"
-	{ if (!opts.set_encoding (Enc::UCS2))   { error_encoding (); return EXIT_FAIL; } goto opt; }
-#line 2062 "src/conf/parse_opts.cc"
+#line 135 "../src/conf/parse_opts.re"
+	{ version (); return EXIT_OK; }
+#line 2087 "src/conf/parse_opts.cc"
 yy503:
-	++YYCURSOR;
-#line 134 "../src/conf/parse_opts.re"
-	{ opts.set_bFlag (true);             goto opt; }
-#line 2067 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'r') goto yy534;
+	goto yy258;
+yy504:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'p') goto yy535;
+	goto yy258;
 yy505:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy523;
-	goto yy252;
+	if (yych <= 0x00) goto yy536;
+	goto yy258;
 yy506:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'd') goto yy524;
-	goto yy252;
+	if (yych == 'r') goto yy538;
+	goto yy258;
 yy507:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy525;
-	goto yy252;
+	if (yych == 'n') goto yy539;
+	goto yy258;
 yy508:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy526;
-	goto yy252;
+	if (yych == 'r') goto yy540;
+	goto yy258;
 yy509:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy528;
-	goto yy252;
+	if (yych <= 0x00) goto yy541;
+	goto yy258;
 yy510:
-	++YYCURSOR;
-#line 158 "../src/conf/parse_opts.re"
-	{ goto opt_empty_class; }
-#line 2092 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'g') goto yy543;
+	goto yy258;
+yy511:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'p') goto yy544;
+	goto yy258;
 yy512:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy529;
-	goto yy252;
+	if (yych <= 0x00) goto yy545;
+	goto yy258;
 yy513:
-	++YYCURSOR;
-#line 139 "../src/conf/parse_opts.re"
-	{ opts.set_FFlag (true);             goto opt; }
-#line 2101 "src/conf/parse_opts.cc"
-yy515:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy530;
-	goto yy252;
+	if (yych == 'i') goto yy547;
+	goto yy258;
+yy514:
+	++YYCURSOR;
+#line 140 "../src/conf/parse_opts.re"
+	{ opts.set_target (opt_t::DOT);      goto opt; }
+#line 2136 "src/conf/parse_opts.cc"
 yy516:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy531;
-	goto yy252;
+	if (yych == 's') goto yy548;
+	goto yy258;
 yy517:
-	++YYCURSOR;
-#line 160 "../src/conf/parse_opts.re"
-	{ goto opt; }
-#line 2114 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'p') goto yy549;
+	goto yy258;
+yy518:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'a') goto yy550;
+	goto yy258;
 yy519:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy532;
-	goto yy252;
+	if (yych == 't') goto yy551;
+	goto yy258;
 yy520:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy533;
-	goto yy252;
+	if (yych == 's') goto yy552;
+	goto yy258;
 yy521:
-	++YYCURSOR;
-#line 155 "../src/conf/parse_opts.re"
-	{ if (!next (YYCURSOR, argv)) { error_arg ("-t, --type-header"); return EXIT_FAIL; } goto opt_header; }
-#line 2127 "src/conf/parse_opts.cc"
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'i') goto yy553;
+	goto yy258;
+yy522:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy554;
+	goto yy258;
 yy523:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy534;
-	goto yy252;
+	if (yych == 'n') goto yy555;
+	goto yy258;
 yy524:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy535;
-	goto yy252;
+	if (yych == 's') goto yy556;
+	goto yy258;
 yy525:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy537;
-	goto yy252;
-yy526:
 	++YYCURSOR;
-#line 136 "../src/conf/parse_opts.re"
-	{ opts.set_dFlag (true);             goto opt; }
-#line 2144 "src/conf/parse_opts.cc"
+#line 145 "../src/conf/parse_opts.re"
+	{ opts.set_rFlag (true);             goto opt; }
+#line 2177 "src/conf/parse_opts.cc"
+yy527:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 's') goto yy557;
+	goto yy258;
 yy528:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy538;
-	goto yy252;
+	if (yych == 's') goto yy558;
+	goto yy258;
 yy529:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy539;
-	goto yy252;
-yy530:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy540;
-	goto yy252;
+	++YYCURSOR;
+#line 151 "../src/conf/parse_opts.re"
+	{ opts.set_target (opt_t::SKELETON); goto opt; }
+#line 2190 "src/conf/parse_opts.cc"
 yy531:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy542;
-	goto yy252;
+	if (yych == 'd') goto yy559;
+	goto yy258;
 yy532:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy543;
-	goto yy252;
+	if (yych == 's') goto yy560;
+	goto yy258;
 yy533:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy544;
-	goto yy252;
+	if (yych == 'e') goto yy561;
+	goto yy258;
 yy534:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'v') goto yy545;
-	goto yy252;
+	if (yych == 's') goto yy562;
+	goto yy258;
 yy535:
-	++YYCURSOR;
-#line 147 "../src/conf/parse_opts.re"
-	{ opts.set_bCaseInverted (true);     goto opt; }
-#line 2177 "src/conf/parse_opts.cc"
-yy537:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy546;
-	goto yy252;
+	if (yych == 'a') goto yy563;
+	goto yy258;
+yy536:
+	++YYCURSOR;
+#line 152 "../src/conf/parse_opts.re"
+	{ opts.set_target (opt_t::SKELETON); opts.set_benchmark (true); goto opt; }
+#line 2215 "src/conf/parse_opts.cc"
 yy538:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy548;
-	goto yy252;
+	if (yych == 's') goto yy564;
+	goto yy258;
 yy539:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'y') goto yy549;
-	goto yy252;
+	if (yych == 's') goto yy565;
+	goto yy258;
 yy540:
-	++YYCURSOR;
-#line 141 "../src/conf/parse_opts.re"
-	{ opts.set_iFlag (true);             goto opt; }
-#line 2194 "src/conf/parse_opts.cc"
-yy542:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'd') goto yy550;
-	goto yy252;
+	if (yych == 't') goto yy566;
+	goto yy258;
+yy541:
+	++YYCURSOR;
+#line 166 "../src/conf/parse_opts.re"
+	{ if (!next (YYCURSOR, argv)) { error_arg ("--char-freq"); return EXIT_FAIL; } goto opt_char_freq; }
+#line 2232 "src/conf/parse_opts.cc"
 yy543:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy551;
-	goto yy252;
+	if (yych == 'o') goto yy567;
+	goto yy258;
 yy544:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy552;
-	goto yy252;
+	if (yych == 'u') goto yy568;
+	goto yy258;
 yy545:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy554;
-	goto yy252;
-yy546:
 	++YYCURSOR;
-#line 140 "../src/conf/parse_opts.re"
-	{ opts.set_gFlag (true);             goto opt; }
-#line 2215 "src/conf/parse_opts.cc"
+#line 172 "../src/conf/parse_opts.re"
+	{ if (!next (YYCURSOR, argv)) { error_arg ("--dfa-cache"); return EXIT_FAIL; } goto opt_dfa_cache; }
+#line 2245 "src/conf/parse_opts.cc"
+yy547:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'z') goto yy569;
+	goto yy258;
 yy548:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy555;
-	goto yy252;
+	if (yych == 's') goto yy570;
+	goto yy258;
 yy549:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy556;
-	goto yy252;
+	if (yych == 'o') goto yy571;
+	goto yy258;
 yy550:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy558;
-	goto yy252;
+	if (yych == 'x') goto yy572;
+	goto yy258;
 yy551:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy559;
-	goto yy252;
-yy552:
+	if (yych <= 0x00) goto yy573;
+	goto yy258;
+yy552:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy575;
+	goto yy258;
+yy553:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'n') goto yy577;
+	goto yy258;
+yy554:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'i') goto yy578;
+	goto yy258;
+yy555:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy579;
+	goto yy258;
+yy556:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy581;
+	goto yy258;
+yy557:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy582;
+	goto yy258;
+yy558:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 's') goto yy584;
+	goto yy258;
+yy559:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'i') goto yy585;
+	goto yy258;
+yy560:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy586;
+	goto yy258;
+yy561:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'r') goto yy587;
+	goto yy258;
+yy562:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy588;
+	goto yy258;
+yy563:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'r') goto yy590;
+	goto yy258;
+yy564:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy591;
+	goto yy258;
+yy565:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'i') goto yy593;
+	goto yy258;
+yy566:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy594;
+	goto yy258;
+yy567:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy595;
+	goto yy258;
+yy568:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy596;
+	goto yy258;
+yy569:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'a') goto yy597;
+	goto yy258;
+yy570:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy598;
+	goto yy258;
+yy571:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'l') goto yy600;
+	goto yy258;
+yy572:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy601;
+	goto yy258;
+yy573:
+	++YYCURSOR;
+#line 156 "../src/conf/parse_opts.re"
+	{ opts.set_instrument (true);        goto opt; }
+#line 2354 "src/conf/parse_opts.cc"
+yy575:
+	++YYCURSOR;
+#line 146 "../src/conf/parse_opts.re"
+	{ opts.set_sFlag (true);             goto opt; }
+#line 2359 "src/conf/parse_opts.cc"
+yy577:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'f') goto yy603;
+	goto yy258;
+yy578:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'o') goto yy604;
+	goto yy258;
+yy579:
+	++YYCURSOR;
+#line 148 "../src/conf/parse_opts.re"
+	{ opts.set_version (false);          goto opt; }
+#line 2372 "src/conf/parse_opts.cc"
+yy581:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy605;
+	goto yy258;
+yy582:
+	++YYCURSOR;
+#line 154 "../src/conf/parse_opts.re"
+	{ opts.set_simdLoops (true);         goto opt; }
+#line 2381 "src/conf/parse_opts.cc"
+yy584:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy607;
+	goto yy258;
+yy585:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy609;
+	goto yy258;
+yy586:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'a') goto yy610;
+	goto yy258;
+yy587:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy611;
+	goto yy258;
+yy588:
+	++YYCURSOR;
+#line 159 "../src/conf/parse_opts.re"
+	{ if (!opts.set_encoding (Enc::UCS2))   { error_encoding (); return EXIT_FAIL; } goto opt; }
+#line 2402 "src/conf/parse_opts.cc"
+yy590:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy613;
+	goto yy258;
+yy591:
+	++YYCURSOR;
+#line 137 "../src/conf/parse_opts.re"
+	{ opts.set_bFlag (true);             goto opt; }
+#line 2411 "src/conf/parse_opts.cc"
+yy593:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy614;
+	goto yy258;
+yy594:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'd') goto yy615;
+	goto yy258;
+yy595:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'o') goto yy616;
+	goto yy258;
+yy596:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy617;
+	goto yy258;
+yy597:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy619;
+	goto yy258;
+yy598:
+	++YYCURSOR;
+#line 169 "../src/conf/parse_opts.re"
+	{ goto opt_empty_class; }
+#line 2436 "src/conf/parse_opts.cc"
+yy600:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'i') goto yy620;
+	goto yy258;
+yy601:
+	++YYCURSOR;
+#line 142 "../src/conf/parse_opts.re"
+	{ opts.set_FFlag (true);             goto opt; }
+#line 2445 "src/conf/parse_opts.cc"
+yy603:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'o') goto yy621;
+	goto yy258;
+yy604:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'n') goto yy622;
+	goto yy258;
+yy605:
+	++YYCURSOR;
+#line 165 "../src/conf/parse_opts.re"
+	{ if (!next (YYCURSOR, argv)) { error_arg ("--profile-use"); return EXIT_FAIL; } goto opt_profile; }
+#line 2458 "src/conf/parse_opts.cc"
+yy607:
+	++YYCURSOR;
+#line 173 "../src/conf/parse_opts.re"
+	{ goto opt; }
+#line 2463 "src/conf/parse_opts.cc"
+yy609:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'i') goto yy623;
+	goto yy258;
+yy610:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy624;
+	goto yy258;
+yy611:
+	++YYCURSOR;
+#line 163 "../src/conf/parse_opts.re"
+	{ if (!next (YYCURSOR, argv)) { error_arg ("-t, --type-header"); return EXIT_FAIL; } goto opt_header; }
+#line 2476 "src/conf/parse_opts.cc"
+yy613:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy625;
+	goto yy258;
+yy614:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'i') goto yy627;
+	goto yy258;
+yy615:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy628;
+	goto yy258;
+yy616:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 's') goto yy630;
+	goto yy258;
+yy617:
+	++YYCURSOR;
+#line 139 "../src/conf/parse_opts.re"
+	{ opts.set_dFlag (true);             goto opt; }
+#line 2497 "src/conf/parse_opts.cc"
+yy619:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'i') goto yy631;
+	goto yy258;
+yy620:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'c') goto yy632;
+	goto yy258;
+yy621:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy633;
+	goto yy258;
+yy622:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == '-') goto yy635;
+	goto yy258;
+yy623:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'o') goto yy636;
+	goto yy258;
+yy624:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy637;
+	goto yy258;
+yy625:
+	++YYCURSOR;
+#line 155 "../src/conf/parse_opts.re"
+	{ opts.set_wordCompare (true);       goto opt; }
+#line 2526 "src/conf/parse_opts.cc"
+yy627:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'v') goto yy638;
+	goto yy258;
+yy628:
+	++YYCURSOR;
+#line 150 "../src/conf/parse_opts.re"
+	{ opts.set_bCaseInverted (true);     goto opt; }
+#line 2535 "src/conf/parse_opts.cc"
+yy630:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy639;
+	goto yy258;
+yy631:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'o') goto yy641;
+	goto yy258;
+yy632:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'y') goto yy642;
+	goto yy258;
+yy633:
+	++YYCURSOR;
+#line 144 "../src/conf/parse_opts.re"
+	{ opts.set_iFlag (true);             goto opt; }
+#line 2552 "src/conf/parse_opts.cc"
+yy635:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'd') goto yy643;
+	goto yy258;
+yy636:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'n') goto yy644;
+	goto yy258;
+yy637:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy645;
+	goto yy258;
+yy638:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy647;
+	goto yy258;
+yy639:
+	++YYCURSOR;
+#line 143 "../src/conf/parse_opts.re"
+	{ opts.set_gFlag (true);             goto opt; }
+#line 2573 "src/conf/parse_opts.cc"
+yy641:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'n') goto yy648;
+	goto yy258;
+yy642:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy649;
+	goto yy258;
+yy643:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'a') goto yy651;
+	goto yy258;
+yy644:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 's') goto yy652;
+	goto yy258;
+yy645:
+	++YYCURSOR;
+#line 141 "../src/conf/parse_opts.re"
+	{ opts.set_fFlag (true);             goto opt; }
+#line 2594 "src/conf/parse_opts.cc"
+yy647:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy653;
+	goto yy258;
+yy648:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy655;
+	goto yy258;
+yy649:
+	++YYCURSOR;
+#line 167 "../src/conf/parse_opts.re"
+	{ goto opt_encoding_policy; }
+#line 2607 "src/conf/parse_opts.cc"
+yy651:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy657;
+	goto yy258;
+yy652:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy658;
+	goto yy258;
+yy653:
+	++YYCURSOR;
+#line 149 "../src/conf/parse_opts.re"
+	{ opts.set_bCaseInsensitive (true);  goto opt; }
+#line 2620 "src/conf/parse_opts.cc"
+yy655:
+	++YYCURSOR;
+#line 170 "../src/conf/parse_opts.re"
+	{ goto opt_dfa_minimization; }
+#line 2625 "src/conf/parse_opts.cc"
+yy657:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy660;
+	goto yy258;
+yy658:
+	++YYCURSOR;
+#line 138 "../src/conf/parse_opts.re"
+	{ opts.set_cFlag (true);             goto opt; }
+#line 2634 "src/conf/parse_opts.cc"
+yy660:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych >= 0x01) goto yy258;
+	++YYCURSOR;
+#line 147 "../src/conf/parse_opts.re"
+	{ opts.set_bNoGenerationDate (true); goto opt; }
+#line 2641 "src/conf/parse_opts.cc"
+}
+#line 174 "../src/conf/parse_opts.re"
+
+
+opt_output:
+
+#line 2648 "src/conf/parse_opts.cc"
+{
+	YYCTYPE yych;
+	static const unsigned char yybm[] = {
+		  0, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+	};
+	yych = (YYCTYPE)*YYCURSOR;
+	if (yych <= 0x00) goto yy665;
+	if (yych != '-') goto yy667;
+yy665:
+	++YYCURSOR;
+#line 179 "../src/conf/parse_opts.re"
+	{
+		error ("bad argument to option -o, --output: %s", *argv);
+		return EXIT_FAIL;
+	}
+#line 2695 "src/conf/parse_opts.cc"
+yy667:
+	yych = (YYCTYPE)*++YYCURSOR;
+	goto yy671;
+yy668:
+	++YYCURSOR;
+#line 183 "../src/conf/parse_opts.re"
+	{ if (!opts.output (*argv)) return EXIT_FAIL; goto opt; }
+#line 2703 "src/conf/parse_opts.cc"
+yy670:
+	++YYCURSOR;
+	yych = (YYCTYPE)*YYCURSOR;
+yy671:
+	if (yybm[0+yych] & 128) {
+		goto yy670;
+	}
+	goto yy668;
+}
+#line 184 "../src/conf/parse_opts.re"
+
+
+opt_header:
+
+#line 2718 "src/conf/parse_opts.cc"
+{
+	YYCTYPE yych;
+	static const unsigned char yybm[] = {
+		  0, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+	};
+	yych = (YYCTYPE)*YYCURSOR;
+	if (yych <= 0x00) goto yy674;
+	if (yych != '-') goto yy676;
+yy674:
+	++YYCURSOR;
+#line 189 "../src/conf/parse_opts.re"
+	{
+		error ("bad argument to option -t, --type-header: %s", *argv);
+		return EXIT_FAIL;
+	}
+#line 2765 "src/conf/parse_opts.cc"
+yy676:
+	yych = (YYCTYPE)*++YYCURSOR;
+	goto yy680;
+yy677:
 	++YYCURSOR;
-#line 138 "../src/conf/parse_opts.re"
-	{ opts.set_fFlag (true);             goto opt; }
-#line 2236 "src/conf/parse_opts.cc"
-yy554:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy560;
-	goto yy252;
-yy555:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy562;
-	goto yy252;
-yy556:
+#line 193 "../src/conf/parse_opts.re"
+	{ opts.set_header_file (*argv); goto opt; }
+#line 2773 "src/conf/parse_opts.cc"
+yy679:
 	++YYCURSOR;
-#line 156 "../src/conf/parse_opts.re"
-	{ goto opt_encoding_policy; }
-#line 2249 "src/conf/parse_opts.cc"
-yy558:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy564;
-	goto yy252;
-yy559:
+	yych = (YYCTYPE)*YYCURSOR;
+yy680:
+	if (yybm[0+yych] & 128) {
+		goto yy679;
+	}
+	goto yy677;
+}
+#line 194 "../src/conf/parse_opts.re"
+
+
+opt_profile:
+
+#line 2788 "src/conf/parse_opts.cc"
+{
+	YYCTYPE yych;
+	static const unsigned char yybm[] = {
+		  0, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+	};
+	yych = (YYCTYPE)*YYCURSOR;
+	if (yych <= 0x00) goto yy683;
+	if (yych != '-') goto yy685;
+yy683:
+	++YYCURSOR;
+#line 199 "../src/conf/parse_opts.re"
+	{
+		error ("bad argument to option --profile-use: %s", *argv);
+		return EXIT_FAIL;
+	}
+#line 2835 "src/conf/parse_opts.cc"
+yy685:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy565;
-	goto yy252;
-yy560:
+	goto yy689;
+yy686:
 	++YYCURSOR;
-#line 146 "../src/conf/parse_opts.re"
-	{ opts.set_bCaseInsensitive (true);  goto opt; }
-#line 2262 "src/conf/parse_opts.cc"
-yy562:
+#line 203 "../src/conf/parse_opts.re"
+	{ opts.set_profile_file (*argv); goto opt; }
+#line 2843 "src/conf/parse_opts.cc"
+yy688:
 	++YYCURSOR;
-#line 159 "../src/conf/parse_opts.re"
-	{ goto opt_dfa_minimization; }
-#line 2267 "src/conf/parse_opts.cc"
-yy564:
-	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy567;
-	goto yy252;
-yy565:
+	yych = (YYCTYPE)*YYCURSOR;
+yy689:
+	if (yybm[0+yych] & 128) {
+		goto yy688;
+	}
+	goto yy686;
+}
+#line 204 "../src/conf/parse_opts.re"
+
+
+opt_char_freq:
+
+#line 2858 "src/conf/parse_opts.cc"
+{
+	YYCTYPE yych;
+	static const unsigned char yybm[] = {
+		  0, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+	};
+	yych = (YYCTYPE)*YYCURSOR;
+	if (yych <= 0x00) goto yy692;
+	if (yych != '-') goto yy694;
+yy692:
 	++YYCURSOR;
-#line 135 "../src/conf/parse_opts.re"
-	{ opts.set_cFlag (true);             goto opt; }
-#line 2276 "src/conf/parse_opts.cc"
-yy567:
+#line 209 "../src/conf/parse_opts.re"
+	{
+		error ("bad argument to option --char-freq (expected: text | json | binary | <file>): %s", *argv);
+		return EXIT_FAIL;
+	}
+#line 2905 "src/conf/parse_opts.cc"
+yy694:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych >= 0x01) goto yy252;
+	goto yy698;
+yy695:
 	++YYCURSOR;
-#line 144 "../src/conf/parse_opts.re"
-	{ opts.set_bNoGenerationDate (true); goto opt; }
-#line 2283 "src/conf/parse_opts.cc"
+#line 213 "../src/conf/parse_opts.re"
+	{ opts.set_char_freq_model (*argv); goto opt; }
+#line 2913 "src/conf/parse_opts.cc"
+yy697:
+	++YYCURSOR;
+	yych = (YYCTYPE)*YYCURSOR;
+yy698:
+	if (yybm[0+yych] & 128) {
+		goto yy697;
+	}
+	goto yy695;
 }
-#line 161 "../src/conf/parse_opts.re"
+#line 214 "../src/conf/parse_opts.re"
 
 
-opt_output:
+opt_stats:
 
-#line 2290 "src/conf/parse_opts.cc"
+#line 2928 "src/conf/parse_opts.cc"
 {
 	YYCTYPE yych;
 	static const unsigned char yybm[] = {
@@ -2324,39 +2962,39 @@ opt_output:
 		128, 128, 128, 128, 128, 128, 128, 128, 
 	};
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych <= 0x00) goto yy572;
-	if (yych != '-') goto yy574;
-yy572:
+	if (yych <= 0x00) goto yy701;
+	if (yych != '-') goto yy703;
+yy701:
 	++YYCURSOR;
-#line 166 "../src/conf/parse_opts.re"
+#line 219 "../src/conf/parse_opts.re"
 	{
-		error ("bad argument to option -o, --output: %s", *argv);
+		error ("bad argument to option --stats: %s", *argv);
 		return EXIT_FAIL;
 	}
-#line 2337 "src/conf/parse_opts.cc"
-yy574:
+#line 2975 "src/conf/parse_opts.cc"
+yy703:
 	yych = (YYCTYPE)*++YYCURSOR;
-	goto yy578;
-yy575:
+	goto yy707;
+yy704:
 	++YYCURSOR;
-#line 170 "../src/conf/parse_opts.re"
-	{ if (!opts.output (*argv)) return EXIT_FAIL; goto opt; }
-#line 2345 "src/conf/parse_opts.cc"
-yy577:
+#line 223 "../src/conf/parse_opts.re"
+	{ opts.set_stats_file (*argv); goto opt; }
+#line 2983 "src/conf/parse_opts.cc"
+yy706:
 	++YYCURSOR;
 	yych = (YYCTYPE)*YYCURSOR;
-yy578:
+yy707:
 	if (yybm[0+yych] & 128) {
-		goto yy577;
+		goto yy706;
 	}
-	goto yy575;
+	goto yy704;
 }
-#line 171 "../src/conf/parse_opts.re"
+#line 224 "../src/conf/parse_opts.re"
 
 
-opt_header:
+opt_dfa_cache:
 
-#line 2360 "src/conf/parse_opts.cc"
+#line 2998 "src/conf/parse_opts.cc"
 {
 	YYCTYPE yych;
 	static const unsigned char yybm[] = {
@@ -2394,34 +3032,118 @@ opt_header:
 		128, 128, 128, 128, 128, 128, 128, 128, 
 	};
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych <= 0x00) goto yy581;
-	if (yych != '-') goto yy583;
-yy581:
+	if (yych <= 0x00) goto yy710;
+	if (yych != '-') goto yy712;
+yy710:
 	++YYCURSOR;
-#line 176 "../src/conf/parse_opts.re"
+#line 229 "../src/conf/parse_opts.re"
 	{
-		error ("bad argument to option -t, --type-header: %s", *argv);
+		error ("bad argument to option --dfa-cache: %s", *argv);
 		return EXIT_FAIL;
 	}
-#line 2407 "src/conf/parse_opts.cc"
-yy583:
+#line 3045 "src/conf/parse_opts.cc"
+yy712:
 	yych = (YYCTYPE)*++YYCURSOR;
-	goto yy587;
-yy584:
+	goto yy716;
+yy713:
 	++YYCURSOR;
-#line 180 "../src/conf/parse_opts.re"
-	{ opts.set_header_file (*argv); goto opt; }
-#line 2415 "src/conf/parse_opts.cc"
-yy586:
+#line 233 "../src/conf/parse_opts.re"
+	{ opts.set_dfa_cache (*argv); goto opt; }
+#line 3053 "src/conf/parse_opts.cc"
+yy715:
+	++YYCURSOR;
+	yych = (YYCTYPE)*YYCURSOR;
+yy716:
+	if (yybm[0+yych] & 128) {
+		goto yy715;
+	}
+	goto yy713;
+}
+#line 234 "../src/conf/parse_opts.re"
+
+
+opt_jobs:
+
+#line 3068 "src/conf/parse_opts.cc"
+{
+	YYCTYPE yych;
+	static const unsigned char yybm[] = {
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		128, 128, 128, 128, 128, 128, 128, 128, 
+		128, 128,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+	};
+	yych = (YYCTYPE)*YYCURSOR;
+	if (yych <= '0') goto yy719;
+	if (yych <= '9') goto yy721;
+yy719:
+	++YYCURSOR;
+yy720:
+#line 239 "../src/conf/parse_opts.re"
+	{
+		error ("bad argument to option -j, --jobs (expected: positive integer): %s", *argv);
+		return EXIT_FAIL;
+	}
+#line 3116 "src/conf/parse_opts.cc"
+yy721:
+	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
+	if (yybm[0+yych] & 128) {
+		goto yy724;
+	}
+	if (yych >= 0x01) goto yy720;
+yy722:
+	++YYCURSOR;
+#line 244 "../src/conf/parse_opts.re"
+	{
+		uint32_t jobs;
+		if (!s_to_u32_unsafe (*argv, YYCURSOR - 1, jobs))
+		{
+			error ("bad argument to option -j, --jobs (overflow): %s", *argv);
+			return EXIT_FAIL;
+		}
+		opts.set_jobs (jobs);
+		goto opt;
+	}
+#line 3136 "src/conf/parse_opts.cc"
+yy724:
 	++YYCURSOR;
 	yych = (YYCTYPE)*YYCURSOR;
-yy587:
 	if (yybm[0+yych] & 128) {
-		goto yy586;
+		goto yy724;
 	}
-	goto yy584;
+	if (yych <= 0x00) goto yy722;
+	YYCURSOR = YYMARKER;
+	goto yy720;
 }
-#line 181 "../src/conf/parse_opts.re"
+#line 254 "../src/conf/parse_opts.re"
 
 
 opt_encoding_policy:
@@ -2431,115 +3153,115 @@ opt_encoding_policy:
 		return EXIT_FAIL;
 	}
 
-#line 2435 "src/conf/parse_opts.cc"
+#line 3157 "src/conf/parse_opts.cc"
 {
 	YYCTYPE yych;
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= 'h') {
-		if (yych == 'f') goto yy592;
+		if (yych == 'f') goto yy731;
 	} else {
-		if (yych <= 'i') goto yy593;
-		if (yych == 's') goto yy594;
+		if (yych <= 'i') goto yy732;
+		if (yych == 's') goto yy733;
 	}
 	++YYCURSOR;
-yy591:
-#line 191 "../src/conf/parse_opts.re"
+yy730:
+#line 264 "../src/conf/parse_opts.re"
 	{
 		error ("bad argument to option --encoding-policy (expected: ignore | substitute | fail): %s", *argv);
 		return EXIT_FAIL;
 	}
-#line 2452 "src/conf/parse_opts.cc"
-yy592:
+#line 3174 "src/conf/parse_opts.cc"
+yy731:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy595;
-	goto yy591;
-yy593:
+	if (yych == 'a') goto yy734;
+	goto yy730;
+yy732:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'g') goto yy597;
-	goto yy591;
-yy594:
+	if (yych == 'g') goto yy736;
+	goto yy730;
+yy733:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'u') goto yy598;
-	goto yy591;
-yy595:
+	if (yych == 'u') goto yy737;
+	goto yy730;
+yy734:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy599;
-yy596:
+	if (yych == 'i') goto yy738;
+yy735:
 	YYCURSOR = YYMARKER;
-	goto yy591;
-yy597:
+	goto yy730;
+yy736:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy600;
-	goto yy596;
-yy598:
+	if (yych == 'n') goto yy739;
+	goto yy735;
+yy737:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'b') goto yy601;
-	goto yy596;
-yy599:
+	if (yych == 'b') goto yy740;
+	goto yy735;
+yy738:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy602;
-	goto yy596;
-yy600:
+	if (yych == 'l') goto yy741;
+	goto yy735;
+yy739:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy603;
-	goto yy596;
-yy601:
+	if (yych == 'o') goto yy742;
+	goto yy735;
+yy740:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy604;
-	goto yy596;
-yy602:
+	if (yych == 's') goto yy743;
+	goto yy735;
+yy741:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy605;
-	goto yy596;
-yy603:
+	if (yych <= 0x00) goto yy744;
+	goto yy735;
+yy742:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy607;
-	goto yy596;
-yy604:
+	if (yych == 'r') goto yy746;
+	goto yy735;
+yy743:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy608;
-	goto yy596;
-yy605:
+	if (yych == 't') goto yy747;
+	goto yy735;
+yy744:
 	++YYCURSOR;
-#line 197 "../src/conf/parse_opts.re"
+#line 270 "../src/conf/parse_opts.re"
 	{ opts.set_encoding_policy (Enc::POLICY_FAIL);       goto opt; }
-#line 2507 "src/conf/parse_opts.cc"
-yy607:
+#line 3229 "src/conf/parse_opts.cc"
+yy746:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy609;
-	goto yy596;
-yy608:
+	if (yych == 'e') goto yy748;
+	goto yy735;
+yy747:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy610;
-	goto yy596;
-yy609:
+	if (yych == 'i') goto yy749;
+	goto yy735;
+yy748:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy611;
-	goto yy596;
-yy610:
+	if (yych <= 0x00) goto yy750;
+	goto yy735;
+yy749:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy613;
-	goto yy596;
-yy611:
+	if (yych == 't') goto yy752;
+	goto yy735;
+yy750:
 	++YYCURSOR;
-#line 195 "../src/conf/parse_opts.re"
+#line 268 "../src/conf/parse_opts.re"
 	{ opts.set_encoding_policy (Enc::POLICY_IGNORE);     goto opt; }
-#line 2528 "src/conf/parse_opts.cc"
-yy613:
+#line 3250 "src/conf/parse_opts.cc"
+yy752:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych != 'u') goto yy596;
+	if (yych != 'u') goto yy735;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych != 't') goto yy596;
+	if (yych != 't') goto yy735;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych != 'e') goto yy596;
+	if (yych != 'e') goto yy735;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych >= 0x01) goto yy596;
+	if (yych >= 0x01) goto yy735;
 	++YYCURSOR;
-#line 196 "../src/conf/parse_opts.re"
+#line 269 "../src/conf/parse_opts.re"
 	{ opts.set_encoding_policy (Enc::POLICY_SUBSTITUTE); goto opt; }
-#line 2541 "src/conf/parse_opts.cc"
+#line 3263 "src/conf/parse_opts.cc"
 }
-#line 198 "../src/conf/parse_opts.re"
+#line 271 "../src/conf/parse_opts.re"
 
 
 opt_input:
@@ -2549,86 +3271,86 @@ opt_input:
 		return EXIT_FAIL;
 	}
 
-#line 2553 "src/conf/parse_opts.cc"
+#line 3275 "src/conf/parse_opts.cc"
 {
 	YYCTYPE yych;
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych <= 'b') goto yy621;
-	if (yych <= 'c') goto yy623;
-	if (yych <= 'd') goto yy624;
-yy621:
+	if (yych <= 'b') goto yy760;
+	if (yych <= 'c') goto yy762;
+	if (yych <= 'd') goto yy763;
+yy760:
 	++YYCURSOR;
-yy622:
-#line 208 "../src/conf/parse_opts.re"
+yy761:
+#line 281 "../src/conf/parse_opts.re"
 	{
 		error ("bad argument to option --input (expected: default | custom): %s", *argv);
 		return EXIT_FAIL;
 	}
-#line 2568 "src/conf/parse_opts.cc"
-yy623:
+#line 3290 "src/conf/parse_opts.cc"
+yy762:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'u') goto yy625;
-	goto yy622;
-yy624:
+	if (yych == 'u') goto yy764;
+	goto yy761;
+yy763:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'e') goto yy627;
-	goto yy622;
-yy625:
+	if (yych == 'e') goto yy766;
+	goto yy761;
+yy764:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy628;
-yy626:
+	if (yych == 's') goto yy767;
+yy765:
 	YYCURSOR = YYMARKER;
-	goto yy622;
-yy627:
+	goto yy761;
+yy766:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'f') goto yy629;
-	goto yy626;
-yy628:
+	if (yych == 'f') goto yy768;
+	goto yy765;
+yy767:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy630;
-	goto yy626;
-yy629:
+	if (yych == 't') goto yy769;
+	goto yy765;
+yy768:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy631;
-	goto yy626;
-yy630:
+	if (yych == 'a') goto yy770;
+	goto yy765;
+yy769:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy632;
-	goto yy626;
-yy631:
+	if (yych == 'o') goto yy771;
+	goto yy765;
+yy770:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'u') goto yy633;
-	goto yy626;
-yy632:
+	if (yych == 'u') goto yy772;
+	goto yy765;
+yy771:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'm') goto yy634;
-	goto yy626;
-yy633:
+	if (yych == 'm') goto yy773;
+	goto yy765;
+yy772:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy635;
-	goto yy626;
-yy634:
+	if (yych == 'l') goto yy774;
+	goto yy765;
+yy773:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy636;
-	goto yy626;
-yy635:
+	if (yych <= 0x00) goto yy775;
+	goto yy765;
+yy774:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy638;
-	goto yy626;
-yy636:
+	if (yych == 't') goto yy777;
+	goto yy765;
+yy775:
 	++YYCURSOR;
-#line 213 "../src/conf/parse_opts.re"
+#line 286 "../src/conf/parse_opts.re"
 	{ opts.set_input_api (InputAPI::CUSTOM);  goto opt; }
-#line 2623 "src/conf/parse_opts.cc"
-yy638:
+#line 3345 "src/conf/parse_opts.cc"
+yy777:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych >= 0x01) goto yy626;
+	if (yych >= 0x01) goto yy765;
 	++YYCURSOR;
-#line 212 "../src/conf/parse_opts.re"
+#line 285 "../src/conf/parse_opts.re"
 	{ opts.set_input_api (InputAPI::DEFAULT); goto opt; }
-#line 2630 "src/conf/parse_opts.cc"
+#line 3352 "src/conf/parse_opts.cc"
 }
-#line 214 "../src/conf/parse_opts.re"
+#line 287 "../src/conf/parse_opts.re"
 
 
 opt_empty_class:
@@ -2638,120 +3360,120 @@ opt_empty_class:
 		return EXIT_FAIL;
 	}
 
-#line 2642 "src/conf/parse_opts.cc"
+#line 3364 "src/conf/parse_opts.cc"
 {
 	YYCTYPE yych;
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == 'e') goto yy645;
-	if (yych == 'm') goto yy646;
+	if (yych == 'e') goto yy784;
+	if (yych == 'm') goto yy785;
 	++YYCURSOR;
-yy644:
-#line 224 "../src/conf/parse_opts.re"
+yy783:
+#line 297 "../src/conf/parse_opts.re"
 	{
 		error ("bad argument to option --empty-class (expected: match-empty | match-none | error): %s", *argv);
 		return EXIT_FAIL;
 	}
-#line 2655 "src/conf/parse_opts.cc"
-yy645:
+#line 3377 "src/conf/parse_opts.cc"
+yy784:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'r') goto yy647;
-	goto yy644;
-yy646:
+	if (yych == 'r') goto yy786;
+	goto yy783;
+yy785:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy649;
-	goto yy644;
-yy647:
+	if (yych == 'a') goto yy788;
+	goto yy783;
+yy786:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy650;
-yy648:
+	if (yych == 'r') goto yy789;
+yy787:
 	YYCURSOR = YYMARKER;
-	goto yy644;
-yy649:
+	goto yy783;
+yy788:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy651;
-	goto yy648;
-yy650:
+	if (yych == 't') goto yy790;
+	goto yy787;
+yy789:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy652;
-	goto yy648;
-yy651:
+	if (yych == 'o') goto yy791;
+	goto yy787;
+yy790:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy653;
-	goto yy648;
-yy652:
+	if (yych == 'c') goto yy792;
+	goto yy787;
+yy791:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy654;
-	goto yy648;
-yy653:
+	if (yych == 'r') goto yy793;
+	goto yy787;
+yy792:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'h') goto yy655;
-	goto yy648;
-yy654:
+	if (yych == 'h') goto yy794;
+	goto yy787;
+yy793:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy656;
-	goto yy648;
-yy655:
+	if (yych <= 0x00) goto yy795;
+	goto yy787;
+yy794:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '-') goto yy658;
-	goto yy648;
-yy656:
+	if (yych == '-') goto yy797;
+	goto yy787;
+yy795:
 	++YYCURSOR;
-#line 230 "../src/conf/parse_opts.re"
+#line 303 "../src/conf/parse_opts.re"
 	{ opts.set_empty_class_policy (EMPTY_CLASS_ERROR);       goto opt; }
-#line 2702 "src/conf/parse_opts.cc"
-yy658:
+#line 3424 "src/conf/parse_opts.cc"
+yy797:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy659;
-	if (yych == 'n') goto yy660;
-	goto yy648;
-yy659:
+	if (yych == 'e') goto yy798;
+	if (yych == 'n') goto yy799;
+	goto yy787;
+yy798:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'm') goto yy661;
-	goto yy648;
-yy660:
+	if (yych == 'm') goto yy800;
+	goto yy787;
+yy799:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy662;
-	goto yy648;
-yy661:
+	if (yych == 'o') goto yy801;
+	goto yy787;
+yy800:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'p') goto yy663;
-	goto yy648;
-yy662:
+	if (yych == 'p') goto yy802;
+	goto yy787;
+yy801:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy664;
-	goto yy648;
-yy663:
+	if (yych == 'n') goto yy803;
+	goto yy787;
+yy802:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy665;
-	goto yy648;
-yy664:
+	if (yych == 't') goto yy804;
+	goto yy787;
+yy803:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy666;
-	goto yy648;
-yy665:
+	if (yych == 'e') goto yy805;
+	goto yy787;
+yy804:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'y') goto yy667;
-	goto yy648;
-yy666:
+	if (yych == 'y') goto yy806;
+	goto yy787;
+yy805:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy668;
-	goto yy648;
-yy667:
+	if (yych <= 0x00) goto yy807;
+	goto yy787;
+yy806:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy670;
-	goto yy648;
-yy668:
+	if (yych <= 0x00) goto yy809;
+	goto yy787;
+yy807:
 	++YYCURSOR;
-#line 229 "../src/conf/parse_opts.re"
+#line 302 "../src/conf/parse_opts.re"
 	{ opts.set_empty_class_policy (EMPTY_CLASS_MATCH_NONE);  goto opt; }
-#line 2748 "src/conf/parse_opts.cc"
-yy670:
+#line 3470 "src/conf/parse_opts.cc"
+yy809:
 	++YYCURSOR;
-#line 228 "../src/conf/parse_opts.re"
+#line 301 "../src/conf/parse_opts.re"
 	{ opts.set_empty_class_policy (EMPTY_CLASS_MATCH_EMPTY); goto opt; }
-#line 2753 "src/conf/parse_opts.cc"
+#line 3475 "src/conf/parse_opts.cc"
 }
-#line 231 "../src/conf/parse_opts.re"
+#line 304 "../src/conf/parse_opts.re"
 
 
 opt_dfa_minimization:
@@ -2761,74 +3483,111 @@ opt_dfa_minimization:
 		return EXIT_FAIL;
 	}
 
-#line 2765 "src/conf/parse_opts.cc"
+#line 3487 "src/conf/parse_opts.cc"
 {
 	YYCTYPE yych;
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == 'm') goto yy676;
-	if (yych == 't') goto yy677;
+	if (yych <= 'l') {
+		if (yych == 'h') goto yy815;
+	} else {
+		if (yych <= 'm') goto yy816;
+		if (yych == 't') goto yy817;
+	}
 	++YYCURSOR;
-yy675:
-#line 241 "../src/conf/parse_opts.re"
+yy814:
+#line 314 "../src/conf/parse_opts.re"
 	{
-		error ("bad argument to option --dfa-minimization (expected: table | moore): %s", *argv);
+		error ("bad argument to option --dfa-minimization (expected: table | moore | hopcroft): %s", *argv);
 		return EXIT_FAIL;
 	}
-#line 2778 "src/conf/parse_opts.cc"
-yy676:
+#line 3504 "src/conf/parse_opts.cc"
+yy815:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'o') goto yy678;
-	goto yy675;
-yy677:
+	if (yych == 'o') goto yy818;
+	goto yy814;
+yy816:
+	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
+	if (yych == 'o') goto yy820;
+	goto yy814;
+yy817:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == 'a') goto yy680;
-	goto yy675;
-yy678:
+	if (yych == 'a') goto yy821;
+	goto yy814;
+yy818:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy681;
-yy679:
+	if (yych == 'p') goto yy822;
+yy819:
 	YYCURSOR = YYMARKER;
-	goto yy675;
-yy680:
+	goto yy814;
+yy820:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'b') goto yy682;
-	goto yy679;
-yy681:
+	if (yych == 'o') goto yy823;
+	goto yy819;
+yy821:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy683;
-	goto yy679;
-yy682:
+	if (yych == 'b') goto yy824;
+	goto yy819;
+yy822:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy684;
-	goto yy679;
-yy683:
+	if (yych == 'c') goto yy825;
+	goto yy819;
+yy823:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy685;
-	goto yy679;
-yy684:
+	if (yych == 'r') goto yy826;
+	goto yy819;
+yy824:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy686;
-	goto yy679;
-yy685:
+	if (yych == 'l') goto yy827;
+	goto yy819;
+yy825:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy687;
-	goto yy679;
-yy686:
+	if (yych == 'r') goto yy828;
+	goto yy819;
+yy826:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy829;
+	goto yy819;
+yy827:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= 0x00) goto yy689;
-	goto yy679;
-yy687:
+	if (yych == 'e') goto yy830;
+	goto yy819;
+yy828:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'o') goto yy831;
+	goto yy819;
+yy829:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy832;
+	goto yy819;
+yy830:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych <= 0x00) goto yy834;
+	goto yy819;
+yy831:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'f') goto yy836;
+	goto yy819;
+yy832:
 	++YYCURSOR;
-#line 246 "../src/conf/parse_opts.re"
-	{ opts.set_dfa_minimization (DFA_MINIMIZATION_MOORE); goto opt; }
-#line 2825 "src/conf/parse_opts.cc"
-yy689:
+#line 319 "../src/conf/parse_opts.re"
+	{ opts.set_dfa_minimization (DFA_MINIMIZATION_MOORE);    goto opt; }
+#line 3575 "src/conf/parse_opts.cc"
+yy834:
+	++YYCURSOR;
+#line 318 "../src/conf/parse_opts.re"
+	{ opts.set_dfa_minimization (DFA_MINIMIZATION_TABLE);    goto opt; }
+#line 3580 "src/conf/parse_opts.cc"
+yy836:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych != 't') goto yy819;
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych >= 0x01) goto yy819;
 	++YYCURSOR;
-#line 245 "../src/conf/parse_opts.re"
-	{ opts.set_dfa_minimization (DFA_MINIMIZATION_TABLE); goto opt; }
-#line 2830 "src/conf/parse_opts.cc"
+#line 320 "../src/conf/parse_opts.re"
+	{ opts.set_dfa_minimization (DFA_MINIMIZATION_HOPCROFT); goto opt; }
+#line 3589 "src/conf/parse_opts.cc"
 }
-#line 247 "../src/conf/parse_opts.re"
+#line 321 "../src/conf/parse_opts.re"
 
 
 end:
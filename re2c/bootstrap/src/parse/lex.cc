@@ -1,4 +1,4 @@
-/* Generated by re2c 0.16 on Mon Nov  7 09:30:24 2016 */
+/* Generated by re2c 0.16 on Fri Oct 16 18:28:24 2026 */
 #line 1 "../src/parse/lex.re"
 #include "src/util/c99_stdint.h"
 #include <stddef.h>
@@ -36,13 +36,20 @@ extern YYSTYPE yylval;
 namespace re2c
 {
 
+// targets that embed generated code into user code
+static bool is_code_target ()
+{
+	return opts->target == opt_t::CODE
+		|| opts->target == opt_t::TABLE;
+}
+
 // source code is in ASCII: pointers have type 'char *'
 // but re2c makes an implicit assumption that YYCTYPE is unsigned
 // when it generates comparisons
-#line 42 "../src/parse/lex.re"
+#line 49 "../src/parse/lex.re"
 
 
-#line 62 "../src/parse/lex.re"
+#line 69 "../src/parse/lex.re"
 
 
 Scanner::ParseMode Scanner::echo()
@@ -58,7 +65,7 @@ Scanner::ParseMode Scanner::echo()
 	tok = cur;
 echo:
 
-#line 62 "src/parse/lex.cc"
+#line 69 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	unsigned int yyaccept = 0;
@@ -116,10 +123,10 @@ echo:
 		}
 	}
 	++YYCURSOR;
-#line 202 "../src/parse/lex.re"
+#line 218 "../src/parse/lex.re"
 	{
 					if(cur == eof) {
-						if (!ignore_eoc && opts->target == opt_t::CODE) {
+						if (!ignore_eoc && is_code_target ()) {
 							out.wraw(tok, tok_len () - 1);
 							// -1 so we don't write out the \0
 						}
@@ -128,15 +135,15 @@ echo:
 						goto echo;
 					}
 				}
-#line 132 "src/parse/lex.cc"
+#line 139 "src/parse/lex.cc"
 yy4:
 	++YYCURSOR;
 yy5:
-#line 213 "../src/parse/lex.re"
+#line 229 "../src/parse/lex.re"
 	{
 					goto echo;
 				}
-#line 140 "src/parse/lex.cc"
+#line 147 "src/parse/lex.cc"
 yy6:
 	yyaccept = 0;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
@@ -145,13 +152,13 @@ yy6:
 	}
 	if (yych == '#') goto yy14;
 yy7:
-#line 189 "../src/parse/lex.re"
+#line 205 "../src/parse/lex.re"
 	{
 					if (ignore_eoc)
 					{
 						ignore_cnt++;
 					}
-					else if (opts->target == opt_t::CODE)
+					else if (is_code_target ())
 					{
 						out.wraw(tok, tok_len ());
 					}
@@ -159,7 +166,7 @@ yy7:
 					cline++;
 					goto echo;
 				}
-#line 163 "src/parse/lex.cc"
+#line 170 "src/parse/lex.cc"
 yy8:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych == '{') goto yy16;
@@ -206,13 +213,13 @@ yy14:
 	}
 yy16:
 	++YYCURSOR;
-#line 78 "../src/parse/lex.re"
+#line 85 "../src/parse/lex.re"
 	{
 					if (opts->rFlag)
 					{
 						fatal("found standard 're2c' block while using -r flag");
 					}
-					if (opts->target == opt_t::CODE)
+					if (is_code_target ())
 					{
 						const size_t lexeme_len = cur[-1] == '{'
 							? sizeof ("%{") - 1
@@ -222,14 +229,14 @@ yy16:
 					tok = cur;
 					return Parse;
 				}
-#line 226 "src/parse/lex.cc"
+#line 233 "src/parse/lex.cc"
 yy18:
 	yyaccept = 2;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych == '\n') goto yy22;
 	if (yych == '\r') goto yy24;
 yy19:
-#line 168 "../src/parse/lex.re"
+#line 184 "../src/parse/lex.re"
 	{
 					if (ignore_eoc)
 					{
@@ -240,14 +247,14 @@ yy19:
 						ignore_eoc = false;
 						ignore_cnt = 0;
 					}
-					else if (opts->target == opt_t::CODE)
+					else if (is_code_target ())
 					{
 						out.wraw(tok, tok_len ());
 					}
 					tok = pos = cur;
 					goto echo;
 				}
-#line 251 "src/parse/lex.cc"
+#line 258 "src/parse/lex.cc"
 yy20:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych == '!') goto yy25;
@@ -258,7 +265,7 @@ yy21:
 	goto yy13;
 yy22:
 	++YYCURSOR;
-#line 150 "../src/parse/lex.re"
+#line 166 "../src/parse/lex.re"
 	{
 					cline++;
 					if (ignore_eoc)
@@ -270,14 +277,14 @@ yy22:
 						ignore_eoc = false;
 						ignore_cnt = 0;
 					}
-					else if (opts->target == opt_t::CODE)
+					else if (is_code_target ())
 					{
 						out.wraw(tok, tok_len ());
 					}
 					tok = pos = cur;
 					goto echo;
 				}
-#line 281 "src/parse/lex.cc"
+#line 288 "src/parse/lex.cc"
 yy24:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych == '\n') goto yy22;
@@ -289,289 +296,318 @@ yy25:
 	case 'i':	goto yy28;
 	case 'm':	goto yy29;
 	case 'r':	goto yy30;
-	case 't':	goto yy31;
-	case 'u':	goto yy32;
+	case 's':	goto yy31;
+	case 't':	goto yy32;
+	case 'u':	goto yy33;
 	default:	goto yy13;
 	}
 yy26:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy33;
+	if (yych == 'n') goto yy34;
 	goto yy13;
 yy27:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy34;
+	if (yych == 'e') goto yy35;
 	goto yy13;
 yy28:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'g') goto yy35;
+	if (yych == 'g') goto yy36;
 	goto yy13;
 yy29:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy36;
+	if (yych == 'a') goto yy37;
 	goto yy13;
 yy30:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy37;
-	if (yych == 'u') goto yy38;
+	if (yych == 'e') goto yy38;
+	if (yych == 'u') goto yy39;
 	goto yy13;
 yy31:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'y') goto yy39;
+	if (yych == 't') goto yy40;
 	goto yy13;
 yy32:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy40;
+	if (yych == 'y') goto yy41;
 	goto yy13;
 yy33:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy41;
+	if (yych == 's') goto yy42;
 	goto yy13;
 yy34:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy42;
+	if (yych == 'e') goto yy43;
 	goto yy13;
 yy35:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy43;
+	if (yych == 't') goto yy44;
 	goto yy13;
 yy36:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'x') goto yy44;
+	if (yych == 'n') goto yy45;
 	goto yy13;
 yy37:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '2') goto yy45;
+	if (yych == 'x') goto yy46;
 	goto yy13;
 yy38:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'l') goto yy46;
+	if (yych == '2') goto yy47;
 	goto yy13;
 yy39:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'p') goto yy47;
+	if (yych == 'l') goto yy48;
 	goto yy13;
 yy40:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy48;
+	if (yych == 'a') goto yy49;
 	goto yy13;
 yy41:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= '0') goto yy50;
-	if (yych <= '9') goto yy13;
-	goto yy50;
+	if (yych == 'p') goto yy50;
+	goto yy13;
 yy42:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy51;
+	if (yych == 'e') goto yy51;
 	goto yy13;
 yy43:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'o') goto yy52;
-	goto yy13;
+	if (yych <= '0') goto yy53;
+	if (yych <= '9') goto yy13;
+	goto yy53;
 yy44:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == ':') goto yy53;
+	if (yych == 's') goto yy54;
 	goto yy13;
 yy45:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy16;
+	if (yych == 'o') goto yy55;
 	goto yy13;
 yy46:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy54;
+	if (yych == ':') goto yy56;
 	goto yy13;
 yy47:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy55;
+	if (yych == 'c') goto yy16;
 	goto yy13;
 yy48:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == ':') goto yy56;
+	if (yych == 'e') goto yy57;
 	goto yy13;
 yy49:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 't') goto yy58;
+	goto yy13;
+yy50:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'e') goto yy59;
+	goto yy13;
+yy51:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == ':') goto yy60;
+	goto yy13;
+yy52:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-yy50:
+yy53:
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy49;
+		if (yych == '\t') goto yy52;
 		goto yy13;
 	} else {
-		if (yych <= ' ') goto yy49;
+		if (yych <= ' ') goto yy52;
 		if (yych <= '0') goto yy13;
-		if (yych <= '9') goto yy57;
+		if (yych <= '9') goto yy61;
 		goto yy13;
 	}
-yy51:
+yy54:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy59;
+	if (yych == 't') goto yy63;
 	goto yy13;
-yy52:
+yy55:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'r') goto yy64;
+	goto yy13;
+yy56:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy60;
+	if (yych == 'r') goto yy65;
 	goto yy13;
-yy53:
+yy57:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy61;
+	if (yych == 's') goto yy66;
 	goto yy13;
-yy54:
+yy58:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy62;
+	if (yych == 's') goto yy67;
 	goto yy13;
-yy55:
+yy59:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 's') goto yy63;
+	if (yych == 's') goto yy68;
 	goto yy13;
-yy56:
+yy60:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy64;
+	if (yych == 'r') goto yy69;
 	goto yy13;
-yy57:
+yy61:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 64) {
-		goto yy57;
+		goto yy61;
 	}
 	if (yych <= '\f') {
 		if (yych <= 0x08) goto yy13;
-		if (yych <= '\t') goto yy65;
-		if (yych <= '\n') goto yy67;
+		if (yych <= '\t') goto yy70;
+		if (yych <= '\n') goto yy72;
 		goto yy13;
 	} else {
-		if (yych <= '\r') goto yy69;
-		if (yych == ' ') goto yy65;
+		if (yych <= '\r') goto yy74;
+		if (yych == ' ') goto yy70;
 		goto yy13;
 	}
-yy59:
+yy63:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'a') goto yy70;
+	if (yych == 'a') goto yy75;
 	goto yy13;
-yy60:
+yy64:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy71;
+	if (yych == 'e') goto yy76;
 	goto yy13;
-yy61:
+yy65:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy72;
+	if (yych == 'e') goto yy77;
 	goto yy13;
-yy62:
+yy66:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == ':') goto yy73;
+	if (yych == ':') goto yy78;
 	goto yy13;
-yy63:
+yy67:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == ':') goto yy79;
+	goto yy13;
+yy68:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == ':') goto yy74;
+	if (yych == ':') goto yy80;
 	goto yy13;
-yy64:
+yy69:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy75;
+	if (yych == 'e') goto yy81;
 	goto yy13;
-yy65:
+yy70:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy65;
+		if (yych == '\t') goto yy70;
 		goto yy13;
 	} else {
-		if (yych <= ' ') goto yy65;
-		if (yych == '"') goto yy76;
+		if (yych <= ' ') goto yy70;
+		if (yych == '"') goto yy82;
 		goto yy13;
 	}
-yy67:
+yy72:
 	++YYCURSOR;
 	YYCURSOR = YYCTXMARKER;
-#line 185 "../src/parse/lex.re"
+#line 201 "../src/parse/lex.re"
 	{
 					set_sourceline ();
 					goto echo;
 				}
-#line 491 "src/parse/lex.cc"
-yy69:
+#line 519 "src/parse/lex.cc"
+yy74:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy67;
+	if (yych == '\n') goto yy72;
 	goto yy13;
-yy70:
+yy75:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 't') goto yy78;
+	if (yych == 't') goto yy84;
 	goto yy13;
-yy71:
+yy76:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == ':') goto yy79;
+	if (yych == ':') goto yy85;
 	goto yy13;
-yy72:
+yy77:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '2') goto yy80;
+	if (yych == '2') goto yy86;
 	goto yy13;
-yy73:
+yy78:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy81;
+	if (yych == 'r') goto yy87;
 	goto yy13;
-yy74:
+yy79:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy82;
+	if (yych == 'r') goto yy88;
 	goto yy13;
-yy75:
+yy80:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '2') goto yy83;
+	if (yych == 'r') goto yy89;
 	goto yy13;
-yy76:
+yy81:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == '2') goto yy90;
+	goto yy13;
+yy82:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 3) YYFILL(3);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 128) {
-		goto yy76;
+		goto yy82;
 	}
 	if (yych <= '\n') goto yy13;
-	if (yych <= '"') goto yy84;
-	goto yy85;
-yy78:
+	if (yych <= '"') goto yy91;
+	goto yy92;
+yy84:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy86;
+	if (yych == 'e') goto yy93;
 	goto yy13;
-yy79:
+yy85:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy87;
+	if (yych == 'r') goto yy94;
 	goto yy13;
-yy80:
+yy86:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy88;
+	if (yych == 'c') goto yy95;
 	goto yy13;
-yy81:
+yy87:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy90;
+	if (yych == 'e') goto yy97;
 	goto yy13;
-yy82:
+yy88:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy91;
+	if (yych == 'e') goto yy98;
 	goto yy13;
-yy83:
+yy89:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy92;
+	if (yych == 'e') goto yy99;
 	goto yy13;
-yy84:
+yy90:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy67;
-	if (yych == '\r') goto yy69;
+	if (yych == 'c') goto yy100;
 	goto yy13;
-yy85:
+yy91:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == '\n') goto yy72;
+	if (yych == '\r') goto yy74;
+	goto yy13;
+yy92:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych == '\n') goto yy13;
-	goto yy76;
-yy86:
+	goto yy82;
+yy93:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == ':') goto yy94;
+	if (yych == ':') goto yy102;
 	goto yy13;
-yy87:
+yy94:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy95;
+	if (yych == 'e') goto yy103;
 	goto yy13;
-yy88:
+yy95:
 	++YYCURSOR;
-#line 119 "../src/parse/lex.re"
+#line 126 "../src/parse/lex.re"
 	{
 					if (opts->target != opt_t::DOT)
 					{
@@ -581,25 +617,29 @@ yy88:
 					ignore_eoc = true;
 					goto echo;
 				}
-#line 585 "src/parse/lex.cc"
-yy90:
+#line 621 "src/parse/lex.cc"
+yy97:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '2') goto yy96;
+	if (yych == '2') goto yy104;
 	goto yy13;
-yy91:
+yy98:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '2') goto yy97;
+	if (yych == '2') goto yy105;
 	goto yy13;
-yy92:
+yy99:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == '2') goto yy106;
+	goto yy13;
+yy100:
 	++YYCURSOR;
-#line 105 "../src/parse/lex.re"
+#line 112 "../src/parse/lex.re"
 	{
 					if (!opts->rFlag)
 					{
 						fatal("found 'use:re2c' block without -r flag");
 					}
 					reuse();
-					if (opts->target == opt_t::CODE)
+					if (is_code_target ())
 					{
 						const size_t lexeme_len = sizeof ("/*!use:re2c") - 1;
 						out.wraw(tok, tok_len () - lexeme_len);
@@ -607,34 +647,38 @@ yy92:
 					tok = cur;
 					return Reuse;
 				}
-#line 611 "src/parse/lex.cc"
-yy94:
+#line 651 "src/parse/lex.cc"
+yy102:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'r') goto yy98;
+	if (yych == 'r') goto yy107;
 	goto yy13;
-yy95:
+yy103:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '2') goto yy99;
+	if (yych == '2') goto yy108;
 	goto yy13;
-yy96:
+yy104:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy100;
+	if (yych == 'c') goto yy109;
 	goto yy13;
-yy97:
+yy105:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy102;
+	if (yych == 'c') goto yy111;
 	goto yy13;
-yy98:
+yy106:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy104;
+	if (yych == 'c') goto yy113;
 	goto yy13;
-yy99:
+yy107:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'c') goto yy105;
+	if (yych == 'e') goto yy115;
 	goto yy13;
-yy100:
+yy108:
+	yych = (YYCTYPE)*++YYCURSOR;
+	if (yych == 'c') goto yy116;
+	goto yy13;
+yy109:
 	++YYCURSOR;
-#line 93 "../src/parse/lex.re"
+#line 100 "../src/parse/lex.re"
 	{
 					if (opts->rFlag)
 					{
@@ -647,10 +691,23 @@ yy100:
 					tok = cur;
 					return Rules;
 				}
-#line 651 "src/parse/lex.cc"
-yy102:
+#line 695 "src/parse/lex.cc"
+yy111:
 	++YYCURSOR;
-#line 139 "../src/parse/lex.re"
+#line 141 "../src/parse/lex.re"
+	{
+					tok = pos = cur;
+					if (opts->target == opt_t::CODE)
+					{
+						out.wdelay_stats ();
+					}
+					ignore_eoc = true;
+					goto echo;
+				}
+#line 708 "src/parse/lex.cc"
+yy113:
+	++YYCURSOR;
+#line 155 "../src/parse/lex.re"
 	{
 					tok = pos = cur;
 					ignore_eoc = true;
@@ -662,34 +719,34 @@ yy102:
 					}
 					goto echo;
 				}
-#line 666 "src/parse/lex.cc"
-yy104:
+#line 723 "src/parse/lex.cc"
+yy115:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '2') goto yy107;
+	if (yych == '2') goto yy118;
 	goto yy13;
-yy105:
+yy116:
 	++YYCURSOR;
-#line 134 "../src/parse/lex.re"
+#line 150 "../src/parse/lex.re"
 	{
 					tok = pos = cur;
 					ignore_eoc = true;
 					goto echo;
 				}
-#line 679 "src/parse/lex.cc"
-yy107:
+#line 736 "src/parse/lex.cc"
+yy118:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych != 'c') goto yy13;
 	++YYCURSOR;
-#line 128 "../src/parse/lex.re"
+#line 135 "../src/parse/lex.re"
 	{
 					tok = pos = cur;
 					out.wdelay_state_goto (opts->topIndent);
 					ignore_eoc = true;
 					goto echo;
 				}
-#line 691 "src/parse/lex.cc"
+#line 748 "src/parse/lex.cc"
 }
-#line 216 "../src/parse/lex.re"
+#line 232 "../src/parse/lex.re"
 
 }
 
@@ -709,7 +766,7 @@ scan:
 
 start:
 
-#line 713 "src/parse/lex.cc"
+#line 770 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	unsigned int yyaccept = 0;
@@ -750,276 +807,276 @@ start:
 	if ((YYLIMIT - YYCURSOR) < 6) YYFILL(6);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 16) {
-		goto yy114;
+		goto yy125;
 	}
 	if (yych <= '9') {
 		if (yych <= '&') {
 			if (yych <= '\r') {
-				if (yych <= 0x08) goto yy112;
-				if (yych <= '\n') goto yy117;
-				if (yych >= '\r') goto yy119;
+				if (yych <= 0x08) goto yy123;
+				if (yych <= '\n') goto yy128;
+				if (yych >= '\r') goto yy130;
 			} else {
 				if (yych <= '"') {
-					if (yych >= '"') goto yy120;
+					if (yych >= '"') goto yy131;
 				} else {
-					if (yych == '%') goto yy122;
+					if (yych == '%') goto yy133;
 				}
 			}
 		} else {
 			if (yych <= '+') {
-				if (yych <= '\'') goto yy123;
-				if (yych <= ')') goto yy125;
-				if (yych <= '*') goto yy127;
-				goto yy129;
+				if (yych <= '\'') goto yy134;
+				if (yych <= ')') goto yy136;
+				if (yych <= '*') goto yy138;
+				goto yy140;
 			} else {
 				if (yych <= '-') {
-					if (yych <= ',') goto yy125;
+					if (yych <= ',') goto yy136;
 				} else {
-					if (yych <= '.') goto yy131;
-					if (yych <= '/') goto yy133;
-					goto yy134;
+					if (yych <= '.') goto yy142;
+					if (yych <= '/') goto yy144;
+					goto yy145;
 				}
 			}
 		}
 	} else {
 		if (yych <= '\\') {
 			if (yych <= '>') {
-				if (yych <= ':') goto yy135;
-				if (yych == '<') goto yy136;
-				goto yy125;
+				if (yych <= ':') goto yy146;
+				if (yych == '<') goto yy147;
+				goto yy136;
 			} else {
 				if (yych <= '@') {
-					if (yych <= '?') goto yy129;
+					if (yych <= '?') goto yy140;
 				} else {
-					if (yych <= 'Z') goto yy134;
-					if (yych <= '[') goto yy137;
-					goto yy125;
+					if (yych <= 'Z') goto yy145;
+					if (yych <= '[') goto yy148;
+					goto yy136;
 				}
 			}
 		} else {
 			if (yych <= 'q') {
-				if (yych == '_') goto yy134;
-				if (yych >= 'a') goto yy134;
+				if (yych == '_') goto yy145;
+				if (yych >= 'a') goto yy145;
 			} else {
 				if (yych <= 'z') {
-					if (yych <= 'r') goto yy139;
-					goto yy134;
+					if (yych <= 'r') goto yy150;
+					goto yy145;
 				} else {
-					if (yych <= '{') goto yy140;
-					if (yych <= '|') goto yy125;
+					if (yych <= '{') goto yy151;
+					if (yych <= '|') goto yy136;
 				}
 			}
 		}
 	}
-yy112:
+yy123:
 	++YYCURSOR;
-yy113:
-#line 388 "../src/parse/lex.re"
+yy124:
+#line 404 "../src/parse/lex.re"
 	{
 					fatalf("unexpected character: '%c'", *tok);
 					goto scan;
 				}
-#line 823 "src/parse/lex.cc"
-yy114:
+#line 880 "src/parse/lex.cc"
+yy125:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 16) {
-		goto yy114;
+		goto yy125;
 	}
-#line 372 "../src/parse/lex.re"
+#line 388 "../src/parse/lex.re"
 	{
 					goto scan;
 				}
-#line 835 "src/parse/lex.cc"
-yy117:
+#line 892 "src/parse/lex.cc"
+yy128:
 	yyaccept = 0;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy142;
+		if (yych == '\t') goto yy153;
 	} else {
-		if (yych <= ' ') goto yy142;
-		if (yych == '#') goto yy145;
+		if (yych <= ' ') goto yy153;
+		if (yych == '#') goto yy156;
 	}
-yy118:
-#line 381 "../src/parse/lex.re"
+yy129:
+#line 397 "../src/parse/lex.re"
 	{
 					if (cur == eof) return 0;
 					pos = cur;
 					cline++;
 					goto scan;
 				}
-#line 853 "src/parse/lex.cc"
-yy119:
+#line 910 "src/parse/lex.cc"
+yy130:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy117;
-	goto yy113;
-yy120:
+	if (yych == '\n') goto yy128;
+	goto yy124;
+yy131:
 	++YYCURSOR;
-#line 265 "../src/parse/lex.re"
+#line 281 "../src/parse/lex.re"
 	{ yylval.regexp = lex_str('"',  opts->bCaseInsensitive ||  opts->bCaseInverted); return TOKEN_REGEXP; }
-#line 862 "src/parse/lex.cc"
-yy122:
+#line 919 "src/parse/lex.cc"
+yy133:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '}') goto yy147;
-	goto yy113;
-yy123:
+	if (yych == '}') goto yy158;
+	goto yy124;
+yy134:
 	++YYCURSOR;
-#line 264 "../src/parse/lex.re"
+#line 280 "../src/parse/lex.re"
 	{ yylval.regexp = lex_str('\'', opts->bCaseInsensitive || !opts->bCaseInverted); return TOKEN_REGEXP; }
-#line 871 "src/parse/lex.cc"
-yy125:
+#line 928 "src/parse/lex.cc"
+yy136:
 	++YYCURSOR;
-yy126:
-#line 275 "../src/parse/lex.re"
+yy137:
+#line 291 "../src/parse/lex.re"
 	{
 					return *tok;
 				}
-#line 879 "src/parse/lex.cc"
-yy127:
+#line 936 "src/parse/lex.cc"
+yy138:
 	++YYCURSOR;
-	if ((yych = (YYCTYPE)*YYCURSOR) == '/') goto yy147;
-#line 279 "../src/parse/lex.re"
+	if ((yych = (YYCTYPE)*YYCURSOR) == '/') goto yy158;
+#line 295 "../src/parse/lex.re"
 	{
 					yylval.op = *tok;
 					return TOKEN_STAR;
 				}
-#line 888 "src/parse/lex.cc"
-yy129:
+#line 945 "src/parse/lex.cc"
+yy140:
 	++YYCURSOR;
-#line 283 "../src/parse/lex.re"
+#line 299 "../src/parse/lex.re"
 	{
 					yylval.op = *tok;
 					return TOKEN_CLOSE;
 				}
-#line 896 "src/parse/lex.cc"
-yy131:
+#line 953 "src/parse/lex.cc"
+yy142:
 	++YYCURSOR;
-#line 367 "../src/parse/lex.re"
+#line 383 "../src/parse/lex.re"
 	{
 					yylval.regexp = mkDot();
 					return TOKEN_REGEXP;
 				}
-#line 904 "src/parse/lex.cc"
-yy133:
+#line 961 "src/parse/lex.cc"
+yy144:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '*') goto yy149;
-	if (yych == '/') goto yy151;
-	goto yy126;
-yy134:
+	if (yych == '*') goto yy160;
+	if (yych == '/') goto yy162;
+	goto yy137;
+yy145:
 	yych = (YYCTYPE)*++YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-	goto yy159;
-yy135:
+	goto yy170;
+yy146:
 	yych = (YYCTYPE)*++YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-	if (yych == '=') goto yy160;
-	goto yy113;
-yy136:
+	if (yych == '=') goto yy171;
+	goto yy124;
+yy147:
 	yyaccept = 1;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == '!') goto yy162;
-	if (yych == '>') goto yy164;
-	goto yy126;
-yy137:
+	if (yych == '!') goto yy173;
+	if (yych == '>') goto yy175;
+	goto yy137;
+yy148:
 	++YYCURSOR;
-	if ((yych = (YYCTYPE)*YYCURSOR) == '^') goto yy165;
-#line 266 "../src/parse/lex.re"
+	if ((yych = (YYCTYPE)*YYCURSOR) == '^') goto yy176;
+#line 282 "../src/parse/lex.re"
 	{ yylval.regexp = lex_cls(false); return TOKEN_REGEXP; }
-#line 930 "src/parse/lex.cc"
-yy139:
+#line 987 "src/parse/lex.cc"
+yy150:
 	yych = (YYCTYPE)*++YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-	if (yych == 'e') goto yy167;
-	goto yy159;
-yy140:
+	if (yych == 'e') goto yy178;
+	goto yy170;
+yy151:
 	yyaccept = 2;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yybm[0+yych] & 64) {
-		goto yy170;
+		goto yy181;
 	}
 	if (yych <= 'Z') {
-		if (yych == ',') goto yy168;
-		if (yych >= 'A') goto yy172;
+		if (yych == ',') goto yy179;
+		if (yych >= 'A') goto yy183;
 	} else {
 		if (yych <= '_') {
-			if (yych >= '_') goto yy172;
+			if (yych >= '_') goto yy183;
 		} else {
-			if (yych <= '`') goto yy141;
-			if (yych <= 'z') goto yy172;
+			if (yych <= '`') goto yy152;
+			if (yych <= 'z') goto yy183;
 		}
 	}
-yy141:
-#line 235 "../src/parse/lex.re"
+yy152:
+#line 251 "../src/parse/lex.re"
 	{
 					depth = 1;
 					goto code;
 				}
-#line 959 "src/parse/lex.cc"
-yy142:
+#line 1016 "src/parse/lex.cc"
+yy153:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy142;
+		if (yych == '\t') goto yy153;
 	} else {
-		if (yych <= ' ') goto yy142;
-		if (yych == '#') goto yy145;
+		if (yych <= ' ') goto yy153;
+		if (yych == '#') goto yy156;
 	}
-yy144:
+yy155:
 	YYCURSOR = YYMARKER;
 	if (yyaccept <= 1) {
 		if (yyaccept == 0) {
-			goto yy118;
+			goto yy129;
 		} else {
-			goto yy126;
+			goto yy137;
 		}
 	} else {
 		if (yyaccept == 2) {
-			goto yy141;
+			goto yy152;
 		} else {
-			goto yy169;
+			goto yy180;
 		}
 	}
-yy145:
+yy156:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 5) YYFILL(5);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy145;
-		goto yy144;
+		if (yych == '\t') goto yy156;
+		goto yy155;
 	} else {
-		if (yych <= ' ') goto yy145;
-		if (yych == 'l') goto yy174;
-		goto yy144;
+		if (yych <= ' ') goto yy156;
+		if (yych == 'l') goto yy185;
+		goto yy155;
 	}
-yy147:
+yy158:
 	++YYCURSOR;
-#line 259 "../src/parse/lex.re"
+#line 275 "../src/parse/lex.re"
 	{
 					tok = cur;
 					return 0;
 				}
-#line 1004 "src/parse/lex.cc"
-yy149:
+#line 1061 "src/parse/lex.cc"
+yy160:
 	++YYCURSOR;
-#line 253 "../src/parse/lex.re"
+#line 269 "../src/parse/lex.re"
 	{
 					depth = 1;
 					goto comment;
 				}
-#line 1012 "src/parse/lex.cc"
-yy151:
+#line 1069 "src/parse/lex.cc"
+yy162:
 	++YYCURSOR;
-#line 250 "../src/parse/lex.re"
+#line 266 "../src/parse/lex.re"
 	{
 				goto nextLine;
 			}
-#line 1019 "src/parse/lex.cc"
-yy153:
+#line 1076 "src/parse/lex.cc"
+yy164:
 	++YYCURSOR;
 	YYCURSOR = YYCTXMARKER;
-#line 351 "../src/parse/lex.re"
+#line 367 "../src/parse/lex.re"
 	{
 					if (!opts->FFlag) {
 						yylval.str = new std::string (tok, tok_len());
@@ -1035,134 +1092,134 @@ yy153:
 						return TOKEN_REGEXP;
 					}
 				}
-#line 1039 "src/parse/lex.cc"
-yy155:
+#line 1096 "src/parse/lex.cc"
+yy166:
 	yych = (YYCTYPE)*++YYCURSOR;
-	goto yy178;
-yy156:
+	goto yy189;
+yy167:
 	++YYCURSOR;
 	YYCURSOR = YYCTXMARKER;
-#line 346 "../src/parse/lex.re"
+#line 362 "../src/parse/lex.re"
 	{
 					yylval.str = new std::string (tok, tok_len ());
 					return TOKEN_ID;
 				}
-#line 1051 "src/parse/lex.cc"
-yy158:
+#line 1108 "src/parse/lex.cc"
+yy169:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-yy159:
+yy170:
 	if (yybm[0+yych] & 32) {
-		goto yy158;
+		goto yy169;
 	}
 	if (yych <= ' ') {
-		if (yych == '\t') goto yy155;
-		if (yych <= 0x1F) goto yy153;
-		goto yy155;
+		if (yych == '\t') goto yy166;
+		if (yych <= 0x1F) goto yy164;
+		goto yy166;
 	} else {
 		if (yych <= ',') {
-			if (yych <= '+') goto yy153;
-			goto yy156;
+			if (yych <= '+') goto yy164;
+			goto yy167;
 		} else {
-			if (yych <= '<') goto yy153;
-			if (yych <= '>') goto yy156;
-			goto yy153;
+			if (yych <= '<') goto yy164;
+			if (yych <= '>') goto yy167;
+			goto yy164;
 		}
 	}
-yy160:
+yy171:
 	++YYCURSOR;
-	if ((yych = (YYCTYPE)*YYCURSOR) == '>') goto yy179;
-#line 244 "../src/parse/lex.re"
+	if ((yych = (YYCTYPE)*YYCURSOR) == '>') goto yy190;
+#line 260 "../src/parse/lex.re"
 	{
 					tok += 2; /* skip ":=" */
 					depth = 0;
 					goto code;
 				}
-#line 1084 "src/parse/lex.cc"
-yy162:
+#line 1141 "src/parse/lex.cc"
+yy173:
 	++YYCURSOR;
-#line 272 "../src/parse/lex.re"
+#line 288 "../src/parse/lex.re"
 	{
 					return TOKEN_SETUP;
 				}
-#line 1091 "src/parse/lex.cc"
-yy164:
+#line 1148 "src/parse/lex.cc"
+yy175:
 	yych = (YYCTYPE)*++YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-	goto yy182;
-yy165:
+	goto yy193;
+yy176:
 	++YYCURSOR;
-#line 267 "../src/parse/lex.re"
+#line 283 "../src/parse/lex.re"
 	{ yylval.regexp = lex_cls(true);  return TOKEN_REGEXP; }
-#line 1100 "src/parse/lex.cc"
-yy167:
+#line 1157 "src/parse/lex.cc"
+yy178:
 	yych = (YYCTYPE)*++YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-	if (yych == '2') goto yy187;
-	goto yy159;
-yy168:
+	if (yych == '2') goto yy198;
+	goto yy170;
+yy179:
 	++YYCURSOR;
-yy169:
-#line 319 "../src/parse/lex.re"
+yy180:
+#line 335 "../src/parse/lex.re"
 	{
 					fatal("illegal closure form, use '{n}', '{n,}', '{n,m}' where n and m are numbers");
 				}
-#line 1113 "src/parse/lex.cc"
-yy170:
+#line 1170 "src/parse/lex.cc"
+yy181:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 64) {
-		goto yy170;
+		goto yy181;
 	}
 	if (yych <= '^') {
 		if (yych <= ',') {
-			if (yych <= '+') goto yy144;
-			goto yy188;
+			if (yych <= '+') goto yy155;
+			goto yy199;
 		} else {
-			if (yych <= '@') goto yy144;
-			if (yych >= '[') goto yy144;
+			if (yych <= '@') goto yy155;
+			if (yych >= '[') goto yy155;
 		}
 	} else {
 		if (yych <= 'z') {
-			if (yych == '`') goto yy144;
+			if (yych == '`') goto yy155;
 		} else {
-			if (yych == '}') goto yy189;
-			goto yy144;
+			if (yych == '}') goto yy200;
+			goto yy155;
 		}
 	}
-yy172:
+yy183:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= '^') {
 		if (yych <= '9') {
-			if (yych <= '/') goto yy144;
-			goto yy172;
+			if (yych <= '/') goto yy155;
+			goto yy183;
 		} else {
-			if (yych <= '@') goto yy144;
-			if (yych <= 'Z') goto yy172;
-			goto yy144;
+			if (yych <= '@') goto yy155;
+			if (yych <= 'Z') goto yy183;
+			goto yy155;
 		}
 	} else {
 		if (yych <= 'z') {
-			if (yych == '`') goto yy144;
-			goto yy172;
+			if (yych == '`') goto yy155;
+			goto yy183;
 		} else {
-			if (yych == '}') goto yy191;
-			goto yy144;
+			if (yych == '}') goto yy202;
+			goto yy155;
 		}
 	}
-yy174:
+yy185:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'i') goto yy193;
-	goto yy144;
-yy175:
+	if (yych == 'i') goto yy204;
+	goto yy155;
+yy186:
 	++YYCURSOR;
 	YYCURSOR = YYCTXMARKER;
-#line 333 "../src/parse/lex.re"
+#line 349 "../src/parse/lex.re"
 	{
 					yylval.str = new std::string (tok, tok_len ());
 					if (opts->FFlag)
@@ -1175,87 +1232,87 @@ yy175:
 						return TOKEN_ID;
 					}
 				}
-#line 1179 "src/parse/lex.cc"
-yy177:
+#line 1236 "src/parse/lex.cc"
+yy188:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-yy178:
+yy189:
 	if (yych <= ' ') {
-		if (yych == '\t') goto yy177;
-		if (yych <= 0x1F) goto yy175;
-		goto yy177;
+		if (yych == '\t') goto yy188;
+		if (yych <= 0x1F) goto yy186;
+		goto yy188;
 	} else {
 		if (yych <= ',') {
-			if (yych <= '+') goto yy175;
-			goto yy156;
+			if (yych <= '+') goto yy186;
+			goto yy167;
 		} else {
-			if (yych <= '<') goto yy175;
-			if (yych <= '>') goto yy156;
-			goto yy175;
+			if (yych <= '<') goto yy186;
+			if (yych <= '>') goto yy167;
+			goto yy186;
 		}
 	}
-yy179:
+yy190:
 	++YYCURSOR;
 	YYCURSOR = YYCTXMARKER;
-#line 240 "../src/parse/lex.re"
+#line 256 "../src/parse/lex.re"
 	{
 					return *tok;
 				}
-#line 1206 "src/parse/lex.cc"
-yy181:
+#line 1263 "src/parse/lex.cc"
+yy192:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*YYCURSOR;
-yy182:
+yy193:
 	if (yych <= '9') {
 		if (yych <= '\t') {
-			if (yych <= 0x08) goto yy144;
-			goto yy181;
+			if (yych <= 0x08) goto yy155;
+			goto yy192;
 		} else {
-			if (yych == ' ') goto yy181;
-			goto yy144;
+			if (yych == ' ') goto yy192;
+			goto yy155;
 		}
 	} else {
 		if (yych <= '=') {
-			if (yych <= ':') goto yy183;
-			if (yych <= '<') goto yy144;
-			goto yy184;
+			if (yych <= ':') goto yy194;
+			if (yych <= '<') goto yy155;
+			goto yy195;
 		} else {
-			if (yych == '{') goto yy185;
-			goto yy144;
+			if (yych == '{') goto yy196;
+			goto yy155;
 		}
 	}
-yy183:
+yy194:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '=') goto yy185;
-	goto yy144;
-yy184:
+	if (yych == '=') goto yy196;
+	goto yy155;
+yy195:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych != '>') goto yy144;
-yy185:
+	if (yych != '>') goto yy155;
+yy196:
 	++YYCURSOR;
 	YYCURSOR = YYCTXMARKER;
-#line 269 "../src/parse/lex.re"
+#line 285 "../src/parse/lex.re"
 	{
 					return TOKEN_NOCOND;
 				}
-#line 1244 "src/parse/lex.cc"
-yy187:
+#line 1301 "src/parse/lex.cc"
+yy198:
 	yych = (YYCTYPE)*++YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-	if (yych == 'c') goto yy194;
-	goto yy159;
-yy188:
+	if (yych == 'c') goto yy205;
+	goto yy170;
+yy199:
 	yyaccept = 3;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych <= '/') goto yy169;
-	if (yych <= '9') goto yy195;
-	if (yych == '}') goto yy197;
-	goto yy169;
-yy189:
+	if (yych <= '/') goto yy180;
+	if (yych <= '9') goto yy206;
+	if (yych == '}') goto yy208;
+	goto yy180;
+yy200:
 	++YYCURSOR;
-#line 288 "../src/parse/lex.re"
+#line 304 "../src/parse/lex.re"
 	{
 					if (!s_to_u32_unsafe (tok + 1, cur - 1, yylval.extop.min))
 					{
@@ -1264,10 +1321,10 @@ yy189:
 					yylval.extop.max = yylval.extop.min;
 					return TOKEN_CLOSESIZE;
 				}
-#line 1268 "src/parse/lex.cc"
-yy191:
+#line 1325 "src/parse/lex.cc"
+yy202:
 	++YYCURSOR;
-#line 323 "../src/parse/lex.re"
+#line 339 "../src/parse/lex.re"
 	{
 					if (!opts->FFlag) {
 						fatal("curly braces for names only allowed with -F switch");
@@ -1275,27 +1332,27 @@ yy191:
 					yylval.str = new std::string (tok + 1, tok_len () - 2); // -2 to omit braces
 					return TOKEN_ID;
 				}
-#line 1279 "src/parse/lex.cc"
-yy193:
+#line 1336 "src/parse/lex.cc"
+yy204:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'n') goto yy199;
-	goto yy144;
-yy194:
+	if (yych == 'n') goto yy210;
+	goto yy155;
+yy205:
 	yych = (YYCTYPE)*++YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-	if (yych == ':') goto yy200;
-	goto yy159;
-yy195:
+	if (yych == ':') goto yy211;
+	goto yy170;
+yy206:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych <= '/') goto yy144;
-	if (yych <= '9') goto yy195;
-	if (yych == '}') goto yy202;
-	goto yy144;
-yy197:
+	if (yych <= '/') goto yy155;
+	if (yych <= '9') goto yy206;
+	if (yych == '}') goto yy213;
+	goto yy155;
+yy208:
 	++YYCURSOR;
-#line 310 "../src/parse/lex.re"
+#line 326 "../src/parse/lex.re"
 	{
 					if (!s_to_u32_unsafe (tok + 1, cur - 2, yylval.extop.min))
 					{
@@ -1304,19 +1361,19 @@ yy197:
 					yylval.extop.max = std::numeric_limits<uint32_t>::max();
 					return TOKEN_CLOSESIZE;
 				}
-#line 1308 "src/parse/lex.cc"
-yy199:
+#line 1365 "src/parse/lex.cc"
+yy210:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == 'e') goto yy204;
-	goto yy144;
-yy200:
+	if (yych == 'e') goto yy215;
+	goto yy155;
+yy211:
 	++YYCURSOR;
-#line 331 "../src/parse/lex.re"
+#line 347 "../src/parse/lex.re"
 	{ lex_conf (); return TOKEN_CONF; }
-#line 1317 "src/parse/lex.cc"
-yy202:
+#line 1374 "src/parse/lex.cc"
+yy213:
 	++YYCURSOR;
-#line 297 "../src/parse/lex.re"
+#line 313 "../src/parse/lex.re"
 	{
 					const char * p = strchr (tok, ',');
 					if (!s_to_u32_unsafe (tok + 1, p, yylval.extop.min))
@@ -1329,132 +1386,132 @@ yy202:
 					}
 					return TOKEN_CLOSESIZE;
 				}
-#line 1333 "src/parse/lex.cc"
-yy204:
+#line 1390 "src/parse/lex.cc"
+yy215:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= '0') goto yy206;
-	if (yych <= '9') goto yy144;
-	goto yy206;
-yy205:
+	if (yych <= '0') goto yy217;
+	if (yych <= '9') goto yy155;
+	goto yy217;
+yy216:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-yy206:
+yy217:
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy205;
-		goto yy144;
+		if (yych == '\t') goto yy216;
+		goto yy155;
 	} else {
-		if (yych <= ' ') goto yy205;
-		if (yych <= '0') goto yy144;
-		if (yych >= ':') goto yy144;
+		if (yych <= ' ') goto yy216;
+		if (yych <= '0') goto yy155;
+		if (yych >= ':') goto yy155;
 	}
-yy207:
+yy218:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= '\r') {
 		if (yych <= '\t') {
-			if (yych <= 0x08) goto yy144;
+			if (yych <= 0x08) goto yy155;
 		} else {
-			if (yych <= '\n') goto yy211;
-			if (yych <= '\f') goto yy144;
-			goto yy213;
+			if (yych <= '\n') goto yy222;
+			if (yych <= '\f') goto yy155;
+			goto yy224;
 		}
 	} else {
 		if (yych <= ' ') {
-			if (yych <= 0x1F) goto yy144;
+			if (yych <= 0x1F) goto yy155;
 		} else {
-			if (yych <= '/') goto yy144;
-			if (yych <= '9') goto yy207;
-			goto yy144;
+			if (yych <= '/') goto yy155;
+			if (yych <= '9') goto yy218;
+			goto yy155;
 		}
 	}
-yy209:
+yy220:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy209;
-		goto yy144;
+		if (yych == '\t') goto yy220;
+		goto yy155;
 	} else {
-		if (yych <= ' ') goto yy209;
-		if (yych == '"') goto yy214;
-		goto yy144;
+		if (yych <= ' ') goto yy220;
+		if (yych == '"') goto yy225;
+		goto yy155;
 	}
-yy211:
+yy222:
 	++YYCURSOR;
 	YYCURSOR = YYCTXMARKER;
-#line 376 "../src/parse/lex.re"
+#line 392 "../src/parse/lex.re"
 	{
 					set_sourceline ();
 					goto scan;
 				}
-#line 1394 "src/parse/lex.cc"
-yy213:
+#line 1451 "src/parse/lex.cc"
+yy224:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy211;
-	goto yy144;
-yy214:
+	if (yych == '\n') goto yy222;
+	goto yy155;
+yy225:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 3) YYFILL(3);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 128) {
-		goto yy214;
+		goto yy225;
 	}
-	if (yych <= '\n') goto yy144;
-	if (yych >= '#') goto yy217;
+	if (yych <= '\n') goto yy155;
+	if (yych >= '#') goto yy228;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy211;
-	if (yych == '\r') goto yy213;
-	goto yy144;
-yy217:
+	if (yych == '\n') goto yy222;
+	if (yych == '\r') goto yy224;
+	goto yy155;
+yy228:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == '\n') goto yy144;
-	goto yy214;
+	if (yych == '\n') goto yy155;
+	goto yy225;
 }
-#line 392 "../src/parse/lex.re"
+#line 408 "../src/parse/lex.re"
 
 
 flex_name:
 
-#line 1424 "src/parse/lex.cc"
+#line 1481 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == '\n') goto yy222;
-	if (yych == '\r') goto yy224;
+	if (yych == '\n') goto yy233;
+	if (yych == '\r') goto yy235;
 	++YYCURSOR;
-yy221:
-#line 403 "../src/parse/lex.re"
+yy232:
+#line 419 "../src/parse/lex.re"
 	{
 		YYCURSOR = tok;
 		goto start;
 	}
-#line 1438 "src/parse/lex.cc"
-yy222:
+#line 1495 "src/parse/lex.cc"
+yy233:
 	++YYCURSOR;
-#line 397 "../src/parse/lex.re"
+#line 413 "../src/parse/lex.re"
 	{
 		YYCURSOR = tok;
 		lexer_state = LEX_NORMAL;
 		return TOKEN_FID_END;
 	}
-#line 1447 "src/parse/lex.cc"
-yy224:
+#line 1504 "src/parse/lex.cc"
+yy235:
 	++YYCURSOR;
-	if ((yych = (YYCTYPE)*YYCURSOR) == '\n') goto yy222;
-	goto yy221;
+	if ((yych = (YYCTYPE)*YYCURSOR) == '\n') goto yy233;
+	goto yy232;
 }
-#line 407 "../src/parse/lex.re"
+#line 423 "../src/parse/lex.re"
 
 
 code:
 
-#line 1458 "src/parse/lex.cc"
+#line 1515 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	unsigned int yyaccept = 0;
@@ -1496,26 +1553,26 @@ code:
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= '&') {
 		if (yych <= '\n') {
-			if (yych <= 0x00) goto yy227;
-			if (yych <= '\t') goto yy229;
-			goto yy231;
+			if (yych <= 0x00) goto yy238;
+			if (yych <= '\t') goto yy240;
+			goto yy242;
 		} else {
-			if (yych == '"') goto yy233;
-			goto yy229;
+			if (yych == '"') goto yy244;
+			goto yy240;
 		}
 	} else {
 		if (yych <= '{') {
-			if (yych <= '\'') goto yy234;
-			if (yych <= 'z') goto yy229;
-			goto yy235;
+			if (yych <= '\'') goto yy245;
+			if (yych <= 'z') goto yy240;
+			goto yy246;
 		} else {
-			if (yych == '}') goto yy237;
-			goto yy229;
+			if (yych == '}') goto yy248;
+			goto yy240;
 		}
 	}
-yy227:
+yy238:
 	++YYCURSOR;
-#line 470 "../src/parse/lex.re"
+#line 486 "../src/parse/lex.re"
 	{
 					if (cur == eof)
 					{
@@ -1527,35 +1584,35 @@ yy227:
 					}
 					goto code;
 				}
-#line 1531 "src/parse/lex.cc"
-yy229:
+#line 1588 "src/parse/lex.cc"
+yy240:
 	++YYCURSOR;
-yy230:
-#line 484 "../src/parse/lex.re"
+yy241:
+#line 500 "../src/parse/lex.re"
 	{
 					goto code;
 				}
-#line 1539 "src/parse/lex.cc"
-yy231:
+#line 1596 "src/parse/lex.cc"
+yy242:
 	yyaccept = 0;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	YYCTXMARKER = YYCURSOR;
 	if (yych <= '\r') {
 		if (yych <= '\t') {
-			if (yych >= '\t') goto yy239;
+			if (yych >= '\t') goto yy250;
 		} else {
-			if (yych <= '\n') goto yy241;
-			if (yych >= '\r') goto yy241;
+			if (yych <= '\n') goto yy252;
+			if (yych >= '\r') goto yy252;
 		}
 	} else {
 		if (yych <= ' ') {
-			if (yych >= ' ') goto yy239;
+			if (yych >= ' ') goto yy250;
 		} else {
-			if (yych == '#') goto yy242;
+			if (yych == '#') goto yy253;
 		}
 	}
-yy232:
-#line 451 "../src/parse/lex.re"
+yy243:
+#line 467 "../src/parse/lex.re"
 	{
 					if (depth == 0)
 					{
@@ -1575,20 +1632,20 @@ yy232:
 					cline++;
 					goto code;
 				}
-#line 1579 "src/parse/lex.cc"
-yy233:
+#line 1636 "src/parse/lex.cc"
+yy244:
 	yyaccept = 1;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == '\n') goto yy230;
-	goto yy246;
-yy234:
+	if (yych == '\n') goto yy241;
+	goto yy257;
+yy245:
 	yyaccept = 1;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == '\n') goto yy230;
-	goto yy251;
-yy235:
+	if (yych == '\n') goto yy241;
+	goto yy262;
+yy246:
 	++YYCURSOR;
-#line 423 "../src/parse/lex.re"
+#line 439 "../src/parse/lex.re"
 	{
 					if (depth == 0)
 					{
@@ -1600,10 +1657,10 @@ yy235:
 					}
 					goto code;
 				}
-#line 1604 "src/parse/lex.cc"
-yy237:
+#line 1661 "src/parse/lex.cc"
+yy248:
 	++YYCURSOR;
-#line 411 "../src/parse/lex.re"
+#line 427 "../src/parse/lex.re"
 	{
 					if (depth == 0)
 					{
@@ -1616,19 +1673,19 @@ yy237:
 					}
 					goto code;
 				}
-#line 1620 "src/parse/lex.cc"
-yy239:
+#line 1677 "src/parse/lex.cc"
+yy250:
 	yyaccept = 2;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy253;
+		if (yych == '\t') goto yy264;
 	} else {
-		if (yych <= ' ') goto yy253;
-		if (yych == '#') goto yy242;
+		if (yych <= ' ') goto yy264;
+		if (yych == '#') goto yy253;
 	}
-yy240:
+yy251:
 	YYCURSOR = YYCTXMARKER;
-#line 438 "../src/parse/lex.re"
+#line 454 "../src/parse/lex.re"
 	{
 					if (depth == 0)
 					{
@@ -1642,175 +1699,175 @@ yy240:
 					cline++;
 					goto code;
 				}
-#line 1646 "src/parse/lex.cc"
-yy241:
+#line 1703 "src/parse/lex.cc"
+yy252:
 	yych = (YYCTYPE)*++YYCURSOR;
-	goto yy240;
-yy242:
+	goto yy251;
+yy253:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 5) YYFILL(5);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 16) {
-		goto yy242;
+		goto yy253;
 	}
-	if (yych == 'l') goto yy255;
-yy244:
+	if (yych == 'l') goto yy266;
+yy255:
 	YYCURSOR = YYMARKER;
 	if (yyaccept <= 1) {
 		if (yyaccept == 0) {
-			goto yy232;
+			goto yy243;
 		} else {
-			goto yy230;
+			goto yy241;
 		}
 	} else {
-		goto yy240;
+		goto yy251;
 	}
-yy245:
+yy256:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-yy246:
+yy257:
 	if (yybm[0+yych] & 32) {
-		goto yy245;
+		goto yy256;
 	}
-	if (yych <= '\n') goto yy244;
-	if (yych >= '#') goto yy249;
-yy247:
+	if (yych <= '\n') goto yy255;
+	if (yych >= '#') goto yy260;
+yy258:
 	++YYCURSOR;
-#line 481 "../src/parse/lex.re"
+#line 497 "../src/parse/lex.re"
 	{
 					goto code;
 				}
-#line 1685 "src/parse/lex.cc"
-yy249:
+#line 1742 "src/parse/lex.cc"
+yy260:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == '\n') goto yy244;
-	goto yy245;
-yy250:
+	if (yych == '\n') goto yy255;
+	goto yy256;
+yy261:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-yy251:
+yy262:
 	if (yybm[0+yych] & 64) {
-		goto yy250;
+		goto yy261;
 	}
-	if (yych <= '\n') goto yy244;
-	if (yych <= '\'') goto yy247;
+	if (yych <= '\n') goto yy255;
+	if (yych <= '\'') goto yy258;
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == '\n') goto yy244;
-	goto yy250;
-yy253:
+	if (yych == '\n') goto yy255;
+	goto yy261;
+yy264:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy253;
-		goto yy244;
+		if (yych == '\t') goto yy264;
+		goto yy255;
 	} else {
-		if (yych <= ' ') goto yy253;
-		if (yych == '#') goto yy242;
-		goto yy244;
+		if (yych <= ' ') goto yy264;
+		if (yych == '#') goto yy253;
+		goto yy255;
 	}
-yy255:
+yy266:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych != 'i') goto yy244;
+	if (yych != 'i') goto yy255;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych != 'n') goto yy244;
+	if (yych != 'n') goto yy255;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych != 'e') goto yy244;
+	if (yych != 'e') goto yy255;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= '0') goto yy260;
-	if (yych <= '9') goto yy244;
-	goto yy260;
-yy259:
+	if (yych <= '0') goto yy271;
+	if (yych <= '9') goto yy255;
+	goto yy271;
+yy270:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-yy260:
+yy271:
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy259;
-		goto yy244;
+		if (yych == '\t') goto yy270;
+		goto yy255;
 	} else {
-		if (yych <= ' ') goto yy259;
-		if (yych <= '0') goto yy244;
-		if (yych >= ':') goto yy244;
+		if (yych <= ' ') goto yy270;
+		if (yych <= '0') goto yy255;
+		if (yych >= ':') goto yy255;
 	}
-yy261:
+yy272:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 128) {
-		goto yy261;
+		goto yy272;
 	}
 	if (yych <= '\f') {
-		if (yych <= 0x08) goto yy244;
-		if (yych <= '\t') goto yy263;
-		if (yych <= '\n') goto yy265;
-		goto yy244;
+		if (yych <= 0x08) goto yy255;
+		if (yych <= '\t') goto yy274;
+		if (yych <= '\n') goto yy276;
+		goto yy255;
 	} else {
-		if (yych <= '\r') goto yy267;
-		if (yych != ' ') goto yy244;
+		if (yych <= '\r') goto yy278;
+		if (yych != ' ') goto yy255;
 	}
-yy263:
+yy274:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy263;
-		goto yy244;
+		if (yych == '\t') goto yy274;
+		goto yy255;
 	} else {
-		if (yych <= ' ') goto yy263;
-		if (yych == '"') goto yy268;
-		goto yy244;
+		if (yych <= ' ') goto yy274;
+		if (yych == '"') goto yy279;
+		goto yy255;
 	}
-yy265:
+yy276:
 	++YYCURSOR;
 	YYCURSOR = YYCTXMARKER;
-#line 434 "../src/parse/lex.re"
+#line 450 "../src/parse/lex.re"
 	{
 					set_sourceline ();
 					goto code;
 				}
-#line 1780 "src/parse/lex.cc"
-yy267:
+#line 1837 "src/parse/lex.cc"
+yy278:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy265;
-	goto yy244;
-yy268:
+	if (yych == '\n') goto yy276;
+	goto yy255;
+yy279:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 3) YYFILL(3);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= '!') {
-		if (yych == '\n') goto yy244;
-		goto yy268;
+		if (yych == '\n') goto yy255;
+		goto yy279;
 	} else {
-		if (yych <= '"') goto yy270;
-		if (yych == '\\') goto yy271;
-		goto yy268;
+		if (yych <= '"') goto yy281;
+		if (yych == '\\') goto yy282;
+		goto yy279;
 	}
-yy270:
+yy281:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy265;
-	if (yych == '\r') goto yy267;
-	goto yy244;
-yy271:
+	if (yych == '\n') goto yy276;
+	if (yych == '\r') goto yy278;
+	goto yy255;
+yy282:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == '\n') goto yy244;
-	goto yy268;
+	if (yych == '\n') goto yy255;
+	goto yy279;
 }
-#line 487 "../src/parse/lex.re"
+#line 503 "../src/parse/lex.re"
 
 
 comment:
 
-#line 1814 "src/parse/lex.cc"
+#line 1871 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	static const unsigned char yybm[] = {
@@ -1850,14 +1907,14 @@ comment:
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= ')') {
-		if (yych == '\n') goto yy276;
+		if (yych == '\n') goto yy287;
 	} else {
-		if (yych <= '*') goto yy278;
-		if (yych == '/') goto yy279;
+		if (yych <= '*') goto yy289;
+		if (yych == '/') goto yy290;
 	}
 	++YYCURSOR;
-yy275:
-#line 519 "../src/parse/lex.re"
+yy286:
+#line 535 "../src/parse/lex.re"
 	{
 					if (cur == eof)
 					{
@@ -1865,15 +1922,15 @@ yy275:
 					}
 					goto comment;
 				}
-#line 1869 "src/parse/lex.cc"
-yy276:
+#line 1926 "src/parse/lex.cc"
+yy287:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yybm[0+yych] & 32) {
-		goto yy280;
+		goto yy291;
 	}
-	if (yych == '#') goto yy283;
-yy277:
-#line 510 "../src/parse/lex.re"
+	if (yych == '#') goto yy294;
+yy288:
+#line 526 "../src/parse/lex.re"
 	{
 					if (cur == eof)
 					{
@@ -1883,41 +1940,41 @@ yy277:
 					cline++;
 					goto comment;
 				}
-#line 1887 "src/parse/lex.cc"
-yy278:
+#line 1944 "src/parse/lex.cc"
+yy289:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '/') goto yy285;
-	goto yy275;
-yy279:
+	if (yych == '/') goto yy296;
+	goto yy286;
+yy290:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '*') goto yy287;
-	goto yy275;
-yy280:
+	if (yych == '*') goto yy298;
+	goto yy286;
+yy291:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 32) {
-		goto yy280;
+		goto yy291;
 	}
-	if (yych == '#') goto yy283;
-yy282:
+	if (yych == '#') goto yy294;
+yy293:
 	YYCURSOR = YYMARKER;
-	goto yy277;
-yy283:
+	goto yy288;
+yy294:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 5) YYFILL(5);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy283;
-		goto yy282;
+		if (yych == '\t') goto yy294;
+		goto yy293;
 	} else {
-		if (yych <= ' ') goto yy283;
-		if (yych == 'l') goto yy289;
-		goto yy282;
+		if (yych <= ' ') goto yy294;
+		if (yych == 'l') goto yy300;
+		goto yy293;
 	}
-yy285:
+yy296:
 	++YYCURSOR;
-#line 491 "../src/parse/lex.re"
+#line 507 "../src/parse/lex.re"
 	{
 					if (--depth == 0)
 					{
@@ -1928,124 +1985,124 @@ yy285:
 						goto comment;
 					}
 				}
-#line 1932 "src/parse/lex.cc"
-yy287:
+#line 1989 "src/parse/lex.cc"
+yy298:
 	++YYCURSOR;
-#line 501 "../src/parse/lex.re"
+#line 517 "../src/parse/lex.re"
 	{
 					++depth;
 					fatal("ambiguous /* found");
 					goto comment;
 				}
-#line 1941 "src/parse/lex.cc"
-yy289:
+#line 1998 "src/parse/lex.cc"
+yy300:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych != 'i') goto yy282;
+	if (yych != 'i') goto yy293;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych != 'n') goto yy282;
+	if (yych != 'n') goto yy293;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych != 'e') goto yy282;
+	if (yych != 'e') goto yy293;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= '0') goto yy294;
-	if (yych <= '9') goto yy282;
-	goto yy294;
-yy293:
+	if (yych <= '0') goto yy305;
+	if (yych <= '9') goto yy293;
+	goto yy305;
+yy304:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-yy294:
+yy305:
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy293;
-		goto yy282;
+		if (yych == '\t') goto yy304;
+		goto yy293;
 	} else {
-		if (yych <= ' ') goto yy293;
-		if (yych <= '0') goto yy282;
-		if (yych >= ':') goto yy282;
+		if (yych <= ' ') goto yy304;
+		if (yych <= '0') goto yy293;
+		if (yych >= ':') goto yy293;
 	}
-yy295:
+yy306:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 64) {
-		goto yy295;
+		goto yy306;
 	}
 	if (yych <= '\f') {
-		if (yych <= 0x08) goto yy282;
-		if (yych <= '\t') goto yy297;
-		if (yych <= '\n') goto yy299;
-		goto yy282;
+		if (yych <= 0x08) goto yy293;
+		if (yych <= '\t') goto yy308;
+		if (yych <= '\n') goto yy310;
+		goto yy293;
 	} else {
-		if (yych <= '\r') goto yy301;
-		if (yych != ' ') goto yy282;
+		if (yych <= '\r') goto yy312;
+		if (yych != ' ') goto yy293;
 	}
-yy297:
+yy308:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy297;
-		goto yy282;
+		if (yych == '\t') goto yy308;
+		goto yy293;
 	} else {
-		if (yych <= ' ') goto yy297;
-		if (yych == '"') goto yy302;
-		goto yy282;
+		if (yych <= ' ') goto yy308;
+		if (yych == '"') goto yy313;
+		goto yy293;
 	}
-yy299:
+yy310:
 	++YYCURSOR;
 	YYCURSOR = YYCTXMARKER;
-#line 506 "../src/parse/lex.re"
+#line 522 "../src/parse/lex.re"
 	{
 					set_sourceline ();
 					goto comment;
 				}
-#line 2003 "src/parse/lex.cc"
-yy301:
+#line 2060 "src/parse/lex.cc"
+yy312:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy299;
-	goto yy282;
-yy302:
+	if (yych == '\n') goto yy310;
+	goto yy293;
+yy313:
 	++YYCURSOR;
 	if ((YYLIMIT - YYCURSOR) < 3) YYFILL(3);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 128) {
-		goto yy302;
+		goto yy313;
 	}
-	if (yych <= '\n') goto yy282;
-	if (yych >= '#') goto yy305;
+	if (yych <= '\n') goto yy293;
+	if (yych >= '#') goto yy316;
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy299;
-	if (yych == '\r') goto yy301;
-	goto yy282;
-yy305:
+	if (yych == '\n') goto yy310;
+	if (yych == '\r') goto yy312;
+	goto yy293;
+yy316:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == '\n') goto yy282;
-	goto yy302;
+	if (yych == '\n') goto yy293;
+	goto yy313;
 }
-#line 526 "../src/parse/lex.re"
+#line 542 "../src/parse/lex.re"
 
 
 nextLine:
 
-#line 2033 "src/parse/lex.cc"
+#line 2090 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == '\n') goto yy310;
+	if (yych == '\n') goto yy321;
 	++YYCURSOR;
-#line 537 "../src/parse/lex.re"
+#line 553 "../src/parse/lex.re"
 	{  if(cur == eof) {
                   return 0;
                }
                goto nextLine;
             }
-#line 2046 "src/parse/lex.cc"
-yy310:
+#line 2103 "src/parse/lex.cc"
+yy321:
 	++YYCURSOR;
-#line 530 "../src/parse/lex.re"
+#line 546 "../src/parse/lex.re"
 	{ if(cur == eof) {
                   return 0;
                }
@@ -2053,9 +2110,9 @@ yy310:
                cline++;
                goto scan;
             }
-#line 2057 "src/parse/lex.cc"
+#line 2114 "src/parse/lex.cc"
 }
-#line 542 "../src/parse/lex.re"
+#line 558 "../src/parse/lex.re"
 
 }
 
@@ -2079,45 +2136,45 @@ RegExp *Scanner::lex_cls(bool neg)
 	uint32_t u, l;
 fst:
 	
-#line 2083 "src/parse/lex.cc"
+#line 2140 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == ']') goto yy315;
-#line 566 "../src/parse/lex.re"
+	if (yych == ']') goto yy326;
+#line 582 "../src/parse/lex.re"
 	{ l = lex_cls_chr(); goto snd; }
-#line 2091 "src/parse/lex.cc"
-yy315:
+#line 2148 "src/parse/lex.cc"
+yy326:
 	++YYCURSOR;
-#line 565 "../src/parse/lex.re"
+#line 581 "../src/parse/lex.re"
 	{ goto end; }
-#line 2096 "src/parse/lex.cc"
+#line 2153 "src/parse/lex.cc"
 }
-#line 567 "../src/parse/lex.re"
+#line 583 "../src/parse/lex.re"
 
 snd:
 	
-#line 2102 "src/parse/lex.cc"
+#line 2159 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*(YYMARKER = YYCURSOR);
-	if (yych == '-') goto yy320;
-yy319:
-#line 570 "../src/parse/lex.re"
+	if (yych == '-') goto yy331;
+yy330:
+#line 586 "../src/parse/lex.re"
 	{ u = l; goto add; }
-#line 2111 "src/parse/lex.cc"
-yy320:
+#line 2168 "src/parse/lex.cc"
+yy331:
 	yych = (YYCTYPE)*++YYCURSOR;
 	YYCTXMARKER = YYCURSOR;
-	if (yych != ']') goto yy322;
+	if (yych != ']') goto yy333;
 	YYCURSOR = YYMARKER;
-	goto yy319;
-yy322:
+	goto yy330;
+yy333:
 	++YYCURSOR;
 	YYCURSOR = YYCTXMARKER;
-#line 571 "../src/parse/lex.re"
+#line 587 "../src/parse/lex.re"
 	{
 			u = lex_cls_chr();
 			if (l > u) {
@@ -2126,9 +2183,9 @@ yy322:
 			}
 			goto add;
 		}
-#line 2130 "src/parse/lex.cc"
+#line 2187 "src/parse/lex.cc"
 }
-#line 579 "../src/parse/lex.re"
+#line 595 "../src/parse/lex.re"
 
 add:
 	if (!(s = opts->encoding.encodeRange(l, u))) {
@@ -2147,306 +2204,306 @@ uint32_t Scanner::lex_cls_chr()
 {
 	tok = cur;
 	
-#line 2151 "src/parse/lex.cc"
+#line 2208 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	unsigned int yyaccept = 0;
 	if ((YYLIMIT - YYCURSOR) < 10) YYFILL(10);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= '\f') {
-		if (yych == '\n') goto yy328;
+		if (yych == '\n') goto yy339;
 	} else {
-		if (yych <= '\r') goto yy330;
-		if (yych == '\\') goto yy331;
+		if (yych <= '\r') goto yy341;
+		if (yych == '\\') goto yy342;
 	}
 	++YYCURSOR;
-yy327:
-#line 603 "../src/parse/lex.re"
+yy338:
+#line 619 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>(tok[0]); }
-#line 2167 "src/parse/lex.cc"
-yy328:
+#line 2224 "src/parse/lex.cc"
+yy339:
 	++YYCURSOR;
-#line 598 "../src/parse/lex.re"
+#line 614 "../src/parse/lex.re"
 	{ fatal ((tok - pos) - tchar, "newline in character class"); }
-#line 2172 "src/parse/lex.cc"
-yy330:
+#line 2229 "src/parse/lex.cc"
+yy341:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy328;
-	goto yy327;
-yy331:
+	if (yych == '\n') goto yy339;
+	goto yy338;
+yy342:
 	++YYCURSOR;
 	if ((yych = (YYCTYPE)*YYCURSOR) <= ']') {
 		if (yych <= '3') {
 			if (yych <= '\r') {
-				if (yych == '\n') goto yy328;
-				if (yych <= '\f') goto yy333;
-				goto yy335;
+				if (yych == '\n') goto yy339;
+				if (yych <= '\f') goto yy344;
+				goto yy346;
 			} else {
-				if (yych == '-') goto yy336;
-				if (yych <= '/') goto yy333;
-				goto yy338;
+				if (yych == '-') goto yy347;
+				if (yych <= '/') goto yy344;
+				goto yy349;
 			}
 		} else {
 			if (yych <= 'W') {
-				if (yych <= '7') goto yy340;
-				if (yych == 'U') goto yy341;
-				goto yy333;
+				if (yych <= '7') goto yy351;
+				if (yych == 'U') goto yy352;
+				goto yy344;
 			} else {
-				if (yych <= 'X') goto yy343;
-				if (yych <= '[') goto yy333;
-				if (yych <= '\\') goto yy344;
-				goto yy346;
+				if (yych <= 'X') goto yy354;
+				if (yych <= '[') goto yy344;
+				if (yych <= '\\') goto yy355;
+				goto yy357;
 			}
 		}
 	} else {
 		if (yych <= 'q') {
 			if (yych <= 'e') {
-				if (yych <= '`') goto yy333;
-				if (yych <= 'a') goto yy348;
-				if (yych <= 'b') goto yy350;
-				goto yy333;
+				if (yych <= '`') goto yy344;
+				if (yych <= 'a') goto yy359;
+				if (yych <= 'b') goto yy361;
+				goto yy344;
 			} else {
-				if (yych <= 'f') goto yy352;
-				if (yych == 'n') goto yy354;
-				goto yy333;
+				if (yych <= 'f') goto yy363;
+				if (yych == 'n') goto yy365;
+				goto yy344;
 			}
 		} else {
 			if (yych <= 'u') {
-				if (yych <= 'r') goto yy356;
-				if (yych <= 's') goto yy333;
-				if (yych <= 't') goto yy358;
-				goto yy343;
+				if (yych <= 'r') goto yy367;
+				if (yych <= 's') goto yy344;
+				if (yych <= 't') goto yy369;
+				goto yy354;
 			} else {
-				if (yych <= 'v') goto yy360;
-				if (yych == 'x') goto yy362;
-				goto yy333;
+				if (yych <= 'v') goto yy371;
+				if (yych == 'x') goto yy373;
+				goto yy344;
 			}
 		}
 	}
-#line 601 "../src/parse/lex.re"
+#line 617 "../src/parse/lex.re"
 	{ fatal ((tok - pos) - tchar, "syntax error in escape sequence"); }
-#line 2229 "src/parse/lex.cc"
-yy333:
+#line 2286 "src/parse/lex.cc"
+yy344:
 	++YYCURSOR;
-yy334:
-#line 616 "../src/parse/lex.re"
+yy345:
+#line 632 "../src/parse/lex.re"
 	{
 			warn.useless_escape(tline, tok - pos, tok[1]);
 			return static_cast<uint8_t>(tok[1]);
 		}
-#line 2238 "src/parse/lex.cc"
-yy335:
+#line 2295 "src/parse/lex.cc"
+yy346:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy328;
-	goto yy334;
-yy336:
+	if (yych == '\n') goto yy339;
+	goto yy345;
+yy347:
 	++YYCURSOR;
-#line 614 "../src/parse/lex.re"
+#line 630 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('-'); }
-#line 2247 "src/parse/lex.cc"
-yy338:
+#line 2304 "src/parse/lex.cc"
+yy349:
 	yyaccept = 0;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych <= '/') goto yy339;
-	if (yych <= '7') goto yy363;
-yy339:
-#line 600 "../src/parse/lex.re"
+	if (yych <= '/') goto yy350;
+	if (yych <= '7') goto yy374;
+yy350:
+#line 616 "../src/parse/lex.re"
 	{ fatal ((tok - pos) - tchar, "syntax error in octal escape sequence"); }
-#line 2256 "src/parse/lex.cc"
-yy340:
+#line 2313 "src/parse/lex.cc"
+yy351:
 	yych = (YYCTYPE)*++YYCURSOR;
-	goto yy339;
-yy341:
+	goto yy350;
+yy352:
 	yyaccept = 1;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy342;
-		if (yych <= '9') goto yy365;
+		if (yych <= '/') goto yy353;
+		if (yych <= '9') goto yy376;
 	} else {
-		if (yych <= 'F') goto yy365;
-		if (yych <= '`') goto yy342;
-		if (yych <= 'f') goto yy365;
+		if (yych <= 'F') goto yy376;
+		if (yych <= '`') goto yy353;
+		if (yych <= 'f') goto yy376;
 	}
-yy342:
-#line 599 "../src/parse/lex.re"
+yy353:
+#line 615 "../src/parse/lex.re"
 	{ fatal ((tok - pos) - tchar, "syntax error in hexadecimal escape sequence"); }
-#line 2274 "src/parse/lex.cc"
-yy343:
+#line 2331 "src/parse/lex.cc"
+yy354:
 	yyaccept = 1;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy342;
-		if (yych <= '9') goto yy366;
-		goto yy342;
+		if (yych <= '/') goto yy353;
+		if (yych <= '9') goto yy377;
+		goto yy353;
 	} else {
-		if (yych <= 'F') goto yy366;
-		if (yych <= '`') goto yy342;
-		if (yych <= 'f') goto yy366;
-		goto yy342;
+		if (yych <= 'F') goto yy377;
+		if (yych <= '`') goto yy353;
+		if (yych <= 'f') goto yy377;
+		goto yy353;
 	}
-yy344:
+yy355:
 	++YYCURSOR;
-#line 613 "../src/parse/lex.re"
+#line 629 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\\'); }
-#line 2292 "src/parse/lex.cc"
-yy346:
+#line 2349 "src/parse/lex.cc"
+yy357:
 	++YYCURSOR;
-#line 615 "../src/parse/lex.re"
+#line 631 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>(']'); }
-#line 2297 "src/parse/lex.cc"
-yy348:
+#line 2354 "src/parse/lex.cc"
+yy359:
 	++YYCURSOR;
-#line 606 "../src/parse/lex.re"
+#line 622 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\a'); }
-#line 2302 "src/parse/lex.cc"
-yy350:
+#line 2359 "src/parse/lex.cc"
+yy361:
 	++YYCURSOR;
-#line 607 "../src/parse/lex.re"
+#line 623 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\b'); }
-#line 2307 "src/parse/lex.cc"
-yy352:
+#line 2364 "src/parse/lex.cc"
+yy363:
 	++YYCURSOR;
-#line 608 "../src/parse/lex.re"
+#line 624 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\f'); }
-#line 2312 "src/parse/lex.cc"
-yy354:
+#line 2369 "src/parse/lex.cc"
+yy365:
 	++YYCURSOR;
-#line 609 "../src/parse/lex.re"
+#line 625 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\n'); }
-#line 2317 "src/parse/lex.cc"
-yy356:
+#line 2374 "src/parse/lex.cc"
+yy367:
 	++YYCURSOR;
-#line 610 "../src/parse/lex.re"
+#line 626 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\r'); }
-#line 2322 "src/parse/lex.cc"
-yy358:
+#line 2379 "src/parse/lex.cc"
+yy369:
 	++YYCURSOR;
-#line 611 "../src/parse/lex.re"
+#line 627 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\t'); }
-#line 2327 "src/parse/lex.cc"
-yy360:
+#line 2384 "src/parse/lex.cc"
+yy371:
 	++YYCURSOR;
-#line 612 "../src/parse/lex.re"
+#line 628 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\v'); }
-#line 2332 "src/parse/lex.cc"
-yy362:
+#line 2389 "src/parse/lex.cc"
+yy373:
 	yyaccept = 1;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy342;
-		if (yych <= '9') goto yy367;
-		goto yy342;
+		if (yych <= '/') goto yy353;
+		if (yych <= '9') goto yy378;
+		goto yy353;
 	} else {
-		if (yych <= 'F') goto yy367;
-		if (yych <= '`') goto yy342;
-		if (yych <= 'f') goto yy367;
-		goto yy342;
+		if (yych <= 'F') goto yy378;
+		if (yych <= '`') goto yy353;
+		if (yych <= 'f') goto yy378;
+		goto yy353;
 	}
-yy363:
+yy374:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= '/') goto yy364;
-	if (yych <= '7') goto yy368;
-yy364:
+	if (yych <= '/') goto yy375;
+	if (yych <= '7') goto yy379;
+yy375:
 	YYCURSOR = YYMARKER;
 	if (yyaccept == 0) {
-		goto yy339;
+		goto yy350;
 	} else {
-		goto yy342;
+		goto yy353;
 	}
-yy365:
+yy376:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy364;
-		if (yych <= '9') goto yy370;
-		goto yy364;
+		if (yych <= '/') goto yy375;
+		if (yych <= '9') goto yy381;
+		goto yy375;
 	} else {
-		if (yych <= 'F') goto yy370;
-		if (yych <= '`') goto yy364;
-		if (yych <= 'f') goto yy370;
-		goto yy364;
+		if (yych <= 'F') goto yy381;
+		if (yych <= '`') goto yy375;
+		if (yych <= 'f') goto yy381;
+		goto yy375;
 	}
-yy366:
+yy377:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy364;
-		if (yych <= '9') goto yy371;
-		goto yy364;
+		if (yych <= '/') goto yy375;
+		if (yych <= '9') goto yy382;
+		goto yy375;
 	} else {
-		if (yych <= 'F') goto yy371;
-		if (yych <= '`') goto yy364;
-		if (yych <= 'f') goto yy371;
-		goto yy364;
+		if (yych <= 'F') goto yy382;
+		if (yych <= '`') goto yy375;
+		if (yych <= 'f') goto yy382;
+		goto yy375;
 	}
-yy367:
+yy378:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy364;
-		if (yych <= '9') goto yy372;
-		goto yy364;
+		if (yych <= '/') goto yy375;
+		if (yych <= '9') goto yy383;
+		goto yy375;
 	} else {
-		if (yych <= 'F') goto yy372;
-		if (yych <= '`') goto yy364;
-		if (yych <= 'f') goto yy372;
-		goto yy364;
+		if (yych <= 'F') goto yy383;
+		if (yych <= '`') goto yy375;
+		if (yych <= 'f') goto yy383;
+		goto yy375;
 	}
-yy368:
+yy379:
 	++YYCURSOR;
-#line 605 "../src/parse/lex.re"
+#line 621 "../src/parse/lex.re"
 	{ return unesc_oct(tok, cur); }
-#line 2397 "src/parse/lex.cc"
-yy370:
+#line 2454 "src/parse/lex.cc"
+yy381:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy364;
-		if (yych <= '9') goto yy374;
-		goto yy364;
+		if (yych <= '/') goto yy375;
+		if (yych <= '9') goto yy385;
+		goto yy375;
 	} else {
-		if (yych <= 'F') goto yy374;
-		if (yych <= '`') goto yy364;
-		if (yych <= 'f') goto yy374;
-		goto yy364;
+		if (yych <= 'F') goto yy385;
+		if (yych <= '`') goto yy375;
+		if (yych <= 'f') goto yy385;
+		goto yy375;
 	}
-yy371:
+yy382:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy364;
-		if (yych <= '9') goto yy367;
-		goto yy364;
+		if (yych <= '/') goto yy375;
+		if (yych <= '9') goto yy378;
+		goto yy375;
 	} else {
-		if (yych <= 'F') goto yy367;
-		if (yych <= '`') goto yy364;
-		if (yych <= 'f') goto yy367;
-		goto yy364;
+		if (yych <= 'F') goto yy378;
+		if (yych <= '`') goto yy375;
+		if (yych <= 'f') goto yy378;
+		goto yy375;
 	}
-yy372:
+yy383:
 	++YYCURSOR;
-#line 604 "../src/parse/lex.re"
+#line 620 "../src/parse/lex.re"
 	{ return unesc_hex(tok, cur); }
-#line 2426 "src/parse/lex.cc"
-yy374:
+#line 2483 "src/parse/lex.cc"
+yy385:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy364;
-		if (yych >= ':') goto yy364;
+		if (yych <= '/') goto yy375;
+		if (yych >= ':') goto yy375;
 	} else {
-		if (yych <= 'F') goto yy375;
-		if (yych <= '`') goto yy364;
-		if (yych >= 'g') goto yy364;
+		if (yych <= 'F') goto yy386;
+		if (yych <= '`') goto yy375;
+		if (yych >= 'g') goto yy375;
 	}
-yy375:
+yy386:
 	++YYCURSOR;
 	if ((yych = (YYCTYPE)*YYCURSOR) <= '@') {
-		if (yych <= '/') goto yy364;
-		if (yych <= '9') goto yy366;
-		goto yy364;
+		if (yych <= '/') goto yy375;
+		if (yych <= '9') goto yy377;
+		goto yy375;
 	} else {
-		if (yych <= 'F') goto yy366;
-		if (yych <= '`') goto yy364;
-		if (yych <= 'f') goto yy366;
-		goto yy364;
+		if (yych <= 'F') goto yy377;
+		if (yych <= '`') goto yy375;
+		if (yych <= 'f') goto yy377;
+		goto yy375;
 	}
 }
-#line 620 "../src/parse/lex.re"
+#line 636 "../src/parse/lex.re"
 
 }
 
@@ -2455,298 +2512,298 @@ uint32_t Scanner::lex_str_chr(char quote, bool &end)
 	end = false;
 	tok = cur;
 	
-#line 2459 "src/parse/lex.cc"
+#line 2516 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	unsigned int yyaccept = 0;
 	if ((YYLIMIT - YYCURSOR) < 10) YYFILL(10);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= '\f') {
-		if (yych == '\n') goto yy380;
+		if (yych == '\n') goto yy391;
 	} else {
-		if (yych <= '\r') goto yy382;
-		if (yych == '\\') goto yy383;
+		if (yych <= '\r') goto yy393;
+		if (yych == '\\') goto yy394;
 	}
 	++YYCURSOR;
-yy379:
-#line 634 "../src/parse/lex.re"
+yy390:
+#line 650 "../src/parse/lex.re"
 	{
 			end = tok[0] == quote;
 			return static_cast<uint8_t>(tok[0]);
 		}
-#line 2478 "src/parse/lex.cc"
-yy380:
+#line 2535 "src/parse/lex.cc"
+yy391:
 	++YYCURSOR;
-#line 629 "../src/parse/lex.re"
+#line 645 "../src/parse/lex.re"
 	{ fatal ((tok - pos) - tchar, "newline in character string"); }
-#line 2483 "src/parse/lex.cc"
-yy382:
+#line 2540 "src/parse/lex.cc"
+yy393:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy380;
-	goto yy379;
-yy383:
+	if (yych == '\n') goto yy391;
+	goto yy390;
+yy394:
 	++YYCURSOR;
 	if ((yych = (YYCTYPE)*YYCURSOR) <= '`') {
 		if (yych <= '7') {
 			if (yych <= '\f') {
-				if (yych == '\n') goto yy380;
-				goto yy385;
+				if (yych == '\n') goto yy391;
+				goto yy396;
 			} else {
-				if (yych <= '\r') goto yy387;
-				if (yych <= '/') goto yy385;
-				if (yych <= '3') goto yy388;
-				goto yy390;
+				if (yych <= '\r') goto yy398;
+				if (yych <= '/') goto yy396;
+				if (yych <= '3') goto yy399;
+				goto yy401;
 			}
 		} else {
 			if (yych <= 'W') {
-				if (yych == 'U') goto yy391;
-				goto yy385;
+				if (yych == 'U') goto yy402;
+				goto yy396;
 			} else {
-				if (yych <= 'X') goto yy393;
-				if (yych == '\\') goto yy394;
-				goto yy385;
+				if (yych <= 'X') goto yy404;
+				if (yych == '\\') goto yy405;
+				goto yy396;
 			}
 		}
 	} else {
 		if (yych <= 'q') {
 			if (yych <= 'e') {
-				if (yych <= 'a') goto yy396;
-				if (yych <= 'b') goto yy398;
-				goto yy385;
+				if (yych <= 'a') goto yy407;
+				if (yych <= 'b') goto yy409;
+				goto yy396;
 			} else {
-				if (yych <= 'f') goto yy400;
-				if (yych == 'n') goto yy402;
-				goto yy385;
+				if (yych <= 'f') goto yy411;
+				if (yych == 'n') goto yy413;
+				goto yy396;
 			}
 		} else {
 			if (yych <= 'u') {
-				if (yych <= 'r') goto yy404;
-				if (yych <= 's') goto yy385;
-				if (yych <= 't') goto yy406;
-				goto yy393;
+				if (yych <= 'r') goto yy415;
+				if (yych <= 's') goto yy396;
+				if (yych <= 't') goto yy417;
+				goto yy404;
 			} else {
-				if (yych <= 'v') goto yy408;
-				if (yych == 'x') goto yy410;
-				goto yy385;
+				if (yych <= 'v') goto yy419;
+				if (yych == 'x') goto yy421;
+				goto yy396;
 			}
 		}
 	}
-#line 632 "../src/parse/lex.re"
+#line 648 "../src/parse/lex.re"
 	{ fatal ((tok - pos) - tchar, "syntax error in escape sequence"); }
-#line 2537 "src/parse/lex.cc"
-yy385:
+#line 2594 "src/parse/lex.cc"
+yy396:
 	++YYCURSOR;
-yy386:
-#line 648 "../src/parse/lex.re"
+yy397:
+#line 664 "../src/parse/lex.re"
 	{
 			if (tok[1] != quote) {
 				warn.useless_escape(tline, tok - pos, tok[1]);
 			}
 			return static_cast<uint8_t>(tok[1]);
 		}
-#line 2548 "src/parse/lex.cc"
-yy387:
+#line 2605 "src/parse/lex.cc"
+yy398:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych == '\n') goto yy380;
-	goto yy386;
-yy388:
+	if (yych == '\n') goto yy391;
+	goto yy397;
+yy399:
 	yyaccept = 0;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych <= '/') goto yy389;
-	if (yych <= '7') goto yy411;
-yy389:
-#line 631 "../src/parse/lex.re"
+	if (yych <= '/') goto yy400;
+	if (yych <= '7') goto yy422;
+yy400:
+#line 647 "../src/parse/lex.re"
 	{ fatal ((tok - pos) - tchar, "syntax error in octal escape sequence"); }
-#line 2561 "src/parse/lex.cc"
-yy390:
+#line 2618 "src/parse/lex.cc"
+yy401:
 	yych = (YYCTYPE)*++YYCURSOR;
-	goto yy389;
-yy391:
+	goto yy400;
+yy402:
 	yyaccept = 1;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy392;
-		if (yych <= '9') goto yy413;
+		if (yych <= '/') goto yy403;
+		if (yych <= '9') goto yy424;
 	} else {
-		if (yych <= 'F') goto yy413;
-		if (yych <= '`') goto yy392;
-		if (yych <= 'f') goto yy413;
+		if (yych <= 'F') goto yy424;
+		if (yych <= '`') goto yy403;
+		if (yych <= 'f') goto yy424;
 	}
-yy392:
-#line 630 "../src/parse/lex.re"
+yy403:
+#line 646 "../src/parse/lex.re"
 	{ fatal ((tok - pos) - tchar, "syntax error in hexadecimal escape sequence"); }
-#line 2579 "src/parse/lex.cc"
-yy393:
+#line 2636 "src/parse/lex.cc"
+yy404:
 	yyaccept = 1;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy392;
-		if (yych <= '9') goto yy414;
-		goto yy392;
+		if (yych <= '/') goto yy403;
+		if (yych <= '9') goto yy425;
+		goto yy403;
 	} else {
-		if (yych <= 'F') goto yy414;
-		if (yych <= '`') goto yy392;
-		if (yych <= 'f') goto yy414;
-		goto yy392;
+		if (yych <= 'F') goto yy425;
+		if (yych <= '`') goto yy403;
+		if (yych <= 'f') goto yy425;
+		goto yy403;
 	}
-yy394:
+yy405:
 	++YYCURSOR;
-#line 647 "../src/parse/lex.re"
+#line 663 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\\'); }
-#line 2597 "src/parse/lex.cc"
-yy396:
+#line 2654 "src/parse/lex.cc"
+yy407:
 	++YYCURSOR;
-#line 640 "../src/parse/lex.re"
+#line 656 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\a'); }
-#line 2602 "src/parse/lex.cc"
-yy398:
+#line 2659 "src/parse/lex.cc"
+yy409:
 	++YYCURSOR;
-#line 641 "../src/parse/lex.re"
+#line 657 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\b'); }
-#line 2607 "src/parse/lex.cc"
-yy400:
+#line 2664 "src/parse/lex.cc"
+yy411:
 	++YYCURSOR;
-#line 642 "../src/parse/lex.re"
+#line 658 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\f'); }
-#line 2612 "src/parse/lex.cc"
-yy402:
+#line 2669 "src/parse/lex.cc"
+yy413:
 	++YYCURSOR;
-#line 643 "../src/parse/lex.re"
+#line 659 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\n'); }
-#line 2617 "src/parse/lex.cc"
-yy404:
+#line 2674 "src/parse/lex.cc"
+yy415:
 	++YYCURSOR;
-#line 644 "../src/parse/lex.re"
+#line 660 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\r'); }
-#line 2622 "src/parse/lex.cc"
-yy406:
+#line 2679 "src/parse/lex.cc"
+yy417:
 	++YYCURSOR;
-#line 645 "../src/parse/lex.re"
+#line 661 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\t'); }
-#line 2627 "src/parse/lex.cc"
-yy408:
+#line 2684 "src/parse/lex.cc"
+yy419:
 	++YYCURSOR;
-#line 646 "../src/parse/lex.re"
+#line 662 "../src/parse/lex.re"
 	{ return static_cast<uint8_t>('\v'); }
-#line 2632 "src/parse/lex.cc"
-yy410:
+#line 2689 "src/parse/lex.cc"
+yy421:
 	yyaccept = 1;
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
 	if (yych <= '@') {
-		if (yych <= '/') goto yy392;
-		if (yych <= '9') goto yy415;
-		goto yy392;
+		if (yych <= '/') goto yy403;
+		if (yych <= '9') goto yy426;
+		goto yy403;
 	} else {
-		if (yych <= 'F') goto yy415;
-		if (yych <= '`') goto yy392;
-		if (yych <= 'f') goto yy415;
-		goto yy392;
+		if (yych <= 'F') goto yy426;
+		if (yych <= '`') goto yy403;
+		if (yych <= 'f') goto yy426;
+		goto yy403;
 	}
-yy411:
+yy422:
 	yych = (YYCTYPE)*++YYCURSOR;
-	if (yych <= '/') goto yy412;
-	if (yych <= '7') goto yy416;
-yy412:
+	if (yych <= '/') goto yy423;
+	if (yych <= '7') goto yy427;
+yy423:
 	YYCURSOR = YYMARKER;
 	if (yyaccept == 0) {
-		goto yy389;
+		goto yy400;
 	} else {
-		goto yy392;
+		goto yy403;
 	}
-yy413:
+yy424:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy412;
-		if (yych <= '9') goto yy418;
-		goto yy412;
+		if (yych <= '/') goto yy423;
+		if (yych <= '9') goto yy429;
+		goto yy423;
 	} else {
-		if (yych <= 'F') goto yy418;
-		if (yych <= '`') goto yy412;
-		if (yych <= 'f') goto yy418;
-		goto yy412;
+		if (yych <= 'F') goto yy429;
+		if (yych <= '`') goto yy423;
+		if (yych <= 'f') goto yy429;
+		goto yy423;
 	}
-yy414:
+yy425:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy412;
-		if (yych <= '9') goto yy419;
-		goto yy412;
+		if (yych <= '/') goto yy423;
+		if (yych <= '9') goto yy430;
+		goto yy423;
 	} else {
-		if (yych <= 'F') goto yy419;
-		if (yych <= '`') goto yy412;
-		if (yych <= 'f') goto yy419;
-		goto yy412;
+		if (yych <= 'F') goto yy430;
+		if (yych <= '`') goto yy423;
+		if (yych <= 'f') goto yy430;
+		goto yy423;
 	}
-yy415:
+yy426:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy412;
-		if (yych <= '9') goto yy420;
-		goto yy412;
+		if (yych <= '/') goto yy423;
+		if (yych <= '9') goto yy431;
+		goto yy423;
 	} else {
-		if (yych <= 'F') goto yy420;
-		if (yych <= '`') goto yy412;
-		if (yych <= 'f') goto yy420;
-		goto yy412;
+		if (yych <= 'F') goto yy431;
+		if (yych <= '`') goto yy423;
+		if (yych <= 'f') goto yy431;
+		goto yy423;
 	}
-yy416:
+yy427:
 	++YYCURSOR;
-#line 639 "../src/parse/lex.re"
+#line 655 "../src/parse/lex.re"
 	{ return unesc_oct(tok, cur); }
-#line 2697 "src/parse/lex.cc"
-yy418:
+#line 2754 "src/parse/lex.cc"
+yy429:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy412;
-		if (yych <= '9') goto yy422;
-		goto yy412;
+		if (yych <= '/') goto yy423;
+		if (yych <= '9') goto yy433;
+		goto yy423;
 	} else {
-		if (yych <= 'F') goto yy422;
-		if (yych <= '`') goto yy412;
-		if (yych <= 'f') goto yy422;
-		goto yy412;
+		if (yych <= 'F') goto yy433;
+		if (yych <= '`') goto yy423;
+		if (yych <= 'f') goto yy433;
+		goto yy423;
 	}
-yy419:
+yy430:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy412;
-		if (yych <= '9') goto yy415;
-		goto yy412;
+		if (yych <= '/') goto yy423;
+		if (yych <= '9') goto yy426;
+		goto yy423;
 	} else {
-		if (yych <= 'F') goto yy415;
-		if (yych <= '`') goto yy412;
-		if (yych <= 'f') goto yy415;
-		goto yy412;
+		if (yych <= 'F') goto yy426;
+		if (yych <= '`') goto yy423;
+		if (yych <= 'f') goto yy426;
+		goto yy423;
 	}
-yy420:
+yy431:
 	++YYCURSOR;
-#line 638 "../src/parse/lex.re"
+#line 654 "../src/parse/lex.re"
 	{ return unesc_hex(tok, cur); }
-#line 2726 "src/parse/lex.cc"
-yy422:
+#line 2783 "src/parse/lex.cc"
+yy433:
 	yych = (YYCTYPE)*++YYCURSOR;
 	if (yych <= '@') {
-		if (yych <= '/') goto yy412;
-		if (yych >= ':') goto yy412;
+		if (yych <= '/') goto yy423;
+		if (yych >= ':') goto yy423;
 	} else {
-		if (yych <= 'F') goto yy423;
-		if (yych <= '`') goto yy412;
-		if (yych >= 'g') goto yy412;
+		if (yych <= 'F') goto yy434;
+		if (yych <= '`') goto yy423;
+		if (yych >= 'g') goto yy423;
 	}
-yy423:
+yy434:
 	++YYCURSOR;
 	if ((yych = (YYCTYPE)*YYCURSOR) <= '@') {
-		if (yych <= '/') goto yy412;
-		if (yych <= '9') goto yy414;
-		goto yy412;
+		if (yych <= '/') goto yy423;
+		if (yych <= '9') goto yy425;
+		goto yy423;
 	} else {
-		if (yych <= 'F') goto yy414;
-		if (yych <= '`') goto yy412;
-		if (yych <= 'f') goto yy414;
-		goto yy412;
+		if (yych <= 'F') goto yy425;
+		if (yych <= '`') goto yy423;
+		if (yych <= 'f') goto yy425;
+		goto yy423;
 	}
 }
-#line 654 "../src/parse/lex.re"
+#line 670 "../src/parse/lex.re"
 
 }
 
@@ -2767,7 +2824,7 @@ void Scanner::set_sourceline ()
 sourceline:
 	tok = cur;
 
-#line 2771 "src/parse/lex.cc"
+#line 2828 "src/parse/lex.cc"
 {
 	YYCTYPE yych;
 	static const unsigned char yybm[] = {
@@ -2807,23 +2864,23 @@ sourceline:
 	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yych <= '!') {
-		if (yych == '\n') goto yy428;
+		if (yych == '\n') goto yy439;
 	} else {
-		if (yych <= '"') goto yy430;
-		if (yych <= '0') goto yy426;
-		if (yych <= '9') goto yy431;
+		if (yych <= '"') goto yy441;
+		if (yych <= '0') goto yy437;
+		if (yych <= '9') goto yy442;
 	}
-yy426:
+yy437:
 	++YYCURSOR;
-yy427:
-#line 697 "../src/parse/lex.re"
+yy438:
+#line 713 "../src/parse/lex.re"
 	{
   					goto sourceline;
   				}
-#line 2824 "src/parse/lex.cc"
-yy428:
+#line 2881 "src/parse/lex.cc"
+yy439:
 	++YYCURSOR;
-#line 685 "../src/parse/lex.re"
+#line 701 "../src/parse/lex.re"
 	{
   					if (cur == eof)
   					{
@@ -2836,19 +2893,19 @@ yy428:
 			  		tok = cur;
 			  		return; 
 				}
-#line 2840 "src/parse/lex.cc"
-yy430:
+#line 2897 "src/parse/lex.cc"
+yy441:
 	yych = (YYCTYPE)*(YYMARKER = ++YYCURSOR);
-	if (yych == '\n') goto yy427;
-	goto yy435;
-yy431:
+	if (yych == '\n') goto yy438;
+	goto yy446;
+yy442:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
 	if (yybm[0+yych] & 64) {
-		goto yy431;
+		goto yy442;
 	}
-#line 674 "../src/parse/lex.re"
+#line 690 "../src/parse/lex.re"
 	{
 					if (!s_to_u32_unsafe (tok, cur, cline))
 					{
@@ -2856,37 +2913,37 @@ yy431:
 					}
 					goto sourceline; 
 				}
-#line 2860 "src/parse/lex.cc"
-yy434:
+#line 2917 "src/parse/lex.cc"
+yy445:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-yy435:
+yy446:
 	if (yybm[0+yych] & 128) {
-		goto yy434;
+		goto yy445;
 	}
-	if (yych <= '\n') goto yy436;
-	if (yych <= '"') goto yy437;
-	goto yy439;
-yy436:
+	if (yych <= '\n') goto yy447;
+	if (yych <= '"') goto yy448;
+	goto yy450;
+yy447:
 	YYCURSOR = YYMARKER;
-	goto yy427;
-yy437:
+	goto yy438;
+yy448:
 	++YYCURSOR;
-#line 681 "../src/parse/lex.re"
+#line 697 "../src/parse/lex.re"
 	{
 					escape (in.file_name, std::string (tok + 1, tok_len () - 2)); // -2 to omit quotes
 			  		goto sourceline; 
 				}
-#line 2882 "src/parse/lex.cc"
-yy439:
+#line 2939 "src/parse/lex.cc"
+yy450:
 	++YYCURSOR;
 	if (YYLIMIT <= YYCURSOR) YYFILL(1);
 	yych = (YYCTYPE)*YYCURSOR;
-	if (yych == '\n') goto yy436;
-	goto yy434;
+	if (yych == '\n') goto yy447;
+	goto yy445;
 }
-#line 700 "../src/parse/lex.re"
+#line 716 "../src/parse/lex.re"
 
 }
 
@@ -1,4 +1,4 @@
-/* Generated by re2c 0.16 on Thu Jan 21 10:47:47 2016 */
+/* Generated by re2c 0.16 on Fri Oct 16 21:06:17 2026 */
 #line 1 "../src/parse/lex_conf.re"
 #include "src/util/c99_stdint.h"
 #include <string>
@@ -66,10 +66,11 @@ void Scanner::lex_conf ()
 	case 'd':	goto yy5;
 	case 'f':	goto yy6;
 	case 'i':	goto yy7;
-	case 'l':	goto yy8;
-	case 's':	goto yy9;
-	case 'v':	goto yy10;
-	case 'y':	goto yy11;
+	case 'k':	goto yy8;
+	case 'l':	goto yy9;
+	case 's':	goto yy10;
+	case 'v':	goto yy11;
+	case 'y':	goto yy12;
 	default:	goto yy2;
 	}
 yy2:
@@ -77,52 +78,57 @@ yy2:
 yy3:
 #line 42 "../src/parse/lex_conf.re"
 	{ fatal ((tok - pos) - tchar, "unrecognized configuration"); }
-#line 81 "src/parse/lex_conf.cc"
+#line 82 "src/parse/lex_conf.cc"
 yy4:
 	yyaccept = 0;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == 'g') goto yy12;
-	if (yych == 'o') goto yy14;
+	if (yych == 'g') goto yy13;
+	if (yych == 'o') goto yy15;
 	goto yy3;
 yy5:
 	yyaccept = 0;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == 'e') goto yy15;
+	if (yych == 'e') goto yy16;
 	goto yy3;
 yy6:
 	yyaccept = 0;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == 'l') goto yy16;
+	if (yych == 'l') goto yy17;
 	goto yy3;
 yy7:
 	yyaccept = 0;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == 'n') goto yy17;
+	if (yych == 'n') goto yy18;
 	goto yy3;
 yy8:
 	yyaccept = 0;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == 'a') goto yy18;
+	if (yych == 'e') goto yy19;
 	goto yy3;
 yy9:
 	yyaccept = 0;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == 't') goto yy19;
+	if (yych == 'a') goto yy20;
 	goto yy3;
 yy10:
 	yyaccept = 0;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == 'a') goto yy20;
+	if (yych == 't') goto yy21;
 	goto yy3;
 yy11:
 	yyaccept = 0;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == 'y') goto yy21;
+	if (yych == 'a') goto yy22;
 	goto yy3;
 yy12:
-	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy22;
+	yyaccept = 0;
+	yych = (unsigned char)*(ptr = ++cur);
+	if (yych == 'y') goto yy23;
+	goto yy3;
 yy13:
+	yych = (unsigned char)*++cur;
+	if (yych == 'o') goto yy24;
+yy14:
 	cur = ptr;
 	if (yyaccept <= 5) {
 		if (yyaccept <= 2) {
@@ -130,343 +136,363 @@ yy13:
 				if (yyaccept == 0) {
 					goto yy3;
 				} else {
-					goto yy119;
+					goto yy128;
 				}
 			} else {
-				goto yy161;
+				goto yy173;
 			}
 		} else {
 			if (yyaccept <= 4) {
 				if (yyaccept == 3) {
-					goto yy206;
+					goto yy221;
 				} else {
-					goto yy255;
+					goto yy272;
 				}
 			} else {
-				goto yy321;
+				goto yy344;
 			}
 		}
 	} else {
 		if (yyaccept <= 8) {
 			if (yyaccept <= 7) {
 				if (yyaccept == 6) {
-					goto yy356;
+					goto yy383;
 				} else {
-					goto yy377;
+					goto yy408;
 				}
 			} else {
-				goto yy383;
+				goto yy414;
 			}
 		} else {
 			if (yyaccept == 9) {
-				goto yy420;
+				goto yy451;
 			} else {
-				goto yy423;
+				goto yy454;
 			}
 		}
 	}
-yy14:
-	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy23;
-	goto yy13;
 yy15:
 	yych = (unsigned char)*++cur;
-	if (yych == 'f') goto yy24;
-	goto yy13;
+	if (yych == 'n') goto yy25;
+	goto yy14;
 yy16:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy25;
-	goto yy13;
+	if (yych == 'f') goto yy26;
+	goto yy14;
 yy17:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy26;
-	goto yy13;
+	if (yych == 'a') goto yy27;
+	goto yy14;
 yy18:
 	yych = (unsigned char)*++cur;
-	if (yych == 'b') goto yy27;
-	goto yy13;
+	if (yych == 'd') goto yy28;
+	goto yy14;
 yy19:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy28;
-	goto yy13;
+	if (yych == 'y') goto yy29;
+	goto yy14;
 yy20:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy29;
-	goto yy13;
+	if (yych == 'b') goto yy30;
+	goto yy14;
 yy21:
 	yych = (unsigned char)*++cur;
-	if (yych <= 'c') {
-		if (yych <= 'a') goto yy13;
-		if (yych <= 'b') goto yy30;
-		goto yy31;
-	} else {
-		if (yych == 'f') goto yy32;
-		goto yy13;
-	}
+	if (yych == 'a') goto yy31;
+	goto yy14;
 yy22:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy33;
-	goto yy13;
+	if (yych == 'r') goto yy32;
+	goto yy14;
 yy23:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy34;
-	goto yy13;
+	if (yych <= 'c') {
+		if (yych <= 'a') goto yy14;
+		if (yych <= 'b') goto yy33;
+		goto yy34;
+	} else {
+		if (yych == 'f') goto yy35;
+		goto yy14;
+	}
 yy24:
 	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy35;
-	goto yy13;
+	if (yych == 't') goto yy36;
+	goto yy14;
 yy25:
 	yych = (unsigned char)*++cur;
-	if (yych == 'g') goto yy36;
-	goto yy13;
+	if (yych == 'd') goto yy37;
+	goto yy14;
 yy26:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy37;
-	goto yy13;
+	if (yych == 'i') goto yy38;
+	goto yy14;
 yy27:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy38;
-	goto yy13;
+	if (yych == 'g') goto yy39;
+	goto yy14;
 yy28:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy39;
-	if (yych == 't') goto yy40;
-	goto yy13;
+	if (yych == 'e') goto yy40;
+	goto yy14;
 yy29:
 	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy41;
-	goto yy13;
+	if (yych == 'w') goto yy41;
+	goto yy14;
 yy30:
 	yych = (unsigned char)*++cur;
-	if (yych == 'm') goto yy42;
-	goto yy13;
+	if (yych == 'e') goto yy42;
+	goto yy14;
 yy31:
 	yych = (unsigned char)*++cur;
-	if (yych == 'h') goto yy43;
-	goto yy13;
+	if (yych == 'r') goto yy43;
+	if (yych == 't') goto yy44;
+	goto yy14;
 yy32:
 	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy44;
-	goto yy13;
+	if (yych == 'i') goto yy45;
+	goto yy14;
 yy33:
 	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy45;
-	goto yy13;
+	if (yych == 'm') goto yy46;
+	goto yy14;
 yy34:
 	yych = (unsigned char)*++cur;
-	if (yych <= 'd') {
-		if (yych == ':') goto yy46;
-		goto yy13;
-	} else {
-		if (yych <= 'e') goto yy47;
-		if (yych == 'p') goto yy48;
-		goto yy13;
-	}
+	if (yych == 'h') goto yy47;
+	goto yy14;
 yy35:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy49;
-	goto yy13;
+	if (yych == 'i') goto yy48;
+	goto yy14;
 yy36:
 	yych = (unsigned char)*++cur;
-	if (yych == 's') goto yy50;
-	goto yy13;
+	if (yych == 'o') goto yy49;
+	goto yy14;
 yy37:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy51;
-	goto yy13;
+	if (yych <= 'd') {
+		if (yych == ':') goto yy50;
+		goto yy14;
+	} else {
+		if (yych <= 'e') goto yy51;
+		if (yych == 'p') goto yy52;
+		goto yy14;
+	}
 yy38:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy52;
-	goto yy13;
+	if (yych == 'n') goto yy53;
+	goto yy14;
 yy39:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy53;
-	goto yy13;
+	if (yych == 's') goto yy54;
+	goto yy14;
 yy40:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy54;
-	goto yy13;
+	if (yych == 'n') goto yy55;
+	goto yy14;
 yy41:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy55;
-	goto yy13;
+	if (yych == 'o') goto yy56;
+	goto yy14;
 yy42:
 	yych = (unsigned char)*++cur;
-	if (yych == ':') goto yy56;
-	goto yy13;
+	if (yych == 'l') goto yy57;
+	goto yy14;
 yy43:
 	yych = (unsigned char)*++cur;
-	if (yych == ':') goto yy57;
-	goto yy13;
+	if (yych == 't') goto yy58;
+	goto yy14;
 yy44:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy58;
-	goto yy13;
+	if (yych == 'e') goto yy59;
+	goto yy14;
 yy45:
 	yych = (unsigned char)*++cur;
-	if (yych == ':') goto yy59;
-	goto yy13;
+	if (yych == 'a') goto yy60;
+	goto yy14;
 yy46:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy60;
-	if (yych == 'g') goto yy61;
-	goto yy13;
+	if (yych == ':') goto yy61;
+	goto yy14;
 yy47:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy62;
-	goto yy13;
+	if (yych == ':') goto yy62;
+	goto yy14;
 yy48:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy63;
-	goto yy13;
+	if (yych == 'l') goto yy63;
+	goto yy14;
 yy49:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy64;
-	goto yy13;
+	if (yych == ':') goto yy64;
+	goto yy14;
 yy50:
 	yych = (unsigned char)*++cur;
-	if (yych == ':') goto yy65;
-	goto yy13;
+	if (yych == 'd') goto yy65;
+	if (yych == 'g') goto yy66;
+	goto yy14;
 yy51:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy66;
-	goto yy13;
+	if (yych == 'n') goto yy67;
+	goto yy14;
 yy52:
 	yych = (unsigned char)*++cur;
-	if (yych == ':') goto yy67;
-	if (yych == 'p') goto yy68;
-	goto yy13;
+	if (yych == 'r') goto yy68;
+	goto yy14;
 yy53:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy69;
-	goto yy13;
+	if (yych == 'e') goto yy69;
+	goto yy14;
 yy54:
 	yych = (unsigned char)*++cur;
 	if (yych == ':') goto yy70;
-	goto yy13;
+	goto yy14;
 yy55:
 	yych = (unsigned char)*++cur;
-	if (yych == 'b') goto yy71;
-	goto yy13;
+	if (yych == 't') goto yy71;
+	goto yy14;
 yy56:
 	yych = (unsigned char)*++cur;
-	if (yych == 'h') goto yy72;
-	goto yy13;
+	if (yych == 'r') goto yy72;
+	goto yy14;
 yy57:
 	yych = (unsigned char)*++cur;
-	if (yych == 'c') goto yy73;
-	if (yych == 'e') goto yy74;
-	goto yy13;
+	if (yych == ':') goto yy73;
+	if (yych == 'p') goto yy74;
+	goto yy14;
 yy58:
 	yych = (unsigned char)*++cur;
 	if (yych == 'l') goto yy75;
-	goto yy13;
+	goto yy14;
 yy59:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy76;
-	goto yy13;
+	if (yych == ':') goto yy76;
+	goto yy14;
 yy60:
 	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy77;
-	goto yy13;
+	if (yych == 'b') goto yy77;
+	goto yy14;
 yy61:
 	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy78;
-	goto yy13;
+	if (yych == 'h') goto yy78;
+	goto yy14;
 yy62:
 	yych = (unsigned char)*++cur;
-	if (yych == 'u') goto yy79;
-	goto yy13;
+	if (yych == 'c') goto yy79;
+	if (yych == 'e') goto yy80;
+	goto yy14;
 yy63:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy80;
-	goto yy13;
+	if (yych == 'l') goto yy81;
+	goto yy14;
 yy64:
 	yych = (unsigned char)*++cur;
-	if (yych == ':') goto yy81;
-	goto yy13;
+	if (yych == 't') goto yy82;
+	goto yy14;
 yy65:
 	yych = (unsigned char)*++cur;
-	if (yych <= 'e') {
-		if (yych == '8') goto yy82;
-		if (yych <= 'd') goto yy13;
-		goto yy82;
-	} else {
-		if (yych <= 'u') {
-			if (yych <= 't') goto yy13;
-			goto yy82;
-		} else {
-			if (yych <= 'v') goto yy13;
-			if (yych <= 'x') goto yy82;
-			goto yy13;
-		}
-	}
+	if (yych == 'i') goto yy83;
+	goto yy14;
 yy66:
 	yych = (unsigned char)*++cur;
-	if (yych == ':') goto yy84;
-	goto yy13;
+	if (yych == 'o') goto yy84;
+	goto yy14;
 yy67:
 	yych = (unsigned char)*++cur;
-	if (yych == 'y') goto yy85;
-	goto yy13;
+	if (yych == 'u') goto yy85;
+	goto yy14;
 yy68:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy86;
-	goto yy13;
+	if (yych == 'e') goto yy86;
+	goto yy14;
 yy69:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy87;
-	goto yy13;
+	if (yych == ':') goto yy87;
+	goto yy14;
 yy70:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy88;
-	if (yych == 'n') goto yy89;
-	goto yy13;
+	if (yych <= 'e') {
+		if (yych == '8') goto yy88;
+		if (yych <= 'd') goto yy14;
+		goto yy88;
+	} else {
+		if (yych <= 'u') {
+			if (yych <= 't') goto yy14;
+			goto yy88;
+		} else {
+			if (yych <= 'v') goto yy14;
+			if (yych <= 'x') goto yy88;
+			goto yy14;
+		}
+	}
 yy71:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy90;
-	goto yy13;
+	if (yych == ':') goto yy90;
+	goto yy14;
 yy72:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy91;
-	goto yy13;
+	if (yych == 'd') goto yy91;
+	goto yy14;
 yy73:
 	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy92;
-	goto yy13;
+	if (yych == 'y') goto yy92;
+	goto yy14;
 yy74:
 	yych = (unsigned char)*++cur;
-	if (yych == 'm') goto yy93;
-	goto yy13;
+	if (yych == 'r') goto yy93;
+	goto yy14;
 yy75:
 	yych = (unsigned char)*++cur;
-	if (yych == ':') goto yy94;
-	goto yy13;
+	if (yych == 'a') goto yy94;
+	goto yy14;
 yy76:
 	yych = (unsigned char)*++cur;
-	if (yych == 'h') goto yy95;
-	goto yy13;
+	if (yych == 'a') goto yy95;
+	if (yych == 'n') goto yy96;
+	goto yy14;
 yy77:
 	yych = (unsigned char)*++cur;
-	if (yych == 'v') goto yy96;
-	goto yy13;
+	if (yych == 'l') goto yy97;
+	goto yy14;
 yy78:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy97;
-	goto yy13;
+	if (yych == 'e') goto yy98;
+	goto yy14;
 yy79:
 	yych = (unsigned char)*++cur;
-	if (yych == 'm') goto yy98;
-	goto yy13;
+	if (yych == 'o') goto yy99;
+	goto yy14;
 yy80:
 	yych = (unsigned char)*++cur;
-	if (yych == 'f') goto yy99;
-	goto yy13;
+	if (yych == 'm') goto yy100;
+	goto yy14;
 yy81:
 	yych = (unsigned char)*++cur;
-	if (yych == 'Y') goto yy100;
-	goto yy13;
+	if (yych == ':') goto yy101;
+	goto yy14;
 yy82:
+	yych = (unsigned char)*++cur;
+	if (yych == 'h') goto yy102;
+	goto yy14;
+yy83:
+	yych = (unsigned char)*++cur;
+	if (yych == 'v') goto yy103;
+	goto yy14;
+yy84:
+	yych = (unsigned char)*++cur;
+	if (yych == 't') goto yy104;
+	goto yy14;
+yy85:
+	yych = (unsigned char)*++cur;
+	if (yych == 'm') goto yy105;
+	goto yy14;
+yy86:
+	yych = (unsigned char)*++cur;
+	if (yych == 'f') goto yy106;
+	goto yy14;
+yy87:
+	yych = (unsigned char)*++cur;
+	if (yych == 'Y') goto yy107;
+	goto yy14;
+yy88:
 	++cur;
 #line 45 "../src/parse/lex_conf.re"
 	{
@@ -492,952 +518,1018 @@ yy82:
 		}
 		return;
 	}
-#line 496 "src/parse/lex_conf.cc"
-yy84:
-	yych = (unsigned char)*++cur;
-	if (yych <= 'r') goto yy13;
-	if (yych <= 's') goto yy101;
-	if (yych <= 't') goto yy102;
-	goto yy13;
-yy85:
-	yych = (unsigned char)*++cur;
-	if (yych == 'y') goto yy103;
-	goto yy13;
-yy86:
-	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy104;
-	goto yy13;
-yy87:
-	yych = (unsigned char)*++cur;
-	if (yych == 'b') goto yy105;
-	goto yy13;
-yy88:
-	yych = (unsigned char)*++cur;
-	if (yych == 'b') goto yy106;
-	goto yy13;
-yy89:
-	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy107;
-	goto yy13;
+#line 522 "src/parse/lex_conf.cc"
 yy90:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy108;
-	goto yy13;
+	if (yych <= 'r') goto yy14;
+	if (yych <= 's') goto yy108;
+	if (yych <= 't') goto yy109;
+	goto yy14;
 yy91:
 	yych = (unsigned char)*++cur;
-	if (yych == 'x') goto yy109;
-	goto yy13;
+	if (yych == 's') goto yy110;
+	goto yy14;
 yy92:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy111;
-	goto yy13;
+	if (yych == 'y') goto yy111;
+	goto yy14;
 yy93:
 	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy112;
-	goto yy13;
+	if (yych == 'e') goto yy112;
+	goto yy14;
 yy94:
 	yych = (unsigned char)*++cur;
-	if (yych <= 'd') {
-		if (yych == 'c') goto yy113;
-		goto yy13;
-	} else {
-		if (yych <= 'e') goto yy114;
-		if (yych == 'p') goto yy115;
-		goto yy13;
-	}
+	if (yych == 'b') goto yy113;
+	goto yy14;
 yy95:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy116;
-	goto yy13;
+	if (yych == 'b') goto yy114;
+	goto yy14;
 yy96:
 	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy117;
-	goto yy13;
+	if (yych == 'e') goto yy115;
+	goto yy14;
 yy97:
 	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy118;
-	goto yy13;
+	if (yych == 'e') goto yy116;
+	goto yy14;
 yy98:
 	yych = (unsigned char)*++cur;
-	if (yych == 'p') goto yy120;
-	goto yy13;
+	if (yych == 'x') goto yy117;
+	goto yy14;
 yy99:
 	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy121;
-	goto yy13;
+	if (yych == 'n') goto yy119;
+	goto yy14;
 yy100:
 	yych = (unsigned char)*++cur;
-	if (yych == 'Y') goto yy122;
-	goto yy13;
+	if (yych == 'i') goto yy120;
+	goto yy14;
 yy101:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy123;
-	goto yy13;
+	switch (yych) {
+	case 'c':	goto yy121;
+	case 'e':	goto yy122;
+	case 'p':	goto yy123;
+	case 's':	goto yy124;
+	default:	goto yy14;
+	}
 yy102:
 	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy124;
-	goto yy13;
+	if (yych == 'r') goto yy125;
+	goto yy14;
 yy103:
 	yych = (unsigned char)*++cur;
-	if (yych == 'F') goto yy125;
-	if (yych == 'N') goto yy126;
-	goto yy13;
+	if (yych == 'i') goto yy126;
+	goto yy14;
 yy104:
 	yych = (unsigned char)*++cur;
-	if (yych == 'f') goto yy127;
-	goto yy13;
+	if (yych == 'o') goto yy127;
+	goto yy14;
 yy105:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy128;
-	goto yy13;
+	if (yych == 'p') goto yy129;
+	goto yy14;
 yy106:
 	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy129;
-	goto yy13;
+	if (yych == 'i') goto yy130;
+	goto yy14;
 yy107:
 	yych = (unsigned char)*++cur;
-	if (yych == 'x') goto yy130;
-	goto yy13;
+	if (yych == 'Y') goto yy131;
+	goto yy14;
 yy108:
 	yych = (unsigned char)*++cur;
-	if (yych == ':') goto yy131;
-	goto yy13;
+	if (yych == 't') goto yy132;
+	goto yy14;
 yy109:
-	++cur;
-#line 95 "../src/parse/lex_conf.re"
-	{ opts.set_yybmHexTable (lex_conf_number () != 0); return; }
-#line 610 "src/parse/lex_conf.cc"
+	yych = (unsigned char)*++cur;
+	if (yych == 'o') goto yy133;
+	goto yy14;
+yy110:
+	yych = (unsigned char)*++cur;
+	if (yych == ':') goto yy134;
+	goto yy14;
 yy111:
 	yych = (unsigned char)*++cur;
-	if (yych == 'v') goto yy132;
-	goto yy13;
+	if (yych == 'F') goto yy135;
+	if (yych == 'N') goto yy136;
+	goto yy14;
 yy112:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy133;
-	goto yy13;
+	if (yych == 'f') goto yy137;
+	goto yy14;
 yy113:
 	yych = (unsigned char)*++cur;
-	if (yych == 'h') goto yy135;
-	goto yy13;
+	if (yych == 'e') goto yy138;
+	goto yy14;
 yy114:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy136;
-	goto yy13;
+	if (yych == 'o') goto yy139;
+	goto yy14;
 yy115:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy137;
-	goto yy13;
+	if (yych == 'x') goto yy140;
+	goto yy14;
 yy116:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy138;
-	goto yy13;
+	if (yych == ':') goto yy141;
+	goto yy14;
 yy117:
-	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy139;
-	goto yy13;
-yy118:
-	yyaccept = 1;
-	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == '@') goto yy140;
+	++cur;
+#line 95 "../src/parse/lex_conf.re"
+	{ opts.set_yybmHexTable (lex_conf_number () != 0); return; }
+#line 643 "src/parse/lex_conf.cc"
 yy119:
-#line 79 "../src/parse/lex_conf.re"
-	{ opts.set_condGoto         (lex_conf_string ()); return; }
-#line 646 "src/parse/lex_conf.cc"
+	yych = (unsigned char)*++cur;
+	if (yych == 'v') goto yy142;
+	goto yy14;
 yy120:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy141;
-	goto yy13;
+	if (yych == 't') goto yy143;
+	goto yy14;
 yy121:
 	yych = (unsigned char)*++cur;
-	if (yych == 'x') goto yy142;
-	goto yy13;
+	if (yych == 'h') goto yy145;
+	goto yy14;
 yy122:
 	yych = (unsigned char)*++cur;
-	switch (yych) {
-	case 'B':	goto yy144;
-	case 'C':	goto yy145;
-	case 'D':	goto yy146;
-	case 'F':	goto yy147;
-	case 'G':	goto yy148;
-	case 'L':	goto yy149;
-	case 'M':	goto yy150;
-	case 'P':	goto yy151;
-	case 'R':	goto yy152;
-	case 'S':	goto yy153;
-	default:	goto yy13;
-	}
+	if (yych == 'n') goto yy146;
+	goto yy14;
 yy123:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy154;
-	goto yy13;
+	if (yych == 'a') goto yy147;
+	goto yy14;
 yy124:
 	yych = (unsigned char)*++cur;
-	if (yych == 'p') goto yy155;
-	goto yy13;
+	if (yych == 'e') goto yy148;
+	goto yy14;
 yy125:
 	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy157;
-	goto yy13;
+	if (yych == 'e') goto yy149;
+	goto yy14;
 yy126:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy158;
-	goto yy13;
+	if (yych == 'd') goto yy150;
+	goto yy14;
 yy127:
-	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy159;
-	goto yy13;
+	yyaccept = 1;
+	yych = (unsigned char)*(ptr = ++cur);
+	if (yych == '@') goto yy151;
 yy128:
-	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy160;
-	goto yy13;
+#line 79 "../src/parse/lex_conf.re"
+	{ opts.set_condGoto         (lex_conf_string ()); return; }
+#line 683 "src/parse/lex_conf.cc"
 yy129:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy162;
-	goto yy13;
+	if (yych == 'r') goto yy152;
+	goto yy14;
 yy130:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy163;
-	goto yy13;
+	if (yych == 'x') goto yy153;
+	goto yy14;
 yy131:
 	yych = (unsigned char)*++cur;
-	if (yych == 'y') goto yy164;
-	goto yy13;
+	switch (yych) {
+	case 'B':	goto yy155;
+	case 'C':	goto yy156;
+	case 'D':	goto yy157;
+	case 'F':	goto yy158;
+	case 'G':	goto yy159;
+	case 'L':	goto yy160;
+	case 'M':	goto yy161;
+	case 'P':	goto yy162;
+	case 'R':	goto yy163;
+	case 'S':	goto yy164;
+	default:	goto yy14;
+	}
 yy132:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy165;
-	goto yy13;
+	if (yych == 'r') goto yy165;
+	goto yy14;
 yy133:
-	++cur;
-#line 138 "../src/parse/lex_conf.re"
-	{ opts.set_bEmitYYCh      (lex_conf_number () != 0); return; }
-#line 714 "src/parse/lex_conf.cc"
+	yych = (unsigned char)*++cur;
+	if (yych == 'p') goto yy166;
+	goto yy14;
+yy134:
+	yych = (unsigned char)*++cur;
+	if (yych == 't') goto yy168;
+	goto yy14;
 yy135:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy166;
-	goto yy13;
+	if (yych == 'i') goto yy169;
+	goto yy14;
 yy136:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy167;
-	goto yy13;
+	if (yych == 'e') goto yy170;
+	goto yy14;
 yy137:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy168;
-	goto yy13;
+	if (yych == 'i') goto yy171;
+	goto yy14;
 yy138:
 	yych = (unsigned char)*++cur;
-	if (yych == 's') goto yy169;
-	goto yy13;
+	if (yych == 'l') goto yy172;
+	goto yy14;
 yy139:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy170;
-	goto yy13;
+	if (yych == 'r') goto yy174;
+	goto yy14;
 yy140:
 	yych = (unsigned char)*++cur;
-	if (yych == 'c') goto yy171;
-	goto yy13;
+	if (yych == 't') goto yy175;
+	goto yy14;
 yy141:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy172;
-	goto yy13;
+	if (yych == 'y') goto yy176;
+	goto yy14;
 yy142:
-	++cur;
-#line 75 "../src/parse/lex_conf.re"
-	{ opts.set_condPrefix       (lex_conf_string ()); return; }
-#line 747 "src/parse/lex_conf.cc"
-yy144:
 	yych = (unsigned char)*++cur;
-	if (yych == 'A') goto yy173;
-	goto yy13;
+	if (yych == 'e') goto yy177;
+	goto yy14;
+yy143:
+	++cur;
+#line 142 "../src/parse/lex_conf.re"
+	{ opts.set_bEmitYYCh      (lex_conf_number () != 0); return; }
+#line 755 "src/parse/lex_conf.cc"
 yy145:
 	yych = (unsigned char)*++cur;
-	if (yych <= 'S') {
-		if (yych == 'O') goto yy174;
-		goto yy13;
-	} else {
-		if (yych <= 'T') goto yy175;
-		if (yych <= 'U') goto yy176;
-		goto yy13;
-	}
+	if (yych == 'e') goto yy178;
+	goto yy14;
 yy146:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy177;
-	goto yy13;
+	if (yych == 'a') goto yy179;
+	goto yy14;
 yy147:
 	yych = (unsigned char)*++cur;
-	if (yych == 'I') goto yy178;
-	goto yy13;
+	if (yych == 'r') goto yy180;
+	goto yy14;
 yy148:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy179;
-	goto yy13;
+	if (yych == 'n') goto yy181;
+	goto yy14;
 yy149:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy180;
-	if (yych == 'I') goto yy181;
-	goto yy13;
+	if (yych == 's') goto yy182;
+	goto yy14;
 yy150:
 	yych = (unsigned char)*++cur;
-	if (yych == 'A') goto yy182;
-	goto yy13;
+	if (yych == 'e') goto yy183;
+	goto yy14;
 yy151:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy183;
-	goto yy13;
+	if (yych == 'c') goto yy184;
+	goto yy14;
 yy152:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy184;
-	goto yy13;
+	if (yych == 'e') goto yy185;
+	goto yy14;
 yy153:
+	++cur;
+#line 75 "../src/parse/lex_conf.re"
+	{ opts.set_condPrefix       (lex_conf_string ()); return; }
+#line 792 "src/parse/lex_conf.cc"
+yy155:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy185;
-	if (yych == 'K') goto yy186;
-	goto yy13;
-yy154:
+	if (yych == 'A') goto yy186;
+	goto yy14;
+yy156:
 	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy187;
-	goto yy13;
-yy155:
-	++cur;
-#line 123 "../src/parse/lex_conf.re"
-	{
-		const int32_t n = lex_conf_number ();
-		if (n < 0)
-		{
-			fatal ("configuration 'indent:top' must be nonnegative");
-		}
-		opts.set_topIndent (static_cast<uint32_t> (n));
-		return;
+	if (yych <= 'S') {
+		if (yych == 'O') goto yy187;
+		goto yy14;
+	} else {
+		if (yych <= 'T') goto yy188;
+		if (yych <= 'U') goto yy189;
+		goto yy14;
 	}
-#line 812 "src/parse/lex_conf.cc"
 yy157:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy188;
-	goto yy13;
+	if (yych == 'E') goto yy190;
+	goto yy14;
 yy158:
 	yych = (unsigned char)*++cur;
-	if (yych == 'x') goto yy189;
-	goto yy13;
+	if (yych == 'I') goto yy191;
+	goto yy14;
 yy159:
 	yych = (unsigned char)*++cur;
-	if (yych == 'x') goto yy190;
-	goto yy13;
+	if (yych == 'E') goto yy192;
+	goto yy14;
 yy160:
-	yyaccept = 2;
-	yych = (unsigned char)*(ptr = ++cur);
-	ctx = cur;
-	if (yybm[0+yych] & 64) {
-		goto yy192;
-	}
-	if (yych == '=') goto yy194;
+	yych = (unsigned char)*++cur;
+	if (yych == 'E') goto yy193;
+	if (yych == 'I') goto yy194;
+	goto yy14;
 yy161:
-#line 151 "../src/parse/lex_conf.re"
-	{ out.set_user_start_label (lex_conf_string ()); return; }
-#line 836 "src/parse/lex_conf.cc"
+	yych = (unsigned char)*++cur;
+	if (yych == 'A') goto yy195;
+	goto yy14;
 yy162:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy196;
-	goto yy13;
+	if (yych == 'E') goto yy196;
+	goto yy14;
 yy163:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy198;
-	goto yy13;
+	if (yych == 'E') goto yy197;
+	goto yy14;
 yy164:
 	yych = (unsigned char)*++cur;
-	if (yych == 'y') goto yy199;
-	goto yy13;
+	if (yych == 'E') goto yy198;
+	if (yych == 'K') goto yy199;
+	goto yy14;
 yy165:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy200;
-	goto yy13;
+	if (yych == 'i') goto yy200;
+	goto yy14;
 yy166:
-	yych = (unsigned char)*++cur;
-	if (yych == 'c') goto yy201;
-	goto yy13;
-yy167:
-	yych = (unsigned char)*++cur;
-	if (yych == 'b') goto yy202;
-	goto yy13;
+	++cur;
+#line 127 "../src/parse/lex_conf.re"
+	{
+		const int32_t n = lex_conf_number ();
+		if (n < 0)
+		{
+			fatal ("configuration 'indent:top' must be nonnegative");
+		}
+		opts.set_topIndent (static_cast<uint32_t> (n));
+		return;
+	}
+#line 857 "src/parse/lex_conf.cc"
 yy168:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy203;
-	goto yy13;
+	if (yych == 'o') goto yy201;
+	goto yy14;
 yy169:
 	yych = (unsigned char)*++cur;
-	if (yych == 'h') goto yy204;
-	goto yy13;
+	if (yych == 'l') goto yy202;
+	goto yy14;
 yy170:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy205;
-	goto yy13;
+	if (yych == 'x') goto yy203;
+	goto yy14;
 yy171:
 	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy207;
-	goto yy13;
+	if (yych == 'x') goto yy204;
+	goto yy14;
 yy172:
-	yych = (unsigned char)*++cur;
-	if (yych == 'f') goto yy208;
-	goto yy13;
+	yyaccept = 2;
+	yych = (unsigned char)*(ptr = ++cur);
+	ctx = cur;
+	if (yybm[0+yych] & 64) {
+		goto yy206;
+	}
+	if (yych == '=') goto yy208;
 yy173:
-	yych = (unsigned char)*++cur;
-	if (yych == 'C') goto yy209;
-	goto yy13;
+#line 156 "../src/parse/lex_conf.re"
+	{ out.set_user_start_label (lex_conf_string ()); return; }
+#line 885 "src/parse/lex_conf.cc"
 yy174:
 	yych = (unsigned char)*++cur;
-	if (yych == 'N') goto yy210;
-	goto yy13;
+	if (yych == 't') goto yy210;
+	goto yy14;
 yy175:
 	yych = (unsigned char)*++cur;
-	if (yych <= 'W') goto yy13;
-	if (yych <= 'X') goto yy211;
-	if (yych <= 'Y') goto yy212;
-	goto yy13;
+	if (yych == 'l') goto yy212;
+	goto yy14;
 yy176:
 	yych = (unsigned char)*++cur;
-	if (yych == 'R') goto yy213;
-	goto yy13;
+	if (yych == 'y') goto yy213;
+	goto yy14;
 yy177:
 	yych = (unsigned char)*++cur;
-	if (yych == 'B') goto yy214;
-	goto yy13;
+	if (yych == 'r') goto yy214;
+	goto yy14;
 yy178:
 	yych = (unsigned char)*++cur;
-	if (yych == 'L') goto yy215;
-	goto yy13;
+	if (yych == 'c') goto yy215;
+	goto yy14;
 yy179:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy216;
-	goto yy13;
+	if (yych == 'b') goto yy216;
+	goto yy14;
 yy180:
 	yych = (unsigned char)*++cur;
-	if (yych == 'S') goto yy217;
-	goto yy13;
+	if (yych == 'a') goto yy217;
+	goto yy14;
 yy181:
 	yych = (unsigned char)*++cur;
-	if (yych == 'M') goto yy218;
-	goto yy13;
+	if (yych == 't') goto yy218;
+	goto yy14;
 yy182:
 	yych = (unsigned char)*++cur;
-	if (yych == 'R') goto yy219;
-	goto yy13;
+	if (yych == 'h') goto yy219;
+	goto yy14;
 yy183:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy220;
-	goto yy13;
+	if (yych == 'r') goto yy220;
+	goto yy14;
 yy184:
 	yych = (unsigned char)*++cur;
-	if (yych == 'S') goto yy221;
-	goto yy13;
+	if (yych == 'o') goto yy222;
+	goto yy14;
 yy185:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy222;
-	goto yy13;
+	if (yych == 'f') goto yy223;
+	goto yy14;
 yy186:
 	yych = (unsigned char)*++cur;
-	if (yych == 'I') goto yy223;
-	goto yy13;
+	if (yych == 'C') goto yy224;
+	goto yy14;
 yy187:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy224;
-	goto yy13;
+	if (yych == 'N') goto yy225;
+	goto yy14;
 yy188:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy225;
-	goto yy13;
+	if (yych <= 'W') goto yy14;
+	if (yych <= 'X') goto yy226;
+	if (yych <= 'Y') goto yy227;
+	goto yy14;
 yy189:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy226;
-	goto yy13;
+	if (yych == 'R') goto yy228;
+	goto yy14;
 yy190:
+	yych = (unsigned char)*++cur;
+	if (yych == 'B') goto yy229;
+	goto yy14;
+yy191:
+	yych = (unsigned char)*++cur;
+	if (yych == 'L') goto yy230;
+	goto yy14;
+yy192:
+	yych = (unsigned char)*++cur;
+	if (yych == 'T') goto yy231;
+	goto yy14;
+yy193:
+	yych = (unsigned char)*++cur;
+	if (yych == 'S') goto yy232;
+	goto yy14;
+yy194:
+	yych = (unsigned char)*++cur;
+	if (yych == 'M') goto yy233;
+	goto yy14;
+yy195:
+	yych = (unsigned char)*++cur;
+	if (yych == 'R') goto yy234;
+	goto yy14;
+yy196:
+	yych = (unsigned char)*++cur;
+	if (yych == 'E') goto yy235;
+	goto yy14;
+yy197:
+	yych = (unsigned char)*++cur;
+	if (yych == 'S') goto yy236;
+	goto yy14;
+yy198:
+	yych = (unsigned char)*++cur;
+	if (yych == 'T') goto yy237;
+	goto yy14;
+yy199:
+	yych = (unsigned char)*++cur;
+	if (yych == 'I') goto yy238;
+	goto yy14;
+yy200:
+	yych = (unsigned char)*++cur;
+	if (yych == 'n') goto yy239;
+	goto yy14;
+yy201:
+	yych = (unsigned char)*++cur;
+	if (yych == 'k') goto yy240;
+	goto yy14;
+yy202:
+	yych = (unsigned char)*++cur;
+	if (yych == 'l') goto yy241;
+	goto yy14;
+yy203:
+	yych = (unsigned char)*++cur;
+	if (yych == 't') goto yy242;
+	goto yy14;
+yy204:
 	++cur;
-#line 147 "../src/parse/lex_conf.re"
+#line 152 "../src/parse/lex_conf.re"
 	{ opts.set_labelPrefix (lex_conf_string ()); return; }
-#line 955 "src/parse/lex_conf.cc"
-yy192:
+#line 1012 "src/parse/lex_conf.cc"
+yy206:
 	++cur;
 	if (lim <= cur) fill(1);
 	yych = (unsigned char)*cur;
 	if (yybm[0+yych] & 64) {
-		goto yy192;
+		goto yy206;
 	}
-	if (yych != '=') goto yy13;
-yy194:
+	if (yych != '=') goto yy14;
+yy208:
 	++cur;
 	if ((lim - cur) < 2) fill(2);
 	yych = (unsigned char)*cur;
 	if (yych <= ',') {
 		if (yych <= '\t') {
-			if (yych <= 0x08) goto yy13;
-			goto yy194;
+			if (yych <= 0x08) goto yy14;
+			goto yy208;
 		} else {
-			if (yych == ' ') goto yy194;
-			goto yy13;
+			if (yych == ' ') goto yy208;
+			goto yy14;
 		}
 	} else {
 		if (yych <= '/') {
-			if (yych <= '-') goto yy228;
-			goto yy13;
+			if (yych <= '-') goto yy244;
+			goto yy14;
 		} else {
-			if (yych <= '0') goto yy229;
-			if (yych <= '9') goto yy231;
-			goto yy13;
+			if (yych <= '0') goto yy245;
+			if (yych <= '9') goto yy247;
+			goto yy14;
 		}
 	}
-yy196:
+yy210:
 	++cur;
 #line 90 "../src/parse/lex_conf.re"
 	{ opts.set_bUseStateAbort  (lex_conf_number () != 0); return; }
-#line 990 "src/parse/lex_conf.cc"
-yy198:
+#line 1047 "src/parse/lex_conf.cc"
+yy212:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy233;
-	goto yy13;
-yy199:
+	if (yych == 'a') goto yy249;
+	goto yy14;
+yy213:
 	yych = (unsigned char)*++cur;
 	if (yych <= 'c') {
-		if (yych <= '`') goto yy13;
-		if (yych <= 'a') goto yy234;
-		if (yych <= 'b') goto yy235;
-		goto yy236;
+		if (yych <= '`') goto yy14;
+		if (yych <= 'a') goto yy250;
+		if (yych <= 'b') goto yy251;
+		goto yy252;
 	} else {
-		if (yych <= 'r') goto yy13;
-		if (yych <= 's') goto yy237;
-		if (yych <= 't') goto yy238;
-		goto yy13;
+		if (yych <= 'r') goto yy14;
+		if (yych <= 's') goto yy253;
+		if (yych <= 't') goto yy254;
+		goto yy14;
 	}
-yy200:
-	yych = (unsigned char)*++cur;
-	if (yych == 's') goto yy239;
-	goto yy13;
-yy201:
-	yych = (unsigned char)*++cur;
-	if (yych == 'k') goto yy240;
-	goto yy13;
-yy202:
-	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy242;
-	goto yy13;
-yy203:
-	yych = (unsigned char)*++cur;
-	if (yych == 'm') goto yy243;
-	goto yy13;
-yy204:
-	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy244;
-	goto yy13;
-yy205:
-	yyaccept = 3;
-	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == '@') goto yy245;
-yy206:
-#line 77 "../src/parse/lex_conf.re"
-	{ opts.set_condDivider      (lex_conf_string ()); return; }
-#line 1035 "src/parse/lex_conf.cc"
-yy207:
-	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy246;
-	goto yy13;
-yy208:
-	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy247;
-	goto yy13;
-yy209:
-	yych = (unsigned char)*++cur;
-	if (yych == 'K') goto yy248;
-	goto yy13;
-yy210:
-	yych = (unsigned char)*++cur;
-	if (yych == 'D') goto yy249;
-	goto yy13;
-yy211:
-	yych = (unsigned char)*++cur;
-	if (yych == 'M') goto yy250;
-	goto yy13;
-yy212:
-	yych = (unsigned char)*++cur;
-	if (yych == 'P') goto yy251;
-	goto yy13;
-yy213:
-	yych = (unsigned char)*++cur;
-	if (yych == 'S') goto yy252;
-	goto yy13;
 yy214:
 	yych = (unsigned char)*++cur;
-	if (yych == 'U') goto yy253;
-	goto yy13;
+	if (yych == 's') goto yy255;
+	goto yy14;
 yy215:
 	yych = (unsigned char)*++cur;
-	if (yych == 'L') goto yy254;
-	goto yy13;
+	if (yych == 'k') goto yy256;
+	goto yy14;
 yy216:
 	yych = (unsigned char)*++cur;
-	if (yych == 'C') goto yy256;
-	if (yych == 'S') goto yy257;
-	goto yy13;
+	if (yych == 'l') goto yy258;
+	goto yy14;
 yy217:
 	yych = (unsigned char)*++cur;
-	if (yych == 'S') goto yy258;
-	goto yy13;
+	if (yych == 'm') goto yy259;
+	goto yy14;
 yy218:
 	yych = (unsigned char)*++cur;
-	if (yych == 'I') goto yy259;
-	goto yy13;
+	if (yych == 'i') goto yy260;
+	goto yy14;
 yy219:
 	yych = (unsigned char)*++cur;
-	if (yych == 'K') goto yy260;
-	goto yy13;
+	if (yych == 'o') goto yy261;
+	goto yy14;
 yy220:
-	yych = (unsigned char)*++cur;
-	if (yych == 'K') goto yy261;
-	goto yy13;
+	yyaccept = 3;
+	yych = (unsigned char)*(ptr = ++cur);
+	if (yych == '@') goto yy262;
 yy221:
-	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy263;
-	goto yy13;
+#line 77 "../src/parse/lex_conf.re"
+	{ opts.set_condDivider      (lex_conf_string ()); return; }
+#line 1096 "src/parse/lex_conf.cc"
 yy222:
 	yych = (unsigned char)*++cur;
-	if (yych == 'C') goto yy264;
-	if (yych == 'S') goto yy265;
-	goto yy13;
+	if (yych == 'n') goto yy263;
+	goto yy14;
 yy223:
 	yych = (unsigned char)*++cur;
-	if (yych == 'P') goto yy266;
-	goto yy13;
+	if (yych == 'i') goto yy264;
+	goto yy14;
 yy224:
 	yych = (unsigned char)*++cur;
-	if (yych == 'g') goto yy268;
-	goto yy13;
+	if (yych == 'K') goto yy265;
+	goto yy14;
 yy225:
 	yych = (unsigned char)*++cur;
-	if (yych == 'L') goto yy270;
-	goto yy13;
+	if (yych == 'D') goto yy266;
+	goto yy14;
 yy226:
-	++cur;
-#line 89 "../src/parse/lex_conf.re"
-	{ opts.set_yynext          (lex_conf_string ()); return; }
-#line 1118 "src/parse/lex_conf.cc"
+	yych = (unsigned char)*++cur;
+	if (yych == 'M') goto yy267;
+	goto yy14;
+yy227:
+	yych = (unsigned char)*++cur;
+	if (yych == 'P') goto yy268;
+	goto yy14;
 yy228:
 	yych = (unsigned char)*++cur;
-	if (yych <= '0') goto yy13;
-	if (yych <= '9') goto yy231;
-	goto yy13;
+	if (yych == 'S') goto yy269;
+	goto yy14;
 yy229:
-	++cur;
+	yych = (unsigned char)*++cur;
+	if (yych == 'U') goto yy270;
+	goto yy14;
 yy230:
-	cur = ctx;
-#line 150 "../src/parse/lex_conf.re"
-	{ out.set_force_start_label (lex_conf_number () != 0); return; }
-#line 1130 "src/parse/lex_conf.cc"
+	yych = (unsigned char)*++cur;
+	if (yych == 'L') goto yy271;
+	goto yy14;
 yy231:
-	++cur;
-	if (lim <= cur) fill(1);
-	yych = (unsigned char)*cur;
-	if (yybm[0+yych] & 128) {
-		goto yy231;
-	}
-	goto yy230;
+	yych = (unsigned char)*++cur;
+	if (yych == 'C') goto yy273;
+	if (yych == 'S') goto yy274;
+	goto yy14;
+yy232:
+	yych = (unsigned char)*++cur;
+	if (yych == 'S') goto yy275;
+	goto yy14;
 yy233:
 	yych = (unsigned char)*++cur;
-	if (yych == 'b') goto yy271;
-	goto yy13;
+	if (yych == 'I') goto yy276;
+	goto yy14;
 yy234:
 	yych = (unsigned char)*++cur;
-	if (yych == 'c') goto yy272;
-	goto yy13;
+	if (yych == 'K') goto yy277;
+	goto yy14;
 yy235:
 	yych = (unsigned char)*++cur;
-	if (yych == 'm') goto yy273;
-	goto yy13;
+	if (yych == 'K') goto yy278;
+	goto yy14;
 yy236:
 	yych = (unsigned char)*++cur;
-	if (yych == 'h') goto yy275;
-	if (yych == 't') goto yy277;
-	goto yy13;
+	if (yych == 'T') goto yy280;
+	goto yy14;
 yy237:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy278;
-	goto yy13;
+	if (yych == 'C') goto yy281;
+	if (yych == 'S') goto yy282;
+	goto yy14;
 yy238:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy279;
-	goto yy13;
+	if (yych == 'P') goto yy283;
+	goto yy14;
 yy239:
 	yych = (unsigned char)*++cur;
-	if (yych == 'i') goto yy280;
-	goto yy13;
+	if (yych == 'g') goto yy285;
+	goto yy14;
 yy240:
-	++cur;
-#line 145 "../src/parse/lex_conf.re"
-	{ opts.set_fill_check   (lex_conf_number () != 0); return; }
-#line 1172 "src/parse/lex_conf.cc"
-yy242:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy281;
-	goto yy13;
-yy243:
+	if (yych == 'e') goto yy287;
+	goto yy14;
+yy241:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy283;
-	goto yy13;
+	if (yych == 'L') goto yy288;
+	goto yy14;
+yy242:
+	++cur;
+#line 89 "../src/parse/lex_conf.re"
+	{ opts.set_yynext          (lex_conf_string ()); return; }
+#line 1183 "src/parse/lex_conf.cc"
 yy244:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy284;
-	goto yy13;
+	if (yych <= '0') goto yy14;
+	if (yych <= '9') goto yy247;
+	goto yy14;
 yy245:
-	yych = (unsigned char)*++cur;
-	if (yych == 'c') goto yy285;
-	goto yy13;
+	++cur;
 yy246:
-	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy286;
-	goto yy13;
+	cur = ctx;
+#line 155 "../src/parse/lex_conf.re"
+	{ out.set_force_start_label (lex_conf_number () != 0); return; }
+#line 1195 "src/parse/lex_conf.cc"
 yy247:
+	++cur;
+	if (lim <= cur) fill(1);
+	yych = (unsigned char)*cur;
+	if (yybm[0+yych] & 128) {
+		goto yy247;
+	}
+	goto yy246;
+yy249:
 	yych = (unsigned char)*++cur;
-	if (yych == 'x') goto yy288;
-	goto yy13;
-yy248:
-	yych = (unsigned char)*++cur;
-	if (yych == 'U') goto yy290;
-	goto yy13;
-yy249:
-	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy291;
-	goto yy13;
+	if (yych == 'b') goto yy289;
+	goto yy14;
 yy250:
 	yych = (unsigned char)*++cur;
-	if (yych == 'A') goto yy292;
-	goto yy13;
+	if (yych == 'c') goto yy290;
+	goto yy14;
 yy251:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy293;
-	goto yy13;
+	if (yych == 'm') goto yy291;
+	goto yy14;
 yy252:
 	yych = (unsigned char)*++cur;
-	if (yych == 'O') goto yy295;
-	goto yy13;
+	if (yych == 'h') goto yy293;
+	if (yych == 't') goto yy295;
+	goto yy14;
 yy253:
 	yych = (unsigned char)*++cur;
-	if (yych == 'G') goto yy296;
-	goto yy13;
+	if (yych == 't') goto yy296;
+	goto yy14;
 yy254:
-	yyaccept = 4;
-	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == ':') goto yy298;
-	if (yych == '@') goto yy299;
-yy255:
-#line 140 "../src/parse/lex_conf.re"
-	{ opts.set_fill         (lex_conf_string ()); return; }
-#line 1229 "src/parse/lex_conf.cc"
-yy256:
 	yych = (unsigned char)*++cur;
-	if (yych == 'O') goto yy300;
-	goto yy13;
-yy257:
+	if (yych == 'a') goto yy297;
+	goto yy14;
+yy255:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy301;
-	goto yy13;
+	if (yych == 'i') goto yy298;
+	goto yy14;
+yy256:
+	++cur;
+#line 149 "../src/parse/lex_conf.re"
+	{ opts.set_fill_check   (lex_conf_number () != 0); return; }
+#line 1237 "src/parse/lex_conf.cc"
 yy258:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy302;
-	goto yy13;
+	if (yych == 'e') goto yy299;
+	goto yy14;
 yy259:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy303;
-	goto yy13;
+	if (yych == 'e') goto yy301;
+	goto yy14;
 yy260:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy305;
-	goto yy13;
+	if (yych == 'n') goto yy302;
+	goto yy14;
 yy261:
-	++cur;
-#line 113 "../src/parse/lex_conf.re"
-	{ opts.set_yypeek       (lex_conf_string ()); return; }
-#line 1254 "src/parse/lex_conf.cc"
+	yych = (unsigned char)*++cur;
+	if (yych == 'l') goto yy303;
+	goto yy14;
+yy262:
+	yych = (unsigned char)*++cur;
+	if (yych == 'c') goto yy304;
+	goto yy14;
 yy263:
 	yych = (unsigned char)*++cur;
-	if (yych == 'O') goto yy306;
-	goto yy13;
+	if (yych == 'd') goto yy305;
+	goto yy14;
 yy264:
 	yych = (unsigned char)*++cur;
-	if (yych == 'O') goto yy307;
-	goto yy13;
+	if (yych == 'x') goto yy307;
+	goto yy14;
 yy265:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy308;
-	goto yy13;
+	if (yych == 'U') goto yy309;
+	goto yy14;
 yy266:
+	yych = (unsigned char)*++cur;
+	if (yych == 'T') goto yy310;
+	goto yy14;
+yy267:
+	yych = (unsigned char)*++cur;
+	if (yych == 'A') goto yy311;
+	goto yy14;
+yy268:
+	yych = (unsigned char)*++cur;
+	if (yych == 'E') goto yy312;
+	goto yy14;
+yy269:
+	yych = (unsigned char)*++cur;
+	if (yych == 'O') goto yy314;
+	goto yy14;
+yy270:
+	yych = (unsigned char)*++cur;
+	if (yych == 'G') goto yy315;
+	goto yy14;
+yy271:
+	yyaccept = 4;
+	yych = (unsigned char)*(ptr = ++cur);
+	if (yych == ':') goto yy317;
+	if (yych == '@') goto yy318;
+yy272:
+#line 144 "../src/parse/lex_conf.re"
+	{ opts.set_fill         (lex_conf_string ()); return; }
+#line 1298 "src/parse/lex_conf.cc"
+yy273:
+	yych = (unsigned char)*++cur;
+	if (yych == 'O') goto yy319;
+	goto yy14;
+yy274:
+	yych = (unsigned char)*++cur;
+	if (yych == 'T') goto yy320;
+	goto yy14;
+yy275:
+	yych = (unsigned char)*++cur;
+	if (yych == 'T') goto yy321;
+	goto yy14;
+yy276:
+	yych = (unsigned char)*++cur;
+	if (yych == 'T') goto yy322;
+	goto yy14;
+yy277:
+	yych = (unsigned char)*++cur;
+	if (yych == 'E') goto yy324;
+	goto yy14;
+yy278:
 	++cur;
-#line 114 "../src/parse/lex_conf.re"
+#line 117 "../src/parse/lex_conf.re"
+	{ opts.set_yypeek       (lex_conf_string ()); return; }
+#line 1323 "src/parse/lex_conf.cc"
+yy280:
+	yych = (unsigned char)*++cur;
+	if (yych == 'O') goto yy325;
+	goto yy14;
+yy281:
+	yych = (unsigned char)*++cur;
+	if (yych == 'O') goto yy326;
+	goto yy14;
+yy282:
+	yych = (unsigned char)*++cur;
+	if (yych == 'T') goto yy327;
+	goto yy14;
+yy283:
+	++cur;
+#line 118 "../src/parse/lex_conf.re"
 	{ opts.set_yyskip       (lex_conf_string ()); return; }
-#line 1271 "src/parse/lex_conf.cc"
-yy268:
+#line 1340 "src/parse/lex_conf.cc"
+yy285:
 	++cur;
-#line 121 "../src/parse/lex_conf.re"
+#line 125 "../src/parse/lex_conf.re"
 	{ opts.set_indString (lex_conf_string ()); return; }
-#line 1276 "src/parse/lex_conf.cc"
-yy270:
+#line 1345 "src/parse/lex_conf.cc"
+yy287:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy309;
-	goto yy13;
-yy271:
+	if (yych == 'n') goto yy328;
+	goto yy14;
+yy288:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy310;
-	goto yy13;
-yy272:
+	if (yych == 'a') goto yy330;
+	goto yy14;
+yy289:
 	yych = (unsigned char)*++cur;
-	if (yych == 'c') goto yy311;
-	goto yy13;
-yy273:
+	if (yych == 'e') goto yy331;
+	goto yy14;
+yy290:
+	yych = (unsigned char)*++cur;
+	if (yych == 'c') goto yy332;
+	goto yy14;
+yy291:
 	++cur;
 #line 94 "../src/parse/lex_conf.re"
 	{ opts.set_yybm         (lex_conf_string ()); return; }
-#line 1293 "src/parse/lex_conf.cc"
-yy275:
+#line 1366 "src/parse/lex_conf.cc"
+yy293:
 	++cur;
-#line 136 "../src/parse/lex_conf.re"
+#line 140 "../src/parse/lex_conf.re"
 	{ opts.set_yych           (lex_conf_string ()); return; }
-#line 1298 "src/parse/lex_conf.cc"
-yy277:
+#line 1371 "src/parse/lex_conf.cc"
+yy295:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy312;
-	goto yy13;
-yy278:
+	if (yych == 'a') goto yy333;
+	goto yy14;
+yy296:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy313;
-	goto yy13;
-yy279:
+	if (yych == 'a') goto yy334;
+	goto yy14;
+yy297:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy314;
-	goto yy13;
-yy280:
+	if (yych == 'b') goto yy335;
+	if (yych == 'r') goto yy336;
+	goto yy14;
+yy298:
 	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy315;
-	goto yy13;
-yy281:
+	if (yych == 'o') goto yy337;
+	goto yy14;
+yy299:
 	++cur;
-#line 141 "../src/parse/lex_conf.re"
+#line 145 "../src/parse/lex_conf.re"
 	{ opts.set_fill_use     (lex_conf_number () != 0); return; }
-#line 1319 "src/parse/lex_conf.cc"
-yy283:
+#line 1393 "src/parse/lex_conf.cc"
+yy301:
+	yych = (unsigned char)*++cur;
+	if (yych == 't') goto yy338;
+	goto yy14;
+yy302:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy316;
-	goto yy13;
-yy284:
+	if (yych == 'e') goto yy339;
+	goto yy14;
+yy303:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy317;
-	goto yy13;
-yy285:
+	if (yych == 'd') goto yy340;
+	goto yy14;
+yy304:
 	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy319;
-	goto yy13;
-yy286:
+	if (yych == 'o') goto yy342;
+	goto yy14;
+yy305:
 	++cur;
 #line 80 "../src/parse/lex_conf.re"
 	{ opts.set_condGotoParam    (lex_conf_string ()); return; }
-#line 1336 "src/parse/lex_conf.cc"
-yy288:
+#line 1414 "src/parse/lex_conf.cc"
+yy307:
 	++cur;
 #line 76 "../src/parse/lex_conf.re"
 	{ opts.set_condEnumPrefix   (lex_conf_string ()); return; }
-#line 1341 "src/parse/lex_conf.cc"
-yy290:
+#line 1419 "src/parse/lex_conf.cc"
+yy309:
 	yych = (unsigned char)*++cur;
-	if (yych == 'P') goto yy320;
-	goto yy13;
-yy291:
+	if (yych == 'P') goto yy343;
+	goto yy14;
+yy310:
 	yych = (unsigned char)*++cur;
-	if (yych == 'Y') goto yy322;
-	goto yy13;
-yy292:
+	if (yych == 'Y') goto yy345;
+	goto yy14;
+yy311:
 	yych = (unsigned char)*++cur;
-	if (yych == 'R') goto yy323;
-	goto yy13;
-yy293:
+	if (yych == 'R') goto yy346;
+	goto yy14;
+yy312:
 	++cur;
-#line 135 "../src/parse/lex_conf.re"
+#line 139 "../src/parse/lex_conf.re"
 	{ opts.set_yyctype        (lex_conf_string ()); return; }
-#line 1358 "src/parse/lex_conf.cc"
-yy295:
+#line 1436 "src/parse/lex_conf.cc"
+yy314:
 	yych = (unsigned char)*++cur;
-	if (yych == 'R') goto yy324;
-	goto yy13;
-yy296:
+	if (yych == 'R') goto yy347;
+	goto yy14;
+yy315:
 	++cur;
-#line 133 "../src/parse/lex_conf.re"
+#line 137 "../src/parse/lex_conf.re"
 	{ opts.set_yydebug (lex_conf_string ()); return; }
-#line 1367 "src/parse/lex_conf.cc"
-yy298:
+#line 1445 "src/parse/lex_conf.cc"
+yy317:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy326;
-	goto yy13;
-yy299:
+	if (yych == 'n') goto yy349;
+	goto yy14;
+yy318:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy327;
-	goto yy13;
-yy300:
+	if (yych == 'l') goto yy350;
+	goto yy14;
+yy319:
 	yych = (unsigned char)*++cur;
-	if (yych == 'N') goto yy328;
-	goto yy13;
-yy301:
+	if (yych == 'N') goto yy351;
+	goto yy14;
+yy320:
 	yych = (unsigned char)*++cur;
-	if (yych == 'A') goto yy329;
-	goto yy13;
-yy302:
+	if (yych == 'A') goto yy352;
+	goto yy14;
+yy321:
 	yych = (unsigned char)*++cur;
-	if (yych == 'H') goto yy330;
-	goto yy13;
-yy303:
+	if (yych == 'H') goto yy353;
+	goto yy14;
+yy322:
 	++cur;
-#line 111 "../src/parse/lex_conf.re"
+#line 115 "../src/parse/lex_conf.re"
 	{ opts.set_yylimit     (lex_conf_string ()); return; }
-#line 1392 "src/parse/lex_conf.cc"
-yy305:
+#line 1470 "src/parse/lex_conf.cc"
+yy324:
 	yych = (unsigned char)*++cur;
-	if (yych == 'R') goto yy331;
-	goto yy13;
-yy306:
+	if (yych == 'R') goto yy354;
+	goto yy14;
+yy325:
 	yych = (unsigned char)*++cur;
-	if (yych == 'R') goto yy333;
-	goto yy13;
-yy307:
+	if (yych == 'R') goto yy356;
+	goto yy14;
+yy326:
 	yych = (unsigned char)*++cur;
-	if (yych == 'N') goto yy334;
-	goto yy13;
-yy308:
+	if (yych == 'N') goto yy357;
+	goto yy14;
+yy327:
 	yych = (unsigned char)*++cur;
-	if (yych == 'A') goto yy335;
-	goto yy13;
-yy309:
+	if (yych == 'A') goto yy358;
+	goto yy14;
+yy328:
+	++cur;
+#line 110 "../src/parse/lex_conf.re"
+	{ opts.set_keywords_token (lex_conf_string ()); return; }
+#line 1491 "src/parse/lex_conf.cc"
+yy330:
 	yych = (unsigned char)*++cur;
-	if (yych == 'b') goto yy336;
-	goto yy13;
-yy310:
+	if (yych == 'b') goto yy359;
+	goto yy14;
+yy331:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy337;
-	goto yy13;
-yy311:
+	if (yych == 'l') goto yy360;
+	goto yy14;
+yy332:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy339;
-	goto yy13;
-yy312:
+	if (yych == 'e') goto yy362;
+	goto yy14;
+yy333:
 	yych = (unsigned char)*++cur;
-	if (yych == 'b') goto yy340;
-	goto yy13;
-yy313:
+	if (yych == 'b') goto yy363;
+	goto yy14;
+yy334:
 	yych = (unsigned char)*++cur;
-	if (yych == 'b') goto yy341;
-	goto yy13;
-yy314:
+	if (yych == 'b') goto yy364;
+	if (yych == 't') goto yy365;
+	goto yy14;
+yy335:
 	yych = (unsigned char)*++cur;
-	if (yych == 'g') goto yy342;
-	goto yy13;
-yy315:
+	if (yych == 'l') goto yy366;
+	goto yy14;
+yy336:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy343;
-	goto yy13;
-yy316:
+	if (yych == 'g') goto yy367;
+	goto yy14;
+yy337:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy345;
-	goto yy13;
-yy317:
+	if (yych == 'n') goto yy368;
+	goto yy14;
+yy338:
+	yych = (unsigned char)*++cur;
+	if (yych == 'e') goto yy370;
+	goto yy14;
+yy339:
+	yych = (unsigned char)*++cur;
+	if (yych == 'l') goto yy371;
+	goto yy14;
+yy340:
 	++cur;
 #line 97 "../src/parse/lex_conf.re"
 	{
@@ -1449,490 +1541,513 @@ yy317:
 		opts.set_cGotoThreshold (static_cast<uint32_t> (n));
 		return;
 	}
-#line 1453 "src/parse/lex_conf.cc"
-yy319:
+#line 1545 "src/parse/lex_conf.cc"
+yy342:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy346;
-	goto yy13;
-yy320:
+	if (yych == 'n') goto yy373;
+	goto yy14;
+yy343:
 	yyaccept = 5;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == 'C') goto yy347;
-yy321:
-#line 115 "../src/parse/lex_conf.re"
+	if (yych == 'C') goto yy374;
+yy344:
+#line 119 "../src/parse/lex_conf.re"
 	{ opts.set_yybackup     (lex_conf_string ()); return; }
-#line 1465 "src/parse/lex_conf.cc"
-yy322:
+#line 1557 "src/parse/lex_conf.cc"
+yy345:
 	yych = (unsigned char)*++cur;
-	if (yych == 'P') goto yy348;
-	goto yy13;
-yy323:
+	if (yych == 'P') goto yy375;
+	goto yy14;
+yy346:
 	yych = (unsigned char)*++cur;
-	if (yych == 'K') goto yy349;
-	goto yy13;
-yy324:
+	if (yych == 'K') goto yy376;
+	goto yy14;
+yy347:
 	++cur;
-#line 108 "../src/parse/lex_conf.re"
+#line 112 "../src/parse/lex_conf.re"
 	{ opts.set_yycursor    (lex_conf_string ()); return; }
-#line 1478 "src/parse/lex_conf.cc"
-yy326:
+#line 1570 "src/parse/lex_conf.cc"
+yy349:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy350;
-	goto yy13;
-yy327:
+	if (yych == 'a') goto yy377;
+	goto yy14;
+yy350:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy351;
-	goto yy13;
-yy328:
+	if (yych == 'e') goto yy378;
+	goto yy14;
+yy351:
 	yych = (unsigned char)*++cur;
-	if (yych == 'D') goto yy352;
-	goto yy13;
-yy329:
+	if (yych == 'D') goto yy379;
+	goto yy14;
+yy352:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy353;
-	goto yy13;
-yy330:
+	if (yych == 'T') goto yy380;
+	goto yy14;
+yy353:
 	yych = (unsigned char)*++cur;
-	if (yych == 'A') goto yy354;
-	goto yy13;
-yy331:
+	if (yych == 'A') goto yy381;
+	goto yy14;
+yy354:
 	++cur;
-#line 109 "../src/parse/lex_conf.re"
+#line 113 "../src/parse/lex_conf.re"
 	{ opts.set_yymarker    (lex_conf_string ()); return; }
-#line 1503 "src/parse/lex_conf.cc"
-yy333:
+#line 1595 "src/parse/lex_conf.cc"
+yy356:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy355;
-	goto yy13;
-yy334:
+	if (yych == 'E') goto yy382;
+	goto yy14;
+yy357:
 	yych = (unsigned char)*++cur;
-	if (yych == 'D') goto yy357;
-	goto yy13;
-yy335:
+	if (yych == 'D') goto yy384;
+	goto yy14;
+yy358:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy358;
-	goto yy13;
-yy336:
+	if (yych == 'T') goto yy385;
+	goto yy14;
+yy359:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy359;
-	goto yy13;
-yy337:
+	if (yych == 'e') goto yy386;
+	goto yy14;
+yy360:
 	++cur;
 #line 91 "../src/parse/lex_conf.re"
 	{ opts.set_bUseStateNext   (lex_conf_number () != 0); return; }
-#line 1524 "src/parse/lex_conf.cc"
-yy339:
+#line 1616 "src/parse/lex_conf.cc"
+yy362:
 	yych = (unsigned char)*++cur;
-	if (yych == 'p') goto yy360;
-	goto yy13;
-yy340:
+	if (yych == 'p') goto yy387;
+	goto yy14;
+yy363:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy361;
-	goto yy13;
-yy341:
+	if (yych == 'l') goto yy388;
+	goto yy14;
+yy364:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy362;
-	goto yy13;
-yy342:
+	if (yych == 'l') goto yy389;
+	goto yy14;
+yy365:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy363;
-	goto yy13;
-yy343:
+	if (yych == 's') goto yy390;
+	goto yy14;
+yy366:
+	yych = (unsigned char)*++cur;
+	if (yych == 'e') goto yy392;
+	goto yy14;
+yy367:
+	yych = (unsigned char)*++cur;
+	if (yych == 'e') goto yy394;
+	goto yy14;
+yy368:
 	++cur;
-#line 137 "../src/parse/lex_conf.re"
+#line 141 "../src/parse/lex_conf.re"
 	{ opts.set_yychConversion (lex_conf_number () != 0); return; }
-#line 1545 "src/parse/lex_conf.cc"
-yy345:
+#line 1645 "src/parse/lex_conf.cc"
+yy370:
 	yych = (unsigned char)*++cur;
-	if (yych == 'r') goto yy364;
-	goto yy13;
-yy346:
+	if (yych == 'r') goto yy395;
+	goto yy14;
+yy371:
+	++cur;
+#line 150 "../src/parse/lex_conf.re"
+	{ opts.set_fill_sentinel (lex_conf_number ()); return; }
+#line 1654 "src/parse/lex_conf.cc"
+yy373:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy366;
-	goto yy13;
-yy347:
+	if (yych == 'd') goto yy397;
+	goto yy14;
+yy374:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy368;
-	goto yy13;
-yy348:
+	if (yych == 'T') goto yy399;
+	goto yy14;
+yy375:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy369;
-	goto yy13;
-yy349:
+	if (yych == 'E') goto yy400;
+	goto yy14;
+yy376:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy371;
-	goto yy13;
-yy350:
+	if (yych == 'E') goto yy402;
+	goto yy14;
+yy377:
 	yych = (unsigned char)*++cur;
-	if (yych == 'k') goto yy372;
-	goto yy13;
-yy351:
+	if (yych == 'k') goto yy403;
+	goto yy14;
+yy378:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy373;
-	goto yy13;
-yy352:
+	if (yych == 'n') goto yy404;
+	goto yy14;
+yy379:
 	yych = (unsigned char)*++cur;
-	if (yych == 'I') goto yy375;
-	goto yy13;
-yy353:
+	if (yych == 'I') goto yy406;
+	goto yy14;
+yy380:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy376;
-	goto yy13;
-yy354:
+	if (yych == 'E') goto yy407;
+	goto yy14;
+yy381:
 	yych = (unsigned char)*++cur;
-	if (yych == 'N') goto yy378;
-	goto yy13;
-yy355:
+	if (yych == 'N') goto yy409;
+	goto yy14;
+yy382:
 	yyaccept = 6;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == 'C') goto yy380;
-yy356:
-#line 117 "../src/parse/lex_conf.re"
+	if (yych == 'C') goto yy411;
+yy383:
+#line 121 "../src/parse/lex_conf.re"
 	{ opts.set_yyrestore    (lex_conf_string ()); return; }
-#line 1593 "src/parse/lex_conf.cc"
-yy357:
+#line 1698 "src/parse/lex_conf.cc"
+yy384:
 	yych = (unsigned char)*++cur;
-	if (yych == 'I') goto yy381;
-	goto yy13;
-yy358:
+	if (yych == 'I') goto yy412;
+	goto yy14;
+yy385:
 	yych = (unsigned char)*++cur;
-	if (yych == 'E') goto yy382;
-	goto yy13;
-yy359:
+	if (yych == 'E') goto yy413;
+	goto yy14;
+yy386:
 	yych = (unsigned char)*++cur;
-	if (yych == 'l') goto yy384;
-	goto yy13;
-yy360:
+	if (yych == 'l') goto yy415;
+	goto yy14;
+yy387:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy386;
-	goto yy13;
-yy361:
+	if (yych == 't') goto yy417;
+	goto yy14;
+yy388:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy388;
-	goto yy13;
-yy362:
+	if (yych == 'e') goto yy419;
+	goto yy14;
+yy389:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy390;
-	goto yy13;
-yy363:
+	if (yych == 'e') goto yy421;
+	goto yy14;
+yy390:
+	++cur;
+#line 108 "../src/parse/lex_conf.re"
+	{ opts.set_yystats (lex_conf_string ()); return; }
+#line 1727 "src/parse/lex_conf.cc"
+yy392:
+	++cur;
+#line 107 "../src/parse/lex_conf.re"
+	{ opts.set_yytable (lex_conf_string ()); return; }
+#line 1732 "src/parse/lex_conf.cc"
+yy394:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy392;
-	goto yy13;
-yy364:
+	if (yych == 't') goto yy423;
+	goto yy14;
+yy395:
 	++cur;
-#line 143 "../src/parse/lex_conf.re"
+#line 147 "../src/parse/lex_conf.re"
 	{ opts.set_fill_arg_use (lex_conf_number () != 0); return; }
-#line 1626 "src/parse/lex_conf.cc"
-yy366:
+#line 1741 "src/parse/lex_conf.cc"
+yy397:
 	++cur;
 #line 78 "../src/parse/lex_conf.re"
 	{ opts.set_condDividerParam (lex_conf_string ()); return; }
-#line 1631 "src/parse/lex_conf.cc"
-yy368:
+#line 1746 "src/parse/lex_conf.cc"
+yy399:
 	yych = (unsigned char)*++cur;
-	if (yych == 'X') goto yy394;
-	goto yy13;
-yy369:
+	if (yych == 'X') goto yy425;
+	goto yy14;
+yy400:
 	++cur;
 #line 69 "../src/parse/lex_conf.re"
 	{ opts.set_yycondtype       (lex_conf_string ()); return; }
-#line 1640 "src/parse/lex_conf.cc"
-yy371:
+#line 1755 "src/parse/lex_conf.cc"
+yy402:
 	yych = (unsigned char)*++cur;
-	if (yych == 'R') goto yy396;
-	goto yy13;
-yy372:
+	if (yych == 'R') goto yy427;
+	goto yy14;
+yy403:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy398;
-	goto yy13;
-yy373:
+	if (yych == 'e') goto yy429;
+	goto yy14;
+yy404:
 	++cur;
-#line 142 "../src/parse/lex_conf.re"
+#line 146 "../src/parse/lex_conf.re"
 	{ opts.set_fill_arg     (lex_conf_string ()); return; }
-#line 1653 "src/parse/lex_conf.cc"
-yy375:
+#line 1768 "src/parse/lex_conf.cc"
+yy406:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy399;
-	goto yy13;
-yy376:
+	if (yych == 'T') goto yy430;
+	goto yy14;
+yy407:
 	yyaccept = 7;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == ':') goto yy400;
-yy377:
+	if (yych == ':') goto yy431;
+yy408:
 #line 83 "../src/parse/lex_conf.re"
 	{ opts.set_state_get       (lex_conf_string ()); return; }
-#line 1665 "src/parse/lex_conf.cc"
-yy378:
+#line 1780 "src/parse/lex_conf.cc"
+yy409:
 	++cur;
-#line 119 "../src/parse/lex_conf.re"
+#line 123 "../src/parse/lex_conf.re"
 	{ opts.set_yylessthan   (lex_conf_string ()); return; }
-#line 1670 "src/parse/lex_conf.cc"
-yy380:
+#line 1785 "src/parse/lex_conf.cc"
+yy411:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy401;
-	goto yy13;
-yy381:
+	if (yych == 'T') goto yy432;
+	goto yy14;
+yy412:
 	yych = (unsigned char)*++cur;
-	if (yych == 'T') goto yy402;
-	goto yy13;
-yy382:
+	if (yych == 'T') goto yy433;
+	goto yy14;
+yy413:
 	yyaccept = 8;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == ':') goto yy403;
-	if (yych == '@') goto yy404;
-yy383:
+	if (yych == ':') goto yy434;
+	if (yych == '@') goto yy435;
+yy414:
 #line 85 "../src/parse/lex_conf.re"
 	{ opts.set_state_set       (lex_conf_string ()); return; }
-#line 1687 "src/parse/lex_conf.cc"
-yy384:
+#line 1802 "src/parse/lex_conf.cc"
+yy415:
 	++cur;
 #line 88 "../src/parse/lex_conf.re"
 	{ opts.set_yyfilllabel     (lex_conf_string ()); return; }
-#line 1692 "src/parse/lex_conf.cc"
-yy386:
+#line 1807 "src/parse/lex_conf.cc"
+yy417:
 	++cur;
 #line 92 "../src/parse/lex_conf.re"
 	{ opts.set_yyaccept        (lex_conf_string ()); return; }
-#line 1697 "src/parse/lex_conf.cc"
-yy388:
+#line 1812 "src/parse/lex_conf.cc"
+yy419:
 	++cur;
 #line 81 "../src/parse/lex_conf.re"
 	{ opts.set_yyctable         (lex_conf_string ()); return; }
-#line 1702 "src/parse/lex_conf.cc"
-yy390:
+#line 1817 "src/parse/lex_conf.cc"
+yy421:
 	++cur;
-#line 154 "../src/parse/lex_conf.re"
+#line 159 "../src/parse/lex_conf.re"
 	{ lex_conf_string (); return; }
-#line 1707 "src/parse/lex_conf.cc"
-yy392:
+#line 1822 "src/parse/lex_conf.cc"
+yy423:
 	++cur;
 #line 106 "../src/parse/lex_conf.re"
 	{ opts.set_yytarget (lex_conf_string ()); return; }
-#line 1712 "src/parse/lex_conf.cc"
-yy394:
+#line 1827 "src/parse/lex_conf.cc"
+yy425:
 	++cur;
-#line 116 "../src/parse/lex_conf.re"
+#line 120 "../src/parse/lex_conf.re"
 	{ opts.set_yybackupctx  (lex_conf_string ()); return; }
-#line 1717 "src/parse/lex_conf.cc"
-yy396:
+#line 1832 "src/parse/lex_conf.cc"
+yy427:
 	++cur;
-#line 110 "../src/parse/lex_conf.re"
+#line 114 "../src/parse/lex_conf.re"
 	{ opts.set_yyctxmarker (lex_conf_string ()); return; }
-#line 1722 "src/parse/lex_conf.cc"
-yy398:
+#line 1837 "src/parse/lex_conf.cc"
+yy429:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy405;
-	goto yy13;
-yy399:
+	if (yych == 'd') goto yy436;
+	goto yy14;
+yy430:
 	yych = (unsigned char)*++cur;
-	if (yych == 'I') goto yy407;
-	goto yy13;
-yy400:
+	if (yych == 'I') goto yy438;
+	goto yy14;
+yy431:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy408;
-	goto yy13;
-yy401:
+	if (yych == 'n') goto yy439;
+	goto yy14;
+yy432:
 	yych = (unsigned char)*++cur;
-	if (yych == 'X') goto yy409;
-	goto yy13;
-yy402:
+	if (yych == 'X') goto yy440;
+	goto yy14;
+yy433:
 	yych = (unsigned char)*++cur;
-	if (yych == 'I') goto yy411;
-	goto yy13;
-yy403:
+	if (yych == 'I') goto yy442;
+	goto yy14;
+yy434:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy412;
-	goto yy13;
-yy404:
+	if (yych == 'n') goto yy443;
+	goto yy14;
+yy435:
 	yych = (unsigned char)*++cur;
-	if (yych == 's') goto yy413;
-	goto yy13;
-yy405:
+	if (yych == 's') goto yy444;
+	goto yy14;
+yy436:
 	++cur;
-#line 144 "../src/parse/lex_conf.re"
+#line 148 "../src/parse/lex_conf.re"
 	{ opts.set_fill_naked   (lex_conf_number () != 0); return; }
-#line 1755 "src/parse/lex_conf.cc"
-yy407:
+#line 1870 "src/parse/lex_conf.cc"
+yy438:
 	yych = (unsigned char)*++cur;
-	if (yych == 'O') goto yy414;
-	goto yy13;
-yy408:
+	if (yych == 'O') goto yy445;
+	goto yy14;
+yy439:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy415;
-	goto yy13;
-yy409:
+	if (yych == 'a') goto yy446;
+	goto yy14;
+yy440:
 	++cur;
-#line 118 "../src/parse/lex_conf.re"
+#line 122 "../src/parse/lex_conf.re"
 	{ opts.set_yyrestorectx (lex_conf_string ()); return; }
-#line 1768 "src/parse/lex_conf.cc"
-yy411:
+#line 1883 "src/parse/lex_conf.cc"
+yy442:
 	yych = (unsigned char)*++cur;
-	if (yych == 'O') goto yy416;
-	goto yy13;
-yy412:
+	if (yych == 'O') goto yy447;
+	goto yy14;
+yy443:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy417;
-	goto yy13;
-yy413:
+	if (yych == 'a') goto yy448;
+	goto yy14;
+yy444:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy418;
-	goto yy13;
-yy414:
+	if (yych == 't') goto yy449;
+	goto yy14;
+yy445:
 	yych = (unsigned char)*++cur;
-	if (yych == 'N') goto yy419;
-	goto yy13;
-yy415:
+	if (yych == 'N') goto yy450;
+	goto yy14;
+yy446:
 	yych = (unsigned char)*++cur;
-	if (yych == 'k') goto yy421;
-	goto yy13;
-yy416:
+	if (yych == 'k') goto yy452;
+	goto yy14;
+yy447:
 	yych = (unsigned char)*++cur;
-	if (yych == 'N') goto yy422;
-	goto yy13;
-yy417:
+	if (yych == 'N') goto yy453;
+	goto yy14;
+yy448:
 	yych = (unsigned char)*++cur;
-	if (yych == 'k') goto yy424;
-	goto yy13;
-yy418:
+	if (yych == 'k') goto yy455;
+	goto yy14;
+yy449:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy425;
-	goto yy13;
-yy419:
+	if (yych == 'a') goto yy456;
+	goto yy14;
+yy450:
 	yyaccept = 9;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == ':') goto yy426;
-yy420:
+	if (yych == ':') goto yy457;
+yy451:
 #line 70 "../src/parse/lex_conf.re"
 	{ opts.set_cond_get         (lex_conf_string ()); return; }
-#line 1808 "src/parse/lex_conf.cc"
-yy421:
+#line 1923 "src/parse/lex_conf.cc"
+yy452:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy427;
-	goto yy13;
-yy422:
+	if (yych == 'e') goto yy458;
+	goto yy14;
+yy453:
 	yyaccept = 10;
 	yych = (unsigned char)*(ptr = ++cur);
-	if (yych == ':') goto yy428;
-	if (yych == '@') goto yy429;
-yy423:
+	if (yych == ':') goto yy459;
+	if (yych == '@') goto yy460;
+yy454:
 #line 72 "../src/parse/lex_conf.re"
 	{ opts.set_cond_set         (lex_conf_string ()); return; }
-#line 1821 "src/parse/lex_conf.cc"
-yy424:
+#line 1936 "src/parse/lex_conf.cc"
+yy455:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy430;
-	goto yy13;
-yy425:
+	if (yych == 'e') goto yy461;
+	goto yy14;
+yy456:
 	yych = (unsigned char)*++cur;
-	if (yych == 't') goto yy431;
-	goto yy13;
-yy426:
+	if (yych == 't') goto yy462;
+	goto yy14;
+yy457:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy432;
-	goto yy13;
-yy427:
+	if (yych == 'n') goto yy463;
+	goto yy14;
+yy458:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy433;
-	goto yy13;
-yy428:
+	if (yych == 'd') goto yy464;
+	goto yy14;
+yy459:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy435;
-	goto yy13;
-yy429:
+	if (yych == 'n') goto yy466;
+	goto yy14;
+yy460:
 	yych = (unsigned char)*++cur;
-	if (yych == 'c') goto yy436;
-	goto yy13;
-yy430:
+	if (yych == 'c') goto yy467;
+	goto yy14;
+yy461:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy437;
-	goto yy13;
-yy431:
+	if (yych == 'd') goto yy468;
+	goto yy14;
+yy462:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy439;
-	goto yy13;
-yy432:
+	if (yych == 'e') goto yy470;
+	goto yy14;
+yy463:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy441;
-	goto yy13;
-yy433:
+	if (yych == 'a') goto yy472;
+	goto yy14;
+yy464:
 	++cur;
 #line 84 "../src/parse/lex_conf.re"
 	{ opts.set_state_get_naked (lex_conf_number () != 0); return; }
-#line 1862 "src/parse/lex_conf.cc"
-yy435:
+#line 1977 "src/parse/lex_conf.cc"
+yy466:
 	yych = (unsigned char)*++cur;
-	if (yych == 'a') goto yy442;
-	goto yy13;
-yy436:
+	if (yych == 'a') goto yy473;
+	goto yy14;
+yy467:
 	yych = (unsigned char)*++cur;
-	if (yych == 'o') goto yy443;
-	goto yy13;
-yy437:
+	if (yych == 'o') goto yy474;
+	goto yy14;
+yy468:
 	++cur;
 #line 86 "../src/parse/lex_conf.re"
 	{ opts.set_state_set_naked (lex_conf_number () != 0); return; }
-#line 1875 "src/parse/lex_conf.cc"
-yy439:
+#line 1990 "src/parse/lex_conf.cc"
+yy470:
 	++cur;
 #line 87 "../src/parse/lex_conf.re"
 	{ opts.set_state_set_arg   (lex_conf_string ()); return; }
-#line 1880 "src/parse/lex_conf.cc"
-yy441:
+#line 1995 "src/parse/lex_conf.cc"
+yy472:
 	yych = (unsigned char)*++cur;
-	if (yych == 'k') goto yy444;
-	goto yy13;
-yy442:
+	if (yych == 'k') goto yy475;
+	goto yy14;
+yy473:
 	yych = (unsigned char)*++cur;
-	if (yych == 'k') goto yy445;
-	goto yy13;
-yy443:
+	if (yych == 'k') goto yy476;
+	goto yy14;
+yy474:
 	yych = (unsigned char)*++cur;
-	if (yych == 'n') goto yy446;
-	goto yy13;
-yy444:
+	if (yych == 'n') goto yy477;
+	goto yy14;
+yy475:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy447;
-	goto yy13;
-yy445:
+	if (yych == 'e') goto yy478;
+	goto yy14;
+yy476:
 	yych = (unsigned char)*++cur;
-	if (yych == 'e') goto yy448;
-	goto yy13;
-yy446:
+	if (yych == 'e') goto yy479;
+	goto yy14;
+yy477:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy449;
-	goto yy13;
-yy447:
+	if (yych == 'd') goto yy480;
+	goto yy14;
+yy478:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy451;
-	goto yy13;
-yy448:
+	if (yych == 'd') goto yy482;
+	goto yy14;
+yy479:
 	yych = (unsigned char)*++cur;
-	if (yych == 'd') goto yy453;
-	goto yy13;
-yy449:
+	if (yych == 'd') goto yy484;
+	goto yy14;
+yy480:
 	++cur;
 #line 73 "../src/parse/lex_conf.re"
 	{ opts.set_cond_set_arg     (lex_conf_string ()); return; }
-#line 1917 "src/parse/lex_conf.cc"
-yy451:
+#line 2032 "src/parse/lex_conf.cc"
+yy482:
 	++cur;
 #line 71 "../src/parse/lex_conf.re"
 	{ opts.set_cond_get_naked   (lex_conf_number () != 0); return; }
-#line 1922 "src/parse/lex_conf.cc"
-yy453:
+#line 2037 "src/parse/lex_conf.cc"
+yy484:
 	++cur;
 #line 74 "../src/parse/lex_conf.re"
 	{ opts.set_cond_set_naked   (lex_conf_number () != 0); return; }
-#line 1927 "src/parse/lex_conf.cc"
+#line 2042 "src/parse/lex_conf.cc"
 }
-#line 155 "../src/parse/lex_conf.re"
+#line 160 "../src/parse/lex_conf.re"
 
 }
 
 void Scanner::lex_conf_assign ()
 {
 
-#line 1936 "src/parse/lex_conf.cc"
+#line 2051 "src/parse/lex_conf.cc"
 {
 	unsigned char yych;
 	static const unsigned char yybm[] = {
@@ -1972,56 +2087,56 @@ void Scanner::lex_conf_assign ()
 	if ((lim - cur) < 2) fill(2);
 	yych = (unsigned char)*cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy459;
+		if (yych == '\t') goto yy490;
 	} else {
-		if (yych <= ' ') goto yy459;
-		if (yych == '=') goto yy460;
+		if (yych <= ' ') goto yy490;
+		if (yych == '=') goto yy491;
 	}
 	++cur;
-yy458:
-#line 161 "../src/parse/lex_conf.re"
+yy489:
+#line 166 "../src/parse/lex_conf.re"
 	{ fatal ("missing '=' in configuration"); }
-#line 1985 "src/parse/lex_conf.cc"
-yy459:
+#line 2100 "src/parse/lex_conf.cc"
+yy490:
 	yych = (unsigned char)*(ptr = ++cur);
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy463;
-		goto yy458;
+		if (yych == '\t') goto yy494;
+		goto yy489;
 	} else {
-		if (yych <= ' ') goto yy463;
-		if (yych != '=') goto yy458;
+		if (yych <= ' ') goto yy494;
+		if (yych != '=') goto yy489;
 	}
-yy460:
+yy491:
 	++cur;
 	if (lim <= cur) fill(1);
 	yych = (unsigned char)*cur;
 	if (yybm[0+yych] & 128) {
-		goto yy460;
+		goto yy491;
 	}
-#line 162 "../src/parse/lex_conf.re"
+#line 167 "../src/parse/lex_conf.re"
 	{ return; }
-#line 2004 "src/parse/lex_conf.cc"
-yy463:
+#line 2119 "src/parse/lex_conf.cc"
+yy494:
 	++cur;
 	if (lim <= cur) fill(1);
 	yych = (unsigned char)*cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy463;
+		if (yych == '\t') goto yy494;
 	} else {
-		if (yych <= ' ') goto yy463;
-		if (yych == '=') goto yy460;
+		if (yych <= ' ') goto yy494;
+		if (yych == '=') goto yy491;
 	}
 	cur = ptr;
-	goto yy458;
+	goto yy489;
 }
-#line 163 "../src/parse/lex_conf.re"
+#line 168 "../src/parse/lex_conf.re"
 
 }
 
 void Scanner::lex_conf_semicolon ()
 {
 
-#line 2025 "src/parse/lex_conf.cc"
+#line 2140 "src/parse/lex_conf.cc"
 {
 	unsigned char yych;
 	static const unsigned char yybm[] = {
@@ -2061,39 +2176,39 @@ void Scanner::lex_conf_semicolon ()
 	if ((lim - cur) < 2) fill(2);
 	yych = (unsigned char)*cur;
 	if (yych <= 0x1F) {
-		if (yych == '\t') goto yy470;
+		if (yych == '\t') goto yy501;
 	} else {
-		if (yych <= ' ') goto yy470;
-		if (yych == ';') goto yy471;
+		if (yych <= ' ') goto yy501;
+		if (yych == ';') goto yy502;
 	}
 	++cur;
-yy469:
-#line 169 "../src/parse/lex_conf.re"
+yy500:
+#line 174 "../src/parse/lex_conf.re"
 	{ fatal ("missing ending ';' in configuration"); }
-#line 2074 "src/parse/lex_conf.cc"
-yy470:
+#line 2189 "src/parse/lex_conf.cc"
+yy501:
 	yych = (unsigned char)*(ptr = ++cur);
 	if (yybm[0+yych] & 128) {
-		goto yy473;
+		goto yy504;
 	}
-	if (yych != ';') goto yy469;
-yy471:
+	if (yych != ';') goto yy500;
+yy502:
 	++cur;
-#line 170 "../src/parse/lex_conf.re"
+#line 175 "../src/parse/lex_conf.re"
 	{ return; }
-#line 2085 "src/parse/lex_conf.cc"
-yy473:
+#line 2200 "src/parse/lex_conf.cc"
+yy504:
 	++cur;
 	if (lim <= cur) fill(1);
 	yych = (unsigned char)*cur;
 	if (yybm[0+yych] & 128) {
-		goto yy473;
+		goto yy504;
 	}
-	if (yych == ';') goto yy471;
+	if (yych == ';') goto yy502;
 	cur = ptr;
-	goto yy469;
+	goto yy500;
 }
-#line 171 "../src/parse/lex_conf.re"
+#line 176 "../src/parse/lex_conf.re"
 
 }
 
@@ -2102,7 +2217,7 @@ int32_t Scanner::lex_conf_number ()
 	lex_conf_assign ();
 	tok = cur;
 
-#line 2106 "src/parse/lex_conf.cc"
+#line 2221 "src/parse/lex_conf.cc"
 {
 	unsigned char yych;
 	static const unsigned char yybm[] = {
@@ -2142,21 +2257,21 @@ int32_t Scanner::lex_conf_number ()
 	if ((lim - cur) < 2) fill(2);
 	yych = (unsigned char)*cur;
 	if (yych <= '/') {
-		if (yych == '-') goto yy479;
+		if (yych == '-') goto yy510;
 	} else {
-		if (yych <= '0') goto yy480;
-		if (yych <= '9') goto yy482;
+		if (yych <= '0') goto yy511;
+		if (yych <= '9') goto yy513;
 	}
-yy478:
-yy479:
+yy509:
+yy510:
 	yych = (unsigned char)*++cur;
-	if (yych <= '0') goto yy478;
-	if (yych <= '9') goto yy482;
-	goto yy478;
-yy480:
+	if (yych <= '0') goto yy509;
+	if (yych <= '9') goto yy513;
+	goto yy509;
+yy511:
 	++cur;
-yy481:
-#line 180 "../src/parse/lex_conf.re"
+yy512:
+#line 185 "../src/parse/lex_conf.re"
 	{
 		int32_t n = 0;
 		if (!s_to_i32_unsafe (tok, cur, n))
@@ -2166,17 +2281,17 @@ yy481:
 		lex_conf_semicolon ();
 		return n;
 	}
-#line 2170 "src/parse/lex_conf.cc"
-yy482:
+#line 2285 "src/parse/lex_conf.cc"
+yy513:
 	++cur;
 	if (lim <= cur) fill(1);
 	yych = (unsigned char)*cur;
 	if (yybm[0+yych] & 128) {
-		goto yy482;
+		goto yy513;
 	}
-	goto yy481;
+	goto yy512;
 }
-#line 189 "../src/parse/lex_conf.re"
+#line 194 "../src/parse/lex_conf.re"
 
 }
 
@@ -2186,7 +2301,7 @@ std::string Scanner::lex_conf_string ()
 	std::string s;
 	tok = cur;
 
-#line 2190 "src/parse/lex_conf.cc"
+#line 2305 "src/parse/lex_conf.cc"
 {
 	unsigned char yych;
 	static const unsigned char yybm[] = {
@@ -2227,37 +2342,37 @@ std::string Scanner::lex_conf_string ()
 	yych = (unsigned char)*cur;
 	if (yych <= '!') {
 		if (yych <= '\n') {
-			if (yych <= 0x08) goto yy487;
+			if (yych <= 0x08) goto yy518;
 		} else {
-			if (yych != ' ') goto yy487;
+			if (yych != ' ') goto yy518;
 		}
 	} else {
 		if (yych <= '\'') {
-			if (yych <= '"') goto yy489;
-			if (yych <= '&') goto yy487;
-			goto yy489;
+			if (yych <= '"') goto yy520;
+			if (yych <= '&') goto yy518;
+			goto yy520;
 		} else {
-			if (yych != ';') goto yy487;
+			if (yych != ';') goto yy518;
 		}
 	}
-yy486:
-#line 212 "../src/parse/lex_conf.re"
+yy517:
+#line 217 "../src/parse/lex_conf.re"
 	{
 		s = std::string(tok, tok_len());
 		goto end;
 	}
-#line 2250 "src/parse/lex_conf.cc"
-yy487:
+#line 2365 "src/parse/lex_conf.cc"
+yy518:
 	++cur;
 	if (lim <= cur) fill(1);
 	yych = (unsigned char)*cur;
 	if (yybm[0+yych] & 128) {
-		goto yy487;
+		goto yy518;
 	}
-	goto yy486;
-yy489:
+	goto yy517;
+yy520:
 	++cur;
-#line 198 "../src/parse/lex_conf.re"
+#line 203 "../src/parse/lex_conf.re"
 	{
 		const char quote = tok[0];
 		for (bool end;;) {
@@ -2272,9 +2387,9 @@ yy489:
 			}
 		}
 	}
-#line 2276 "src/parse/lex_conf.cc"
+#line 2391 "src/parse/lex_conf.cc"
 }
-#line 216 "../src/parse/lex_conf.re"
+#line 221 "../src/parse/lex_conf.re"
 
 end:
 	lex_conf_semicolon ();
@@ -1,22 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.4.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-/* Skeleton interface for Bison's Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006,
-   2009, 2010 Free Software Foundation, Inc.
-   
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -27,38 +27,53 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_BOOTSTRAP_SRC_PARSE_Y_TAB_H_INCLUDED
+# define YY_YY_BOOTSTRAP_SRC_PARSE_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
 
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     TOKEN_CLOSE = 258,
-     TOKEN_CLOSESIZE = 259,
-     TOKEN_CODE = 260,
-     TOKEN_CONF = 261,
-     TOKEN_ID = 262,
-     TOKEN_FID = 263,
-     TOKEN_FID_END = 264,
-     TOKEN_NOCOND = 265,
-     TOKEN_REGEXP = 266,
-     TOKEN_SETUP = 267,
-     TOKEN_STAR = 268
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    TOKEN_CLOSE = 258,             /* TOKEN_CLOSE  */
+    TOKEN_CLOSESIZE = 259,         /* TOKEN_CLOSESIZE  */
+    TOKEN_CODE = 260,              /* TOKEN_CODE  */
+    TOKEN_CONF = 261,              /* TOKEN_CONF  */
+    TOKEN_ID = 262,                /* TOKEN_ID  */
+    TOKEN_FID = 263,               /* TOKEN_FID  */
+    TOKEN_FID_END = 264,           /* TOKEN_FID_END  */
+    TOKEN_NOCOND = 265,            /* TOKEN_NOCOND  */
+    TOKEN_REGEXP = 266,            /* TOKEN_REGEXP  */
+    TOKEN_SETUP = 267,             /* TOKEN_SETUP  */
+    TOKEN_STAR = 268               /* TOKEN_STAR  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
-
-
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
 
-
 	re2c::RegExp * regexp;
 	const re2c::Code * code;
 	char op;
@@ -67,13 +82,17 @@ typedef union YYSTYPE
 	re2c::CondList * clist;
 
 
-
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
 
+int yyparse (void);
+
+
+#endif /* !YY_YY_BOOTSTRAP_SRC_PARSE_Y_TAB_H_INCLUDED  */
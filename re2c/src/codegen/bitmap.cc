@@ -1,33 +1,99 @@
 #include <algorithm> // min
 #include <string.h> // memset
+#include <string>
 
 #include "src/codegen/bitmap.h"
 #include "src/codegen/go.h"
 #include "src/codegen/output.h"
 #include "src/conf/opt.h"
 #include "src/globals.h"
+#include "src/ir/adfa/adfa.h"
 
 namespace re2c
 {
 
-BitMap *BitMap::first = NULL;
+/*
+ * note [wide tables]
+ *
+ * Bitmaps and computed-goto tables have one entry per code unit, so
+ * they only cover code units below 0x100: with '-w', '-x' and '-u'
+ * transitions on wider code units are nested 'if' over high spans.
+ * Character classes of non-Latin scripts have many high spans, and
+ * binary search over them is slow.
+ *
+ * If a state has at least 're2c:cgoto:threshold' high spans, high code
+ * units are classified with two-level tables instead: code unit 'c' is
+ * split into page 'c >> 8' and offset 'c & 0xFF'; the page map of the
+ * state gives the index of the page, and the page gives bitmap mask or
+ * jump target. Most pages are uniform (all code units in the page go
+ * to the same state), so identical pages are shared by all states of
+ * the DFA, and so are identical page maps. Page 0 is never looked up:
+ * low code units are handled by the ordinary bitmap or jump table.
+ *
+ * With '-b' the bitmap of a state is extended to high code units and
+ * the remaining high spans are still nested 'if'. With '-g' the whole
+ * high part is a jump table. Values above the last code unit are out
+ * of table bounds and are checked explicitly: YYCTYPE is not required
+ * to be exactly as wide as code units (a 32-bit YYCTYPE with '-w' is
+ * common), so the check is needed for every encoding.
+ */
+uint32_t wide_pages()
+{
+	return opts->encoding.nCodeUnits() >> 8;
+}
+
+// element type for indices of n pages
+static const char *page_index_type(size_t n)
+{
+	return n <= 0x100
+		? "unsigned char"
+		: n <= 0x10000 ? "unsigned short" : "unsigned int";
+}
+
+static void gen_page_maps(OutputFile &o, uint32_t ind, const std::string &name, const std::vector<uint32_t> &maps, size_t npages)
+{
+	o.wind(ind).ws("static const ").ws(page_index_type(npages)).ws(" ").wstring(name).ws("[] = {");
+	for (size_t j = 0; j < maps.size(); ++j)
+	{
+		if (j % 8 == 0)
+		{
+			o.ws("\n").wind(ind+1);
+		}
+		o.wu32_width(maps[j], 3).ws(", ");
+	}
+	o.ws("\n").wind(ind).ws("};\n");
+}
 
-BitMap::BitMap(const Go *g, const State *x)
+BitMap::BitMap(const Go *g, const State *x, const BitMap *n)
 	: go(g)
 	, on(x)
-	, next(first)
+	, next(n)
 	, i(0)
 	, m(0)
-{
-	first = this;
-}
+{}
 
 BitMap::~BitMap()
 {
 	delete next;
 }
 
-const BitMap *BitMap::find(const Go *g, const State *x)
+bitmaps_t::bitmaps_t()
+	: first(NULL)
+	, jumps()
+	, jump_maps()
+	, uniform_jumps()
+	, mixed_jumps()
+	, jump_map_offsets()
+	, used(false)
+	, used_wide(false)
+{}
+
+bitmaps_t::~bitmaps_t()
+{
+	delete first;
+}
+
+const BitMap *bitmaps_t::find(const Go *g, const State *x)
 {
 	for (const BitMap *b = first; b; b = b->next)
 	{
@@ -37,10 +103,10 @@ const BitMap *BitMap::find(const Go *g, const State *x)
 		}
 	}
 
-	return new BitMap(g, x);
+	return first = new BitMap(g, x, first);
 }
 
-const BitMap *BitMap::find(const State *x)
+const BitMap *bitmaps_t::find(const State *x) const
 {
 	for (const BitMap *b = first; b; b = b->next)
 	{
@@ -53,6 +119,56 @@ const BitMap *BitMap::find(const State *x)
 	return NULL;
 }
 
+// returns offset of the page map of the given spans in jump tables
+uint32_t bitmaps_t::add_jumps(const Span *span, uint32_t nSpans)
+{
+	const uint32_t npages = wide_pages();
+	std::vector<uint32_t> map(npages, 0);
+	std::vector<const State*> page(0x100);
+	uint32_t i = 0;
+
+	for (uint32_t p = 1; p < npages; ++p)
+	{
+		const uint32_t lb = p << 8, ub = lb + 0x100;
+		for (; i + 1 < nSpans && span[i].ub <= lb; ++i);
+
+		if (span[i].ub >= ub || i + 1 == nSpans)
+		{
+			const State *to = span[i].to;
+			std::map<const State*, uint32_t>::const_iterator u = uniform_jumps.find(to);
+			if (u == uniform_jumps.end())
+			{
+				u = uniform_jumps.insert(std::make_pair(to, static_cast<uint32_t>(jumps.size() >> 8))).first;
+				jumps.insert(jumps.end(), 0x100, to);
+			}
+			map[p] = u->second;
+		}
+		else
+		{
+			for (uint32_t c = lb, j = i; c < ub; ++c)
+			{
+				for (; j + 1 < nSpans && span[j].ub <= c; ++j);
+				page[c - lb] = span[j].to;
+			}
+			std::map<std::vector<const State*>, uint32_t>::const_iterator m = mixed_jumps.find(page);
+			if (m == mixed_jumps.end())
+			{
+				m = mixed_jumps.insert(std::make_pair(page, static_cast<uint32_t>(jumps.size() >> 8))).first;
+				jumps.insert(jumps.end(), page.begin(), page.end());
+			}
+			map[p] = m->second;
+		}
+	}
+
+	std::map<std::vector<uint32_t>, uint32_t>::const_iterator k = jump_map_offsets.find(map);
+	if (k == jump_map_offsets.end())
+	{
+		k = jump_map_offsets.insert(std::make_pair(map, static_cast<uint32_t>(jump_maps.size()))).first;
+		jump_maps.insert(jump_maps.end(), map.begin(), map.end());
+	}
+	return k->second;
+}
+
 static void doGen(const Go *g, const State *s, uint32_t *bm, uint32_t f, uint32_t m)
 {
 	Span *b = g->span, *e = &b[g->nSpans];
@@ -72,9 +188,9 @@ static void doGen(const Go *g, const State *s, uint32_t *bm, uint32_t f, uint32_
 	}
 }
 
-void BitMap::gen(OutputFile & o, uint32_t ind, uint32_t lb, uint32_t ub)
+void bitmaps_t::gen(OutputFile & o, uint32_t ind, uint32_t lb, uint32_t ub) const
 {
-	if (first && bUsedYYBitmap)
+	if (first && used)
 	{
 		o.wind(ind).ws("static const unsigned char ").wstring(opts->yybm).ws("[] = {");
 
@@ -127,7 +243,112 @@ void BitMap::gen(OutputFile & o, uint32_t ind, uint32_t lb, uint32_t ub)
 		o.ws("\n").wind(ind).ws("};\n");
 		
 		delete[] bm;
+
+		if (used_wide)
+		{
+			gen_wide(o, ind);
+		}
+	}
+	if (!jump_maps.empty())
+	{
+		gen_jumps(o, ind);
+	}
+}
+
+// high part of bitmaps: 8 bitmaps share page maps, just like 'yybm'
+void bitmaps_t::gen_wide(OutputFile &o, uint32_t ind) const
+{
+	const uint32_t npages = wide_pages();
+	std::vector<uint8_t> bm((npages - 1) << 8);
+	std::vector<uint8_t> pages;
+	std::map<std::vector<uint8_t>, uint32_t> index;
+	std::vector<uint32_t> maps;
+
+	for (const BitMap *b = first; b;)
+	{
+		std::fill(bm.begin(), bm.end(), 0);
+		for (uint32_t m = 0x80; b && m; m >>= 1)
+		{
+			Span *x = b->go->span, *e = &x[b->go->nSpans];
+			for (uint32_t lb = 0; x < e; lb = x->ub, ++x)
+			{
+				if (x->to == b->on)
+				{
+					for (uint32_t c = std::max(lb, 0x100u); c < x->ub; ++c)
+					{
+						bm[c - 0x100] |= static_cast<uint8_t>(m);
+					}
+				}
+			}
+			b = b->next;
+		}
+
+		maps.push_back(0);
+		for (uint32_t p = 1; p < npages; ++p)
+		{
+			const std::vector<uint8_t> page(&bm[(p - 1) << 8], &bm[(p - 1) << 8] + 0x100);
+			std::map<std::vector<uint8_t>, uint32_t>::const_iterator i = index.find(page);
+			if (i == index.end())
+			{
+				i = index.insert(std::make_pair(page, static_cast<uint32_t>(pages.size() >> 8))).first;
+				pages.insert(pages.end(), page.begin(), page.end());
+			}
+			maps.push_back(i->second);
+		}
+	}
+
+	gen_page_maps(o, ind, opts->yybm + "_map", maps, pages.size() >> 8);
+	o.wind(ind).ws("static const unsigned char ").wstring(opts->yybm).ws("_pages[] = {");
+	for (size_t j = 0; j < pages.size(); ++j)
+	{
+		if (j % 0x100 == 0)
+		{
+			o.ws("\n").wind(ind+1).ws("/* page ").wu64(j >> 8).ws(" */");
+		}
+		if (j % 8 == 0)
+		{
+			o.ws("\n").wind(ind+1);
+		}
+		if (opts->yybmHexTable)
+		{
+			o.wu32_hex(pages[j]);
+		}
+		else
+		{
+			o.wu32_width(pages[j], 3);
+		}
+		o.ws(", ");
+	}
+	o.ws("\n").wind(ind).ws("};\n");
+}
+
+void bitmaps_t::gen_jumps(OutputFile &o, uint32_t ind) const
+{
+	gen_page_maps(o, ind, opts->yytarget + "_map", jump_maps, jumps.size() >> 8);
+
+	uint32_t max_digits = 0;
+	for (size_t j = 0; j < jumps.size(); ++j)
+	{
+		max_digits = std::max(max_digits, jumps[j]->label.width());
+	}
+	o.wind(ind).ws("static void *").wstring(opts->yytarget).ws("_pages[] = {");
+	for (size_t j = 0; j < jumps.size(); ++j)
+	{
+		if (j % 0x100 == 0)
+		{
+			o.ws("\n").wind(ind+1).ws("/* page ").wu64(j >> 8).ws(" */");
+		}
+		if (j % 8 == 0)
+		{
+			o.ws("\n").wind(ind+1);
+		}
+		o.ws("&&").wstring(opts->labelPrefix).wlabel(jumps[j]->label).ws(",");
+		if (j % 8 != 7)
+		{
+			o.wstring(std::string(max_digits - jumps[j]->label.width() + 1, ' '));
+		}
 	}
+	o.ws("\n").wind(ind).ws("};\n");
 }
 
 // All spans in b1 that lead to s1 are pairwise equal to that in b2 leading to s2
@@ -2,6 +2,8 @@
 #define _RE2C_CODEGEN_BITMAP_
 
 #include "src/util/c99_stdint.h"
+#include <map>
+#include <vector>
 
 #include "src/util/forbid_copy.h"
 
@@ -16,8 +18,6 @@ struct OutputFile;
 class BitMap
 {
 public:
-	static BitMap	*first;
-
 	const Go        *go;
 	const State     *on;
 	const BitMap    *next;
@@ -25,15 +25,48 @@ public:
 	uint32_t        m;
 
 public:
-	static const BitMap *find(const Go*, const State*);
-	static const BitMap *find(const State*);
-	static void gen(OutputFile &, uint32_t ind, uint32_t, uint32_t);
-	BitMap(const Go*, const State*);
+	BitMap(const Go*, const State*, const BitMap*);
 	~BitMap();
 
 	FORBID_COPY (BitMap);
 };
 
+// all bitmaps of one DFA: they are built when the DFA is compiled
+// and emitted together as one table in front of DFA code
+// (together with two-level tables for wide code units, see note [wide tables])
+class bitmaps_t
+{
+	BitMap *first;
+
+	// jump tables: pages of 256 targets and page maps of all states
+	std::vector<const State*> jumps;
+	std::vector<uint32_t> jump_maps;
+	std::map<const State*, uint32_t> uniform_jumps;
+	std::map<std::vector<const State*>, uint32_t> mixed_jumps;
+	std::map<std::vector<uint32_t>, uint32_t> jump_map_offsets;
+
+public:
+	bool used;
+	bool used_wide;
+
+	bitmaps_t();
+	~bitmaps_t();
+	const BitMap *find(const Go*, const State*);
+	const BitMap *find(const State*) const;
+	uint32_t add_jumps(const Span*, uint32_t);
+	bool empty() const { return first == NULL && jump_maps.empty(); }
+	void gen(OutputFile &, uint32_t ind, uint32_t, uint32_t) const;
+
+private:
+	void gen_wide(OutputFile &, uint32_t ind) const;
+	void gen_jumps(OutputFile &, uint32_t ind) const;
+
+	FORBID_COPY (bitmaps_t);
+};
+
+// the number of 256-unit pages in the current encoding
+uint32_t wide_pages();
+
 bool matches(const Span * b1, uint32_t n1, const State * s1, const Span * b2, uint32_t n2, const State * s2);
 
 #ifdef _MSC_VER
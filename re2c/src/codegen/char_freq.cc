@@ -0,0 +1,168 @@
+#include <stddef.h>
+#include <string.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "src/codegen/char_freq.h"
+#include "src/conf/msg.h"
+
+namespace re2c
+{
+
+CharFreq char_freq;
+
+const uint32_t CharFreq::SIZE = 0x100;
+
+CharFreq::CharFreq ()
+{
+	for (uint32_t c = 0; c <= SIZE; ++c)
+	{
+		sum[c] = c;
+	}
+}
+
+struct char_weight_t
+{
+	char chars[27];
+	uint32_t weight;
+};
+
+// built-in models: every byte has weight 1 unless listed here
+// (weights of letters are roughly their frequency in English text)
+static const char_weight_t TEXT[] =
+	{ {" ",    1800}
+	, {"e",    1270}
+	, {"t",     910}
+	, {"a",     820}
+	, {"o",     750}
+	, {"i",     700}
+	, {"n",     670}
+	, {"s",     630}
+	, {"h",     610}
+	, {"r",     600}
+	, {"d",     430}
+	, {"l",     400}
+	, {"cu",    280}
+	, {"mw",    240}
+	, {"f",     220}
+	, {"gy",    200}
+	, {"p",     190}
+	, {"b",     150}
+	, {"v",     100}
+	, {"k",      80}
+	, {"\n.,",  100}
+	, {"ETAOINSHRDLCUMWFGYPBVKJXQZ", 30}
+	, {"jxqz",   15}
+	, {"0123456789", 10}
+	, {"'\"-;:!?()", 5}
+	};
+
+static const char_weight_t JSON[] =
+	{ {"\"",    800}
+	, {" ",     400}
+	, {":,",    200}
+	, {"0123456789", 150}
+	, {"e",     130}
+	, {"taoinsrhdl", 60}
+	, {"cumwfgypbvkjxqz", 20}
+	, {"\n{}",  50}
+	, {"[].-",  30}
+	, {"ETAOINSHRDLCUMWFGYPBVKJXQZ", 5}
+	};
+
+template <size_t N>
+static void set_model (uint64_t * freq, const char_weight_t (& model) [N])
+{
+	for (size_t i = 0; i < N; ++i)
+	{
+		for (const char * p = model[i].chars; *p; ++p)
+		{
+			freq[static_cast<unsigned char> (*p)] = model[i].weight;
+		}
+	}
+}
+
+/*
+ * 'model' is either a name of built-in model ('text', 'json' or
+ * 'binary') or a file with '<code unit> <weight>' pairs (decimal or
+ * '0x'-prefixed hexadecimal code units); omitted code units have
+ * weight 1. Malformed lines are reported: a typo in the model would
+ * otherwise quietly give a wrong model.
+ */
+bool CharFreq::load (const char * model)
+{
+	uint64_t freq[0x100];
+	for (uint32_t c = 0; c < SIZE; ++c)
+	{
+		freq[c] = 1;
+	}
+
+	if (strcmp (model, "text") == 0)
+	{
+		set_model (freq, TEXT);
+	}
+	else if (strcmp (model, "json") == 0)
+	{
+		set_model (freq, JSON);
+	}
+	else if (strcmp (model, "binary") != 0)
+	{
+		std::ifstream f (model);
+		if (!f.is_open ())
+		{
+			error ("cannot open character frequency file: %s", model);
+			return false;
+		}
+		uint32_t n = 0;
+		for (std::string line; std::getline (f, line);)
+		{
+			++n;
+			if (line.find_first_not_of (" \t") == std::string::npos)
+			{
+				continue;
+			}
+			std::istringstream s (line);
+			uint32_t c = 0;
+			uint64_t w = 0;
+			if (line.compare (0, 2, "0x") == 0)
+			{
+				s.ignore (2);
+				s >> std::hex >> c >> std::dec;
+			}
+			else
+			{
+				s >> c;
+			}
+			if (line.find ('-') != std::string::npos || !s || !(s >> w) || !(s >> std::ws).eof ())
+			{
+				error ("bad character frequency file %s, line %u: expected '<code unit> <weight>'", model, n);
+				return false;
+			}
+			if (c >= SIZE)
+			{
+				error ("bad character frequency file %s, line %u: code unit 0x%X is out of range 0x00 - 0xFF", model, n, c);
+				return false;
+			}
+			freq[c] = w;
+		}
+	}
+
+	sum[0] = 0;
+	for (uint32_t c = 0; c < SIZE; ++c)
+	{
+		sum[c + 1] = sum[c] + freq[c];
+	}
+	return true;
+}
+
+uint64_t CharFreq::weight (uint32_t lb, uint32_t ub) const
+{
+	if (lb >= SIZE)
+	{
+		return 1;
+	}
+	return sum[ub < SIZE ? ub : SIZE] - sum[lb] + (ub > SIZE ? 1 : 0);
+}
+
+} // namespace re2c
@@ -0,0 +1,28 @@
+#ifndef _RE2C_CODEGEN_CHAR_FREQ_
+#define _RE2C_CODEGEN_CHAR_FREQ_
+
+#include "src/util/c99_stdint.h"
+#include "src/util/forbid_copy.h"
+
+namespace re2c
+{
+
+// static model of input: relative frequencies of code units 0x00 - 0xFF
+// (code units above 0xFF are not modelled: each span of them, however
+// long, weighs 1, which is a guess that they are rare)
+class CharFreq
+{
+	static const uint32_t SIZE;
+	uint64_t sum[0x101]; // prefix sums: sum[c] is the weight of [0, c)
+
+public:
+	CharFreq ();
+	bool load (const char * model);
+	uint64_t weight (uint32_t lb, uint32_t ub) const;
+
+	FORBID_COPY (CharFreq);
+};
+
+} // namespace re2c
+
+#endif // _RE2C_CODEGEN_CHAR_FREQ_
@@ -22,6 +22,7 @@ void emit_action
 
 // helpers
 void genGoTo (OutputFile & o, uint32_t ind, const State * from, const State * to, bool & readCh);
+void genStat (OutputFile & o, uint32_t ind, const State * s);
 
 template<typename _Ty> std::string replaceParam (std::string str, const std::string & param, const _Ty & value)
 {
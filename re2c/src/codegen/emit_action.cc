@@ -1,6 +1,9 @@
 #include "src/util/c99_stdint.h"
 #include <stddef.h>
+#include <algorithm>
 #include <set>
+#include <utility>
+#include <vector>
 #include <string>
 
 #include "src/codegen/emit.h"
@@ -10,6 +13,7 @@
 #include "src/globals.h"
 #include "src/ir/adfa/action.h"
 #include "src/ir/adfa/adfa.h"
+#include "src/ir/keywords/keywords.h"
 #include "src/ir/regexp/regexp.h"
 #include "src/ir/regexp/regexp_rule.h"
 #include "src/ir/skeleton/skeleton.h"
@@ -23,11 +27,14 @@ class label_t;
 
 static void need               (OutputFile & o, uint32_t ind, bool & readCh, size_t n, bool bSetMarker);
 static void emit_match         (OutputFile & o, uint32_t ind, bool & readCh, const State * const s);
+static void emit_simd_skip     (OutputFile & o, uint32_t ind, const State * const s);
 static void emit_initial       (OutputFile & o, uint32_t ind, bool & readCh, const State * const s, const Initial & init, const std::set<label_t> & used_labels);
 static void emit_save          (OutputFile & o, uint32_t ind, bool & readCh, const State * const s, uint32_t save, bool save_yyaccept);
 static void emit_accept_binary (OutputFile & o, uint32_t ind, bool & readCh, const State * const s, const accept_t & accept, size_t l, size_t r);
 static void emit_accept        (OutputFile & o, uint32_t ind, bool & readCh, const State * const s, const accept_t & accept);
 static void emit_rule          (OutputFile & o, uint32_t ind, const State * const s, const RuleOp * const rule, const std::string & condName, const Skeleton * skeleton);
+static void emit_keywords      (OutputFile & o, uint32_t ind, const State * const s);
+static void emit_fill          (OutputFile & o, uint32_t ind, const State * const s, const State * const dispatch);
 static void genYYFill          (OutputFile & o, size_t need);
 static void genSetCondition    (OutputFile & o, uint32_t ind, const std::string & newcond);
 static void genSetState        (OutputFile & o, uint32_t ind, uint32_t fillIndex);
@@ -63,6 +70,9 @@ void emit_action
 		case Action::RULE:
 			emit_rule (o, ind, s, action.info.rule, condName, skeleton);
 			break;
+		case Action::FILL:
+			emit_fill (o, ind, s, action.info.dispatch);
+			break;
 	}
 	if (s->isPreCtxt && opts->target != opt_t::DOT)
 	{
@@ -83,6 +93,10 @@ void emit_match (OutputFile & o, uint32_t ind, bool & readCh, const State * cons
 	if (s->fill != 0)
 	{
 		o.wstring(opts->input_api.stmt_skip (ind));
+		if (opts->simdLoops)
+		{
+			emit_simd_skip (o, ind, s);
+		}
 	}
 	else if (!read_ahead)
 	{
@@ -102,6 +116,132 @@ void emit_match (OutputFile & o, uint32_t ind, bool & readCh, const State * cons
 	}
 }
 
+/*
+ * note [SIMD self-loops]
+ *
+ * States like '[a-zA-Z0-9_]*' loop back to themselves on a character
+ * class; scalar code spends a full skip-fill-peek-dispatch round per
+ * character. With --simd-loops we prepend the scalar code of such
+ * state with a block scan: load 16 code units at once, classify them
+ * with SSE2 range checks and skip the prefix that stays in the loop.
+ * Scalar code then continues from the first unit that leaves the loop
+ * (or from the end of the buffer).
+ *
+ * Skipping is only correct if none of the skipped positions would have
+ * triggered YYFILL: the block scan runs only if there are at least
+ * 'fill + 15' units left before YYLIMIT (and at least 16 to be loaded).
+ * Thus the optimization requires default input API, enabled YYFILL
+ * with bounds check, and 1-byte code units (the latter is checked by
+ * the generated code, because YYCTYPE is unknown to re2c).
+ *
+ * Each range [l, u] of the class is checked as 'sat(c - l, u - l) == 0',
+ * where 'sat' is unsigned saturating subtraction; if the complement of
+ * the class consists of fewer ranges, the complement is checked instead.
+ * Classes with too many ranges are not worth it and are left alone.
+ */
+static const size_t SIMD_MAX_RANGES = 6;
+
+static void simd_range (OutputFile & o, uint32_t l, uint32_t u)
+{
+	if (l == u)
+	{
+		o.ws("_mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) ").wu32_hex(l).ws("))");
+		return;
+	}
+	o.ws("_mm_cmpeq_epi8 (_mm_subs_epu8 (");
+	if (u == 0xFF)
+	{
+		o.ws("_mm_set1_epi8 ((char) ").wu32_hex(l).ws("), yysv");
+	}
+	else if (l == 0)
+	{
+		o.ws("yysv, _mm_set1_epi8 ((char) ").wu32_hex(u).ws(")");
+	}
+	else
+	{
+		o.ws("_mm_sub_epi8 (yysv, _mm_set1_epi8 ((char) ").wu32_hex(l).ws(")), ")
+			.ws("_mm_set1_epi8 ((char) ").wu32_hex(u - l).ws(")");
+	}
+	o.ws("), _mm_setzero_si128 ())");
+}
+
+void emit_simd_skip (OutputFile & o, uint32_t ind, const State * const s)
+{
+	if (s->action.type != Action::MATCH
+		|| s->isPreCtxt
+		|| opts->dFlag
+		|| opts->encoding.szCodeUnit () != 1
+		|| opts->input_api.type () != InputAPI::DEFAULT
+		|| !opts->fill_use
+		|| !opts->fill_check)
+	{
+		return;
+	}
+
+	// loop heads are split into skip-fill-peek part and dispatch part
+	// (see 'DFA::split'), transitions are stored in the latter
+	const Go & go = s->isBase
+		? s->go.span[0].to->go
+		: s->go;
+
+	// ranges of code units that loop back to this state and their complement
+	std::vector<std::pair<uint32_t, uint32_t> > loop, exit;
+	for (uint32_t i = 0, lb = 0; i < go.nSpans; lb = go.span[i++].ub)
+	{
+		const uint32_t ub = go.span[i].ub;
+		std::vector<std::pair<uint32_t, uint32_t> > & r = go.span[i].to == s ? loop : exit;
+		if (!r.empty () && r.back ().second + 1 == lb)
+		{
+			r.back ().second = ub - 1;
+		}
+		else
+		{
+			r.push_back (std::make_pair (lb, ub - 1));
+		}
+	}
+	if (loop.empty ())
+	{
+		return;
+	}
+	const bool inverted = exit.size () < loop.size ();
+	const std::vector<std::pair<uint32_t, uint32_t> > & ranges = inverted ? exit : loop;
+	if (ranges.size () > SIMD_MAX_RANGES)
+	{
+		return;
+	}
+
+	const size_t bound = s->fill + 15 > 16 ? s->fill + 15 : 16;
+	o.ws("#if defined(__SSE2__) && defined(__GNUC__)\n");
+	o.wind(ind).ws("while (sizeof (").wstring(opts->yyctype).ws(") == 1 && (")
+		.wstring(opts->yylimit).ws(" - ").wstring(opts->yycursor).ws(") >= ").wu64(bound).ws(") {\n");
+	o.wind(ind + 1).ws("const __m128i yysv = _mm_loadu_si128 ((const __m128i *) ").wstring(opts->yycursor).ws(");\n");
+	o.wind(ind + 1).ws("__m128i yysm = ");
+	if (ranges.empty ())
+	{
+		o.ws("_mm_setzero_si128 ()");
+	}
+	else
+	{
+		simd_range (o, ranges[0].first, ranges[0].second);
+	}
+	o.ws(";\n");
+	o.wind(ind + 1).ws("unsigned int yysk;\n");
+	for (size_t i = 1; i < ranges.size (); ++i)
+	{
+		o.wind(ind + 1).ws("yysm = _mm_or_si128 (yysm, ");
+		simd_range (o, ranges[i].first, ranges[i].second);
+		o.ws(");\n");
+	}
+	o.wind(ind + 1).ws("yysk = (unsigned int) _mm_movemask_epi8 (yysm)").ws(inverted ? "" : " ^ 0xFFFF").ws(";\n");
+	o.wind(ind + 1).ws("if (yysk != 0) {\n");
+	o.wind(ind + 2).wstring(opts->yycursor).ws(" += __builtin_ctz (yysk);\n");
+	o.wind(ind + 2).ws("break;\n");
+	o.wind(ind + 1).ws("}\n");
+	o.wind(ind + 1).wstring(opts->yycursor).ws(" += 16;\n");
+	o.wind(ind).ws("}\n");
+	o.ws("#endif\n");
+}
+
 void emit_initial (OutputFile & o, uint32_t ind, bool & readCh, const State * const s, const Initial & initial, const std::set<label_t> & used_labels)
 {
 	if (opts->target == opt_t::DOT)
@@ -131,6 +271,11 @@ void emit_initial (OutputFile & o, uint32_t ind, bool & readCh, const State * co
 		o.wind(ind).wstring(opts->yydebug).ws("(").wlabel(initial.label).ws(", *").wstring(opts->yycursor).ws(");\n");
 	}
 
+	if (opts->instrument)
+	{
+		genStat (o, ind, s);
+	}
+
 	if (s->fill != 0)
 	{
 		need(o, ind, readCh, s->fill, initial.setMarker);
@@ -262,6 +407,11 @@ void emit_rule (OutputFile & o, uint32_t ind, const State * const s, const RuleO
 		return;
 	}
 
+	if (s->keywords)
+	{
+		emit_keywords (o, ind, s);
+	}
+
 	uint32_t back = rule->ctx->fixedLength();
 	if (back != 0u && opts->target != opt_t::DOT)
 	{
@@ -296,6 +446,110 @@ void emit_rule (OutputFile & o, uint32_t ind, const State * const s, const RuleO
 	}
 }
 
+static void emit_keyword_table (OutputFile & o, uint32_t ind, const char * name, const std::vector<uint32_t> & table)
+{
+	const uint32_t max = *std::max_element (table.begin (), table.end ());
+	o.wind(ind).ws("static const ")
+		.ws(max <= 0xFF ? "unsigned char" : max <= 0xFFFF ? "unsigned short" : "unsigned long")
+		.ws(" ").ws(name).ws("[").wu32(static_cast<uint32_t> (table.size ())).ws("] = {");
+	for (size_t i = 0; i < table.size (); ++i)
+	{
+		if (i % 16 == 0)
+		{
+			o.ws("\n").wind(ind + 1);
+		}
+		o.wu32(table[i]).ws(i + 1 == table.size () ? "\n" : i % 16 == 15 ? "," : ", ");
+	}
+	o.wind(ind).ws("};\n");
+}
+
+/*
+ * Lexeme matched by identifier rule: look it up in perfect hash table,
+ * compare with the only candidate and jump to keyword rule on match.
+ * Hash functions must agree with 'keyword_hash' and 'keyword_slot'.
+ * See note [keywords].
+ */
+void emit_keywords (OutputFile & o, uint32_t ind, const State * const s)
+{
+	const keywords_t & kw = *s->keywords;
+	std::vector<uint32_t> offs (1, 0);
+	std::vector<uint32_t> str;
+	for (size_t i = 0; i < kw.words.size (); ++i)
+	{
+		str.insert (str.end (), kw.words[i].str.begin (), kw.words[i].str.end ());
+		offs.push_back (static_cast<uint32_t> (str.size ()));
+	}
+	const std::string & yyctype = opts->yyctype;
+
+	o.wind(ind++).ws("{\n");
+	emit_keyword_table (o, ind, "yykwdisp", kw.disp);
+	emit_keyword_table (o, ind, "yykwslot", kw.slots);
+	emit_keyword_table (o, ind, "yykwoff", offs);
+	o.wind(ind).ws("static const ").wstring(yyctype).ws(" yykwstr[").wu32(static_cast<uint32_t> (str.size ())).ws("] = {");
+	for (size_t i = 0; i < str.size (); ++i)
+	{
+		if (i % 16 == 0)
+		{
+			o.ws("\n").wind(ind + 1);
+		}
+		o.wc_hex(str[i]).ws(i + 1 == str.size () ? "\n" : i % 16 == 15 ? "," : ", ");
+	}
+	o.wind(ind).ws("};\n");
+	o.wind(ind).ws("const ").wstring(yyctype).ws(" *yykwtok = (const ").wstring(yyctype).ws(" *) (").wstring(opts->keywords_token).ws(");\n");
+	o.wind(ind).ws("const unsigned long yykwlen = (unsigned long) ((const ").wstring(yyctype).ws(" *) (").wstring(opts->yycursor).ws(") - yykwtok);\n");
+	o.wind(ind++).ws("if (yykwlen >= ").wu32(kw.min_len).ws(" && yykwlen <= ").wu32(kw.max_len).ws(") {\n");
+	o.wind(ind).ws("unsigned long yykwh = 2166136261ul;\n");
+	o.wind(ind).ws("unsigned long yykwi;\n");
+	o.wind(ind++).ws("for (yykwi = 0; yykwi < yykwlen; ++yykwi) {\n");
+	o.wind(ind--).ws("yykwh = ((yykwh ^ yykwtok[yykwi]) * 16777619ul) & 0xFFFFFFFFul;\n");
+	o.wind(ind).ws("}\n");
+	o.wind(ind).ws("yykwh = (((yykwh ^ yykwdisp[yykwh & ").wu32((1u << kw.bucket_bits) - 1)
+		.ws("]) * 2654435761ul) & 0xFFFFFFFFul) >> ").wu32(32 - kw.slot_bits).ws(";\n");
+	o.wind(ind).ws("yykwh = yykwslot[yykwh];\n");
+	o.wind(ind++).ws("if (yykwh != 0 && yykwlen == (unsigned long) (yykwoff[yykwh] - yykwoff[yykwh - 1])) {\n");
+	o.wind(ind).ws("const ").wstring(yyctype).ws(" *yykwp = yykwstr + yykwoff[yykwh - 1];\n");
+	o.wind(ind++).ws("for (yykwi = 0; yykwi < yykwlen; ++yykwi) {\n");
+	o.wind(ind--).ws("if (yykwtok[yykwi] != yykwp[yykwi]) break;\n");
+	o.wind(ind).ws("}\n");
+	o.wind(ind++).ws("if (yykwi == yykwlen) {\n");
+	o.wind(ind).ws("switch (yykwh) {\n");
+	for (size_t i = 0; i < s->keywordStates.size (); ++i)
+	{
+		o.wind(ind).ws("case ").wu32(static_cast<uint32_t> (i + 1)).ws(": goto ")
+			.wstring(opts->labelPrefix).wlabel(s->keywordStates[i]->label).ws(";\n");
+	}
+	o.wind(ind).ws("}\n");
+	o.wind(--ind).ws("}\n");
+	o.wind(--ind).ws("}\n");
+	o.wind(--ind).ws("}\n");
+	o.wind(--ind).ws("}\n");
+}
+
+/*
+ * Sentinel was read: if it is the end of buffer, try to refill and
+ * re-dispatch on new input. Otherwise (or if YYFILL did not add data)
+ * sentinel is an ordinary character: proceed with the original
+ * transition, which is emitted as unconditional jump of FILL state.
+ * See note [sentinel].
+ */
+void emit_fill (OutputFile & o, uint32_t ind, const State * const s, const State * const dispatch)
+{
+	if (opts->target == opt_t::DOT)
+	{
+		return;
+	}
+
+	const std::string lessthan = opts->input_api.expr_lessthan_one ();
+	o.wind(ind).ws("if (").wstring(lessthan).ws(") {\n");
+	o.wind(ind + 1);
+	genYYFill(o, 1);
+	o.wind(ind + 1).ws("if (").wstring(lessthan).ws(") goto ")
+		.wstring(opts->labelPrefix).wlabel(s->go.span[0].to->label).ws(";\n");
+	o.wstring(opts->input_api.stmt_peek (ind + 1));
+	o.wind(ind + 1).ws("goto ").wstring(opts->labelPrefix).wlabel(dispatch->label).ws(";\n");
+	o.wind(ind).ws("}\n");
+}
+
 void need (OutputFile & o, uint32_t ind, bool & readCh, size_t n, bool bSetMarker)
 {
 	if (opts->target == opt_t::DOT)
@@ -311,7 +565,8 @@ void need (OutputFile & o, uint32_t ind, bool & readCh, size_t n, bool bSetMarke
 		genSetState (o, ind, fillIndex);
 	}
 
-	if (opts->fill_use && n > 0)
+	// in sentinel mode bounds are checked by FILL states
+	if (opts->fill_use && n > 0 && opts->fill_sentinel < 0)
 	{
 		o.wind(ind);
 		if (n == 1)
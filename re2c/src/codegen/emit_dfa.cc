@@ -1,6 +1,7 @@
 #include "src/util/c99_stdint.h"
 #include <stddef.h>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -12,9 +13,11 @@
 #include "src/codegen/label.h"
 #include "src/codegen/output.h"
 #include "src/conf/opt.h"
+#include "src/conf/warn.h"
 #include "src/globals.h"
 #include "src/ir/adfa/action.h"
 #include "src/ir/adfa/adfa.h"
+#include "src/ir/regexp/regexp_rule.h"
 #include "src/ir/skeleton/skeleton.h"
 #include "src/util/counter.h"
 
@@ -26,6 +29,7 @@ static void genCondGotoSub (OutputFile & o, uint32_t ind, const std::vector<std:
 static void genCondTable   (OutputFile & o, uint32_t ind, const std::vector<std::string> & condnames);
 static void genCondGoto    (OutputFile & o, uint32_t ind, const std::vector<std::string> & condnames);
 static void emit_state     (OutputFile & o, uint32_t ind, const State * s, bool used_label);
+static void emit_word      (OutputFile & o, uint32_t ind, const State * s);
 
 std::string genGetCondition()
 {
@@ -51,6 +55,26 @@ void genGoTo(OutputFile & o, uint32_t ind, const State *from, const State *to, b
 	o.wind(ind).ws("goto ").wstring(opts->labelPrefix).wlabel(to->label).ws(";\n");
 }
 
+void genStat (OutputFile & o, uint32_t ind, const State * s)
+{
+	std::ostringstream name;
+	switch (s->action.type)
+	{
+		case Action::MATCH:
+		case Action::INITIAL:
+		case Action::SAVE:
+			name << "state " << opts->labelPrefix << s->label;
+			break;
+		case Action::RULE:
+			name << "rule " << s->action.info.rule->loc.filename
+				<< ":" << s->action.info.rule->loc.line;
+			break;
+		default:
+			return;
+	}
+	o.wind(ind).ws("++").wstring(opts->yystats).ws("[").wu32(o.new_stat (name.str ())).ws("];\n");
+}
+
 void emit_state (OutputFile & o, uint32_t ind, const State * s, bool used_label)
 {
 	if (opts->target != opt_t::DOT)
@@ -63,9 +87,52 @@ void emit_state (OutputFile & o, uint32_t ind, const State * s, bool used_label)
 		{
 			o.wind(ind).wstring(opts->yydebug).ws("(").wlabel(s->label).ws(", ").wstring(opts->input_api.expr_peek ()).ws(");\n");
 		}
+		if (opts->instrument && (s->action.type != Action::INITIAL))
+		{
+			genStat (o, ind, s);
+		}
 	}
 }
 
+// see note [word-at-a-time comparison]
+void emit_word (OutputFile & o, uint32_t ind, const State * s)
+{
+	const std::vector<uint32_t> & word = s->word;
+	o.wind(ind++).ws("{\n");
+	o.wind(ind).ws("static const ").wstring(opts->yyctype).ws(" yyword[] = {");
+	for (size_t i = 0; i < word.size (); ++i)
+	{
+		o.ws(i == 0 ? "" : ", ").wc_hex(word[i]);
+	}
+	o.ws("};\n");
+	// sizes that are not a power of two are covered with two overlapping
+	// comparisons: C compilers do not always inline memcmp of other sizes
+	const size_t n = word.size ();
+	size_t m = 1;
+	for (; 2 * m <= n; m *= 2);
+	std::ostringstream cmp;
+	if (m == n)
+	{
+		cmp << "memcmp (" << opts->yycursor << ", yyword, sizeof (yyword)) == 0";
+	}
+	else
+	{
+		cmp << "memcmp (" << opts->yycursor << ", yyword, " << m << " * sizeof (yyword[0])) == 0"
+			<< " && memcmp (" << opts->yycursor << " + " << n - m << ", yyword + " << n - m
+			<< ", " << m << " * sizeof (yyword[0])) == 0";
+	}
+	// the chain is hot: keep the shortcut on the fall-through path
+	o.ws("#if defined(__GNUC__)\n");
+	o.wind(ind).ws("if (__builtin_expect (").wstring(cmp.str ()).ws(", 1)) {\n");
+	o.ws("#else\n");
+	o.wind(ind).ws("if (").wstring(cmp.str ()).ws(") {\n");
+	o.ws("#endif\n");
+	o.wind(ind + 1).wstring(opts->yycursor).ws(" += ").wu64(n - 1).ws(";\n");
+	o.wind(ind + 1).ws("goto ").wstring(opts->labelPrefix).wlabel(s->wordExit->label).ws(";\n");
+	o.wind(ind).ws("}\n");
+	o.wind(--ind).ws("}\n");
+}
+
 void DFA::count_used_labels (std::set<label_t> & used, label_t start, label_t initial, bool force_start) const
 {
 	// In '-f' mode, default state is always state 0
@@ -80,6 +147,18 @@ void DFA::count_used_labels (std::set<label_t> & used, label_t start, label_t in
 	for (State * s = head; s; s = s->next)
 	{
 		s->go.used_labels (used);
+		if (s->wordExit)
+		{
+			used.insert (s->wordExit->label);
+		}
+		for (size_t i = 0; i < s->keywordStates.size (); ++i)
+		{
+			used.insert (s->keywordStates[i]->label);
+		}
+		if (s->action.type == Action::FILL)
+		{
+			used.insert (s->action.info.dispatch->label);
+		}
 	}
 	for (uint32_t i = 0; i < accepts.size (); ++i)
 	{
@@ -108,6 +187,10 @@ void DFA::emit_body (OutputFile & o, uint32_t& ind, const std::set<label_t> & us
 		bool readCh = false;
 		emit_state (o, ind, s, used_labels.count (s->label));
 		emit_action (s->action, o, ind, readCh, s, cond, skeleton, used_labels, save_yyaccept);
+		if (!s->word.empty ())
+		{
+			emit_word (o, ind, s);
+		}
 		s->go.emit(o, ind, readCh);
 	}
 }
@@ -115,6 +198,8 @@ void DFA::emit_body (OutputFile & o, uint32_t& ind, const std::set<label_t> & us
 void DFA::emit(Output & output, uint32_t& ind, bool isLastCond, bool& bPrologBrace)
 {
 	OutputFile & o = output.source;
+	const double time_start = wall_time ();
+	const size_t size_start = o.size ();
 
 	bool bProlog = (!opts->cFlag || !bWroteCondCheck);
 
@@ -131,21 +216,37 @@ void DFA::emit(Output & output, uint32_t& ind, bool isLastCond, bool& bPrologBra
 	{
 		s->label = o.label_counter.next ();
 	}
+	if (opts->profile_file)
+	{
+		layout ();
+	}
 	std::set<label_t> used_labels;
 	count_used_labels (used_labels, start_label, initial_label, o.get_force_start_label ());
 
 	head->action.set_initial (initial_label, head->action.type == Action::SAVE);
 
-	skeleton->warn_undefined_control_flow ();
-	skeleton->warn_unreachable_rules ();
-	skeleton->warn_match_empty ();
+	// skeleton is only constructed if it is needed, see compile
+	const double time_analyses = wall_time ();
+	if (warn.is_set (Warn::UNDEFINED_CONTROL_FLOW))
+	{
+		skeleton->warn_undefined_control_flow ();
+	}
+	if (warn.is_set (Warn::UNREACHABLE_RULES))
+	{
+		skeleton->warn_unreachable_rules ();
+	}
+	if (warn.is_set (Warn::MATCH_EMPTY_STRING))
+	{
+		skeleton->warn_match_empty ();
+	}
+	stats.time_analyses = wall_time () - time_analyses;
 
 	if (opts->target == opt_t::SKELETON)
 	{
 		if (output.skeletons.insert (name).second)
 		{
 			skeleton->emit_data (o.file_name);
-			skeleton->emit_start (o, max_fill, need_backup, need_backupctx, need_accept);
+			skeleton->emit_start (o, max_fill, need_backup, need_backupctx, need_accept, bitmaps);
 			uint32_t i = 2;
 			emit_body (o, i, used_labels, initial_label);
 			skeleton->emit_end (o, need_backup, need_backupctx);
@@ -164,7 +265,7 @@ void DFA::emit(Output & output, uint32_t& ind, bool isLastCond, bool& bPrologBra
 			}
 			else if ((!opts->fFlag && o.get_used_yyaccept ())
 			||  (!opts->fFlag && opts->bEmitYYCh)
-			||  (opts->bFlag && !opts->cFlag && BitMap::first)
+			||  (opts->bFlag && !opts->cFlag && !bitmaps.empty ())
 			||  (opts->cFlag && !bWroteCondCheck && opts->gFlag)
 			||  (opts->fFlag && !bWroteGetState && opts->gFlag)
 			)
@@ -189,9 +290,9 @@ void DFA::emit(Output & output, uint32_t& ind, bool isLastCond, bool& bPrologBra
 				o.ws("\n");
 			}
 		}
-		if (opts->bFlag && !opts->cFlag && BitMap::first)
+		if (opts->bFlag && !opts->cFlag && !bitmaps.empty ())
 		{
-			BitMap::gen(o, ind, lbChar, ubChar <= 256 ? ubChar : 256);
+			bitmaps.gen(o, ind, lbChar, ubChar <= 256 ? ubChar : 256);
 		}
 		if (bProlog)
 		{
@@ -228,14 +329,21 @@ void DFA::emit(Output & output, uint32_t& ind, bool isLastCond, bool& bPrologBra
 				o.wstring(opts->condPrefix).wstring(cond).ws(":\n");
 			}
 		}
-		if (opts->cFlag && opts->bFlag && BitMap::first)
+		if (opts->cFlag && opts->bFlag && !bitmaps.empty ())
 		{
 			o.wind(ind++).ws("{\n");
-			BitMap::gen(o, ind, lbChar, ubChar <= 256 ? ubChar : 256);
+			bitmaps.gen(o, ind, lbChar, ubChar <= 256 ? ubChar : 256);
 		}
 		// Generate code
-		emit_body (o, ind, used_labels, initial_label);
-		if (opts->cFlag && opts->bFlag && BitMap::first)
+		if (opts->target == opt_t::TABLE)
+		{
+			emit_table (o, ind);
+		}
+		else
+		{
+			emit_body (o, ind, used_labels, initial_label);
+		}
+		if (opts->cFlag && opts->bFlag && !bitmaps.empty ())
 		{
 			o.wind(--ind).ws("}\n");
 		}
@@ -246,11 +354,11 @@ void DFA::emit(Output & output, uint32_t& ind, bool isLastCond, bool& bPrologBra
 		}
 	}
 
-	// Cleanup
-	if (BitMap::first)
+	if (opts->stats_file)
 	{
-		delete BitMap::first;
-		BitMap::first = NULL;
+		stats.time_codegen = wall_time () - time_start - stats.time_analyses;
+		stats.bytes = o.size () - size_start;
+		report.add_dfa (stats);
 	}
 }
 
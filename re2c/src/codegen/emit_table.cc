@@ -0,0 +1,502 @@
+#include "src/util/c99_stdint.h"
+#include <stddef.h>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "src/codegen/emit.h"
+#include "src/codegen/go.h"
+#include "src/codegen/input_api.h"
+#include "src/codegen/output.h"
+#include "src/conf/opt.h"
+#include "src/globals.h"
+#include "src/ir/adfa/action.h"
+#include "src/ir/adfa/adfa.h"
+
+namespace re2c
+{
+
+/*
+ * note [table-driven DFA]
+ *
+ * With '--table' each DFA is emitted as a set of static arrays and
+ * a small driver loop instead of per-state code. Only rule actions
+ * are emitted as code (dispatched on the final state).
+ *
+ * Input characters are first mapped to character classes: class
+ * boundaries are the union of all span boundaries, so that every
+ * state has the same transition on all characters of a class.
+ * Code units up to 0x100 are mapped with a direct table, wider ones
+ * with a binary search on class boundaries.
+ *
+ * Transition rows are compressed with row displacement (comb
+ * compression): each state has a default transition (the most
+ * frequent one in its row), the remaining entries of all rows are
+ * packed into one 'next' array at per-state offsets 'base', chosen
+ * so that entries of different rows don't collide. A parallel array
+ * 'check' tells which state owns each entry:
+ *
+ *     i = base[s] + class
+ *     s' = check[i] == s ? next[i] : def[s]
+ *
+ * Per-state actions are bit flags. Flags below TABLE_CTX describe
+ * what happens on entering state (they mirror 'emit_action'), the
+ * rest describe what the state does before taking a transition.
+ * States with a single outgoing transition don't read input.
+ */
+static const uint32_t TABLE_SKIP   = 1u;   // skip input character
+static const uint32_t TABLE_SAVE   = 2u;   // set 'yyaccept'
+static const uint32_t TABLE_BACKUP = 4u;   // backup input position
+static const uint32_t TABLE_ACCEPT = 8u;   // restore input position, go to accepted rule
+static const uint32_t TABLE_RULE   = 16u;  // exit driver loop, execute rule action
+static const uint32_t TABLE_CTX    = 32u;  // backup trailing context position
+static const uint32_t TABLE_MARK   = 64u;  // backup input position (initial state)
+static const uint32_t TABLE_NOREAD = 128u; // take default transition, don't read input
+
+static const char * table_type (uint32_t max)
+{
+	return max < 0x100
+		? "unsigned char"
+		: max < 0x10000
+			? "unsigned short"
+			: "unsigned int";
+}
+
+// orders states by decreasing number of non-default transitions
+struct longer_row_t
+{
+	const std::vector<std::vector<uint32_t> > & rows;
+
+	explicit longer_row_t (const std::vector<std::vector<uint32_t> > & r)
+		: rows (r)
+	{}
+	bool operator () (uint32_t x, uint32_t y) const
+	{
+		return rows[x].size () > rows[y].size ();
+	}
+};
+
+static void emit_array (OutputFile & o, uint32_t ind, const std::string & name, const std::vector<uint32_t> & xs)
+{
+	const uint32_t max = *std::max_element (xs.begin (), xs.end ());
+	o.wind(ind).ws("static const ").ws(table_type (max)).ws(" ").wstring(name).ws("[").wu64(xs.size ()).ws("] = {");
+	for (size_t i = 0; i < xs.size (); ++i)
+	{
+		if (i % 16 == 0)
+		{
+			o.ws("\n").wind(ind + 1);
+		}
+		o.wu32(xs[i]).ws(",");
+		if (i % 16 != 15 && i + 1 != xs.size ())
+		{
+			o.ws(" ");
+		}
+	}
+	o.ws("\n").wind(ind).ws("};\n");
+}
+
+static void emit_fill (OutputFile & o, uint32_t ind, const std::string & need)
+{
+	o.wind(ind);
+	if (opts->fill_check)
+	{
+		o.ws("if (").wstring(opts->input_api.expr_lessthan (need)).ws(") ");
+	}
+	o.wstring(replaceParam (opts->fill, opts->fill_arg, need));
+	if (!opts->fill_naked)
+	{
+		if (opts->fill_arg_use)
+		{
+			o.ws("(").wstring(need).ws(")");
+		}
+		o.ws(";");
+	}
+	o.ws("\n");
+}
+
+static void emit_rules
+	( OutputFile & o
+	, uint32_t ind
+	, const std::vector<const State *> & rules
+	, const std::vector<uint32_t> & index
+	, size_t l
+	, size_t r
+	, const std::string & cond
+	, const Skeleton * skeleton
+	)
+{
+	if (l < r)
+	{
+		const size_t m = (l + r) >> 1;
+		const std::string state = opts->yytable + "state";
+		o.wind(ind).ws("if (").wstring(state).ws(r == l + 1 ? " == " : " <= ").wu32(index[m]).ws(") {\n");
+		emit_rules (o, ind + 1, rules, index, l, m, cond, skeleton);
+		o.wind(ind).ws("} else {\n");
+		emit_rules (o, ind + 1, rules, index, m + 1, r, cond, skeleton);
+		o.wind(ind).ws("}\n");
+	}
+	else if (rules[l]->action.type == Action::RULE)
+	{
+		bool readCh = false;
+		const std::set<label_t> used_labels;
+		emit_action (rules[l]->action, o, ind, readCh, rules[l], cond, skeleton, used_labels, false);
+	}
+}
+
+void DFA::emit_table (OutputFile & o, uint32_t ind) const
+{
+	const std::string & t = opts->yytable;
+	const std::string state = t + "state";
+
+	// number states in list order: initial state is state 0
+	std::vector<const State *> states;
+	std::map<const State *, uint32_t> index;
+	for (const State * s = head; s; s = s->next)
+	{
+		index[s] = static_cast<uint32_t> (states.size ());
+		states.push_back (s);
+	}
+	const uint32_t nstates = static_cast<uint32_t> (states.size ());
+
+	// character classes: upper bounds of all spans of reading states
+	std::set<uint32_t> bounds;
+	for (uint32_t i = 0; i < nstates; ++i)
+	{
+		const Go & go = states[i]->go;
+		if (go.nSpans > 1)
+		{
+			for (uint32_t j = 0; j < go.nSpans; ++j)
+			{
+				bounds.insert (go.span[j].ub);
+			}
+		}
+	}
+	const std::vector<uint32_t> bound (bounds.begin (), bounds.end ());
+	const uint32_t nclasses = static_cast<uint32_t> (bound.size ());
+
+	// per-state actions, input requirements and default transitions
+	std::vector<uint32_t> act (nstates, 0);
+	std::vector<uint32_t> fill (nstates, 0);
+	std::vector<uint32_t> save (nstates, 0);
+	std::vector<uint32_t> def (nstates, 0);
+	std::vector<const State *> rules;
+	std::vector<uint32_t> rule_index;
+	const bool save_yyaccept = accepts.size () > 1;
+	for (uint32_t i = 0; i < nstates; ++i)
+	{
+		const State * s = states[i];
+		switch (s->action.type)
+		{
+			case Action::MATCH:
+				act[i] |= TABLE_SKIP;
+				fill[i] = static_cast<uint32_t> (s->fill);
+				break;
+			case Action::INITIAL:
+				act[i] |= TABLE_SKIP;
+				if (s->action.info.initial->setMarker)
+				{
+					act[i] |= TABLE_MARK;
+				}
+				fill[i] = static_cast<uint32_t> (s->fill);
+				break;
+			case Action::SAVE:
+				act[i] |= TABLE_SKIP | TABLE_BACKUP;
+				if (save_yyaccept)
+				{
+					act[i] |= TABLE_SAVE;
+					save[i] = s->action.info.save;
+				}
+				fill[i] = static_cast<uint32_t> (s->fill);
+				break;
+			case Action::MOVE:
+			case Action::FILL: // sentinel mode is off with '--table'
+				break;
+			case Action::ACCEPT:
+				if (accepts.size () > 0)
+				{
+					act[i] |= TABLE_ACCEPT;
+				}
+				break;
+			case Action::RULE:
+				act[i] |= TABLE_RULE;
+				rules.push_back (s);
+				rule_index.push_back (i);
+				break;
+		}
+		if (s->isPreCtxt)
+		{
+			act[i] |= TABLE_CTX;
+		}
+		if (s->go.nSpans == 1)
+		{
+			act[i] |= TABLE_NOREAD;
+			def[i] = index[s->go.span[0].to];
+		}
+		else if (s->go.nSpans == 0 && !(act[i] & (TABLE_ACCEPT | TABLE_RULE)))
+		{
+			// no transitions and no action: generated code would fall
+			// through to the next state, or out of DFA (see warning
+			// about undefined control flow)
+			if (s->next)
+			{
+				act[i] |= TABLE_NOREAD;
+				def[i] = index[s->next];
+			}
+			else
+			{
+				act[i] |= TABLE_RULE;
+				rules.push_back (s);
+				rule_index.push_back (i);
+			}
+		}
+	}
+
+	// transition rows: reading states only
+	std::vector<std::vector<uint32_t> > rows (nstates);
+	std::vector<uint32_t> order;
+	for (uint32_t i = 0; i < nstates; ++i)
+	{
+		const Go & go = states[i]->go;
+		if (go.nSpans <= 1)
+		{
+			continue;
+		}
+		std::vector<uint32_t> row (nclasses);
+		std::map<uint32_t, uint32_t> freq;
+		for (uint32_t c = 0, j = 0; c < nclasses; ++c)
+		{
+			for (; go.span[j].ub < bound[c]; ++j);
+			++freq[row[c] = index[go.span[j].to]];
+		}
+		uint32_t most = 0;
+		for (std::map<uint32_t, uint32_t>::const_iterator k = freq.begin (); k != freq.end (); ++k)
+		{
+			if (k->second > most)
+			{
+				most = k->second;
+				def[i] = k->first;
+			}
+		}
+		for (uint32_t c = 0; c < nclasses; ++c)
+		{
+			if (row[c] != def[i])
+			{
+				rows[i].push_back (c);
+				rows[i].push_back (row[c]);
+			}
+		}
+		order.push_back (i);
+	}
+
+	// row displacement: place longest rows first, each at the first
+	// offset where none of its entries collides with placed entries
+	std::stable_sort (order.begin (), order.end (), longer_row_t (rows));
+	const uint32_t NONE = nstates;
+	std::vector<uint32_t> base (nstates, 0);
+	std::vector<uint32_t> next;
+	std::vector<uint32_t> check;
+	size_t first_free = 0;
+	for (size_t k = 0; k < order.size (); ++k)
+	{
+		const uint32_t i = order[k];
+		const std::vector<uint32_t> & row = rows[i];
+		size_t b = first_free > row[0] ? first_free - row[0] : 0;
+		for (;; ++b)
+		{
+			size_t e = 0;
+			for (; e < row.size (); e += 2)
+			{
+				const size_t x = b + row[e];
+				if (x < check.size () && check[x] != NONE)
+				{
+					break;
+				}
+			}
+			if (e == row.size ())
+			{
+				break;
+			}
+		}
+		base[i] = static_cast<uint32_t> (b);
+		if (check.size () < b + nclasses)
+		{
+			check.resize (b + nclasses, NONE);
+			next.resize (b + nclasses, 0);
+		}
+		for (size_t e = 0; e < row.size (); e += 2)
+		{
+			check[b + row[e]] = i;
+			next[b + row[e]] = row[e + 1];
+		}
+		for (; first_free < check.size () && check[first_free] != NONE; ++first_free);
+	}
+
+	uint32_t flags = 0;
+	uint32_t max_fill = 0;
+	for (uint32_t i = 0; i < nstates; ++i)
+	{
+		flags |= act[i];
+		max_fill = std::max (max_fill, fill[i]);
+	}
+	const bool use_fill = opts->fill_use && max_fill > 0;
+
+	o.wind(ind++).ws("{\n");
+
+	// tables
+	if (nclasses > 0)
+	{
+		if (ubChar <= 0x100)
+		{
+			std::vector<uint32_t> cls (ubChar);
+			for (uint32_t c = 0, j = 0; c < ubChar; ++c)
+			{
+				for (; bound[j] <= c; ++j);
+				cls[c] = j;
+			}
+			emit_array (o, ind, t + "cls", cls);
+		}
+		else
+		{
+			emit_array (o, ind, t + "bound", bound);
+		}
+	}
+	emit_array (o, ind, t + "act", act);
+	if (use_fill)
+	{
+		emit_array (o, ind, t + "fill", fill);
+	}
+	if (flags & TABLE_SAVE)
+	{
+		emit_array (o, ind, t + "save", save);
+	}
+	if ((flags & TABLE_ACCEPT) && accepts.size () > 1)
+	{
+		std::vector<uint32_t> acc;
+		for (uint32_t i = 0; i < accepts.size (); ++i)
+		{
+			acc.push_back (index[accepts[i]]);
+		}
+		emit_array (o, ind, t + "accept", acc);
+	}
+	emit_array (o, ind, t + "def", def);
+	if (!next.empty ())
+	{
+		emit_array (o, ind, t + "base", base);
+		emit_array (o, ind, t + "next", next);
+		emit_array (o, ind, t + "check", check);
+	}
+
+	// driver loop
+	const std::string a = t + "act[" + state + "]";
+	o.wind(ind).ws("unsigned int ").wstring(state).ws(" = 0");
+	if (!next.empty ())
+	{
+		o.ws(", ").wstring(t).ws("i");
+		if (ubChar > 0x100)
+		{
+			o.ws(", ").wstring(t).ws("l, ").wstring(t).ws("u, ").wstring(t).ws("m");
+		}
+	}
+	o.ws(";\n");
+	o.wind(ind++).ws("for (;;) {\n");
+	if (opts->dFlag)
+	{
+		o.wind(ind).wstring(opts->yydebug).ws("(").wstring(state).ws(", ").wstring(opts->input_api.expr_peek ()).ws(");\n");
+	}
+	if (use_fill)
+	{
+		o.wind(ind++).ws("if (").wstring(t).ws("fill[").wstring(state).ws("] != 0) {\n");
+		emit_fill (o, ind, t + "fill[" + state + "]");
+		o.wind(--ind).ws("}\n");
+	}
+	if (flags & TABLE_MARK)
+	{
+		o.wind(ind).ws("if (").wstring(a).ws(" & ").wu32(TABLE_MARK).ws(") ").wstring(opts->input_api.stmt_backup (0));
+	}
+	if (flags & TABLE_CTX)
+	{
+		o.wind(ind).ws("if (").wstring(a).ws(" & ").wu32(TABLE_CTX).ws(") ").wstring(opts->input_api.stmt_backupctx (0));
+	}
+	if (next.empty ())
+	{
+		o.wind(ind).wstring(state).ws(" = ").wstring(t).ws("def[").wstring(state).ws("];\n");
+	}
+	else
+	{
+		if (flags & TABLE_NOREAD)
+		{
+			o.wind(ind++).ws("if (").wstring(a).ws(" & ").wu32(TABLE_NOREAD).ws(") {\n");
+			o.wind(ind).wstring(state).ws(" = ").wstring(t).ws("def[").wstring(state).ws("];\n");
+			o.wind(ind - 1).ws("} else {\n");
+		}
+		else
+		{
+			o.wind(ind++).ws("{\n");
+		}
+		o.wstring(opts->input_api.stmt_peek (ind));
+		if (ubChar <= 0x100)
+		{
+			o.wind(ind).wstring(t).ws("i = ")
+				.wstring(t).ws("base[").wstring(state).ws("] + ")
+				.wstring(t).ws("cls[").wstring(opts->yych).ws("];\n");
+		}
+		else
+		{
+			o.wind(ind).wstring(t).ws("l = 0;\n");
+			o.wind(ind).wstring(t).ws("u = ").wu32(nclasses - 1).ws(";\n");
+			o.wind(ind++).ws("while (").wstring(t).ws("l < ").wstring(t).ws("u) {\n");
+			o.wind(ind).wstring(t).ws("m = (").wstring(t).ws("l + ").wstring(t).ws("u) / 2;\n");
+			o.wind(ind).ws("if (").wstring(opts->yych).ws(" < ").wstring(t).ws("bound[").wstring(t).ws("m]) ")
+				.wstring(t).ws("u = ").wstring(t).ws("m;\n");
+			o.wind(ind).ws("else ").wstring(t).ws("l = ").wstring(t).ws("m + 1;\n");
+			o.wind(--ind).ws("}\n");
+			o.wind(ind).wstring(t).ws("i = ").wstring(t).ws("base[").wstring(state).ws("] + ").wstring(t).ws("l;\n");
+		}
+		o.wind(ind).wstring(state).ws(" = ").wstring(t).ws("check[").wstring(t).ws("i] == ").wstring(state)
+			.ws(" ? ").wstring(t).ws("next[").wstring(t).ws("i] : ").wstring(t).ws("def[").wstring(state).ws("];\n");
+		o.wind(--ind).ws("}\n");
+	}
+	if (flags & TABLE_SKIP)
+	{
+		o.wind(ind).ws("if (").wstring(a).ws(" & ").wu32(TABLE_SKIP).ws(") ").wstring(opts->input_api.stmt_skip (0));
+	}
+	if (flags & TABLE_SAVE)
+	{
+		o.wind(ind).ws("if (").wstring(a).ws(" & ").wu32(TABLE_SAVE).ws(") ")
+			.wstring(opts->yyaccept).ws(" = ").wstring(t).ws("save[").wstring(state).ws("];\n");
+	}
+	if (flags & TABLE_BACKUP)
+	{
+		o.wind(ind).ws("if (").wstring(a).ws(" & ").wu32(TABLE_BACKUP).ws(") ").wstring(opts->input_api.stmt_backup (0));
+	}
+	if (flags & TABLE_ACCEPT)
+	{
+		o.wind(ind++).ws("if (").wstring(a).ws(" & ").wu32(TABLE_ACCEPT).ws(") {\n");
+		o.wstring(opts->input_api.stmt_restore (ind));
+		o.wind(ind).wstring(state).ws(" = ");
+		if (accepts.size () > 1)
+		{
+			o.wstring(t).ws("accept[").wstring(opts->yyaccept).ws("];\n");
+		}
+		else
+		{
+			o.wu32(index[accepts[0]]).ws(";\n");
+		}
+		o.wind(ind).ws("break;\n");
+		o.wind(--ind).ws("}\n");
+	}
+	o.wind(ind).ws("if (").wstring(a).ws(" & ").wu32(TABLE_RULE).ws(") break;\n");
+	o.wind(--ind).ws("}\n");
+
+	// rule actions
+	if (!rules.empty ())
+	{
+		emit_rules (o, ind, rules, rule_index, 0, rules.size () - 1, cond, skeleton);
+	}
+
+	o.wind(--ind).ws("}\n");
+}
+
+} // end namespace re2c
@@ -13,8 +13,10 @@ namespace re2c
 {
 
 class BitMap;
+class bitmaps_t;
 struct State;
 struct If;
+struct SearchTree;
 
 struct Span
 {
@@ -64,7 +66,7 @@ struct Binary
 	Cond * cond;
 	If * thn;
 	If * els;
-	Binary (const Span * s, uint32_t n, const State * next);
+	Binary (const Span * s, const SearchTree * t, uint32_t i, uint32_t n, const State * next);
 	~Binary ();
 	void emit (OutputFile & o, uint32_t ind, bool & readCh);
 	void used_labels (std::set<label_t> & used);
@@ -75,10 +77,15 @@ struct Binary
 struct Linear
 {
 	std::vector<std::pair<const Cond *, const State *> > branches;
-	Linear (const Span * s, uint32_t n, const State * next);
+	uint64_t cost;
+	Linear (const Span * s, const uint64_t * w, uint32_t n, const State * next);
 	~Linear ();
 	void emit (OutputFile & o, uint32_t ind, bool & readCh);
 	void used_labels (std::set<label_t> & used);
+
+private:
+	void chain (const Span * s, uint32_t n, const State * next);
+	void hot_first (const Span * s, const uint64_t * w, uint32_t n, const State * next);
 };
 
 struct If
@@ -93,7 +100,7 @@ struct If
 		Binary * binary;
 		Linear * linear;
 	} info;
-	If (type_t t, const Span * sp, uint32_t nsp, const State * next);
+	If (type_t t, const Span * sp, const SearchTree * tree, uint32_t i, uint32_t nsp, const State * next);
 	~If ();
 	void emit (OutputFile & o, uint32_t ind, bool & readCh);
 	void used_labels (std::set<label_t> & used);
@@ -111,7 +118,7 @@ struct SwitchIf
 		Cases * cases;
 		If * ifs;
 	} info;
-	SwitchIf (const Span * sp, uint32_t nsp, const State * next);
+	SwitchIf (const Span * sp, uint32_t nsp, uint32_t lb, const State * next);
 	~SwitchIf ();
 	void emit (OutputFile & o, uint32_t ind, bool & readCh);
 	void used_labels (std::set<label_t> & used);
@@ -123,7 +130,8 @@ struct GoBitmap
 	const State * bitmap_state;
 	SwitchIf * hgo;
 	SwitchIf * lgo;
-	GoBitmap (const Span * span, uint32_t nSpans, const Span * hspan, uint32_t hSpans, const BitMap * bm, const State * bm_state, const State * next);
+	bool wide; // see note [wide tables]
+	GoBitmap (const Span * span, uint32_t nSpans, const Span * hspan, uint32_t hSpans, const BitMap * bm, const State * bm_state, const State * next, bool use_wide);
 	~GoBitmap ();
 	void emit (OutputFile & o, uint32_t ind, bool & readCh);
 	void used_labels (std::set<label_t> & used);
@@ -150,7 +158,11 @@ struct Cpgoto
 {
 	SwitchIf * hgo;
 	CpgotoTable * table;
-	Cpgoto (const Span * span, uint32_t nSpans, const Span * hspan, uint32_t hSpans, const State * next);
+	// two-level table for high spans (see note [wide tables])
+	const Span * wspan;
+	uint32_t wSpans;
+	uint32_t wmap;
+	Cpgoto (const Span * span, uint32_t nSpans, const Span * hspan, uint32_t hSpans, const State * next, bitmaps_t * wide);
 	~Cpgoto ();
 	void emit (OutputFile & o, uint32_t ind, bool & readCh);
 	void used_labels (std::set<label_t> & used);
@@ -191,7 +203,7 @@ struct Go
 
 	Go ();
 	~Go ();
-	void init (const State * from);
+	void init (const State * from, bitmaps_t & bitmaps);
 	void emit (OutputFile & o, uint32_t ind, bool & readCh);
 	void used_labels (std::set<label_t> & used);
 
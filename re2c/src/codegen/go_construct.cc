@@ -48,20 +48,128 @@ Cond::Cond (const std::string & cmp, uint32_t val)
 	, value (val)
 {}
 
-Binary::Binary (const Span * s, uint32_t n, const State * next)
+/*
+ * note [weighted search trees]
+ *
+ * Nested 'if' form a binary search tree over spans, with spans in the
+ * leaves. By default the tree is balanced by the number of spans. If
+ * spans have weights (the probability that input falls into a span),
+ * the expected number of comparisons is
+ *
+ *     sum (weight (span) * depth (span)),
+ *
+ * which is minimized by an optimal alphabetic tree. Weights come from
+ * '--char-freq' model (total weight of code units in span) or, failing
+ * that, from '--profile-use' (execution count of the target state).
+ *
+ * Optimal tree is found with Knuth's dynamic programming: cost of a
+ * subtree [i, j] is its total weight plus the cost of both subtrees,
+ * and the optimal root is monotonous in both i and j. Subtrees of an
+ * optimal tree are optimal, so the root table is solved once for all
+ * spans of a state and each 'Binary' looks up the root of its subrange.
+ */
+static bool weighted ()
+{
+	return opts->char_freq_model || opts->profile_file;
+}
+
+// optimal alphabetic tree over weighted spans, solved once per state:
+// 'Binary' node for spans [i, j) splits them at root[i][j]; 'lb' is the
+// least code unit that can reach the first span
+struct SearchTree
+{
+	std::vector<uint64_t> weight;
+	std::vector<std::vector<uint32_t> > root;
+	uint64_t total;
+	uint64_t cost;
+
+	SearchTree (const Span * s, uint32_t n, uint32_t lb);
+	FORBID_COPY (SearchTree);
+};
+
+SearchTree::SearchTree (const Span * s, uint32_t n, uint32_t lb)
+	: weight ()
+	, root ()
+	, total (0)
+	, cost (0)
+{
+	for (uint32_t i = 0; i < n; lb = s[i++].ub)
+	{
+		weight.push_back (opts->char_freq_model
+			? char_freq.weight (lb, s[i].ub)
+			: s[i].to->freq);
+		total += weight.back ();
+	}
+	if (total == 0)
+	{
+		return;
+	}
+
+	std::vector<uint64_t> sum (n + 1, 0);
+	for (uint32_t i = 0; i < n; ++i)
+	{
+		sum[i + 1] = sum[i] + weight[i];
+	}
+
+	// cost[i][j] and root[i][j] for spans [i, j)
+	std::vector<std::vector<uint64_t> > cost (n + 1, std::vector<uint64_t> (n + 1, 0));
+	root.assign (n + 1, std::vector<uint32_t> (n + 1, 0));
+	for (uint32_t i = 0; i + 1 < n; ++i)
+	{
+		cost[i][i + 2] = weight[i] + weight[i + 1];
+		root[i][i + 2] = i + 1;
+	}
+	for (uint32_t d = 3; d <= n; ++d)
+	{
+		for (uint32_t i = 0, j = d; j <= n; ++i, ++j)
+		{
+			uint64_t best = 0;
+			for (uint32_t k = root[i][j - 1]; k <= root[i + 1][j]; ++k)
+			{
+				const uint64_t c = cost[i][k] + cost[k][j];
+				if (k == root[i][j - 1] || c < best)
+				{
+					best = c;
+					root[i][j] = k;
+				}
+			}
+			cost[i][j] = best + sum[j] - sum[i];
+		}
+	}
+	this->cost = cost[0][n];
+}
+
+Binary::Binary (const Span * s, const SearchTree * t, uint32_t i, uint32_t n, const State * next)
 	: cond (NULL)
 	, thn (NULL)
 	, els (NULL)
 {
-	const uint32_t l = n / 2;
+	const uint32_t l = t ? t->root[i][i + n] - i : n / 2;
 	const uint32_t h = n - l;
+	// optimal subtrees are not degenerated into linear chains
+	const uint32_t max_linear = t ? 2 : 4;
 	cond = new Cond ("<=", s[l - 1].ub - 1);
-	thn = new If (l > 4 ? If::BINARY : If::LINEAR, &s[0], l, next);
-	els = new If (h > 4 ? If::BINARY : If::LINEAR, &s[l], h, next);
+	// do not elide jump to the next state in single-span branches:
+	// it leaves empty branch instead
+	thn = new If (l > max_linear ? If::BINARY : If::LINEAR, &s[0], t, i, l, l == 1 ? NULL : next);
+	els = new If (h > max_linear ? If::BINARY : If::LINEAR, &s[l], t, i + l, h, h == 1 ? NULL : next);
 }
 
-Linear::Linear (const Span * s, uint32_t n, const State * next)
+Linear::Linear (const Span * s, const uint64_t * w, uint32_t n, const State * next)
 	: branches ()
+	, cost (0)
+{
+	if (w != NULL && n > 2)
+	{
+		hot_first (s, w, n, next);
+	}
+	else
+	{
+		chain (s, n, next);
+	}
+}
+
+void Linear::chain (const Span * s, uint32_t n, const State * next)
 {
 	for (;;)
 	{
@@ -102,56 +210,220 @@ Linear::Linear (const Span * s, uint32_t n, const State * next)
 	}
 }
 
-If::If (type_t t, const Span * sp, uint32_t nsp, const State * next)
+/*
+ * note [hot-first linear chains]
+ *
+ * With weights, comparisons are ordered by weight of the tested span
+ * rather than by code unit. A step can test the lowest span ('<='),
+ * the highest span ('>=') or a span of a single code unit ('=='). Code
+ * units of the tested span never reach the rest of the chain, so the
+ * span is removed; a single code unit removed from the middle joins an
+ * adjacent span, and two adjacent spans with the same target state are
+ * merged (which saves a comparison).
+ *
+ * Chains are short (a few spans), so all orders of tests are tried
+ * and the cheapest one is taken: it tests hot spans first, and prefers
+ * '==' that merge spans. 'cost' is the expected number of comparisons
+ * times total weight, the same measure as the cost of an optimal tree.
+ */
+struct wrange_t
+{
+	uint32_t lb;
+	uint32_t ub;
+	const State * to;
+	uint64_t weight;
+};
+
+static bool testable (const std::vector<wrange_t> & r, size_t k)
+{
+	return k == 0 || k == r.size () - 1 || r[k].ub - r[k].lb == 1;
+}
+
+static void remove_range (std::vector<wrange_t> & r, size_t k)
+{
+	if (k > 0 && k < r.size () - 1)
+	{
+		wrange_t & a = r[k - 1];
+		wrange_t & b = r[k + 1];
+		if (a.to == b.to)
+		{
+			a.ub = b.ub;
+			a.weight += b.weight;
+			r.erase (r.begin () + static_cast<ptrdiff_t> (k + 1));
+		}
+		// keep single code unit spans testable with '=='
+		else if (a.ub - a.lb == 1 && b.ub - b.lb != 1)
+		{
+			b.lb = a.ub;
+		}
+		else
+		{
+			a.ub = b.lb;
+		}
+	}
+	r.erase (r.begin () + static_cast<ptrdiff_t> (k));
+}
+
+// cost of the rest of the chain if the next test is the 'tests'-th one
+static uint64_t chain_cost (const std::vector<wrange_t> & r, uint64_t tests, size_t * best)
+{
+	const size_t m = r.size ();
+	if (m == 1)
+	{
+		return r[0].weight * (tests - 1);
+	}
+	uint64_t min = 0;
+	for (size_t k = 0; k < m; ++k)
+	{
+		if (testable (r, k))
+		{
+			std::vector<wrange_t> rest (r);
+			remove_range (rest, k);
+			const uint64_t c = r[k].weight * tests + chain_cost (rest, tests + 1, NULL);
+			if (k == 0 || c < min)
+			{
+				min = c;
+				if (best)
+				{
+					*best = k;
+				}
+			}
+		}
+	}
+	return min;
+}
+
+void Linear::hot_first (const Span * s, const uint64_t * w, uint32_t n, const State * next)
+{
+	std::vector<wrange_t> r;
+	for (uint32_t i = 0, lb = 0; i < n; lb = s[i++].ub)
+	{
+		const wrange_t x = {lb, s[i].ub, s[i].to, w[i]};
+		r.push_back (x);
+	}
+	cost = chain_cost (r, 1, NULL);
+
+	while (r.size () > 1)
+	{
+		const size_t m = r.size ();
+		size_t k = 0;
+		if (m == 2)
+		{
+			// the other span is reached without comparison:
+			// let it be the next state, so that jump is elided
+			k = r[0].to == next || (r[1].to != next && r[1].weight > r[0].weight) ? 1 : 0;
+		}
+		else
+		{
+			chain_cost (r, 1, &k);
+		}
+
+		if (k == 0)
+		{
+			branches.push_back (std::make_pair (new Cond ("<=", r[0].ub - 1), r[0].to));
+		}
+		else if (k == m - 1)
+		{
+			branches.push_back (std::make_pair (new Cond (">=", r[k].lb), r[k].to));
+		}
+		else
+		{
+			branches.push_back (std::make_pair (new Cond ("==", r[k].lb), r[k].to));
+		}
+		remove_range (r, k);
+	}
+	if (next == NULL || r[0].to != next)
+	{
+		branches.push_back (std::make_pair (static_cast<const Cond *> (NULL), r[0].to));
+	}
+}
+
+If::If (type_t t, const Span * sp, const SearchTree * tree, uint32_t i, uint32_t nsp, const State * next)
 	: type (t)
 	, info ()
 {
 	switch (type)
 	{
 		case BINARY:
-			info.binary = new Binary (sp, nsp, next);
+			info.binary = new Binary (sp, tree, i, nsp, next);
 			break;
 		case LINEAR:
-			info.linear = new Linear (sp, nsp, next);
+			info.linear = new Linear (sp, tree ? &tree->weight[i] : NULL, nsp, next);
 			break;
 	}
 }
 
-SwitchIf::SwitchIf (const Span * sp, uint32_t nsp, const State * next)
+SwitchIf::SwitchIf (const Span * sp, uint32_t nsp, uint32_t lb, const State * next)
 	: type (IF)
 	, info ()
 {
-	if ((!opts->sFlag && nsp > 2) || (nsp > 8 && (sp[nsp - 2].ub - sp[0].ub <= 3 * (nsp - 2))))
+	// with a model of input, weighted 'if' beat 'switch' (see note [weighted search trees])
+	if (!opts->char_freq_model
+		&& ((!opts->sFlag && nsp > 2) || (nsp > 8 && (sp[nsp - 2].ub - sp[0].ub <= 3 * (nsp - 2)))))
 	{
 		type = SWITCH;
 		info.cases = new Cases (sp, nsp);
 	}
+	else if (weighted () && nsp > 2)
+	{
+		const SearchTree tree (sp, nsp, lb);
+		const SearchTree * t = tree.total > 0 ? &tree : NULL;
+		// short chains may beat the optimal tree: '==' tests take hot
+		// code units out of order (see note [hot-first linear chains])
+		if (t && nsp <= 5)
+		{
+			info.ifs = new If (If::LINEAR, sp, t, 0, nsp, next);
+			if (info.ifs->info.linear->cost >= tree.cost)
+			{
+				delete info.ifs;
+				info.ifs = NULL;
+			}
+		}
+		if (info.ifs == NULL)
+		{
+			info.ifs = new If (t || nsp > 5 ? If::BINARY : If::LINEAR, sp, t, 0, nsp, next);
+		}
+	}
 	else if (nsp > 5)
 	{
-		info.ifs = new If (If::BINARY, sp, nsp, next);
+		info.ifs = new If (If::BINARY, sp, NULL, 0, nsp, next);
 	}
 	else
 	{
-		info.ifs = new If (If::LINEAR, sp, nsp, next);
+		info.ifs = new If (If::LINEAR, sp, NULL, 0, nsp, next);
 	}
 }
 
-GoBitmap::GoBitmap (const Span * span, uint32_t nSpans, const Span * hspan, uint32_t hSpans, const BitMap * bm, const State * bm_state, const State * next)
+GoBitmap::GoBitmap (const Span * span, uint32_t nSpans, const Span * hspan, uint32_t hSpans, const BitMap * bm, const State * bm_state, const State * next, bool use_wide)
 	: bitmap (bm)
 	, bitmap_state (bm_state)
 	, hgo (NULL)
 	, lgo (NULL)
+	, wide (false)
 {
 	Span * bspan = allocate<Span> (nSpans);
 	uint32_t bSpans = unmap (bspan, span, nSpans, bm_state);
 	lgo = bSpans == 0
 		? NULL
-		:  new SwitchIf (bspan, bSpans, next);
+		:  new SwitchIf (bspan, bSpans, 0, next);
+	if (use_wide)
+	{
+		// high code units that are not in bitmap: high part of
+		// bitmap never falls through, so jumps must be explicit
+		const uint32_t wSpans = unmap (bspan, hspan, hSpans, bm_state);
+		if (wSpans > 0)
+		{
+			wide = true;
+			hgo = new SwitchIf (bspan, wSpans, 0x100, NULL);
+		}
+	}
 	// if there are any low spans, then next state for high spans
-	// must be NULL to trigger explicit goto generation in linear 'if'
-	hgo = hSpans == 0
-		? NULL
-		: new SwitchIf (hspan, hSpans, lgo ? NULL : next);
+	// must be NULL to trigger explicit goto generation in linear 'if';
+	// high spans are only checked for code units above 0xFF
+	if (!wide && hSpans > 0)
+	{
+		hgo = new SwitchIf (hspan, hSpans, 0x100, lgo ? NULL : next);
+	}
 	operator delete (bspan);
 }
 
@@ -170,9 +442,12 @@ CpgotoTable::CpgotoTable (const Span * span, uint32_t nSpans)
 	}
 }
 
-Cpgoto::Cpgoto (const Span * span, uint32_t nSpans, const Span * hspan, uint32_t hSpans, const State * next)
-	: hgo (hSpans == 0 ? NULL : new SwitchIf (hspan, hSpans, next))
+Cpgoto::Cpgoto (const Span * span, uint32_t nSpans, const Span * hspan, uint32_t hSpans, const State * next, bitmaps_t * wide)
+	: hgo (hSpans == 0 || wide ? NULL : new SwitchIf (hspan, hSpans, 0x100, next))
 	, table (new CpgotoTable (span, nSpans))
+	, wspan (wide ? hspan : NULL)
+	, wSpans (wide ? hSpans : 0)
+	, wmap (wide ? wide->add_jumps (span, nSpans) : 0)
 {}
 
 Dot::Dot (const Span * sp, uint32_t nsp, const State * s)
@@ -187,9 +462,10 @@ Go::Go ()
 	, info ()
 {}
 
-void Go::init (const State * from)
+void Go::init (const State * from, bitmaps_t & bitmaps)
 {
-	if (nSpans == 0)
+	// with '--table' transitions are emitted as tables from spans
+	if (nSpans == 0 || opts->target == opt_t::TABLE)
 	{
 		return;
 	}
@@ -215,7 +491,7 @@ void Go::init (const State * from)
 	{
 		if (span[i].to->isBase)
 		{
-			const BitMap *b = BitMap::find (span[i].to);
+			const BitMap *b = bitmaps.find (span[i].to);
 			if (b && matches(b->go->span, b->go->nSpans, b->on, span, nSpans, span[i].to))
 			{
 				if (bitmap == NULL)
@@ -229,26 +505,29 @@ void Go::init (const State * from)
 	}
 
 	const uint32_t dSpans = nSpans - hSpans - nBitmaps;
+	// see note [wide tables]
+	const bool wide = hSpans > 0 && hSpans >= opts->cGotoThreshold;
 	if (opts->target == opt_t::DOT)
 	{
 		type = DOT;
 		info.dot = new Dot (span, nSpans, from);
 	}
-	else if (opts->gFlag && (dSpans >= opts->cGotoThreshold))
+	else if (opts->gFlag && (dSpans >= opts->cGotoThreshold || wide))
 	{
 		type = CPGOTO;
-		info.cpgoto = new Cpgoto (span, nSpans, hspan, hSpans, from->next);
+		info.cpgoto = new Cpgoto (span, nSpans, hspan, hSpans, from->next, wide ? &bitmaps : NULL);
 	}
 	else if (opts->bFlag && (nBitmaps > 0))
 	{
 		type = BITMAP;
-		info.bitmap = new GoBitmap (span, nSpans, hspan, hSpans, bitmap, bitmap_state, from->next);
-		bUsedYYBitmap = true;
+		info.bitmap = new GoBitmap (span, nSpans, hspan, hSpans, bitmap, bitmap_state, from->next, wide);
+		bitmaps.used = true;
+		bitmaps.used_wide |= info.bitmap->wide;
 	}
 	else
 	{
 		type = SWITCH_IF;
-		info.switchif = new SwitchIf (span, nSpans, from->next);
+		info.switchif = new SwitchIf (span, nSpans, 0, from->next);
 	}
 }
 
@@ -22,6 +22,8 @@ static void output_if (OutputFile & o, uint32_t ind, bool & readCh, const std::s
 static void output_goto (OutputFile & o, uint32_t ind, bool & readCh, label_t to);
 static std::string output_yych (bool & readCh);
 static std::string output_hgo (OutputFile & o, uint32_t ind, bool & readCh, SwitchIf * hgo);
+static void output_page (OutputFile & o, const std::string & table, uint32_t map);
+static void output_mask (OutputFile & o, uint32_t m);
 
 std::string output_yych (bool & readCh)
 {
@@ -68,6 +70,26 @@ std::string output_hgo (OutputFile & o, uint32_t ind, bool & readCh, SwitchIf *
 	return yych;
 }
 
+// lookup of high code unit in two-level table (see note [wide tables])
+void output_page (OutputFile & o, const std::string & table, uint32_t map)
+{
+	o.wstring(table).ws("_pages[(")
+		.wstring(table).ws("_map[").wu32(map).ws(" + (").wstring(opts->yych).ws(" >> 8)] << 8)")
+		.ws(" + (").wstring(opts->yych).ws(" & 0xFF)]");
+}
+
+void output_mask (OutputFile & o, uint32_t m)
+{
+	if (opts->yybmHexTable)
+	{
+		o.wu32_hex(m);
+	}
+	else
+	{
+		o.wu32(m);
+	}
+}
+
 void Case::emit (OutputFile & o, uint32_t ind)
 {
 	for (uint32_t i = 0; i < ranges.size (); ++i)
@@ -160,16 +182,28 @@ void SwitchIf::emit (OutputFile & o, uint32_t ind, bool & readCh)
 
 void GoBitmap::emit (OutputFile & o, uint32_t ind, bool & readCh)
 {
-	std::string yych = output_hgo (o, ind, readCh, hgo);
-	o.ws("if (").wstring(opts->yybm).ws("[").wu32(bitmap->i).ws("+").wstring(yych).ws("] & ");
-	if (opts->yybmHexTable)
+	std::string yych;
+	if (wide)
 	{
-		o.wu32_hex(bitmap->m);
+		o.wind(ind).ws("if (").wstring(output_yych (readCh)).ws(" & ~0xFF) {\n");
+		// see note [wide tables]
+		o.wind(ind + 1).ws("if (").wstring(opts->yych).ws(" <= ").wc_hex (opts->encoding.nCodeUnits () - 1).ws(" && (");
+		output_page (o, opts->yybm, bitmap->i / 0x100 * wide_pages ());
+		o.ws(" & ");
+		output_mask (o, bitmap->m);
+		o.ws(")) {\n");
+		output_goto (o, ind + 2, readCh, bitmap_state->label);
+		o.wind(ind + 1).ws("}\n");
+		hgo->emit (o, ind + 1, readCh);
+		o.wind(ind).ws("} else ");
+		yych = opts->yych;
 	}
 	else
 	{
-		o.wu32(bitmap->m);
+		yych = output_hgo (o, ind, readCh, hgo);
 	}
+	o.ws("if (").wstring(opts->yybm).ws("[").wu32(bitmap->i).ws("+").wstring(yych).ws("] & ");
+	output_mask (o, bitmap->m);
 	o.ws(") {\n");
 	output_goto (o, ind + 1, readCh, bitmap_state->label);
 	o.wind(ind).ws("}\n");
@@ -219,7 +253,23 @@ void CpgotoTable::emit (OutputFile & o, uint32_t ind)
 
 void Cpgoto::emit (OutputFile & o, uint32_t ind, bool & readCh)
 {
-	std::string yych = output_hgo (o, ind, readCh, hgo);
+	std::string yych;
+	if (wspan != NULL)
+	{
+		o.wind(ind).ws("if (").wstring(output_yych (readCh)).ws(" & ~0xFF) {\n");
+		// see note [wide tables]
+		output_if (o, ind + 1, readCh, ">", opts->encoding.nCodeUnits () - 1);
+		output_goto (o, 0, readCh, wspan[wSpans - 1].to->label);
+		o.wind(ind + 1).ws("goto *");
+		output_page (o, opts->yytarget, wmap);
+		o.ws(";\n");
+		o.wind(ind).ws("} else ");
+		yych = opts->yych;
+	}
+	else
+	{
+		yych = output_hgo (o, ind, readCh, hgo);
+	}
 	o.ws("{\n");
 	table->emit (o, ++ind);
 	o.wind(ind).ws("goto *").wstring(opts->yytarget).ws("[").wstring(yych).ws("];\n");
@@ -87,6 +87,10 @@ void Cpgoto::used_labels (std::set<label_t> & used)
 		hgo->used_labels (used);
 	}
 	table->used_labels (used);
+	for (uint32_t i = 0; i < wSpans; ++i)
+	{
+		used.insert (wspan[i].to->label);
+	}
 }
 
 void Go::used_labels (std::set<label_t> & used)
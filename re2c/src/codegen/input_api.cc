@@ -158,6 +158,13 @@ std::string InputAPI::expr_lessthan_one () const
 }
 
 std::string InputAPI::expr_lessthan (size_t n) const
+{
+	std::ostringstream s;
+	s << n;
+	return expr_lessthan (s.str ());
+}
+
+std::string InputAPI::expr_lessthan (const std::string & n) const
 {
 	std::ostringstream s;
 	switch (type_)
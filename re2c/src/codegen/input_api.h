@@ -36,6 +36,7 @@ public:
 	std::string stmt_skip_backup_peek (uint32_t ind) const;
 	std::string expr_lessthan_one () const;
 	std::string expr_lessthan (size_t n) const;
+	std::string expr_lessthan (const std::string & n) const;
 };
 
 } // end namespace re2c
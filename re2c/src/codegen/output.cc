@@ -1,5 +1,7 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <time.h>
+#include <algorithm>
 #include <iomanip>
 
 #include "src/codegen/indent.h"
@@ -13,18 +15,57 @@
 namespace re2c
 {
 
-OutputFragment::OutputFragment (type_t t, uint32_t i)
-	: type (t)
-	, stream ()
-	, indent (i)
-{}
+/*
+ * note [streaming output]
+ *
+ * Some parts of the output (delayed fragments) depend on things that
+ * become known only later: YYMAXFILL, condition types, state switch
+ * and counters depend on the whole file, yyaccept initialization
+ * depends on the whole block, and #line directives depend on the number
+ * of lines before them. Holding the whole output in memory until the
+ * end is expensive for large scanners, so output is flushed as soon as
+ * possible:
+ *
+ *   - While all fragments so far are resolved, code goes straight
+ *     to the output file. A delayed fragment is resolved on the spot
+ *     if it can be (#line directives, and yyaccept initialization once
+ *     its block is finished).
+ *
+ *   - At the first fragment that can't be resolved yet, a temporary
+ *     spill file is created. From now on code goes to the spill file
+ *     (each fragment remembers how much of it was spilled), and delayed
+ *     fragments wait in memory.
+ *
+ *   - At the end, the waiting fragments are resolved and written
+ *     interleaved with the code copied back from the spill file.
+ *
+ * Code fragments are flushed when they are closed (a delayed fragment
+ * or a new block starts) and also when they grow large, so that code
+ * of a single huge DFA isn't accumulated in memory either.
+ *
+ * If compilation fails (with an error or -Werror), the output file
+ * must be left empty, as if nothing had been written: fatal errors
+ * terminate re2c with 'exit', so the file is truncated in an 'atexit'
+ * handler unless output has been completed. Output to stdout can't be
+ * taken back, so it is not streamed.
+ */
+static const std::streamoff FLUSH_THRESHOLD = 64 * 1024;
+
+static OutputFile * streamed_file = NULL;
+
+static void discard_streamed_file ()
+{
+	if (streamed_file != NULL)
+	{
+		streamed_file->discard ();
+	}
+}
 
-uint32_t OutputFragment::count_lines ()
+static uint32_t count_lines (const std::string & content)
 {
 	uint32_t lines = 0;
-	const std::string content = stream.str ();
 	const char * p = content.c_str ();
-	for (uint32_t i = 0; i < content.size (); ++i)
+	for (size_t i = 0; i < content.size (); ++i)
 	{
 		if (p[i] == '\n')
 		{
@@ -34,6 +75,14 @@ uint32_t OutputFragment::count_lines ()
 	return lines;
 }
 
+OutputFragment::OutputFragment (type_t t, uint32_t i)
+	: type (t)
+	, stream ()
+	, indent (i)
+	, spilled (0)
+	, spilled_lines (0)
+{}
+
 OutputBlock::OutputBlock ()
 	: fragments ()
 	, used_yyaccept (false)
@@ -55,7 +104,16 @@ OutputBlock::~OutputBlock ()
 OutputFile::OutputFile (const char * fn)
 	: file_name (fn)
 	, file (NULL)
+	, spill (NULL)
 	, blocks ()
+	, stats ()
+	, streaming (false)
+	, line_count (1)
+	, flushed_bytes (0)
+	, flushed_block (0)
+	, flushed_fragment (0)
+	, spill_block (0)
+	, spill_fragment (0)
 	, label_counter ()
 	, warn_condition_order (!opts->tFlag) // see note [condition order]
 {
@@ -72,16 +130,32 @@ bool OutputFile::open ()
 	else
 	{
 		file = fopen (file_name, "w");
+
+		// see note [streaming output]
+		streaming = true;
+		if (streamed_file == NULL)
+		{
+			atexit (discard_streamed_file);
+		}
+		streamed_file = this;
 	}
 	return file != NULL;
 }
 
 OutputFile::~OutputFile ()
 {
+	if (streamed_file == this)
+	{
+		streamed_file = NULL;
+	}
 	if (file != NULL && file != stdout)
 	{
 		fclose (file);
 	}
+	if (spill != NULL)
+	{
+		fclose (spill);
+	}
 	for (unsigned int i = 0; i < blocks.size (); ++i)
 	{
 		delete blocks[i];
@@ -106,6 +180,10 @@ OutputFile & OutputFile::wraw (const char * s, size_t n)
 			o.write(p, 1);
 	}
 
+	if (o.tellp () >= FLUSH_THRESHOLD)
+	{
+		flush ();
+	}
 	return *this;
 }
 
@@ -200,13 +278,19 @@ OutputFile & OutputFile::wrank (rule_rank_t r)
 
 OutputFile & OutputFile::wind (uint32_t ind)
 {
-	stream () << indent(ind);
+	std::ostream & o = stream ();
+	if (o.tellp () >= FLUSH_THRESHOLD)
+	{
+		flush ();
+	}
+	o << indent(ind);
 	return *this;
 }
 
 void OutputFile::insert_code ()
 {
 	blocks.back ()->fragments.push_back (new OutputFragment (OutputFragment::CODE, 0));
+	flush ();
 }
 
 OutputFile & OutputFile::wdelay_line_info ()
@@ -227,6 +311,13 @@ OutputFile & OutputFile::wdelay_state_goto (uint32_t ind)
 	return *this;
 }
 
+OutputFile & OutputFile::wdelay_stats ()
+{
+	blocks.back ()->fragments.push_back (new OutputFragment (OutputFragment::STATS, 0));
+	insert_code ();
+	return *this;
+}
+
 OutputFile & OutputFile::wdelay_types ()
 {
 	warn_condition_order = false; // see note [condition order]
@@ -291,12 +382,126 @@ uint32_t OutputFile::get_block_line () const
 	return blocks.back ()->line;
 }
 
+uint32_t OutputFile::new_stat (const std::string & name)
+{
+	stats.push_back (name);
+	return static_cast<uint32_t> (stats.size () - 1);
+}
+
+// bytes of code written so far (delayed fragments are not resolved yet)
+size_t OutputFile::size ()
+{
+	size_t bytes = flushed_bytes;
+	for (size_t j = flushed_block; j < blocks.size (); ++j)
+	{
+		const OutputBlock & b = * blocks[j];
+		for (size_t i = j == flushed_block ? flushed_fragment : 0; i < b.fragments.size (); ++i)
+		{
+			bytes += static_cast<size_t> (b.fragments[i]->stream.tellp ());
+		}
+	}
+	return bytes;
+}
+
 void OutputFile::new_block ()
 {
 	blocks.push_back (new OutputBlock ());
 	insert_code ();
 }
 
+// generate contents of delayed fragment if it doesn't depend
+// on anything that is not known yet (see note [streaming output])
+bool OutputFile::resolve (OutputFragment & f, const OutputBlock & b, bool closed)
+{
+	switch (f.type)
+	{
+		case OutputFragment::LINE_INFO:
+			output_line_info (f.stream, line_count + 1, file_name);
+			return true;
+		case OutputFragment::YYACCEPT_INIT:
+			if (closed)
+			{
+				output_yyaccept_init (f.stream, f.indent, b.used_yyaccept);
+				return true;
+			}
+			return false;
+		default:
+			return false;
+	}
+}
+
+// move fragment contents to spill file (if any) or output file
+void OutputFile::write (OutputFragment & f)
+{
+	const std::string content = f.stream.str ();
+	if (content.empty ())
+	{
+		return;
+	}
+	f.stream.str ("");
+	flushed_bytes += content.size ();
+	const uint32_t lines = count_lines (content);
+	if (spill != NULL)
+	{
+		fwrite (content.c_str (), 1, content.size (), spill);
+		f.spilled += content.size ();
+		f.spilled_lines += lines;
+	}
+	else
+	{
+		fwrite (content.c_str (), 1, content.size (), file);
+		line_count += lines;
+	}
+}
+
+void OutputFile::flush ()
+{
+	if (!streaming)
+	{
+		return;
+	}
+	for (; flushed_block < blocks.size (); ++flushed_block, flushed_fragment = 0)
+	{
+		const OutputBlock & b = * blocks[flushed_block];
+		const bool closed = flushed_block + 1 < blocks.size ();
+		for (; flushed_fragment < b.fragments.size (); ++flushed_fragment)
+		{
+			OutputFragment & f = * b.fragments[flushed_fragment];
+			switch (f.type)
+			{
+				case OutputFragment::CODE:
+				// no text, warning is reported in 'emit'
+				case OutputFragment::WARN_CONDITION_ORDER:
+					break;
+				default:
+					if (spill == NULL && resolve (f, b, closed))
+					{
+						break;
+					}
+					if (spill == NULL)
+					{
+						spill = tmpfile ();
+						if (spill == NULL)
+						{
+							// keep the rest in memory
+							streaming = false;
+							return;
+						}
+						spill_block = flushed_block;
+						spill_fragment = flushed_fragment;
+					}
+					continue;
+			}
+			write (f);
+			if (!closed && flushed_fragment + 1 == b.fragments.size ())
+			{
+				// the last fragment is still open
+				return;
+			}
+		}
+	}
+}
+
 void OutputFile::emit
 	( const std::vector<std::string> & types
 	, size_t max_fill
@@ -304,16 +509,39 @@ void OutputFile::emit
 {
 	if (file != NULL)
 	{
-		unsigned int line_count = 1;
 		for (unsigned int j = 0; j < blocks.size (); ++j)
 		{
 			OutputBlock & b = * blocks[j];
 			for (unsigned int i = 0; i < b.fragments.size (); ++i)
+			{
+				if (b.fragments[i]->type == OutputFragment::WARN_CONDITION_ORDER
+					&& warn_condition_order) // see note [condition order]
+				{
+					warn.condition_order (b.line);
+				}
+			}
+		}
+
+		// see note [streaming output]
+		size_t first_block = flushed_block;
+		size_t first_fragment = flushed_fragment;
+		if (spill != NULL)
+		{
+			first_block = spill_block;
+			first_fragment = spill_fragment;
+			rewind (spill);
+		}
+		char buffer[4096];
+		for (size_t j = first_block; j < blocks.size (); ++j)
+		{
+			OutputBlock & b = * blocks[j];
+			for (size_t i = j == first_block ? first_fragment : 0; i < b.fragments.size (); ++i)
 			{
 				OutputFragment & f = * b.fragments[i];
 				switch (f.type)
 				{
 					case OutputFragment::CODE:
+					case OutputFragment::WARN_CONDITION_ORDER:
 						break;
 					case OutputFragment::LINE_INFO:
 						output_line_info (f.stream, line_count + 1, file_name);
@@ -321,15 +549,12 @@ void OutputFile::emit
 					case OutputFragment::STATE_GOTO:
 						output_state_goto (f.stream, f.indent, 0);
 						break;
+					case OutputFragment::STATS:
+						output_stats (f.stream, stats);
+						break;
 					case OutputFragment::TYPES:
 						output_types (f.stream, f.indent, types);
 						break;
-					case OutputFragment::WARN_CONDITION_ORDER:
-						if (warn_condition_order) // see note [condition order]
-						{
-							warn.condition_order (b.line);
-						}
-						break;
 					case OutputFragment::YYACCEPT_INIT:
 						output_yyaccept_init (f.stream, f.indent, b.used_yyaccept);
 						break;
@@ -337,14 +562,33 @@ void OutputFile::emit
 						output_yymaxfill (f.stream, max_fill);
 						break;
 				}
+				for (size_t n = f.spilled, m; n > 0; n -= m)
+				{
+					m = fread (buffer, 1, std::min (n, sizeof (buffer)), spill);
+					if (m == 0)
+					{
+						break;
+					}
+					fwrite (buffer, 1, m, file);
+				}
+				line_count += f.spilled_lines;
 				std::string content = f.stream.str ();
 				fwrite (content.c_str (), 1, content.size (), file);
-				line_count += f.count_lines ();
+				line_count += count_lines (content);
 			}
 		}
 	}
 }
 
+// compilation failed: leave the output file empty
+void OutputFile::discard ()
+{
+	if (file != NULL && file != stdout)
+	{
+		file = freopen (file_name, "w", file);
+	}
+}
+
 HeaderFile::HeaderFile (const char * fn)
 	: stream ()
 	// header is always generated, but not always dumped to file
@@ -393,6 +637,10 @@ Output::~Output ()
 		source.emit (types, max_fill);
 		header.emit (types);
 	}
+	else
+	{
+		source.discard ();
+	}
 }
 
 void output_state_goto (std::ostream & o, uint32_t ind, uint32_t start_label)
@@ -418,6 +666,35 @@ void output_state_goto (std::ostream & o, uint32_t ind, uint32_t start_label)
 	}
 }
 
+/*
+ * Counters are shared by all blocks in the file: each state and rule
+ * emitted with '--instrument' takes the next slot. The dump function
+ * prints all of them along with their labels (or rule locations).
+ */
+void output_stats (std::ostream & o, const std::vector<std::string> & stats)
+{
+	const size_t n = stats.size ();
+	if (n == 0)
+	{
+		return;
+	}
+	const std::string & yystats = opts->yystats;
+	o << "static unsigned long " << yystats << "[" << n << "];\n";
+	o << "static const char * const " << yystats << "name[" << n << "] = {\n";
+	for (size_t i = 0; i < n; ++i)
+	{
+		o << indent (1) << "\"" << stats[i] << "\",\n";
+	}
+	o << "};\n";
+	o << "static void " << yystats << "dump (FILE * f)\n";
+	o << "{\n";
+	o << indent (1) << "unsigned int i;\n";
+	o << indent (1) << "for (i = 0; i < " << n << "; ++i) {\n";
+	o << indent (2) << "fprintf (f, \"%s\\t%lu\\n\", " << yystats << "name[i], " << yystats << "[i]);\n";
+	o << indent (1) << "}\n";
+	o << "}\n";
+}
+
 void output_yyaccept_init (std::ostream & o, uint32_t ind, bool used_yyaccept)
 {
 	if (used_yyaccept)
@@ -26,6 +26,7 @@ struct OutputFragment
 //		, CONFIG
 		, LINE_INFO
 		, STATE_GOTO
+		, STATS
 		, TYPES
 		, WARN_CONDITION_ORDER
 		, YYACCEPT_INIT
@@ -35,9 +36,10 @@ struct OutputFragment
 	type_t type;
 	std::ostringstream stream;
 	uint32_t indent;
+	size_t spilled; // bytes moved to spill file (see note [streaming output])
+	uint32_t spilled_lines;
 
 	OutputFragment (type_t t, uint32_t i);
-	uint32_t count_lines ();
 };
 
 struct OutputBlock
@@ -59,7 +61,16 @@ public:
 
 private:
 	FILE * file;
+	FILE * spill;
 	std::vector<OutputBlock *> blocks;
+	std::vector<std::string> stats;
+	bool streaming;
+	uint32_t line_count;
+	size_t flushed_bytes;
+	size_t flushed_block;
+	size_t flushed_fragment;
+	size_t spill_block;
+	size_t spill_fragment;
 
 public:
 	counter_t<label_t> label_counter;
@@ -68,6 +79,9 @@ public:
 private:
 	std::ostream & stream ();
 	void insert_code ();
+	bool resolve (OutputFragment & f, const OutputBlock & b, bool closed);
+	void write (OutputFragment & f);
+	void flush ();
 
 public:
 	OutputFile (const char * fn);
@@ -98,6 +112,7 @@ public:
 	// delayed output
 	OutputFile & wdelay_line_info ();
 	OutputFile & wdelay_state_goto (uint32_t ind);
+	OutputFile & wdelay_stats ();
 	OutputFile & wdelay_types ();
 	OutputFile & wdelay_warn_condition_order ();
 	OutputFile & wdelay_yyaccept_init (uint32_t ind);
@@ -110,8 +125,11 @@ public:
 	bool get_force_start_label () const;
 	void set_block_line (uint32_t l);
 	uint32_t get_block_line () const;
+	uint32_t new_stat (const std::string & name);
+	size_t size ();
 
 	void emit (const std::vector<std::string> & types, size_t max_fill);
+	void discard ();
 
 	FORBID_COPY (OutputFile);
 };
@@ -145,6 +163,7 @@ struct Output
 
 void output_line_info (std::ostream &, uint32_t, const char *);
 void output_state_goto (std::ostream &, uint32_t, uint32_t);
+void output_stats (std::ostream &, const std::vector<std::string> &);
 void output_types (std::ostream &, uint32_t, const std::vector<std::string> &);
 void output_version_time (std::ostream &);
 void output_yyaccept_init (std::ostream &, uint32_t, bool);
@@ -0,0 +1,93 @@
+#include <ctype.h>
+#include <fstream>
+#include <sstream>
+
+#include "src/codegen/profile.h"
+#include "src/conf/msg.h"
+#include "src/parse/loc.h"
+
+namespace re2c
+{
+
+Profile profile;
+
+Profile::Profile ()
+	: states ()
+	, rules ()
+{}
+
+/*
+ * Names are those generated by '--instrument' (see 'genStat'):
+ * 'state <prefix><label>' and 'rule <file>:<line>'. State names are
+ * stripped of label prefix. Counters with the same name are summed,
+ * so dumps of several training runs can be simply concatenated.
+ * Malformed lines are reported: a profile that does not match the
+ * scanner would silently give unweighted code.
+ */
+bool Profile::load (const char * fname)
+{
+	std::ifstream f (fname);
+	if (!f.is_open ())
+	{
+		error ("cannot open profile file: %s", fname);
+		return false;
+	}
+	uint32_t n = 0;
+	for (std::string line; std::getline (f, line);)
+	{
+		++n;
+		if (line.empty ())
+		{
+			continue;
+		}
+		const std::string::size_type tab = line.rfind ('\t');
+		const std::string name = line.substr (0, tab);
+		const std::string cnt = tab == std::string::npos ? "" : line.substr (tab + 1);
+		std::istringstream s (cnt);
+		uint64_t count = 0;
+		if (cnt.empty () || !isdigit (cnt[0]) || !(s >> count) || !s.eof ())
+		{
+			error ("bad profile file %s, line %u: expected '<counter name>\\t<count>'", fname, n);
+			return false;
+		}
+		if (name.compare (0, 6, "state ") == 0)
+		{
+			std::string::size_type i = 6;
+			for (; i < name.size () && !isdigit (name[i]); ++i);
+			if (i == name.size ())
+			{
+				error ("bad profile file %s, line %u: no label in state counter name", fname, n);
+				return false;
+			}
+			states[name.substr (i)] += count;
+		}
+		else if (name.compare (0, 5, "rule ") == 0)
+		{
+			rules[name.substr (5)] += count;
+		}
+		else
+		{
+			error ("bad profile file %s, line %u: unknown counter '%s'", fname, n, name.c_str ());
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t Profile::state (label_t l) const
+{
+	std::ostringstream s;
+	s << l;
+	std::map<std::string, uint64_t>::const_iterator i = states.find (s.str ());
+	return i == states.end () ? 0 : i->second;
+}
+
+uint64_t Profile::rule (const Loc & loc) const
+{
+	std::ostringstream s;
+	s << loc.filename << ":" << loc.line;
+	std::map<std::string, uint64_t>::const_iterator i = rules.find (s.str ());
+	return i == rules.end () ? 0 : i->second;
+}
+
+} // namespace re2c
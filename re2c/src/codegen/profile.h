@@ -0,0 +1,34 @@
+#ifndef _RE2C_CODEGEN_PROFILE_
+#define _RE2C_CODEGEN_PROFILE_
+
+#include <map>
+#include <string>
+
+#include "src/codegen/label.h"
+#include "src/util/c99_stdint.h"
+#include "src/util/forbid_copy.h"
+
+namespace re2c
+{
+
+struct Loc;
+
+// execution counts recorded by a scanner built with '--instrument'
+// and dumped with 'yystatsdump': one '<name>\t<count>' line per counter
+class Profile
+{
+	std::map<std::string, uint64_t> states;
+	std::map<std::string, uint64_t> rules;
+
+public:
+	Profile ();
+	bool load (const char * fname);
+	uint64_t state (label_t l) const;
+	uint64_t rule (const Loc & loc) const;
+
+	FORBID_COPY (Profile);
+};
+
+} // namespace re2c
+
+#endif // _RE2C_CODEGEN_PROFILE_
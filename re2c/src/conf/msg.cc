@@ -60,7 +60,7 @@ void warning (const char * type, uint32_t line, bool error, const char * fmt, ..
 void usage ()
 {
 	fprintf (stderr,
-	"usage: re2c [-bcdDefFghirsuvVwx18] [-o of] [-t th] file\n"
+	"usage: re2c [-bcdDefFghirsuvVwx18] [-j n] [-o of] [-t th] file\n"
 	"\n"
 	"-? -h  --help           Display this info.\n"
 	"\n"
@@ -91,6 +91,10 @@ void usage ()
 	"\n"
 	"-i     --no-debug-info  Do not generate '#line' info (useful for versioning).\n"
 	"\n"
+	"-j n   --jobs=n         Compile up to n conditions in parallel (with -c) and\n"
+	"                        generate data for --skeleton in n threads. Output\n"
+	"                        doesn't depend on n.\n"
+	"\n"
 	"-o of  --output=of      Specify the output file (of) instead of stdout\n"
 	"\n"
 	"-r     --reusable       Allow reuse of scanner definitions.\n"
@@ -145,18 +149,49 @@ void usage ()
 	"                        generate a self-contained program for the same DFA.\n"
 	"                        Most useful for correctness and performance testing.\n"
 	"\n"
+	"--benchmark             Implies --skeleton. Generate a program that measures\n"
+	"                        throughput of the DFA on skeleton data or on a corpus\n"
+	"                        file (MB/s, ns/token, tokens per rule, CPU counters).\n"
+	"\n"
+	"--table                 Emit DFA as compressed transition tables and a driver\n"
+	"                        loop instead of code (-f is not supported).\n"
+	"\n"
+	"--simd-loops            Skip over self-looping character classes 16 bytes at a\n"
+	"                        time using SSE2 (if the C compiler supports it).\n"
+	"\n"
+	"--word-compare          Match chains of single-character states (keywords)\n"
+	"                        with one multi-byte comparison.\n"
+	"\n"
+	"--instrument            Count how many times each state and rule is entered.\n"
+	"                        Counters and dump function are emitted at /*!stats:re2c*/.\n"
+	"\n"
+	"--profile-use file      Order states and branches by execution counts dumped\n"
+	"                        by a scanner built with --instrument.\n"
+	"\n"
+	"--char-freq model       Build nested ifs as optimal search trees for the given\n"
+	"                        distribution of code units: text, json, binary or a file\n"
+	"                        with '<code unit> <weight>' lines.\n"
+	"\n"
+	"--stats file            Write time spent in each compilation phase and sizes of\n"
+	"                        NFA, DFA and generated code to file (in JSON format).\n"
+	"\n"
 	"--empty-class policy    What to do if user inputs empty character class. policy can be\n"
 	"                        one of the following: 'match-empty' (match empty input, default),\n"
 	"                        'match-none' (fail to match on any input), 'error' (compilation\n"
 	"                        error). Note that there are various ways to construct empty class,\n"
 	"                        e.g: [], [^\\x00-\\xFF], [\\x00-\\xFF]\\[\\x00-\\xFF].\n"
 	"\n"
-	"--dfa-minimization <table | moore>\n"
+	"--dfa-minimization <table | moore | hopcroft>\n"
 	"                        Internal algorithm used by re2c to minimize DFA (defaults to\n"
-	"                        'moore'). Both table filling and Moore's algorithms should\n"
-	"                        produce identical DFA (up to states relabelling). Table filling\n"
-	"                        algorithm is much simpler and slower; it serves as a reference\n"
-	"                        implementation.\n"
+	"                        'moore'). Table filling, Moore's and Hopcroft's algorithms\n"
+	"                        should produce identical DFA (up to states relabelling). Table\n"
+	"                        filling algorithm is much simpler and slower; it serves as a\n"
+	"                        reference implementation. Hopcroft's algorithm is the fastest\n"
+	"                        on large DFA.\n"
+	"\n"
+	"--dfa-cache dir         Store compiled DFA in directory dir (which must exist) and\n"
+	"                        reuse them when the same regular expressions are compiled\n"
+	"                        again with the same options.\n"
 	"\n"
 	"-1     --single-pass    Deprecated and does nothing (single pass is by default now).\n"
 	"\n"
@@ -46,6 +46,10 @@ void opt_t::fix ()
 			cGotoThreshold = Opt::baseopt.cGotoThreshold;
 			// default environment-insensitive formatting
 			yybmHexTable = Opt::baseopt.yybmHexTable;
+			simdLoops = Opt::baseopt.simdLoops;
+			wordCompare = Opt::baseopt.wordCompare;
+			profile_file = Opt::baseopt.profile_file;
+			char_freq_model = Opt::baseopt.char_freq_model;
 			// fallthrough
 		case SKELETON:
 			// default line information
@@ -96,6 +100,8 @@ void opt_t::fix ()
 			yylessthan = Opt::baseopt.yylessthan;
 			dFlag = Opt::baseopt.dFlag;
 			yydebug = Opt::baseopt.yydebug;
+			instrument = Opt::baseopt.instrument;
+			yystats = Opt::baseopt.yystats;
 			yyctype = Opt::baseopt.yyctype;
 			yych = Opt::baseopt.yych;
 			bEmitYYCh = Opt::baseopt.bEmitYYCh;
@@ -106,11 +112,36 @@ void opt_t::fix ()
 			fill_arg = Opt::baseopt.fill_arg;
 			fill_arg_use = Opt::baseopt.fill_arg_use;
 			fill_naked = Opt::baseopt.fill_naked;
+			fill_sentinel = Opt::baseopt.fill_sentinel;
 			labelPrefix = Opt::baseopt.labelPrefix;
+			keywords_token = Opt::baseopt.keywords_token;
+			break;
+		case TABLE:
+			// transitions are tables, not code
+			sFlag = Opt::baseopt.sFlag;
+			bFlag = Opt::baseopt.bFlag;
+			gFlag = Opt::baseopt.gFlag;
+			cGotoThreshold = Opt::baseopt.cGotoThreshold;
+			yybmHexTable = Opt::baseopt.yybmHexTable;
+			simdLoops = Opt::baseopt.simdLoops;
+			wordCompare = Opt::baseopt.wordCompare;
+			// driver loop has no per-state code to instrument
+			instrument = Opt::baseopt.instrument;
+			profile_file = Opt::baseopt.profile_file;
+			char_freq_model = Opt::baseopt.char_freq_model;
+			// table driver cannot resume in the middle of DFA
+			fFlag = Opt::baseopt.fFlag;
+			fill_sentinel = Opt::baseopt.fill_sentinel;
+			// keyword lookup needs per-rule code
+			keywords_token = Opt::baseopt.keywords_token;
 			break;
 		default:
 			break;
 	}
+	if (target != SKELETON)
+	{
+		benchmark = Opt::baseopt.benchmark;
+	}
 
 	if (bCaseInsensitive)
 	{
@@ -159,6 +190,10 @@ void opt_t::fix ()
 		cGotoThreshold = Opt::baseopt.cGotoThreshold;
 		yytarget = Opt::baseopt.yytarget;
 	}
+	if (target != TABLE)
+	{
+		yytable = Opt::baseopt.yytable;
+	}
 	if (input_api.type () != InputAPI::DEFAULT)
 	{
 		yycursor = Opt::baseopt.yycursor;
@@ -180,6 +215,10 @@ void opt_t::fix ()
 	{
 		yydebug = Opt::baseopt.yydebug;
 	}
+	if (!instrument)
+	{
+		yystats = Opt::baseopt.yystats;
+	}
 	if (!fill_use)
 	{
 		fill = Opt::baseopt.fill;
@@ -187,6 +226,12 @@ void opt_t::fix ()
 		fill_arg = Opt::baseopt.fill_arg;
 		fill_arg_use = Opt::baseopt.fill_arg_use;
 		fill_naked = Opt::baseopt.fill_naked;
+		fill_sentinel = Opt::baseopt.fill_sentinel;
+	}
+	if (fFlag)
+	{
+		// sentinel checks cannot be resumed after YYFILL
+		fill_sentinel = Opt::baseopt.fill_sentinel;
 	}
 
 	// force individual options
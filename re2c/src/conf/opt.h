@@ -17,6 +17,7 @@ namespace re2c
 #define RE2C_OPTS \
 	/* target */ \
 	OPT1 (opt_t::target_t, target, CODE) \
+	OPT (bool, benchmark, false) \
 	/* fingerprint */ \
 	OPT (bool, bNoGenerationDate, false) \
 	OPT (bool, version, true) \
@@ -63,9 +64,14 @@ namespace re2c
 	OPT (bool, bFlag, false) \
 	OPT (std::string, yybm, "yybm") \
 	OPT (bool, yybmHexTable, false) \
+	OPT (bool, simdLoops, false) \
+	OPT (bool, wordCompare, false) \
 	OPT (bool, gFlag, false) \
 	OPT (std::string, yytarget, "yytarget") \
+	OPT (std::string, yytable, "yyt") \
 	OPT (uint32_t, cGotoThreshold, 9) \
+	/* keywords */ \
+	OPT (std::string, keywords_token, "") \
 	/* formatting */ \
 	OPT (uint32_t, topIndent, 0) \
 	OPT (std::string, indString, "\t") \
@@ -87,6 +93,11 @@ namespace re2c
 	/* debug */ \
 	OPT (bool, dFlag, false) \
 	OPT (std::string, yydebug, "YYDEBUG") \
+	OPT (bool, instrument, false) \
+	OPT (std::string, yystats, "yystats") \
+	OPT (const char *, profile_file, NULL) \
+	OPT (const char *, char_freq_model, NULL) \
+	OPT (const char *, stats_file, NULL) \
 	/* yych */ \
 	OPT (std::string, yyctype, "YYCTYPE") \
 	OPT (std::string, yych, "yych") \
@@ -99,10 +110,13 @@ namespace re2c
 	OPT (std::string, fill_arg, "@@") \
 	OPT (bool, fill_arg_use, true) \
 	OPT (bool, fill_naked, false) \
+	OPT (int32_t, fill_sentinel, -1) \
 	/* labels */ \
 	OPT (std::string, labelPrefix, "yy") \
 	/* internals */ \
-	OPT (dfa_minimization_t, dfa_minimization, DFA_MINIMIZATION_MOORE)
+	OPT (dfa_minimization_t, dfa_minimization, DFA_MINIMIZATION_MOORE) \
+	OPT (const char *, dfa_cache, NULL) \
+	OPT (uint32_t, jobs, 1)
 
 struct opt_t
 {
@@ -110,7 +124,8 @@ struct opt_t
 	{
 		CODE,
 		DOT,
-		SKELETON
+		SKELETON,
+		TABLE
 	};
 
 #define OPT1 OPT
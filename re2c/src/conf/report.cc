@@ -0,0 +1,190 @@
+#include "src/util/c99_stdint.h"
+#include <stdio.h>
+#include <time.h>
+#if HAVE_SYS_TIME_H
+#	include <sys/time.h>
+#endif
+#if HAVE_SYS_RESOURCE_H
+#	include <sys/resource.h>
+#endif
+
+#include "src/conf/report.h"
+
+namespace re2c
+{
+
+Report report;
+
+dfa_stats_t::dfa_stats_t ()
+	: line (0)
+	, cond ()
+	, cached (false)
+	, time_nfa (0)
+	, time_determinization (0)
+	, time_skeleton (0)
+	, time_minimization (0)
+	, time_fillpoints (0)
+	, time_prepare (0)
+	, time_analyses (0)
+	, time_codegen (0)
+	, charset (0)
+	, nfa_states (0)
+	, dfa_states (0)
+	, min_states (0)
+	, adfa_states (0)
+	, spans (0)
+	, bytes (0)
+{}
+
+Report::Report ()
+	: blocks ()
+{}
+
+void Report::new_block (uint32_t line, double time_parse)
+{
+	blocks.push_back (block_t (line, time_parse));
+}
+
+/*
+ * DFA is reported each time it is emitted. With '-r' the same DFA
+ * is emitted by every 'use:re2c' block that doesn't add rules,
+ * so records are keyed by the block in which DFA was compiled and
+ * condition: there is one record per compiled DFA, and code generation
+ * time and size are summed over all its uses.
+ */
+void Report::add_dfa (const dfa_stats_t & dfa)
+{
+	for (size_t i = blocks.size (); i > 0; --i)
+	{
+		block_t & b = blocks[i - 1];
+		if (b.line != dfa.line)
+		{
+			continue;
+		}
+		for (size_t j = 0; j < b.dfas.size (); ++j)
+		{
+			dfa_stats_t & d = b.dfas[j];
+			if (d.cond == dfa.cond)
+			{
+				d.time_codegen += dfa.time_codegen;
+				d.bytes += dfa.bytes;
+				return;
+			}
+		}
+		b.dfas.push_back (dfa);
+		return;
+	}
+	if (!blocks.empty ())
+	{
+		blocks.back ().dfas.push_back (dfa);
+	}
+}
+
+static void json_string (FILE * f, const std::string & s)
+{
+	fputc ('"', f);
+	for (size_t i = 0; i < s.size (); ++i)
+	{
+		const unsigned char c = static_cast<unsigned char> (s[i]);
+		if (c == '"' || c == '\\')
+		{
+			fprintf (f, "\\%c", c);
+		}
+		else if (c < 0x20)
+		{
+			fprintf (f, "\\u%04x", c);
+		}
+		else
+		{
+			fputc (c, f);
+		}
+	}
+	fputc ('"', f);
+}
+
+static void json_time (FILE * f, const char * name, double t, bool last = false)
+{
+	fprintf (f, "\"%s\": %.6f%s", name, t, last ? "" : ", ");
+}
+
+static void json_size (FILE * f, const char * name, size_t n, bool last = false)
+{
+	fprintf (f, "\"%s\": %lu%s", name, static_cast<unsigned long> (n), last ? "" : ", ");
+}
+
+/*
+ * One object per block, one nested object per DFA (condition) compiled
+ * in the block (see 'Report::add_dfa'); times are wall clock seconds. For DFA loaded from
+ * '--dfa-cache' NFA is not constructed and DFA is not determinized
+ * or minimized, so the corresponding times and sizes are zero.
+ */
+bool Report::write (const char * fname, const std::string & input) const
+{
+	FILE * f = fopen (fname, "w");
+	if (!f)
+	{
+		return false;
+	}
+
+	fprintf (f, "{\n\t\"version\": \"%s\",\n\t\"input\": ", PACKAGE_VERSION);
+	json_string (f, input);
+	fprintf (f, ",\n");
+#if HAVE_SYS_RESOURCE_H
+	struct rusage usage;
+	if (getrusage (RUSAGE_SELF, &usage) == 0)
+	{
+		fprintf (f, "\t\"peak_memory_kib\": %ld,\n", static_cast<long> (usage.ru_maxrss));
+	}
+#endif
+	fprintf (f, "\t\"blocks\": [");
+	for (size_t i = 0; i < blocks.size (); ++i)
+	{
+		const block_t & b = blocks[i];
+		fprintf (f, "%s\n\t\t{\n\t\t\t\"line\": %u,\n\t\t\t\"time\": {"
+			, i > 0 ? "," : ""
+			, b.line);
+		json_time (f, "parse", b.time_parse, true);
+		fprintf (f, "},\n\t\t\t\"dfas\": [");
+		for (size_t j = 0; j < b.dfas.size (); ++j)
+		{
+			const dfa_stats_t & d = b.dfas[j];
+			fprintf (f, "%s\n\t\t\t\t{\"cond\": ", j > 0 ? "," : "");
+			json_string (f, d.cond);
+			fprintf (f, ", \"cached\": %s,\n\t\t\t\t\t\"time\": {", d.cached ? "true" : "false");
+			json_time (f, "nfa", d.time_nfa);
+			json_time (f, "determinization", d.time_determinization);
+			json_time (f, "skeleton", d.time_skeleton);
+			json_time (f, "minimization", d.time_minimization);
+			json_time (f, "fillpoints", d.time_fillpoints);
+			json_time (f, "prepare", d.time_prepare);
+			json_time (f, "analyses", d.time_analyses);
+			json_time (f, "codegen", d.time_codegen, true);
+			fprintf (f, "},\n\t\t\t\t\t");
+			json_size (f, "charset", d.charset);
+			json_size (f, "nfa_states", d.nfa_states);
+			json_size (f, "dfa_states", d.dfa_states);
+			json_size (f, "min_states", d.min_states);
+			json_size (f, "adfa_states", d.adfa_states);
+			json_size (f, "spans", d.spans);
+			json_size (f, "bytes", d.bytes, true);
+			fprintf (f, "}");
+		}
+		fprintf (f, "%s]\n\t\t}", b.dfas.empty () ? "" : "\n\t\t\t");
+	}
+	fprintf (f, "%s]\n}\n", blocks.empty () ? "" : "\n\t");
+
+	return fclose (f) == 0;
+}
+
+double wall_time ()
+{
+#if HAVE_SYS_TIME_H
+	struct timeval tv;
+	gettimeofday (&tv, NULL);
+	return static_cast<double> (tv.tv_sec) + static_cast<double> (tv.tv_usec) / 1e6;
+#else
+	return static_cast<double> (clock ()) / CLOCKS_PER_SEC;
+#endif
+}
+
+} // namespace re2c
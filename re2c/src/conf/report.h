@@ -0,0 +1,72 @@
+#ifndef _RE2C_CONF_REPORT_
+#define _RE2C_CONF_REPORT_
+
+#include "src/util/c99_stdint.h"
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+#include "src/util/forbid_copy.h"
+
+namespace re2c
+{
+
+// time (in seconds) and size of each compilation phase of one DFA
+struct dfa_stats_t
+{
+	uint32_t line; // block in which DFA was compiled
+	std::string cond;
+	bool cached;
+
+	double time_nfa;
+	double time_determinization;
+	double time_skeleton;
+	double time_minimization;
+	double time_fillpoints;
+	double time_prepare;
+	double time_analyses;
+	double time_codegen;
+
+	size_t charset;
+	size_t nfa_states;
+	size_t dfa_states;
+	size_t min_states;
+	size_t adfa_states;
+	size_t spans;
+	size_t bytes;
+
+	dfa_stats_t ();
+};
+
+// statistics written with '--stats FILE'
+class Report
+{
+	struct block_t
+	{
+		uint32_t line;
+		double time_parse;
+		std::vector<dfa_stats_t> dfas;
+
+		block_t (uint32_t l, double t)
+			: line (l)
+			, time_parse (t)
+			, dfas ()
+		{}
+	};
+	std::vector<block_t> blocks;
+
+public:
+	Report ();
+	void new_block (uint32_t line, double time_parse);
+	void add_dfa (const dfa_stats_t & dfa);
+	bool write (const char * fname, const std::string & input) const;
+
+	FORBID_COPY (Report);
+};
+
+// wall clock time in seconds
+double wall_time ();
+
+} // namespace re2c
+
+#endif // _RE2C_CONF_REPORT_
@@ -36,6 +36,11 @@ bool Warn::error () const
 	return error_accuml;
 }
 
+bool Warn::is_set (type_t t) const
+{
+	return mask[t] & WARNING;
+}
+
 void Warn::set (type_t t, option_t o)
 {
 	switch (o)
@@ -48,6 +48,7 @@ private:
 public:
 	Warn ();
 	bool error () const;
+	bool is_set (type_t t) const;
 	void set (type_t t, option_t o);
 	void set_all ();
 	void set_all_error ();
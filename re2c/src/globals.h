@@ -3,14 +3,16 @@
 
 #include <string>
 
+#include "src/codegen/char_freq.h"
+#include "src/codegen/profile.h"
 #include "src/conf/opt.h"
+#include "src/conf/report.h"
 #include "src/conf/warn.h"
 #include "src/util/c99_stdint.h"
 
 namespace re2c
 {
 
-extern bool bUsedYYBitmap;
 extern bool bWroteGetState;
 extern bool bWroteCondCheck;
 extern uint32_t last_fill_index;
@@ -18,6 +20,9 @@ extern std::string yySetupRule;
 
 extern Opt opts;
 extern Warn warn;
+extern Profile profile;
+extern CharFreq char_freq;
+extern Report report;
 
 } // end namespace re2c
 
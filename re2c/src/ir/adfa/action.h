@@ -37,7 +37,8 @@ public:
 		SAVE,
 		MOVE,
 		ACCEPT,
-		RULE
+		RULE,
+		FILL
 	} type;
 	union
 	{
@@ -45,6 +46,7 @@ public:
 		uint32_t save;
 		const accept_t * accepts;
 		const RuleOp * rule;
+		const State * dispatch;
 	} info;
 
 public:
@@ -85,6 +87,12 @@ public:
 		type = RULE;
 		info.rule = rule;
 	}
+	void set_fill (const State * dispatch)
+	{
+		clear ();
+		type = FILL;
+		info.dispatch = dispatch;
+	}
 
 private:
 	void clear ()
@@ -99,6 +107,7 @@ private:
 			case MOVE:
 			case ACCEPT:
 			case RULE:
+			case FILL:
 				break;
 		}
 	}
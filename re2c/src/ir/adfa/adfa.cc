@@ -24,6 +24,7 @@ DFA::DFA
 	)
 	: accepts ()
 	, skeleton (skel)
+	, bitmaps ()
 	, name (n)
 	, cond (c)
 	, line (l)
@@ -31,12 +32,14 @@ DFA::DFA
 	, ubChar(charset.back())
 	, nStates(0)
 	, head(NULL)
+	, keywords ()
 
 	// statistics
 	, max_fill (0)
 	, need_backup (false)
 	, need_backupctx (false)
 	, need_accept (false)
+	, stats ()
 {
 	const size_t nstates = dfa.states.size();
 	const size_t nchars = dfa.nchars;
@@ -60,7 +63,15 @@ DFA::DFA
 		s->isPreCtxt = t->ctx;
 		s->rule = t->rule;
 		s->fill = fill[i];
-		s->go.span = allocate<Span>(nchars);
+		// allocate exactly as many spans as there are runs of equal
+		// transitions: the number of character classes may be large
+		uint32_t nspans = 0;
+		for (uint32_t c = 0; c < nchars; ++nspans)
+		{
+			const size_t to = t->arcs[c];
+			for (;++c < nchars && t->arcs[c] == to;);
+		}
+		s->go.span = allocate<Span>(nspans);
 		uint32_t j = 0;
 		for (uint32_t c = 0; c < nchars; ++j)
 		{
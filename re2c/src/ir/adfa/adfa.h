@@ -5,10 +5,14 @@
 #include "src/util/c99_stdint.h"
 #include <set>
 #include <string>
+#include <vector>
 
+#include "src/codegen/bitmap.h"
 #include "src/codegen/go.h"
 #include "src/codegen/label.h"
+#include "src/conf/report.h"
 #include "src/ir/adfa/action.h"
+#include "src/ir/keywords/keywords.h"
 #include "src/ir/regexp/regexp.h"
 #include "src/util/forbid_copy.h"
 
@@ -26,21 +30,35 @@ struct State
 	RuleOp * rule;
 	State * next;
 	size_t fill;
+	uint64_t freq;
 
 	bool isPreCtxt;
 	bool isBase;
 	Go go;
 	Action action;
 
+	// code units matched at once, see note [word-at-a-time comparison]
+	std::vector<uint32_t> word;
+	const State * wordExit;
+
+	// identifier rule: keywords and their rule states, see note [keywords]
+	const keywords_t * keywords;
+	std::vector<const State *> keywordStates;
+
 	State ()
 		: label (label_t::first ())
 		, rule (NULL)
 		, next (0)
 		, fill (0)
+		, freq (0)
 		, isPreCtxt (false)
 		, isBase (false)
 		, go ()
 		, action ()
+		, word ()
+		, wordExit (NULL)
+		, keywords (NULL)
+		, keywordStates ()
 	{}
 	~State ()
 	{
@@ -54,6 +72,7 @@ class DFA
 {
 	accept_t accepts;
 	Skeleton * skeleton;
+	bitmaps_t bitmaps;
 
 public:
 	const std::string name;
@@ -64,12 +83,14 @@ public:
 	uint32_t ubChar;
 	uint32_t nStates;
 	State * head;
+	std::vector<keywords_t> keywords;
 
 	// statistics
 	size_t max_fill;
 	bool need_backup;
 	bool need_backupctx;
 	bool need_accept;
+	dfa_stats_t stats; // see '--stats'
 
 public:
 	DFA	( const dfa_t &dfa
@@ -90,8 +111,12 @@ private:
 	void addState(State*, State *);
 	void split (State *);
 	void findBaseState ();
+	void addSentinelChecks ();
+	void findWordRuns ();
+	void layout ();
 	void count_used_labels (std::set<label_t> & used, label_t prolog, label_t start, bool force_start) const;
 	void emit_body (OutputFile &, uint32_t &, const std::set<label_t> & used_labels, label_t initial) const;
+	void emit_table (OutputFile &, uint32_t) const;
 
 	FORBID_COPY (DFA);
 };
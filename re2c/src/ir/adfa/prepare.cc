@@ -1,9 +1,13 @@
 #include "src/util/c99_stdint.h"
 #include <string.h>
+#include <algorithm>
 #include <map>
+#include <set>
+#include <vector>
 
 #include "src/codegen/bitmap.h"
 #include "src/codegen/go.h"
+#include "src/codegen/input_api.h"
 #include "src/globals.h"
 #include "src/ir/adfa/action.h"
 #include "src/ir/adfa/adfa.h"
@@ -28,12 +32,14 @@ void DFA::split(State *s)
 	s->go.span[0].to = move;
 }
 
+// both span lists cover the same range, so each merged span ends at
+// the upper bound of some span in 'fg' or 'bg': the result has at most
+// 'fg->go.nSpans + bg->go.nSpans' spans, and merge is linear in it
 static uint32_t merge(Span *x0, State *fg, State *bg)
 {
 	Span *x = x0, *f = fg->go.span, *b = bg->go.span;
 	uint32_t nf = fg->go.nSpans, nb = bg->go.nSpans;
 	State *prev = NULL, *to;
-	// NB: we assume both spans are for same range
 
 	for (;;)
 	{
@@ -105,7 +111,14 @@ static uint32_t merge(Span *x0, State *fg, State *bg)
 
 void DFA::findBaseState()
 {
-	Span *span = allocate<Span> (ubChar - lbChar);
+	// scratch space is bounded by the number of spans, not by the
+	// number of code units (which is 0x110000 with '--unicode')
+	uint32_t maxSpans = 0;
+	for (State *s = head; s; s = s->next)
+	{
+		maxSpans = std::max(maxSpans, s->go.nSpans);
+	}
+	Span *span = allocate<Span> (2 * maxSpans);
 
 	for (State *s = head; s; s = s->next)
 	{
@@ -137,10 +150,227 @@ void DFA::findBaseState()
 	operator delete (span);
 }
 
-void DFA::prepare ()
+/*
+ * note [sentinel]
+ *
+ * With 're2c:yyfill:sentinel = <c>;' the user guarantees that the code
+ * unit at YYLIMIT is always <c>. Then there is no need to check bounds
+ * on every fill point: the lexer cannot run past YYLIMIT without
+ * reading <c> first. The only transitions that need a bounds check are
+ * those on <c>: they are redirected to a new (cold) FILL state that
+ * checks if <c> is the real end of buffer. If so, it calls YYFILL and
+ * re-dispatches on the refilled input; if YYFILL brings no new data,
+ * or if <c> is just an ordinary character before YYLIMIT, the FILL
+ * state follows the original transition.
+ *
+ * Re-dispatch needs a label that does not skip the current character,
+ * so non-base states are split just like base ones.
+ *
+ * A state needs no check if all characters lead to the same
+ * non-consuming state (rule or accept): more input would not change
+ * anything. A transition to a MOVE state is checked by that state.
+ */
+void DFA::addSentinelChecks()
 {
-	bUsedYYBitmap = false;
+	const uint32_t c = static_cast<uint32_t> (opts->fill_sentinel);
+	if (c >= ubChar)
+	{
+		return;
+	}
+
+	std::vector<State*> fills;
+	for (State *s = head; s; s = s->next)
+	{
+		if (s->action.type == Action::MATCH || s->action.type == Action::SAVE)
+		{
+			State *d = s->isBase ? s->next : s;
+
+			uint32_t i = 0;
+			for (; d->go.span[i].ub <= c; ++i);
+			State *to = d->go.span[i].to;
+			const Action::type_t t = to->action.type;
+
+			if (t != Action::MOVE
+				&& (d->go.nSpans > 1 || t == Action::MATCH || t == Action::SAVE))
+			{
+				if (!s->isBase)
+				{
+					split(s);
+					d = s->next;
+				}
 
+				State *f = new State;
+				f->action.set_fill (d);
+				f->go.nSpans = 1;
+				f->go.span = allocate<Span> (1);
+				f->go.span[0].ub = ubChar;
+				f->go.span[0].to = to;
+				fills.push_back (f);
+
+				// split the span with sentinel in up to three parts
+				const uint32_t lb = i > 0 ? d->go.span[i - 1].ub : 0;
+				const uint32_t ub = d->go.span[i].ub;
+				Span *span = allocate<Span> (d->go.nSpans + 2);
+				uint32_t n = 0;
+				for (uint32_t j = 0; j < i; ++j)
+				{
+					span[n].ub = d->go.span[j].ub;
+					span[n++].to = d->go.span[j].to;
+				}
+				if (lb < c)
+				{
+					span[n].ub = c;
+					span[n++].to = to;
+				}
+				span[n].ub = c + 1;
+				span[n++].to = f;
+				if (c + 1 < ub)
+				{
+					span[n].ub = ub;
+					span[n++].to = to;
+				}
+				for (uint32_t j = i + 1; j < d->go.nSpans; ++j)
+				{
+					span[n].ub = d->go.span[j].ub;
+					span[n++].to = d->go.span[j].to;
+				}
+				operator delete (d->go.span);
+				d->go.span = span;
+				d->go.nSpans = n;
+			}
+
+			s = d;
+		}
+	}
+
+	// FILL states are cold: put them after all other states
+	State *tail = head;
+	for (; tail->next; tail = tail->next);
+	for (size_t i = 0; i < fills.size (); ++i)
+	{
+		addState(fills[i], tail);
+		tail = fills[i];
+	}
+}
+
+/*
+ * note [word-at-a-time comparison]
+ *
+ * Keywords and other literal strings compile to chains of states that
+ * continue on exactly one code unit and fail on all others. Each state
+ * in the chain costs a load, a compare and a branch. With '--word-compare'
+ * the first state of such chain matches the whole chain at once:
+ *
+ *     if (memcmp (YYCURSOR, yyword, sizeof (yyword)) == 0) {
+ *         YYCURSOR += <length - 1>;
+ *         goto <state after the chain>;
+ *     }
+ *
+ * where 'yyword' is a static array of the expected code units. memcmp
+ * of a constant size is a single (possibly unaligned) load and compare
+ * with an immediate for C compilers, and it is independent of both
+ * endianness and the size of YYCTYPE. Sizes that are not a power of two
+ * are split in two overlapping comparisons (4 + 4 for 7 code units),
+ * and with GCC-compatible compilers the shortcut is marked as likely.
+ * On mismatch the ordinary code of the chain follows, so the fast path
+ * is just a shortcut: it never changes the result, and failing
+ * transitions can go anywhere.
+ *
+ * The comparison may read code units that the ordinary code would not
+ * read (past the first mismatch). This is safe only if they are known
+ * to be in the buffer: all of them are on the longest path from the
+ * last YYFILL point, and YYFILL(n) guarantees that many units. Thus all
+ * states of the chain but the first must have no YYFILL and no accepting
+ * action (the first one may have both), and the optimization requires
+ * enabled YYFILL without 're2c:yyfill:sentinel' and default input API.
+ * A chain is split into pieces of at most 8 bytes.
+ */
+static const uint32_t WORD_MAX_BYTES = 8;
+
+// the only successor of state on a single code unit (or NULL)
+static State * word_next (const State * s, bool first, uint32_t & unit)
+{
+	const Action::type_t t = s->action.type;
+	if (s->isPreCtxt
+		|| !(t == Action::MATCH || (first && t == Action::SAVE))
+		|| !(first || s->fill == 0))
+	{
+		return NULL;
+	}
+
+	const Span * sp = s->go.span;
+	const uint32_t n = s->go.nSpans;
+	uint32_t i;
+	if (n == 2 && sp[0].ub == 1)
+	{
+		i = 0;
+	}
+	else if (n == 2 && sp[1].ub - sp[0].ub == 1)
+	{
+		i = 1;
+	}
+	else if (n == 3 && sp[1].ub - sp[0].ub == 1 && sp[0].to == sp[2].to)
+	{
+		i = 1;
+	}
+	else
+	{
+		return NULL;
+	}
+	// MOVE states dispatch on the code unit loaded by their predecessor
+	State * to = sp[i].to;
+	if (to == s || to->action.type == Action::MOVE)
+	{
+		return NULL;
+	}
+	unit = i == 0 ? 0 : sp[i - 1].ub;
+	return to;
+}
+
+void DFA::findWordRuns()
+{
+	const uint32_t max = WORD_MAX_BYTES / opts->encoding.szCodeUnit ();
+	uint32_t c;
+
+	// states in the middle of a chain do not start a new chain
+	std::set<const State*> inner;
+	for (State *s = head; s; s = s->next)
+	{
+		State *to = word_next (s, true, c);
+		if (to && word_next (to, false, c))
+		{
+			inner.insert (to);
+		}
+	}
+
+	for (State *s = head; s; s = s->next)
+	{
+		if (inner.find (s) != inner.end ())
+		{
+			continue;
+		}
+		for (State *h = s; h;)
+		{
+			State *x = h;
+			for (State *to; h->word.size () < max
+				&& (to = word_next (x, x == h, c)) != NULL; x = to)
+			{
+				h->word.push_back (c);
+			}
+			if (h->word.size () < 2)
+			{
+				h->word.clear ();
+				break;
+			}
+			h->wordExit = x;
+			// continue long chains with a new piece
+			h = h->word.size () == max ? x : NULL;
+		}
+	}
+}
+
+void DFA::prepare ()
+{
 	// create rule states
 	std::map<rule_rank_t, State *> rules;
 	for (State * s = head; s; s = s->next)
@@ -164,6 +394,28 @@ void DFA::prepare ()
 		}
 	}
 
+	// keyword rules are not in DFA: their states are entered
+	// from the state of identifier rule, see note [keywords]
+	for (size_t i = 0; i < keywords.size (); ++i)
+	{
+		const keywords_t & kw = keywords[i];
+		const std::map<rule_rank_t, State *>::const_iterator r = rules.find (kw.ident->rank);
+		if (r == rules.end ())
+		{
+			continue;
+		}
+		State * s = r->second, * prev = s;
+		s->keywords = &kw;
+		for (size_t j = 0; j < kw.words.size (); ++j)
+		{
+			State * k = new State;
+			k->action.set_rule (kw.words[j].rule);
+			s->keywordStates.push_back (k);
+			addState (k, prev);
+			prev = k;
+		}
+	}
+
 	// create default state (if needed)
 	State * default_state = NULL;
 	for (State * s = head; s; s = s->next)
@@ -218,7 +470,7 @@ void DFA::prepare ()
 
 					if (opts->bFlag)
 					{
-						BitMap::find(&s->next->go, s);
+						bitmaps.find(&s->next->go, s);
 					}
 
 					s = s->next;
@@ -231,9 +483,110 @@ void DFA::prepare ()
 	// find ``base'' state, if possible
 	findBaseState();
 
-	for (State * s = head; s; s = s->next)
+	// bounds checks on sentinel transitions only
+	if (opts->fill_sentinel >= 0)
+	{
+		addSentinelChecks();
+	}
+
+	// see note [word-at-a-time comparison]
+	if (opts->wordCompare
+		&& opts->input_api.type () == InputAPI::DEFAULT
+		&& opts->fill_use
+		&& opts->fill_sentinel < 0
+		&& !opts->dFlag
+		&& !opts->instrument)
+	{
+		findWordRuns();
+	}
+
+	// with profile, transitions are constructed after layout
+	// (state labels are needed to read the profile, see 'DFA::layout')
+	if (!opts->profile_file)
+	{
+		for (State * s = head; s; s = s->next)
+		{
+			s->go.init (s, bitmaps);
+		}
+	}
+}
+
+/*
+ * note [profile-guided layout]
+ *
+ * Profile maps state labels and rule locations to execution counts.
+ * Labels are assigned in the order of states, so the profile applies
+ * to a DFA that is laid out exactly as it was in the training build:
+ * we read counts first, and only then rearrange states.
+ *
+ * Each state is followed by its hottest successor that has not been
+ * placed yet, so that the most frequent transition falls through.
+ * Chains start from the initial state and then from unplaced states in
+ * the original order. Split states (see 'DFA::split') are never torn
+ * apart, and FILL states are never pulled out of the cold tail.
+ *
+ * Then transitions are constructed: nested 'if' use state counts as
+ * weights of their targets (see 'Binary' and 'Linear').
+ */
+void DFA::layout()
+{
+	std::vector<State*> order;
+	std::set<State*> moves;
+	for (State *s = head; s; s = s->next)
+	{
+		order.push_back(s);
+		switch (s->action.type)
+		{
+			case Action::RULE:
+				s->freq = profile.rule(s->action.info.rule->loc);
+				break;
+			case Action::MOVE:
+				moves.insert(s);
+				break;
+			default:
+				s->freq = profile.state(s->label);
+				break;
+		}
+	}
+	for (State *s = head; s; s = s->next)
+	{
+		if (s->isBase)
+		{
+			s->next->freq = s->freq;
+		}
+	}
+
+	std::set<State*> placed;
+	State **p = &head;
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		for (State *s = order[i]; s && placed.insert(s).second;)
+		{
+			*p = s;
+			p = &s->next;
+			State *n = s->isBase ? s->next : NULL;
+			if (!n)
+			{
+				for (uint32_t j = 0; j < s->go.nSpans; ++j)
+				{
+					State *to = s->go.span[j].to;
+					if (placed.find(to) == placed.end()
+						&& moves.find(to) == moves.end()
+						&& to->action.type != Action::FILL
+						&& (!n || to->freq > n->freq))
+					{
+						n = to;
+					}
+				}
+			}
+			s = n;
+		}
+	}
+	*p = NULL;
+
+	for (State *s = head; s; s = s->next)
 	{
-		s->go.init (s);
+		s->go.init(s, bitmaps);
 	}
 }
 
@@ -263,6 +616,14 @@ void DFA::calc_stats ()
 
 	// determine if 'yyaccept' variable is used
 	need_accept = accepts.size () > 1;
+
+	stats.adfa_states = 0;
+	stats.spans = 0;
+	for (State * s = head; s; s = s->next)
+	{
+		++stats.adfa_states;
+		stats.spans += s->go.nSpans;
+	}
 }
 
 } // namespace re2c
@@ -1,18 +1,48 @@
+#include "src/util/c99_stdint.h"
+#include <stdlib.h>
 #include <algorithm>
 #include <ostream>
 #include <set>
+#if HAVE_PTHREAD_H
+#	include <pthread.h>
+#endif
 
 #include "src/codegen/output.h"
+#include "src/conf/msg.h"
+#include "src/conf/opt.h"
+#include "src/conf/report.h"
+#include "src/conf/warn.h"
+#include "src/globals.h"
 #include "src/ir/compile.h"
 #include "src/ir/adfa/adfa.h"
+#include "src/ir/dfa/cache.h"
 #include "src/ir/dfa/dfa.h"
+#include "src/ir/keywords/keywords.h"
 #include "src/ir/nfa/nfa.h"
 #include "src/ir/regexp/regexp.h"
 #include "src/ir/skeleton/skeleton.h"
 #include "src/parse/spec.h"
+#include "src/util/forbid_copy.h"
 
 namespace re2c {
 
+// time since the previous lap
+static double lap(double &t)
+{
+	const double t0 = t;
+	t = wall_time();
+	return t - t0;
+}
+
+// skeleton is only needed for some warnings and for '--skeleton'
+static bool need_skeleton()
+{
+	return opts->target == opt_t::SKELETON
+		|| warn.is_set(Warn::UNDEFINED_CONTROL_FLOW)
+		|| warn.is_set(Warn::UNREACHABLE_RULES)
+		|| warn.is_set(Warn::MATCH_EMPTY_STRING);
+}
+
 static std::string make_name(const std::string &cond, uint32_t line)
 {
 	std::ostringstream os;
@@ -26,9 +56,24 @@ static std::string make_name(const std::string &cond, uint32_t line)
 	return name;
 }
 
-smart_ptr<DFA> compile (Spec & spec, Output & output, const std::string & cond, uint32_t cunits)
+/*
+ * note [compiling conditions in parallel]
+ *
+ * Compilation of one DFA doesn't touch any global state: it only
+ * reads options and the (shared) regular expressions and builds
+ * new objects owned by the DFA (including bitmaps). Everything that
+ * affects output or global state (warnings, labels, statistics
+ * accumulated in Output) is done later, when DFA is emitted;
+ * DFA are emitted in order, so output doesn't depend on the number
+ * of threads and on the order in which conditions were compiled.
+ *
+ * Errors are not reported by worker threads either: 'exit' would run
+ * atexit handlers and static destructors while other threads are still
+ * compiling. Instead 'compile_dfa' returns NULL and the error is reported
+ * after all workers have been joined (the first failed condition in order).
+ */
+static DFA *compile_dfa (Spec & spec, const std::string & cond, uint32_t line, uint32_t cunits)
 {
-	const uint32_t line = output.source.get_block_line();
 	const std::string name = make_name(cond, line);
 
 	// The original set of code units (charset) might be very large.
@@ -47,22 +92,70 @@ smart_ptr<DFA> compile (Spec & spec, Output & output, const std::string & cond,
 		cs.push_back(*i);
 	}
 
-	nfa_t nfa(spec.re);
+	// see '--stats'
+	dfa_stats_t stats;
+	stats.line = line;
+	stats.cond = cond;
+	stats.charset = cs.size() - 1;
+	double t = wall_time();
 
-	dfa_t dfa(nfa, cs, spec.rules);
+	// see note [caching DFA]
+	dfa_cache_t cache(spec.re, cunits);
+	dfa_t *det, *dfa;
+	std::vector<size_t> fill;
+	Skeleton *skeleton = NULL;
+	if (cache.load(det, dfa, fill, spec.rules))
+	{
+		stats.cached = true;
+		stats.dfa_states = det->states.size();
+		if (need_skeleton())
+		{
+			skeleton = new Skeleton(*det, cs, spec.rules, name, cond, line);
+		}
+		stats.time_skeleton = lap(t);
+		delete det;
+	}
+	else
+	{
+		nfa_t nfa(spec.re);
+		stats.nfa_states = nfa.size;
+		stats.time_nfa = lap(t);
 
-	// skeleton must be constructed after DFA construction
-	// but prior to any other DFA transformations
-	Skeleton *skeleton = new Skeleton(dfa, cs, spec.rules, name, cond, line);
+		dfa = new dfa_t(nfa, cs, spec.rules);
+		stats.dfa_states = dfa->states.size();
+		stats.time_determinization = lap(t);
 
-	minimization(dfa);
+		// skeleton must be constructed after DFA construction
+		// but prior to any other DFA transformations
+		if (need_skeleton())
+		{
+			skeleton = new Skeleton(*dfa, cs, spec.rules, name, cond, line);
+		}
+		stats.time_skeleton = lap(t);
+		cache.save(*dfa);
 
-	// find YYFILL states and calculate argument to YYFILL
-	std::vector<size_t> fill;
-	fillpoints(dfa, fill);
+		minimization(*dfa);
+		stats.time_minimization = lap(t);
+
+		// find YYFILL states and calculate argument to YYFILL
+		fillpoints(*dfa, fill);
+		stats.time_fillpoints = lap(t);
+		cache.save(*dfa, fill, spec.rules);
+	}
+	stats.min_states = dfa->states.size();
+
+	// see note [compiling conditions in parallel]
+	if (skeleton && skeleton->too_long)
+	{
+		delete skeleton;
+		delete dfa;
+		return NULL;
+	}
 
 	// ADFA stands for 'DFA with actions'
-	DFA *adfa = new DFA(dfa, fill, skeleton, cs, name, cond, line);
+	DFA *adfa = new DFA(*dfa, fill, skeleton, cs, name, cond, line);
+	adfa->keywords = spec.keywords;
+	delete dfa;
 
 	/*
 	 * note [reordering DFA states]
@@ -90,15 +183,159 @@ smart_ptr<DFA> compile (Spec & spec, Output & output, const std::string & cond,
 
 	// finally gather overall DFA statistics
 	adfa->calc_stats();
+	stats.time_prepare = lap(t);
+	stats.adfa_states = adfa->stats.adfa_states;
+	stats.spans = adfa->stats.spans;
+	adfa->stats = stats;
 
-	// accumulate global statistics from this particular DFA
-	output.max_fill = std::max (output.max_fill, adfa->max_fill);
-	if (adfa->need_accept)
+	return adfa;
+}
+
+// accumulate global statistics from this particular DFA
+void accumulate_stats (Output & output, const DFA & dfa)
+{
+	output.max_fill = std::max (output.max_fill, dfa.max_fill);
+	if (dfa.need_accept)
 	{
 		output.source.set_used_yyaccept ();
 	}
+}
 
+// the only error that 'compile_dfa' may run into
+static void error_path_too_long (const std::string & cond)
+{
+	error ("DFA path %sis too long", incond (cond).c_str ());
+	exit (1);
+}
+
+smart_ptr<DFA> compile (Spec & spec, Output & output, const std::string & cond, uint32_t cunits)
+{
+	find_keywords (spec);
+	DFA *adfa = compile_dfa (spec, cond, output.source.get_block_line (), cunits);
+	if (adfa == NULL)
+	{
+		error_path_too_long (cond);
+	}
+	accumulate_stats (output, *adfa);
 	return make_smart_ptr(adfa);
 }
 
+namespace {
+
+// conditions are taken from the queue one by one by worker threads
+struct compile_queue_t
+{
+	const std::vector<std::pair<std::string, Spec *> > & specs;
+	std::vector<DFA *> & dfas;
+	const uint32_t line;
+	const uint32_t cunits;
+	size_t next;
+#if HAVE_PTHREAD_H
+	pthread_mutex_t mutex;
+#endif
+
+	compile_queue_t
+		( const std::vector<std::pair<std::string, Spec *> > & s
+		, std::vector<DFA *> & d
+		, uint32_t l
+		, uint32_t c
+		)
+		: specs (s)
+		, dfas (d)
+		, line (l)
+		, cunits (c)
+		, next (0)
+#if HAVE_PTHREAD_H
+		, mutex ()
+#endif
+	{}
+
+	FORBID_COPY (compile_queue_t);
+};
+
+} // anonymous namespace
+
+static void *compile_worker (void * arg)
+{
+	compile_queue_t & q = *static_cast<compile_queue_t *> (arg);
+	for (;;)
+	{
+#if HAVE_PTHREAD_H
+		pthread_mutex_lock (&q.mutex);
+		const size_t i = q.next++;
+		pthread_mutex_unlock (&q.mutex);
+#else
+		const size_t i = q.next++;
+#endif
+		if (i >= q.specs.size ())
+		{
+			break;
+		}
+		q.dfas[i] = compile_dfa (*q.specs[i].second, q.specs[i].first, q.line, q.cunits);
+	}
+	return NULL;
+}
+
+// see note [compiling conditions in parallel]
+// unlike 'compile', this doesn't accumulate statistics in 'output':
+// 'accumulate_stats' must be called for each DFA before it is emitted
+void compile_parallel
+	( const std::vector<std::pair<std::string, Spec *> > & specs
+	, const Output & output
+	, uint32_t cunits
+	, uint32_t jobs
+	, std::vector<smart_ptr<DFA> > & dfas
+	)
+{
+	const size_t count = specs.size ();
+	std::vector<DFA *> adfas (count, NULL);
+
+	// rewrites regular expressions: not thread-safe (arena)
+	for (size_t i = 0; i < count; ++i)
+	{
+		find_keywords (*specs[i].second);
+	}
+	compile_queue_t queue (specs, adfas, output.source.get_block_line (), cunits);
+
+#if HAVE_PTHREAD_H
+	// the calling thread is a worker too
+	const size_t nthreads = std::min<size_t> (jobs, count);
+	std::vector<pthread_t> threads;
+	pthread_mutex_init (&queue.mutex, NULL);
+	for (size_t i = 1; i < nthreads; ++i)
+	{
+		pthread_t t;
+		if (pthread_create (&t, NULL, compile_worker, &queue) == 0)
+		{
+			threads.push_back (t);
+		}
+	}
+	compile_worker (&queue);
+	for (size_t i = 0; i < threads.size (); ++i)
+	{
+		pthread_join (threads[i], NULL);
+	}
+	pthread_mutex_destroy (&queue.mutex);
+#else
+	// no threads: compile conditions one by one
+	static_cast<void> (jobs);
+	compile_worker (&queue);
+#endif
+
+	// see note [compiling conditions in parallel]
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (adfas[i] == NULL)
+		{
+			error_path_too_long (specs[i].first);
+		}
+	}
+
+	dfas.clear ();
+	for (size_t i = 0; i < count; ++i)
+	{
+		dfas.push_back (make_smart_ptr (adfas[i]));
+	}
+}
+
 } // namespace re2c
@@ -3,6 +3,8 @@
 
 #include "src/util/c99_stdint.h"
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "src/util/smart_ptr.h"
 
@@ -14,6 +16,14 @@ struct Output;
 struct Spec;
 
 smart_ptr<DFA> compile (Spec & spec, Output & output, const std::string & cond, uint32_t cunits);
+void compile_parallel
+	( const std::vector<std::pair<std::string, Spec *> > & specs
+	, const Output & output
+	, uint32_t cunits
+	, uint32_t jobs
+	, std::vector<smart_ptr<DFA> > & dfas
+	);
+void accumulate_stats (Output & output, const DFA & dfa);
 
 } // namespace re2c
 
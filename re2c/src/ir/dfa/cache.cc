@@ -0,0 +1,376 @@
+#include "src/util/c99_stdint.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+
+#include "config.h"
+#if HAVE_UNISTD_H
+#	include <unistd.h>
+#endif
+#include "src/conf/opt.h"
+#include "src/globals.h"
+#include "src/ir/dfa/cache.h"
+#include "src/ir/dfa/dfa.h"
+#include "src/ir/regexp/regexp.h"
+#include "src/ir/regexp/regexp_rule.h"
+
+namespace re2c
+{
+
+/*
+ * note [caching DFA]
+ *
+ * NFA construction, determinization and minimization depend only on
+ * the regular expression (with all rules), the number of code units
+ * and the minimization algorithm; they don't depend on rule actions,
+ * conditions, code generation options or location in the input file.
+ * Determinization is by far the most expensive compilation phase
+ * (it may be exponential), and most re2c runs in incremental builds
+ * compile exactly the same regular expressions as the previous run.
+ *
+ * So with '--dfa-cache DIR' each compiled DFA is stored in a file
+ * named after the hash of its key. The key is the serialized regular
+ * expression (see RegExp::serialize) plus all other inputs listed
+ * above plus re2c version. The file contains:
+ *   - the full key (hash collisions are not trusted)
+ *   - the DFA right after determinization: skeleton (which is used for
+ *     warnings and '--skeleton') must be built from unminimized DFA
+ *   - the minimized DFA and its YYFILL points
+ *   - the sets of shadowed rules found by determinization
+ *   - checksum of all the above
+ * Rules are referenced by their position in the key: RuleOp objects
+ * are different in each run.
+ *
+ * Cache is best effort: a missing, unreadable or malformed file is a
+ * cache miss, and a failure to write the file is silently ignored.
+ * Files are written under a temporary name and renamed into place, so
+ * concurrent re2c processes never see a half-written file.
+ */
+
+static const uint32_t MAGIC = 0x63326572; // "re2c"
+static const uint32_t FORMAT = 1;
+static const uint32_t NONE = ~0u;
+
+static uint32_t checksum (const uint32_t * p, size_t n)
+{
+	uint32_t h = 2166136261u;
+	for (size_t i = 0; i < n; ++i)
+	{
+		h = (h ^ p[i]) * 16777619u;
+	}
+	return h;
+}
+
+static void put_key (std::vector<uint32_t> & data, const std::string & key)
+{
+	const size_t len = key.size ();
+	data.push_back (static_cast<uint32_t> (len));
+	const size_t start = data.size ();
+	data.resize (start + (len + 3) / 4, 0);
+	memcpy (&data[start], key.data (), len);
+}
+
+dfa_key_t::dfa_key_t ()
+	: str ()
+	, rules ()
+	, index ()
+{}
+
+void dfa_key_t::put (char c)
+{
+	str += c;
+}
+
+void dfa_key_t::put (uint32_t n)
+{
+	str.append (reinterpret_cast<const char *> (&n), sizeof (n));
+}
+
+void dfa_key_t::rule (RuleOp * r)
+{
+	if (index.insert (std::make_pair (r, static_cast<uint32_t> (rules.size ()))).second)
+	{
+		rules.push_back (r);
+	}
+}
+
+dfa_cache_t::dfa_cache_t (RegExp * re, uint32_t cunits)
+	: enabled (opts->dfa_cache != NULL)
+	, key ()
+	, path ()
+	, data ()
+	, pos (0)
+{
+	if (!enabled)
+	{
+		return;
+	}
+
+	key.str = "re2c " PACKAGE_VERSION;
+	key.put ('\0');
+	key.put (cunits);
+	key.put (static_cast<uint32_t> (opts->dfa_minimization));
+	re->serialize (key);
+
+	// FNV-1a
+	uint64_t h = 14695981039346656037ull;
+	for (size_t i = 0; i < key.str.size (); ++i)
+	{
+		h = (h ^ static_cast<uint8_t> (key.str[i])) * 1099511628211ull;
+	}
+	char name[32];
+	sprintf (name, "/%08x%08x.dfa"
+		, static_cast<uint32_t> (h >> 32)
+		, static_cast<uint32_t> (h));
+	path = opts->dfa_cache;
+	path += name;
+}
+
+bool dfa_cache_t::get (uint32_t & n)
+{
+	if (pos >= data.size ())
+	{
+		return false;
+	}
+	n = data[pos++];
+	return true;
+}
+
+dfa_t * dfa_cache_t::load_dfa ()
+{
+	uint32_t nchars, nstates;
+	if (!get (nchars) || !get (nstates)
+		|| data.size () - pos < static_cast<size_t> (nstates) * (nchars + 2))
+	{
+		return NULL;
+	}
+
+	dfa_t * dfa = new dfa_t (nchars);
+	for (uint32_t i = 0; i < nstates; ++i)
+	{
+		dfa_state_t * s = new dfa_state_t;
+		dfa->states.push_back (s);
+		const uint32_t rule = data[pos++];
+		s->ctx = data[pos++] != 0;
+		s->arcs = new size_t[nchars];
+		for (uint32_t c = 0; c < nchars; ++c)
+		{
+			const uint32_t to = data[pos++];
+			s->arcs[c] = to == NONE ? dfa_t::NIL : to;
+			if (to != NONE && to >= nstates)
+			{
+				delete dfa;
+				return NULL;
+			}
+		}
+		if (rule != NONE)
+		{
+			if (rule >= key.rules.size ())
+			{
+				delete dfa;
+				return NULL;
+			}
+			s->rule = key.rules[rule];
+		}
+	}
+	return dfa;
+}
+
+bool dfa_cache_t::load
+	( dfa_t * & det
+	, dfa_t * & dfa
+	, std::vector<size_t> & fill
+	, rules_t & rules
+	)
+{
+	det = dfa = NULL;
+	if (!enabled)
+	{
+		return false;
+	}
+
+	FILE * f = fopen (path.c_str (), "rb");
+	if (!f)
+	{
+		return false;
+	}
+	std::vector<char> buf;
+	char chunk[4096];
+	for (size_t n; (n = fread (chunk, 1, sizeof (chunk), f)) > 0;)
+	{
+		buf.insert (buf.end (), chunk, chunk + n);
+	}
+	fclose (f);
+	if (buf.size () % 4 != 0 || buf.size () < 16)
+	{
+		return false;
+	}
+	data.resize (buf.size () / 4);
+	memcpy (&data[0], &buf[0], buf.size ());
+
+	// header, key and checksum
+	std::vector<uint32_t> header;
+	header.push_back (MAGIC);
+	header.push_back (FORMAT);
+	put_key (header, key.str);
+	const size_t n = data.size () - 1;
+	if (n < header.size ()
+		|| !std::equal (header.begin (), header.end (), data.begin ())
+		|| checksum (&data[0], n) != data[n])
+	{
+		// 'save' appends to 'data': don't let it keep the bad file
+		data.clear ();
+		return false;
+	}
+	data.pop_back ();
+	pos = header.size ();
+
+	std::vector<std::vector<uint32_t> > shadow (key.rules.size ());
+	uint32_t nfill = 0;
+	bool ok = (det = load_dfa ()) != NULL
+		&& (dfa = load_dfa ()) != NULL
+		&& get (nfill)
+		&& data.size () - pos >= nfill;
+	for (uint32_t i = 0; ok && i < nfill; ++i)
+	{
+		fill.push_back (data[pos++]);
+	}
+	for (size_t i = 0; ok && i < shadow.size (); ++i)
+	{
+		uint32_t m = 0;
+		ok = get (m) && data.size () - pos >= m;
+		for (uint32_t j = 0; ok && j < m; ++j)
+		{
+			const uint32_t r = data[pos++];
+			ok = r < key.rules.size ();
+			shadow[i].push_back (r);
+		}
+	}
+	ok = ok && pos == data.size ();
+	data.clear ();
+
+	if (!ok)
+	{
+		delete det;
+		delete dfa;
+		det = dfa = NULL;
+		fill.clear ();
+		return false;
+	}
+
+	for (size_t i = 0; i < shadow.size (); ++i)
+	{
+		for (size_t j = 0; j < shadow[i].size (); ++j)
+		{
+			rules[key.rules[i]->rank].shadow.insert (key.rules[shadow[i][j]]->rank);
+		}
+	}
+	return true;
+}
+
+void dfa_cache_t::save (const dfa_t & dfa)
+{
+	if (!enabled)
+	{
+		return;
+	}
+
+	if (data.empty ())
+	{
+		data.push_back (MAGIC);
+		data.push_back (FORMAT);
+		put_key (data, key.str);
+	}
+
+	const size_t nchars = dfa.nchars;
+	const size_t nstates = dfa.states.size ();
+	data.push_back (static_cast<uint32_t> (nchars));
+	data.push_back (static_cast<uint32_t> (nstates));
+	for (size_t i = 0; i < nstates; ++i)
+	{
+		const dfa_state_t * s = dfa.states[i];
+		data.push_back (s->rule ? key.index[s->rule] : NONE);
+		data.push_back (s->ctx ? 1 : 0);
+		for (size_t c = 0; c < nchars; ++c)
+		{
+			const size_t to = s->arcs[c];
+			data.push_back (to == dfa_t::NIL ? NONE : static_cast<uint32_t> (to));
+		}
+	}
+}
+
+void dfa_cache_t::save
+	( const dfa_t & dfa
+	, const std::vector<size_t> & fill
+	, const rules_t & rules
+	)
+{
+	if (!enabled)
+	{
+		return;
+	}
+
+	save (dfa);
+
+	data.push_back (static_cast<uint32_t> (fill.size ()));
+	for (size_t i = 0; i < fill.size (); ++i)
+	{
+		data.push_back (static_cast<uint32_t> (fill[i]));
+	}
+
+	std::map<rule_rank_t, uint32_t> rank2index;
+	for (size_t i = 0; i < key.rules.size (); ++i)
+	{
+		rank2index[key.rules[i]->rank] = static_cast<uint32_t> (i);
+	}
+	for (size_t i = 0; i < key.rules.size (); ++i)
+	{
+		std::vector<uint32_t> shadow;
+		const rules_t::const_iterator r = rules.find (key.rules[i]->rank);
+		if (r != rules.end ())
+		{
+			const std::set<rule_rank_t> & s = r->second.shadow;
+			for (std::set<rule_rank_t>::const_iterator j = s.begin (); j != s.end (); ++j)
+			{
+				const std::map<rule_rank_t, uint32_t>::const_iterator k = rank2index.find (*j);
+				if (k != rank2index.end ())
+				{
+					shadow.push_back (k->second);
+				}
+			}
+		}
+		data.push_back (static_cast<uint32_t> (shadow.size ()));
+		data.insert (data.end (), shadow.begin (), shadow.end ());
+	}
+
+	data.push_back (checksum (&data[0], data.size ()));
+
+	// unique among threads of one process (stack address) and among
+	// processes (process id); without getpid () fall back to time,
+	// which does not tell apart processes started in the same second
+	char suffix[64];
+	sprintf (suffix, ".%lx.%lx.tmp"
+		, static_cast<unsigned long> (reinterpret_cast<size_t> (&suffix))
+#if HAVE_UNISTD_H
+		, static_cast<unsigned long> (getpid ()));
+#else
+		, static_cast<unsigned long> (time (NULL)));
+#endif
+	const std::string tmp = path + suffix;
+	FILE * f = fopen (tmp.c_str (), "wb");
+	if (!f)
+	{
+		data.clear ();
+		return;
+	}
+	const size_t size = data.size () * sizeof (uint32_t);
+	const bool ok = fwrite (&data[0], 1, size, f) == size;
+	if (fclose (f) != 0 || !ok || rename (tmp.c_str (), path.c_str ()) != 0)
+	{
+		remove (tmp.c_str ());
+	}
+	data.clear ();
+}
+
+} // namespace re2c
@@ -0,0 +1,59 @@
+#ifndef _RE2C_IR_DFA_CACHE_
+#define _RE2C_IR_DFA_CACHE_
+
+#include "src/util/c99_stdint.h"
+#include <map>
+#include <string>
+#include <vector>
+
+#include "src/parse/rules.h"
+#include "src/util/forbid_copy.h"
+
+namespace re2c
+{
+
+class RegExp;
+class RuleOp;
+struct dfa_t;
+
+// unambiguous serialization of regular expression (see RegExp::serialize):
+// everything that determinization depends on, rule actions excluded
+struct dfa_key_t
+{
+	std::string str;
+	std::vector<RuleOp*> rules;
+	std::map<RuleOp*, uint32_t> index;
+
+	dfa_key_t ();
+	void put (char c);
+	void put (uint32_t n);
+	void rule (RuleOp * r);
+
+	FORBID_COPY (dfa_key_t);
+};
+
+// cache of compiled DFA in the directory given with '--dfa-cache'
+class dfa_cache_t
+{
+	const bool enabled;
+	dfa_key_t key;
+	std::string path;
+	std::vector<uint32_t> data;
+	size_t pos;
+
+public:
+	dfa_cache_t (RegExp * re, uint32_t cunits);
+	bool load (dfa_t * & det, dfa_t * & dfa, std::vector<size_t> & fill, rules_t & rules);
+	void save (const dfa_t & det);
+	void save (const dfa_t & dfa, const std::vector<size_t> & fill, const rules_t & rules);
+
+private:
+	bool get (uint32_t & n);
+	dfa_t * load_dfa ();
+
+	FORBID_COPY (dfa_cache_t);
+};
+
+} // namespace re2c
+
+#endif // _RE2C_IR_DFA_CACHE_
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <limits>
+#include <stdio.h>
 #include <map>
 #include <set>
 #include <vector>
@@ -10,6 +11,7 @@
 #include "src/ir/regexp/regexp_rule.h"
 #include "src/ir/rule_rank.h"
 #include "src/parse/rules.h"
+#include "src/util/forbid_copy.h"
 #include "src/util/ord_hash_set.h"
 #include "src/util/range.h"
 
@@ -19,7 +21,7 @@ namespace re2c
 const size_t dfa_t::NIL = std::numeric_limits<size_t>::max();
 
 /*
- * note [marking DFA states]
+ * note [marking NFA states]
  *
  * DFA state is a set of NFA states.
  * However, DFA state includes not all NFA states that are in
@@ -27,35 +29,78 @@ const size_t dfa_t::NIL = std::numeric_limits<size_t>::max();
  * and are not context of final states are omitted).
  * The included states are called 'kernel' states.
  *
- * We mark visited NFA states during closure construction.
- * These marks serve two purposes:
- *   - avoid loops in NFA
- *   - avoid duplication of NFA states in kernel
+ * Kernel is the union of epsilon-closures of a few NFA states.
+ * We mark visited NFA states during closure construction:
+ * marks avoid loops in NFA, duplication of NFA states in kernel
+ * and repeated traversal of NFA subgraphs shared by different
+ * closures of the same kernel.
  *
- * Note that after closure construction:
- *   - all non-kernel states must be unmarked (these states are
- *     not stored in kernel and it is impossible to unmark them
- *     afterwards)
- *   - all kernel states must be marked (because we may later
- *     extend this kernel with epsilon-closure of another NFA
- *     state). Kernel states are unmarked later (before finding
- *     or adding DFA state).
+ * Marks are generation stamps stored in a dense array indexed
+ * by NFA state position: a state is marked iff its stamp equals
+ * the current generation. Each kernel gets a new generation,
+ * so marks never have to be reset one by one.
+ *
+ * Closure is constructed with an explicit stack: long alternatives
+ * and deeply nested repetitions produce very long epsilon-paths.
  */
-static nfa_state_t **closure(nfa_state_t **cP, nfa_state_t *n)
+class nfa_marks_t
 {
-	if (!n->mark)
+	const nfa_state_t *base;
+	std::vector<uint32_t> stamps;
+	uint32_t generation;
+
+public:
+	std::vector<nfa_state_t*> stack;
+
+	explicit nfa_marks_t(const nfa_t &nfa)
+		: base(nfa.states)
+		, stamps(nfa.size, 0)
+		, generation(1)
+		, stack()
+	{}
+	bool mark(const nfa_state_t *n)
+	{
+		uint32_t &s = stamps[static_cast<size_t>(n - base)];
+		if (s == generation)
+		{
+			return false;
+		}
+		s = generation;
+		return true;
+	}
+	void next_generation()
 	{
-		n->mark = true;
+		if (++generation == 0)
+		{
+			std::fill(stamps.begin(), stamps.end(), 0);
+			generation = 1;
+		}
+	}
+
+	FORBID_COPY(nfa_marks_t);
+};
+
+static nfa_state_t **closure(nfa_state_t **cP, nfa_state_t *n, nfa_marks_t &marks)
+{
+	std::vector<nfa_state_t*> &stack = marks.stack;
+	stack.push_back(n);
+	while (!stack.empty())
+	{
+		n = stack.back();
+		stack.pop_back();
+		if (!marks.mark(n))
+		{
+			continue;
+		}
 		switch (n->type)
 		{
 			case nfa_state_t::ALT:
-				cP = closure(cP, n->value.alt.out2);
-				cP = closure(cP, n->value.alt.out1);
-				n->mark = false;
+				stack.push_back(n->value.alt.out1);
+				stack.push_back(n->value.alt.out2);
 				break;
 			case nfa_state_t::CTX:
 				*(cP++) = n;
-				cP = closure(cP, n->value.ctx.out);
+				stack.push_back(n->value.ctx.out);
 				break;
 			default:
 				*(cP++) = n;
@@ -70,20 +115,18 @@ static size_t find_state
 	( nfa_state_t **kernel
 	, nfa_state_t **end
 	, ord_hash_set_t &kernels
+	, nfa_marks_t &marks
 	)
 {
+	// see note [marking NFA states]
+	marks.next_generation();
+
 	// zero-sized kernel corresponds to default state
 	if (kernel == end)
 	{
 		return dfa_t::NIL;
 	}
 
-	// see note [marking DFA states]
-	for (nfa_state_t **p = kernel; p != end; ++p)
-	{
-		(*p)->mark = false;
-	}
-
 	// sort kernel states: we need this to get stable hash
 	// and to compare states with simple 'memcmp'
 	std::sort(kernel, end);
@@ -91,16 +134,55 @@ static size_t find_state
 	return kernels.insert(kernel, size);
 }
 
+namespace {
+
+// order character classes by the sets of NFA states they lead to
+struct cmp_arcs_t
+{
+	const std::vector<std::vector<nfa_state_t*> > &arcs;
+
+	explicit cmp_arcs_t(const std::vector<std::vector<nfa_state_t*> > &as)
+		: arcs(as)
+	{}
+	bool operator()(size_t c1, size_t c2) const
+	{
+		return arcs[c1] < arcs[c2];
+	}
+};
+
+} // anonymous namespace
+
+/*
+ * note [sparse DFA transitions]
+ *
+ * Most character classes have no outgoing NFA arcs in most DFA
+ * states: for large charsets (UCS-2, UTF-32) they all end up
+ * in the default state. So instead of computing closure for each
+ * character class, we remember which classes have been touched
+ * by at least one arc and only consider those: all other classes
+ * go to the default state.
+ *
+ * Touched classes are then grouped by the sets of NFA states they
+ * lead to (target lists are built in kernel order, so equal sets
+ * give equal lists). Closure is computed once per group, when the
+ * group's smallest class is met: DFA states are still added in
+ * the order of increasing character class, so state numbering is
+ * the same as if each class was handled separately.
+ */
 dfa_t::dfa_t(const nfa_t &nfa, const charset_t &charset, rules_t &rules)
 	: states()
 	, nchars(charset.size() - 1) // (n + 1) bounds for n ranges
 {
 	std::map<size_t, std::set<RuleOp*> > s2rules;
 	ord_hash_set_t kernels;
+	nfa_marks_t marks(nfa);
 	nfa_state_t **const buffer = new nfa_state_t*[nfa.size];
 	std::vector<std::vector<nfa_state_t*> > arcs(nchars);
+	std::vector<size_t> touched;
+	std::vector<size_t> groups;
+	std::vector<size_t> leader(nchars);
 
-	find_state(buffer, closure(buffer, nfa.root), kernels);
+	find_state(buffer, closure(buffer, nfa.root, marks), kernels, marks);
 	for (size_t i = 0; i < kernels.size(); ++i)
 	{
 		dfa_state_t *s = new dfa_state_t;
@@ -116,12 +198,17 @@ dfa_t::dfa_t(const nfa_t &nfa, const charset_t &charset, rules_t &rules)
 				case nfa_state_t::RAN:
 				{
 					nfa_state_t *m = n->value.ran.out;
-					size_t c = 0;
 					for (Range *r = n->value.ran.ran; r; r = r->next ())
 					{
-						for (; charset[c] != r->lower(); ++c);
+						size_t c = static_cast<size_t>(std::lower_bound(
+							charset.begin(), charset.end(), r->lower())
+							- charset.begin());
 						for (; charset[c] != r->upper(); ++c)
 						{
+							if (arcs[c].empty())
+							{
+								touched.push_back(c);
+							}
 							arcs[c].push_back(m);
 						}
 					}
@@ -138,24 +225,53 @@ dfa_t::dfa_t(const nfa_t &nfa, const charset_t &charset, rules_t &rules)
 			}
 		}
 
+		// see note [sparse DFA transitions]
 		s->arcs = new size_t[nchars];
-		for(size_t c = 0; c < nchars; ++c)
+		std::fill(s->arcs, s->arcs + nchars, NIL);
+
+		std::sort(touched.begin(), touched.end());
+		groups = touched;
+		std::stable_sort(groups.begin(), groups.end(), cmp_arcs_t(arcs));
+		for (size_t j = 0; j < groups.size(); ++j)
 		{
+			const size_t c = groups[j];
+			leader[c] = j > 0 && arcs[groups[j - 1]] == arcs[c]
+				? leader[groups[j - 1]]
+				: c;
+		}
+
+		for (size_t j = 0; j < touched.size(); ++j)
+		{
+			const size_t c = touched[j];
+			if (leader[c] != c)
+			{
+				s->arcs[c] = s->arcs[leader[c]];
+				continue;
+			}
 			nfa_state_t **end = buffer;
-			for (std::vector<nfa_state_t*>::const_iterator j = arcs[c].begin(); j != arcs[c].end(); ++j)
+			for (std::vector<nfa_state_t*>::const_iterator k = arcs[c].begin(); k != arcs[c].end(); ++k)
 			{
-				end = closure(end, *j);
+				end = closure(end, *k, marks);
 			}
-			s->arcs[c] = find_state(buffer, end, kernels);
+			s->arcs[c] = find_state(buffer, end, kernels, marks);
 		}
 
-		for(size_t c = 0; c < nchars; ++c)
+		for (size_t j = 0; j < touched.size(); ++j)
 		{
-			arcs[c].clear();
+			arcs[touched[j]].clear();
 		}
+		touched.clear();
 	}
 	delete[] buffer;
 
+#ifdef RE2C_DEBUG
+	fprintf(stderr, "determinization: %u states, %lu lookups, %lu probes, %.3fs in lookups\n",
+		static_cast<uint32_t>(kernels.size()),
+		static_cast<unsigned long>(kernels.lookups()),
+		static_cast<unsigned long>(kernels.probes()),
+		static_cast<double>(kernels.time()) / CLOCKS_PER_SEC);
+#endif
+
 	const size_t count = states.size();
 	for (size_t i = 0; i < count; ++i)
 	{
@@ -40,6 +40,10 @@ struct dfa_t
 	std::vector<dfa_state_t*> states;
 	const size_t nchars;
 
+	explicit dfa_t(size_t n)
+		: states()
+		, nchars(n)
+	{}
 	dfa_t(const nfa_t &nfa, const charset_t &charset, rules_t &rules);
 	~dfa_t();
 };
@@ -47,7 +51,8 @@ struct dfa_t
 enum dfa_minimization_t
 {
 	DFA_MINIMIZATION_TABLE,
-	DFA_MINIMIZATION_MOORE
+	DFA_MINIMIZATION_MOORE,
+	DFA_MINIMIZATION_HOPCROFT
 };
 
 void minimization(dfa_t &dfa);
@@ -1,4 +1,5 @@
 #include <string.h>
+#include <map>
 #include <utility>
 #include <vector>
 
@@ -196,6 +197,231 @@ static void minimization_moore(
 	delete[] next;
 }
 
+/*
+ * note [DFA minimization: Hopcroft algorithm]
+ *
+ * Like Moore algorithm, this algorithm maintains partition of
+ * DFA states, starting with states distinguished according to their
+ * rule and context. Missing transitions go to an extra "dead" state
+ * that forms a separate set. Instead of refining all sets on each
+ * step, the algorithm keeps a worklist of splitters: pairs of a set
+ * and a symbol. For each splitter (B, c) it finds all states with
+ * transition on c to some state in B and splits each set that has
+ * both such states and other states. Each time a set is split, the
+ * smaller half is added to the worklist for all symbols: if the
+ * original set was already in the worklist, both halves must be
+ * there; otherwise the smaller one is enough.
+ *
+ * Sets are kept as contiguous ranges of one array of states, which
+ * makes marking and splitting sets cost O(1) per state. Together with
+ * inverted transitions this gives O(n log n) time for a fixed number
+ * of symbols.
+ */
+static void minimization_hopcroft(
+	size_t *part,
+	const std::vector<dfa_state_t*> &states,
+	size_t nchars)
+{
+	const size_t count = states.size();
+	const size_t dead = count;
+	const size_t nstates = count + 1;
+
+	// inverted transitions: predecessors of state 's' on symbol 'c'
+	// are pred[pred_idx[s * nchars + c] .. pred_idx[s * nchars + c + 1]]
+	size_t *pred_idx = new size_t[nstates * nchars + 1];
+	size_t *pred = new size_t[count * nchars];
+	memset(pred_idx, 0, (nstates * nchars + 1) * sizeof(size_t));
+	for (size_t i = 0; i < count; ++i)
+	{
+		const size_t *a = states[i]->arcs;
+		for (size_t c = 0; c < nchars; ++c)
+		{
+			const size_t j = a[c] == dfa_t::NIL ? dead : a[c];
+			++pred_idx[j * nchars + c + 1];
+		}
+	}
+	for (size_t k = 0; k < nstates * nchars; ++k)
+	{
+		pred_idx[k + 1] += pred_idx[k];
+	}
+	size_t *fill = new size_t[nstates * nchars];
+	memcpy(fill, pred_idx, nstates * nchars * sizeof(size_t));
+	for (size_t i = 0; i < count; ++i)
+	{
+		const size_t *a = states[i]->arcs;
+		for (size_t c = 0; c < nchars; ++c)
+		{
+			const size_t j = a[c] == dfa_t::NIL ? dead : a[c];
+			pred[fill[j * nchars + c]++] = i;
+		}
+	}
+	delete[] fill;
+
+	// partition: set 'b' occupies elem[first[b] .. past[b]],
+	// marked states of set 'b' are elem[first[b] .. first[b] + marked[b]]
+	size_t *elem = new size_t[nstates];
+	size_t *loc = new size_t[nstates];
+	size_t *set = new size_t[nstates];
+	size_t *first = new size_t[nstates];
+	size_t *past = new size_t[nstates];
+	size_t *marked = new size_t[nstates];
+	size_t nsets = 0;
+
+	std::map<std::pair<RuleOp*, bool>, size_t> init;
+	for (size_t i = 0; i < count; ++i)
+	{
+		dfa_state_t *s = states[i];
+		std::pair<RuleOp*, bool> key(s->rule, s->ctx);
+		std::map<std::pair<RuleOp*, bool>, size_t>::const_iterator
+			b = init.insert(std::make_pair(key, nsets)).first;
+		if (b->second == nsets)
+		{
+			past[nsets++] = 0;
+		}
+		set[i] = b->second;
+		++past[set[i]];
+	}
+	set[dead] = nsets;
+	past[nsets++] = 1;
+	for (size_t b = 0, n = 0; b < nsets; ++b)
+	{
+		first[b] = n;
+		n += past[b];
+		past[b] = first[b];
+		marked[b] = 0;
+	}
+	for (size_t i = 0; i < nstates; ++i)
+	{
+		const size_t l = past[set[i]]++;
+		elem[l] = i;
+		loc[i] = l;
+	}
+
+	// initial worklist: all sets but the largest one
+	std::vector<std::pair<size_t, size_t> > work;
+	size_t largest = 0;
+	for (size_t b = 1; b < nsets; ++b)
+	{
+		if (past[b] - first[b] > past[largest] - first[largest])
+		{
+			largest = b;
+		}
+	}
+	for (size_t b = 0; b < nsets; ++b)
+	{
+		if (b != largest)
+		{
+			for (size_t c = 0; c < nchars; ++c)
+			{
+				work.push_back(std::make_pair(b, c));
+			}
+		}
+	}
+
+	std::vector<size_t> preds;
+	std::vector<size_t> touched;
+	while (!work.empty())
+	{
+		const size_t b = work.back().first;
+		const size_t c = work.back().second;
+		work.pop_back();
+
+		// collect predecessors first: marking reorders states
+		// within sets, including the splitter itself
+		preds.clear();
+		for (size_t l = first[b]; l < past[b]; ++l)
+		{
+			const size_t k = elem[l] * nchars + c;
+			preds.insert(preds.end(),
+				pred + pred_idx[k],
+				pred + pred_idx[k + 1]);
+		}
+
+		for (size_t n = 0; n < preds.size(); ++n)
+		{
+			const size_t i = preds[n];
+			const size_t s = set[i];
+			const size_t m = first[s] + marked[s];
+			if (loc[i] < m)
+			{
+				continue;
+			}
+			if (marked[s] == 0)
+			{
+				touched.push_back(s);
+			}
+			const size_t j = elem[m];
+			elem[loc[i]] = j;
+			loc[j] = loc[i];
+			elem[m] = i;
+			loc[i] = m;
+			++marked[s];
+		}
+
+		for (size_t n = 0; n < touched.size(); ++n)
+		{
+			const size_t s = touched[n];
+			const size_t m = first[s] + marked[s];
+			marked[s] = 0;
+			if (m == past[s])
+			{
+				continue;
+			}
+
+			// the new set is always the smaller half
+			const size_t t = nsets++;
+			if (m - first[s] <= past[s] - m)
+			{
+				first[t] = first[s];
+				past[t] = m;
+				first[s] = m;
+			}
+			else
+			{
+				first[t] = m;
+				past[t] = past[s];
+				past[s] = m;
+			}
+			marked[t] = 0;
+			for (size_t l = first[t]; l < past[t]; ++l)
+			{
+				set[elem[l]] = t;
+			}
+			for (size_t d = 0; d < nchars; ++d)
+			{
+				work.push_back(std::make_pair(t, d));
+			}
+		}
+		touched.clear();
+	}
+
+	// representative of each set is its state with the least index
+	size_t *repr = new size_t[nsets];
+	for (size_t b = 0; b < nsets; ++b)
+	{
+		repr[b] = dfa_t::NIL;
+	}
+	for (size_t i = 0; i < count; ++i)
+	{
+		size_t &r = repr[set[i]];
+		if (r == dfa_t::NIL)
+		{
+			r = i;
+		}
+		part[i] = r;
+	}
+
+	delete[] repr;
+	delete[] marked;
+	delete[] past;
+	delete[] first;
+	delete[] set;
+	delete[] loc;
+	delete[] elem;
+	delete[] pred;
+	delete[] pred_idx;
+}
+
 void minimization(dfa_t &dfa)
 {
 	const size_t count = dfa.states.size();
@@ -210,6 +436,9 @@ void minimization(dfa_t &dfa)
 		case DFA_MINIMIZATION_MOORE:
 			minimization_moore(part, dfa.states, dfa.nchars);
 			break;
+		case DFA_MINIMIZATION_HOPCROFT:
+			minimization_hopcroft(part, dfa.states, dfa.nchars);
+			break;
 	}
 
 	size_t *compact = new size_t[count];
@@ -0,0 +1,378 @@
+#include "src/util/c99_stdint.h"
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "src/codegen/input_api.h"
+#include "src/conf/opt.h"
+#include "src/globals.h"
+#include "src/ir/keywords/keywords.h"
+#include "src/ir/nfa/nfa.h"
+#include "src/ir/regexp/regexp.h"
+#include "src/ir/regexp/regexp_rule.h"
+#include "src/parse/spec.h"
+#include "src/util/range.h"
+
+namespace re2c
+{
+
+/*
+ * note [keywords]
+ *
+ * Reserved words are usually written as rules like '"while" { ... }'
+ * preceding a general identifier rule like '[a-z_][a-z_0-9]* { ... }'.
+ * Each keyword adds its own path to the DFA: with hundreds of keywords
+ * the DFA is a large trie that takes long to build and a lot of code.
+ *
+ * With 're2c:keywords:token = EXPR;' (EXPR is a pointer to the start
+ * of the current lexeme) keyword rules are removed from the regular
+ * expression before DFA construction. Instead the action of identifier
+ * rule looks up the lexeme in a static perfect hash table; if lexeme
+ * is a keyword, control goes to the action of keyword rule. The lookup
+ * is one hash of the lexeme, one probe and one comparison, no matter
+ * how many keywords there are.
+ *
+ * Rule K is a keyword of rule I if:
+ *   - K is a string of at least two code units (no classes with more
+ *     than one code unit, no alternatives or repetitions, no trailing
+ *     context)
+ *   - no other rule is the same string
+ *   - among all rules except such strings, I has the highest priority
+ *     of those that match the whole string, and K has higher priority
+ *     than I (otherwise K is shadowed and must stay as it is)
+ *   - I has no trailing context and is not the default rule
+ * Removed rules only match their own strings, and I matches each such
+ * string, so DFA without keywords matches exactly the same lexemes as
+ * the original DFA; the only difference is that keywords are matched
+ * by I, which is fixed up by the lookup in I's action.
+ *
+ * Keywords only work with the default input API: lexeme is compared
+ * in memory between EXPR and YYCURSOR.
+ */
+
+static const uint32_t MAX_DISP = 0x10000;
+static const uint32_t MAX_SLOT_BITS = 20;
+
+// FNV-1a
+uint32_t keyword_hash (const uint32_t * s, size_t len)
+{
+	uint32_t h = 2166136261u;
+	for (size_t i = 0; i < len; ++i)
+	{
+		h = (h ^ s[i]) * 16777619u;
+	}
+	return h;
+}
+
+// multiplicative hash of displaced FNV-1a, 'bits' must be nonzero
+uint32_t keyword_slot (uint32_t h, uint32_t d, uint32_t bits)
+{
+	return ((h ^ d) * 2654435761u) >> (32 - bits);
+}
+
+static bool by_size (const std::vector<size_t> & b1, const std::vector<size_t> & b2)
+{
+	return b1.size () > b2.size ();
+}
+
+// hash and displace: keys are distributed into buckets by low bits
+// of hash; buckets are placed one by one, largest first, and for
+// each bucket we search for displacement that puts all its keys
+// into free slots; if there is none, try a larger table
+bool keywords_t::build_hash ()
+{
+	const size_t n = words.size ();
+	std::vector<uint32_t> hash (n);
+	min_len = max_len = static_cast<uint32_t> (words[0].str.size ());
+	for (size_t i = 0; i < n; ++i)
+	{
+		const std::vector<uint32_t> & s = words[i].str;
+		hash[i] = keyword_hash (&s[0], s.size ());
+		min_len = std::min (min_len, static_cast<uint32_t> (s.size ()));
+		max_len = std::max (max_len, static_cast<uint32_t> (s.size ()));
+	}
+
+	// about four keys per bucket
+	for (bucket_bits = 0; (4u << bucket_bits) < n; ++bucket_bits);
+	const uint32_t nb = 1u << bucket_bits;
+
+	for (slot_bits = 1; (1u << slot_bits) < n; ++slot_bits);
+	for (; slot_bits <= MAX_SLOT_BITS; ++slot_bits)
+	{
+		std::vector<std::vector<size_t> > buckets (nb);
+		for (size_t i = 0; i < n; ++i)
+		{
+			buckets[hash[i] & (nb - 1)].push_back (i);
+		}
+		std::stable_sort (buckets.begin (), buckets.end (), by_size);
+
+		disp.assign (nb, 0);
+		slots.assign (1u << slot_bits, 0);
+		bool ok = true;
+		for (size_t b = 0; ok && b < nb && !buckets[b].empty (); ++b)
+		{
+			const std::vector<size_t> & keys = buckets[b];
+			std::vector<uint32_t> taken;
+			uint32_t d = 0;
+			for (; d < MAX_DISP; ++d)
+			{
+				taken.clear ();
+				for (size_t k = 0; k < keys.size (); ++k)
+				{
+					const uint32_t slot = keyword_slot (hash[keys[k]], d, slot_bits);
+					if (slots[slot] != 0
+						|| std::find (taken.begin (), taken.end (), slot) != taken.end ())
+					{
+						break;
+					}
+					taken.push_back (slot);
+				}
+				if (taken.size () == keys.size ())
+				{
+					break;
+				}
+			}
+			if (d == MAX_DISP)
+			{
+				ok = false;
+				break;
+			}
+			disp[hash[keys[0]] & (nb - 1)] = d;
+			for (size_t k = 0; k < keys.size (); ++k)
+			{
+				slots[taken[k]] = static_cast<uint32_t> (keys[k] + 1);
+			}
+		}
+		if (ok)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// rule is a string of code units iff its NFA is a chain of
+// single-symbol transitions ending in the final state
+static bool is_string (RuleOp * rule, std::vector<uint32_t> & str)
+{
+	nfa_t nfa (rule);
+	for (nfa_state_t * s = nfa.root;;)
+	{
+		if (s->type == nfa_state_t::FIN)
+		{
+			return !str.empty ();
+		}
+		const Range * r = s->type == nfa_state_t::RAN
+			? s->value.ran.ran
+			: NULL;
+		if (r == NULL
+			|| r->next () != NULL
+			|| r->upper () - r->lower () != 1)
+		{
+			str.clear ();
+			return false;
+		}
+		str.push_back (r->lower ());
+		s = s->value.ran.out;
+	}
+}
+
+static void closure
+	( nfa_t & nfa
+	, nfa_state_t * s
+	, std::vector<nfa_state_t *> & set
+	, std::vector<uint32_t> & mark
+	, uint32_t gen
+	)
+{
+	std::vector<nfa_state_t *> stack (1, s);
+	while (!stack.empty ())
+	{
+		s = stack.back ();
+		stack.pop_back ();
+		uint32_t & m = mark[static_cast<size_t> (s - nfa.states)];
+		if (m == gen)
+		{
+			continue;
+		}
+		m = gen;
+		switch (s->type)
+		{
+			case nfa_state_t::ALT:
+				stack.push_back (s->value.alt.out2);
+				stack.push_back (s->value.alt.out1);
+				break;
+			case nfa_state_t::CTX:
+				stack.push_back (s->value.ctx.out);
+				break;
+			default:
+				set.push_back (s);
+				break;
+		}
+	}
+}
+
+// the highest priority rule that matches the whole string (or NULL)
+static RuleOp * match (nfa_t & nfa, const std::vector<uint32_t> & str)
+{
+	std::vector<uint32_t> mark (nfa.size, 0);
+	uint32_t gen = 1;
+	std::vector<nfa_state_t *> set, next;
+	closure (nfa, nfa.root, set, mark, gen);
+	for (size_t i = 0; i < str.size () && !set.empty (); ++i)
+	{
+		const uint32_t c = str[i];
+		++gen;
+		next.clear ();
+		for (size_t j = 0; j < set.size (); ++j)
+		{
+			const nfa_state_t * s = set[j];
+			if (s->type != nfa_state_t::RAN)
+			{
+				continue;
+			}
+			for (const Range * r = s->value.ran.ran; r; r = r->next ())
+			{
+				if (r->lower () <= c && c < r->upper ())
+				{
+					closure (nfa, s->value.ran.out, next, mark, gen);
+					break;
+				}
+			}
+		}
+		set.swap (next);
+	}
+
+	RuleOp * best = NULL;
+	for (size_t j = 0; j < set.size (); ++j)
+	{
+		if (set[j]->type == nfa_state_t::FIN)
+		{
+			RuleOp * r = set[j]->value.fin.rule;
+			if (!best || r->rank < best->rank)
+			{
+				best = r;
+			}
+		}
+	}
+	return best;
+}
+
+// see note [keywords]
+void find_keywords (Spec & spec)
+{
+	const std::vector<RuleOp *> & rules = spec.ruleops;
+	const size_t n = rules.size ();
+
+	// this spec has been compiled before: start from scratch
+	if (!spec.keywords.empty ())
+	{
+		spec.keywords.clear ();
+		spec.re = NULL;
+		for (size_t i = 0; i < n; ++i)
+		{
+			spec.rules[rules[i]->rank].line = rules[i]->loc.line;
+			spec.re = mkAlt (spec.re, rules[i]);
+		}
+	}
+
+	if (opts->keywords_token.empty ()
+		|| opts->input_api.type () != InputAPI::DEFAULT)
+	{
+		return;
+	}
+
+	// strings that occur only once; single code units cost
+	// one transition in DFA, lookup would only make them slower
+	std::vector<std::vector<uint32_t> > strs (n);
+	std::map<std::vector<uint32_t>, uint32_t> count;
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (is_string (rules[i], strs[i]) && strs[i].size () > 1)
+		{
+			++count[strs[i]];
+		}
+		else
+		{
+			strs[i].clear ();
+		}
+	}
+	RegExp * rest = NULL;
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (!strs[i].empty () && count[strs[i]] > 1)
+		{
+			strs[i].clear ();
+		}
+		if (strs[i].empty ())
+		{
+			rest = mkAlt (rest, rules[i]);
+		}
+	}
+	if (!rest)
+	{
+		return;
+	}
+
+	// group keywords by identifier rule
+	nfa_t nfa (rest);
+	std::vector<keywords_t> groups;
+	std::map<RuleOp *, size_t> group;
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (strs[i].empty ())
+		{
+			continue;
+		}
+		RuleOp * ident = match (nfa, strs[i]);
+		if (!ident
+			|| !(rules[i]->rank < ident->rank)
+			|| ident->rank.is_def ()
+			|| ident->rank.is_none ()
+			|| ident->ctx->calc_size () > 0)
+		{
+			continue;
+		}
+		std::map<RuleOp *, size_t>::const_iterator g = group.find (ident);
+		if (g == group.end ())
+		{
+			g = group.insert (std::make_pair (ident, groups.size ())).first;
+			groups.push_back (keywords_t (ident));
+		}
+		groups[g->second].words.push_back (keyword_t (strs[i], rules[i]));
+	}
+
+	std::set<RuleOp *> removed;
+	for (size_t i = 0; i < groups.size (); ++i)
+	{
+		if (groups[i].build_hash ())
+		{
+			spec.keywords.push_back (groups[i]);
+			for (size_t j = 0; j < groups[i].words.size (); ++j)
+			{
+				removed.insert (groups[i].words[j].rule);
+			}
+		}
+	}
+	if (removed.empty ())
+	{
+		return;
+	}
+
+	// keyword rules are neither in DFA nor in skeleton
+	spec.re = NULL;
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (removed.find (rules[i]) == removed.end ())
+		{
+			spec.re = mkAlt (spec.re, rules[i]);
+		}
+		else
+		{
+			spec.rules.erase (rules[i]->rank);
+		}
+	}
+}
+
+} // namespace re2c
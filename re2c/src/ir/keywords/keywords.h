@@ -0,0 +1,94 @@
+#ifndef _RE2C_IR_KEYWORDS_KEYWORDS_
+#define _RE2C_IR_KEYWORDS_KEYWORDS_
+
+#include "src/util/c99_stdint.h"
+#include <stddef.h> // size_t
+#include <vector>
+
+namespace re2c
+{
+
+class RuleOp;
+struct Spec;
+
+struct keyword_t
+{
+	std::vector<uint32_t> str;
+	RuleOp * rule;
+
+	keyword_t (const std::vector<uint32_t> & s, RuleOp * r)
+		: str (s)
+		, rule (r)
+	{}
+	keyword_t (const keyword_t & k)
+		: str (k.str)
+		, rule (k.rule)
+	{}
+	keyword_t & operator = (const keyword_t & k)
+	{
+		str = k.str;
+		rule = k.rule;
+		return *this;
+	}
+};
+
+// keywords recognized in the action of identifier rule,
+// see note [keywords]
+struct keywords_t
+{
+	RuleOp * ident;
+	std::vector<keyword_t> words;
+
+	// perfect hash: 'disp' has a displacement for each bucket,
+	// 'slots' has keyword index plus one (or zero) for each slot
+	uint32_t bucket_bits;
+	uint32_t slot_bits;
+	std::vector<uint32_t> disp;
+	std::vector<uint32_t> slots;
+	uint32_t min_len;
+	uint32_t max_len;
+
+	explicit keywords_t (RuleOp * r)
+		: ident (r)
+		, words ()
+		, bucket_bits (0)
+		, slot_bits (0)
+		, disp ()
+		, slots ()
+		, min_len (0)
+		, max_len (0)
+	{}
+	keywords_t (const keywords_t & k)
+		: ident (k.ident)
+		, words (k.words)
+		, bucket_bits (k.bucket_bits)
+		, slot_bits (k.slot_bits)
+		, disp (k.disp)
+		, slots (k.slots)
+		, min_len (k.min_len)
+		, max_len (k.max_len)
+	{}
+	keywords_t & operator = (const keywords_t & k)
+	{
+		ident = k.ident;
+		words = k.words;
+		bucket_bits = k.bucket_bits;
+		slot_bits = k.slot_bits;
+		disp = k.disp;
+		slots = k.slots;
+		min_len = k.min_len;
+		max_len = k.max_len;
+		return *this;
+	}
+	bool build_hash ();
+};
+
+// the same hash functions are emitted in generated code
+uint32_t keyword_hash (const uint32_t * s, size_t len);
+uint32_t keyword_slot (uint32_t h, uint32_t d, uint32_t bits);
+
+void find_keywords (Spec & spec);
+
+} // namespace re2c
+
+#endif // _RE2C_IR_KEYWORDS_KEYWORDS_
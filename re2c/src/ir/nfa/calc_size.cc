@@ -1,5 +1,6 @@
 #include "src/util/c99_stdint.h"
 
+#include "src/ir/regexp/encoding/range_suffix.h"
 #include "src/ir/regexp/regexp.h"
 #include "src/ir/regexp/regexp_alt.h"
 #include "src/ir/regexp/regexp_cat.h"
@@ -7,6 +8,7 @@
 #include "src/ir/regexp/regexp_match.h"
 #include "src/ir/regexp/regexp_null.h"
 #include "src/ir/regexp/regexp_rule.h"
+#include "src/ir/regexp/regexp_suffix.h"
 
 namespace re2c
 {
@@ -47,4 +49,18 @@ uint32_t RuleOp::calc_size() const
 		+ 1;
 }
 
+// one transition per arc, alternatives between arcs of each state
+uint32_t SuffixOp::calc_size() const
+{
+	uint32_t size = 0;
+	for (size_t i = 0; i < states.size(); ++i)
+	{
+		for (const RangeSuffix *p = states[i]; p; p = p->next)
+		{
+			size += p->next ? 2 : 1;
+		}
+	}
+	return size;
+}
+
 } // end namespace re2c
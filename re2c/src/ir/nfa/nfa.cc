@@ -1,4 +1,9 @@
+#include <stddef.h>
+#include <map>
+#include <vector>
+
 #include "src/ir/nfa/nfa.h"
+#include "src/ir/regexp/encoding/range_suffix.h"
 #include "src/ir/regexp/regexp.h"
 #include "src/ir/regexp/regexp_alt.h"
 #include "src/ir/regexp/regexp_cat.h"
@@ -6,6 +11,7 @@
 #include "src/ir/regexp/regexp_match.h"
 #include "src/ir/regexp/regexp_null.h"
 #include "src/ir/regexp/regexp_rule.h"
+#include "src/ir/regexp/regexp_suffix.h"
 
 namespace re2c {
 
@@ -69,4 +75,37 @@ nfa_state_t *RuleOp::compile(nfa_t &nfa, nfa_state_t *)
 	return s1;
 }
 
+// each state of range automaton is compiled once,
+// after all its successors (see note [range suffix cache])
+nfa_state_t *SuffixOp::compile(nfa_t &nfa, nfa_state_t *t)
+{
+	std::map<const RangeSuffix*, nfa_state_t*> compiled;
+	std::vector<const RangeSuffix*> arcs;
+	nfa_state_t *s = NULL;
+	for (size_t i = 0; i < states.size(); ++i)
+	{
+		arcs.clear();
+		for (const RangeSuffix *p = states[i]; p; p = p->next)
+		{
+			arcs.push_back(p);
+		}
+		s = NULL;
+		for (size_t j = arcs.size(); j > 0; --j)
+		{
+			const RangeSuffix *p = arcs[j - 1];
+			nfa_state_t *r = &nfa.states[nfa.size++];
+			r->ran(p->child ? compiled[p->child] : t, p->ran);
+			if (s)
+			{
+				nfa_state_t *a = &nfa.states[nfa.size++];
+				a->alt(r, s);
+				r = a;
+			}
+			s = r;
+		}
+		compiled[states[i]] = s;
+	}
+	return s;
+}
+
 } // namespace re2c
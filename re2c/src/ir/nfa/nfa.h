@@ -42,33 +42,28 @@ struct nfa_state_t
 			RuleOp *rule;
 		} fin;
 	} value;
-	bool mark;
 
 	void alt(nfa_state_t *s1, nfa_state_t *s2)
 	{
 		type = ALT;
 		value.alt.out1 = s1;
 		value.alt.out2 = s2;
-		mark = false;
 	}
 	void ran(nfa_state_t *s, Range *r)
 	{
 		type = RAN;
 		value.ran.out = s;
 		value.ran.ran = r;
-		mark = false;
 	}
 	void ctx(nfa_state_t *s)
 	{
 		type = CTX;
 		value.ctx.out = s;
-		mark = false;
 	}
 	void fin(RuleOp *r)
 	{
 		type = FIN;
 		value.fin.rule = r;
-		mark = false;
 	}
 };
 
@@ -1,6 +1,7 @@
 #include "src/util/c99_stdint.h"
 #include <set>
 
+#include "src/ir/regexp/encoding/range_suffix.h"
 #include "src/ir/regexp/regexp.h"
 #include "src/ir/regexp/regexp_alt.h"
 #include "src/ir/regexp/regexp_cat.h"
@@ -8,6 +9,7 @@
 #include "src/ir/regexp/regexp_match.h"
 #include "src/ir/regexp/regexp_null.h"
 #include "src/ir/regexp/regexp_rule.h"
+#include "src/ir/regexp/regexp_suffix.h"
 #include "src/util/range.h"
 
 namespace re2c {
@@ -46,4 +48,16 @@ void RuleOp::split (std::set<uint32_t> & cs)
 	ctx->split (cs);
 }
 
+void SuffixOp::split (std::set<uint32_t> & cs)
+{
+	for (size_t i = 0; i < states.size (); ++i)
+	{
+		for (const RangeSuffix *p = states[i]; p; p = p->next)
+		{
+			cs.insert (p->ran->lower ());
+			cs.insert (p->ran->upper ());
+		}
+	}
+}
+
 } // namespace re2c
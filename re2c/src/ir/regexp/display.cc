@@ -1,5 +1,6 @@
 #include <iostream>
 
+#include "src/ir/regexp/encoding/range_suffix.h"
 #include "src/ir/regexp/regexp.h"
 #include "src/ir/regexp/regexp_alt.h"
 #include "src/ir/regexp/regexp_cat.h"
@@ -7,6 +8,7 @@
 #include "src/ir/regexp/regexp_match.h"
 #include "src/ir/regexp/regexp_null.h"
 #include "src/ir/regexp/regexp_rule.h"
+#include "src/ir/regexp/regexp_suffix.h"
 
 namespace re2c
 {
@@ -47,5 +49,34 @@ void RuleOp::display (std::ostream & o) const
 	o << exp << "/" << ctx << ";";
 }
 
+static void display_state (std::ostream & o, const RangeSuffix * p)
+{
+	if (p->next)
+	{
+		o << "(";
+	}
+	for (const RangeSuffix * q = p; q; q = q->next)
+	{
+		if (q != p)
+		{
+			o << "|";
+		}
+		o << q->ran;
+		if (q->child)
+		{
+			display_state (o, q->child);
+		}
+	}
+	if (p->next)
+	{
+		o << ")";
+	}
+}
+
+void SuffixOp::display (std::ostream & o) const
+{
+	display_state (o, states.back ());
+}
+
 } // end namespace re2c
 
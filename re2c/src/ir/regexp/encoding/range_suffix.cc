@@ -1,38 +1,157 @@
+#include <algorithm>
+#include <set>
+
 #include "src/ir/regexp/encoding/range_suffix.h"
-#include "src/ir/regexp/regexp.h"
 #include "src/ir/regexp/regexp_match.h"
+#include "src/ir/regexp/regexp_suffix.h"
 #include "src/util/range.h"
 
 namespace re2c {
 
-static RegExp * emit (RangeSuffix * p, RegExp * re);
+/*
+ * note [range suffix cache]
+ *
+ * With '--utf-8' and '--utf-16' character class is a set of code unit
+ * sequences: each range of runes is split into sub-ranges that can be
+ * written as catenation of code unit ranges [l1-h1]...[lN-hN] (see
+ * UTF8splitByContinuity and UTF16splitByContinuity).
+ *
+ * Sequences of one class are added to a trie that merges their common
+ * prefixes. Then the trie is turned into minimal acyclic automaton
+ * bottom-up: each state (list of arcs) is looked up in the cache of
+ * states keyed by their arcs (code unit range and target state), so
+ * that all equal subtrees (equal sets of suffixes) become one state.
+ * Adjacent arcs to the same state are merged into one arc. The cache
+ * is shared by all classes in the spec and cleared together with the
+ * arena: common tails like '[80-BF][80-BF]' are built only once.
+ *
+ * Class is then represented with SuffixOp that refers to the start
+ * state of the automaton; it compiles to one NFA transition per arc
+ * (plus alternatives), no matter how many sequences go through the arc
+ * (alternative of sequences would repeat common parts for each path).
+ * Classes of single code units are plain ranges (MatchOp).
+ *
+ * Arcs that end sequence are never merged with arcs that continue it,
+ * so there is no need for final states. Automaton may have overlapping
+ * arcs (in UTF-16 lone surrogates overlap with leading surrogates);
+ * this is fine for NFA.
+ */
 
-free_list<RangeSuffix *> RangeSuffix::freeList;
+arena_t<RangeSuffix> RangeSuffix::arena;
+RangeSuffix::cache_t RangeSuffix::cache;
 
-RegExp * to_regexp (RangeSuffix * p)
+/*
+ * Find (or add) arc [l-h] in list of arcs and return the list
+ * of its successors.
+ */
+RangeSuffix ** add_range (RangeSuffix ** p, uint32_t l, uint32_t h, bool last)
 {
-	return p
-		? emit (p, NULL)
-		: new MatchOp (NULL);
+	for (;; p = &(*p)->next)
+	{
+		if (*p == NULL)
+		{
+			*p = new RangeSuffix (l, h);
+			break;
+		}
+		else if ((*p)->l == l && (*p)->h == h && ((*p)->child == NULL) == last)
+			break;
+	}
+	return &(*p)->child;
+}
+
+static bool less_arc (const RangeSuffix::arc_t & a1, const RangeSuffix::arc_t & a2)
+{
+	if (a1.first != a2.first)
+		return a1.first < a2.first;
+	return a1.second == NULL && a2.second != NULL;
 }
 
 /*
- * Build regexp from suffix tree.
+ * Find (or add) the shared state equivalent to the given
+ * trie node, see note [range suffix cache].
  */
-RegExp * emit(RangeSuffix * p, RegExp * re)
+static RangeSuffix * share (const RangeSuffix * p)
 {
-	if (p == NULL)
-		return re;
-	else
+	std::vector<RangeSuffix::arc_t> arcs;
+	for (; p != NULL; p = p->next)
+	{
+		RangeSuffix * s = p->child ? share (p->child) : NULL;
+		arcs.push_back (std::make_pair (std::make_pair (p->l, p->h), s));
+	}
+	std::sort (arcs.begin (), arcs.end (), less_arc);
+
+	std::vector<RangeSuffix::arc_t> key;
+	for (size_t i = 0; i < arcs.size (); ++i)
 	{
-		RegExp * regexp = NULL;
-		for (; p != NULL; p = p->next)
+		if (!key.empty ()
+			&& key.back ().second == arcs[i].second
+			&& key.back ().first.second + 1 == arcs[i].first.first)
+			key.back ().first.second = arcs[i].first.second;
+		else
+			key.push_back (arcs[i]);
+	}
+
+	RangeSuffix * & state = RangeSuffix::cache[key];
+	if (state == NULL)
+	{
+		for (size_t i = key.size (); i > 0; --i)
 		{
-			RegExp * re1 = doCat(new MatchOp(Range::ran (p->l, p->h + 1)), re);
-			regexp = doAlt(regexp, emit(p->child, re1));
+			RangeSuffix * q = new RangeSuffix (key[i - 1].first.first, key[i - 1].first.second);
+			q->child = key[i - 1].second;
+			q->ran = Range::ran (q->l, q->h + 1);
+			q->next = state;
+			state = q;
 		}
-		return regexp;
 	}
+	return state;
+}
+
+static void suffix_states
+	( const RangeSuffix * p
+	, std::vector<const RangeSuffix *> & states
+	, std::set<const RangeSuffix *> & done
+	)
+{
+	if (!done.insert (p).second)
+		return;
+	for (const RangeSuffix * q = p; q != NULL; q = q->next)
+	{
+		if (q->child != NULL)
+			suffix_states (q->child, states, done);
+	}
+	states.push_back (p);
+}
+
+/*
+ * All states reachable from the given one (inclusive),
+ * each state goes after all its successors.
+ */
+static void suffix_states (const RangeSuffix * p, std::vector<const RangeSuffix *> & states)
+{
+	std::set<const RangeSuffix *> done;
+	suffix_states (p, states, done);
+}
+
+SuffixOp::SuffixOp (const RangeSuffix * root)
+	: states ()
+{
+	suffix_states (root, states);
+}
+
+RegExp * to_regexp (RangeSuffix * p)
+{
+	if (p == NULL)
+		return new MatchOp (NULL);
+
+	RangeSuffix * s = share (p);
+	Range * r = NULL;
+	for (const RangeSuffix * q = s; q != NULL; q = q->next)
+	{
+		if (q->child != NULL)
+			return new SuffixOp (s);
+		r = Range::add (r, q->ran);
+	}
+	return new MatchOp (r);
 }
 
 } // namespace re2c
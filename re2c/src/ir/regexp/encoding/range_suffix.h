@@ -2,36 +2,52 @@
 #define _RE2C_IR_REGEXP_ENCODING_RANGE_SUFFIX_
 
 #include "src/util/c99_stdint.h"
-#include <stddef.h> // NULL
+#include <stddef.h> // NULL, size_t
+#include <map>
+#include <utility>
+#include <vector>
 
+#include "src/util/arena.h"
 #include "src/util/forbid_copy.h"
-#include "src/util/free_list.h"
 
 namespace re2c {
 
+class Range;
 class RegExp;
 
+// arc of range trie (or of shared automaton), see note [range suffix cache]
 struct RangeSuffix
 {
-	static free_list<RangeSuffix *> freeList;
+	typedef std::pair<std::pair<uint32_t, uint32_t>, RangeSuffix *> arc_t;
+	typedef std::map<std::vector<arc_t>, RangeSuffix *> cache_t;
+
+	static arena_t<RangeSuffix> arena;
+	static cache_t cache;
 
 	uint32_t l;
 	uint32_t h;
 	RangeSuffix * next;
-	RangeSuffix * child;
+	RangeSuffix * child; // NULL if sequence ends after this arc
+	Range * ran;         // only in shared automaton
 
 	RangeSuffix (uint32_t lo, uint32_t hi)
 		: l     (lo)
 		, h     (hi)
 		, next  (NULL)
 		, child (NULL)
+		, ran   (NULL)
+	{}
+
+	static void * operator new (size_t size)
 	{
-		freeList.insert(this);
+		return arena.alloc (size);
 	}
+	static void operator delete (void *) {}
 
 	FORBID_COPY (RangeSuffix);
 };
 
+RangeSuffix ** add_range (RangeSuffix ** p, uint32_t l, uint32_t h, bool last);
 RegExp * to_regexp (RangeSuffix * p);
 
 } // namespace re2c
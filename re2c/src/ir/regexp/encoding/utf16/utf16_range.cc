@@ -8,60 +8,18 @@ namespace re2c {
  */
 void UTF16addContinuous1(RangeSuffix * & root, uint32_t l, uint32_t h)
 {
-	RangeSuffix ** p = &root;
-	for (;;)
-	{
-		if (*p == NULL)
-		{
-			*p = new RangeSuffix(l, h);
-			break;
-		}
-		else if ((*p)->l == l && (*p)->h == h)
-		{
-			break;
-		}
-		else
-			p = &(*p)->next;
-	}
+	add_range(&root, l, h, true);
 }
 
 /*
  * Now that we have catenation of word ranges [l1-h1],[l2-h2],
- * we want to add it to existing range, merging suffixes on the fly.
+ * we want to add it to existing range, merging prefixes on the fly
+ * (suffixes are merged later, see note [range suffix cache]).
  */
 void UTF16addContinuous2(RangeSuffix * & root, uint32_t l_ld, uint32_t h_ld, uint32_t l_tr, uint32_t h_tr)
 {
-	RangeSuffix ** p = &root;
-	for (;;)
-	{
-		if (*p == NULL)
-		{
-			*p = new RangeSuffix(l_tr, h_tr);
-			p = &(*p)->child;
-			break;
-		}
-		else if ((*p)->l == l_tr && (*p)->h == h_tr)
-		{
-			p = &(*p)->child;
-			break;
-		}
-		else
-			p = &(*p)->next;
-	}
-	for (;;)
-	{
-		if (*p == NULL)
-		{
-			*p = new RangeSuffix(l_ld, h_ld);
-			break;
-		}
-		else if ((*p)->l == l_ld && (*p)->h == h_ld)
-		{
-			break;
-		}
-		else
-			p = &(*p)->next;
-	}
+	RangeSuffix ** p = add_range(&root, l_ld, h_ld, false);
+	add_range(p, l_tr, h_tr, true);
 }
 
 /*
@@ -24,8 +24,9 @@ RegExp * UTF16Symbol(utf16::rune r)
 /*
  * Split Unicode character class {[l1, h1), ..., [lN, hN)} into
  * ranges [l1, h1-1], ..., [lN, hN-1] and return alternation of
- * them. We store partially built range in suffix tree, which
- * allows to eliminate common suffixes while building.
+ * them. We store partially built range in a trie of code unit
+ * ranges, which is then turned into minimal automaton shared
+ * with other classes (see note [range suffix cache]).
  */
 RegExp * UTF16Range(const Range * r)
 {
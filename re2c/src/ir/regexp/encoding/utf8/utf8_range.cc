@@ -5,7 +5,8 @@ namespace re2c {
 
 /*
  * Now that we have catenation of byte ranges [l1-h1]...[lN-hN],
- * we want to add it to existing range, merging suffixes on the fly.
+ * we want to add it to existing range, merging prefixes on the fly
+ * (suffixes are merged later, see note [range suffix cache]).
  */
 void UTF8addContinuous(RangeSuffix * & root, utf8::rune l, utf8::rune h, uint32_t n)
 {
@@ -15,27 +16,8 @@ void UTF8addContinuous(RangeSuffix * & root, utf8::rune l, utf8::rune h, uint32_
 	utf8::rune_to_bytes(hcs, h);
 
 	RangeSuffix ** p = &root;
-	for (uint32_t i = 1; i <= n; ++i)
-	{
-		const uint32_t lc = lcs[n - i];
-		const uint32_t hc = hcs[n - i];
-		for (;;)
-		{
-			if (*p == NULL)
-			{
-				*p = new RangeSuffix(lc, hc);
-				p = &(*p)->child;
-				break;
-			}
-			else if ((*p)->l == lc && (*p)->h == hc)
-			{
-				p = &(*p)->child;
-				break;
-			}
-			else
-				p = &(*p)->next;
-		}
-	}
+	for (uint32_t i = 0; i < n; ++i)
+		p = add_range(p, lcs[i], hcs[i], i + 1 == n);
 }
 
 /*
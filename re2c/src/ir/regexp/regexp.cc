@@ -22,7 +22,7 @@ namespace re2c
 
 static MatchOp * merge (MatchOp * m1, MatchOp * m2);
 
-free_list<RegExp*> RegExp::vFreeList;
+arena_t<RegExp> RegExp::arena;
 
 RegExp * doAlt (RegExp * e1, RegExp * e2)
 {
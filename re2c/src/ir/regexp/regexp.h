@@ -2,11 +2,12 @@
 #define _RE2C_IR_REGEXP_REGEXP_
 
 #include "src/util/c99_stdint.h"
+#include <stddef.h> // size_t
 #include <iosfwd>
 #include <set>
 #include <vector>
 
-#include "src/util/free_list.h"
+#include "src/util/arena.h"
 #include "src/util/forbid_copy.h"
 
 namespace re2c
@@ -14,23 +15,27 @@ namespace re2c
 
 struct nfa_state_t;
 struct nfa_t;
+struct dfa_key_t;
 
 typedef std::vector<uint32_t> charset_t;
 
 class RegExp
 {
 public:
-	static free_list <RegExp *> vFreeList;
+	static arena_t<RegExp> arena;
 
-	inline RegExp ()
+	static void * operator new (size_t size)
 	{
-		vFreeList.insert (this);
+		return arena.alloc (size);
 	}
-	inline virtual ~RegExp ()
+	static void operator delete (void *) {}
+	inline RegExp ()
 	{
-		vFreeList.erase (this);
+		arena.track (this);
 	}
+	inline virtual ~RegExp () {}
 	virtual void split (std::set<uint32_t> &) = 0;
+	virtual void serialize (dfa_key_t &) = 0;
 	virtual uint32_t calc_size() const = 0;
 	virtual uint32_t fixedLength ();
 	virtual nfa_state_t *compile(nfa_t &nfa, nfa_state_t *n) = 0;
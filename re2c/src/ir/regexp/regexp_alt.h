@@ -17,6 +17,7 @@ public:
 		, exp2 (e2)
 	{}
 	void split (std::set<uint32_t> &);
+	void serialize (dfa_key_t & key);
 	uint32_t calc_size() const;
 	uint32_t fixedLength ();
 	nfa_state_t *compile(nfa_t &nfa, nfa_state_t *n);
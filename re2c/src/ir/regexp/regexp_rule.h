@@ -41,6 +41,7 @@ public:
 	{}
 	void display (std::ostream & o) const;
 	void split (std::set<uint32_t> &);
+	void serialize (dfa_key_t & key);
 	uint32_t calc_size() const;
 	nfa_state_t *compile(nfa_t &nfa, nfa_state_t *n);
 
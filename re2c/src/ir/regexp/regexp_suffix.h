@@ -0,0 +1,32 @@
+#ifndef _RE2C_IR_REGEXP_REGEXP_SUFFIX_
+#define _RE2C_IR_REGEXP_REGEXP_SUFFIX_
+
+#include <vector>
+
+#include "src/ir/regexp/regexp.h"
+
+namespace re2c
+{
+
+struct RangeSuffix;
+
+// class in variable-length encoding, see note [range suffix cache]
+class SuffixOp: public RegExp
+{
+	// reachable states, start state is the last one
+	std::vector<const RangeSuffix *> states;
+
+public:
+	explicit SuffixOp (const RangeSuffix * root);
+	void split (std::set<uint32_t> &);
+	void serialize (dfa_key_t & key);
+	uint32_t calc_size() const;
+	nfa_state_t *compile(nfa_t &nfa, nfa_state_t *n);
+	void display (std::ostream & o) const;
+
+	FORBID_COPY (SuffixOp);
+};
+
+} // end namespace re2c
+
+#endif // _RE2C_IR_REGEXP_REGEXP_SUFFIX_
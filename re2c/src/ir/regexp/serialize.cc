@@ -0,0 +1,91 @@
+#include "src/util/c99_stdint.h"
+#include <map>
+
+#include "src/ir/dfa/cache.h"
+#include "src/ir/regexp/encoding/range_suffix.h"
+#include "src/ir/regexp/regexp.h"
+#include "src/ir/regexp/regexp_alt.h"
+#include "src/ir/regexp/regexp_cat.h"
+#include "src/ir/regexp/regexp_close.h"
+#include "src/ir/regexp/regexp_match.h"
+#include "src/ir/regexp/regexp_null.h"
+#include "src/ir/regexp/regexp_rule.h"
+#include "src/ir/regexp/regexp_suffix.h"
+#include "src/util/range.h"
+
+namespace re2c
+{
+
+// prefix notation: each operator is followed by its operands,
+// so (unlike 'display') different expressions never collide
+
+void AltOp::serialize (dfa_key_t & key)
+{
+	key.put ('|');
+	exp1->serialize (key);
+	exp2->serialize (key);
+}
+
+void CatOp::serialize (dfa_key_t & key)
+{
+	key.put ('.');
+	exp1->serialize (key);
+	exp2->serialize (key);
+}
+
+void CloseOp::serialize (dfa_key_t & key)
+{
+	key.put ('+');
+	exp->serialize (key);
+}
+
+void MatchOp::serialize (dfa_key_t & key)
+{
+	key.put ('[');
+	for (Range *r = match; r; r = r->next ())
+	{
+		key.put (r->lower ());
+		key.put (r->upper ());
+	}
+	key.put (']');
+}
+
+void NullOp::serialize (dfa_key_t & key)
+{
+	key.put ('_');
+}
+
+void RuleOp::serialize (dfa_key_t & key)
+{
+	key.put ('/');
+	key.put (rank.uint32 ());
+	key.rule (this);
+	exp->serialize (key);
+	ctx->serialize (key);
+}
+
+// states are referenced by their index (each state goes after its successors)
+void SuffixOp::serialize (dfa_key_t & key)
+{
+	std::map<const RangeSuffix *, uint32_t> index;
+	key.put ('<');
+	key.put (static_cast<uint32_t> (states.size ()));
+	for (size_t i = 0; i < states.size (); ++i)
+	{
+		uint32_t arcs = 0;
+		for (const RangeSuffix *p = states[i]; p; p = p->next)
+		{
+			++arcs;
+		}
+		key.put (arcs);
+		for (const RangeSuffix *p = states[i]; p; p = p->next)
+		{
+			key.put (p->l);
+			key.put (p->h);
+			key.put (p->child ? index[p->child] : ~0u);
+		}
+		index[states[i]] = static_cast<uint32_t> (i);
+	}
+}
+
+} // namespace re2c
@@ -1,4 +1,5 @@
-#include <map>
+#include "src/util/c99_stdint.h"
+#include <stack>
 #include <utility>
 #include <vector>
 
@@ -16,37 +17,69 @@ namespace re2c
 // We don't need all patterns that cause undefined behaviour.
 // We only need some examples, the shorter the better.
 // See also note [counting skeleton edges].
-void Node::naked_ways (way_t & prefix, std::vector<way_t> & ways, nakeds_t &size)
+void Skeleton::naked_ways (std::vector<way_t> & ways, nakeds_t & size) const
 {
-	if (!rule.rank.is_none ())
+	way_t prefix;
+	if (!nodes[0].rule.rank.is_none ())
 	{
 		return;
 	}
-	else if (end ())
+	else if (end (0))
 	{
 		ways.push_back (prefix);
-		size = size + nakeds_t::from64(prefix.size ());
+		return;
 	}
-	else if (loop < 2)
+
+	std::vector<uint8_t> loop (nodes.size (), 0);
+
+	// stack of (node, next arc), see note [skeleton layout]
+	// prefix holds the arcs that lead to each node on stack but the first one
+	std::stack<std::pair<size_t, uint32_t> > stack;
+	loop[0] = 1;
+	stack.push (std::make_pair (0, arcs[0]));
+	while (!stack.empty ())
 	{
-		local_inc _ (loop);
-		for (arcsets_t::iterator i = arcsets.begin ();
-			i != arcsets.end () && !size.overflow (); ++i)
+		const size_t i = stack.top ().first;
+		const uint32_t a = stack.top ().second++;
+		if (a == arcs[i + 1] || size.overflow ())
+		{
+			// all arcs followed (or enough ways found), return to parent
+			--loop[i];
+			stack.pop ();
+			if (!stack.empty ())
+			{
+				prefix.pop_back ();
+			}
+			continue;
+		}
+
+		const size_t j = targets[a];
+		prefix.push_back (&ranges[a]);
+		if (!nodes[j].rule.rank.is_none ())
+		{
+			// no undefined control flow on this path
+		}
+		else if (end (j))
 		{
-			prefix.push_back (&i->second);
-			i->first->naked_ways (prefix, ways, size);
-			prefix.pop_back ();
+			ways.push_back (prefix);
+			size = size + nakeds_t::from64(prefix.size ());
 		}
+		else if (loop[j] < 2)
+		{
+			++loop[j];
+			stack.push (std::make_pair (j, arcs[j]));
+			continue;
+		}
+		prefix.pop_back ();
 	}
 }
 
 void Skeleton::warn_undefined_control_flow ()
 {
-	way_t prefix;
 	std::vector<way_t> ways;
-	Node::nakeds_t size = Node::nakeds_t::from32(0u);
+	nakeds_t size = nakeds_t::from32(0u);
 
-	nodes->naked_ways (prefix, ways, size);
+	naked_ways (ways, size);
 
 	if (!ways.empty ())
 	{
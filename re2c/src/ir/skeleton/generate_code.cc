@@ -51,10 +51,130 @@ static void from_le(OutputFile &o, uint32_t ind, size_t size, const char *expr)
 	o.ws(";");
 }
 
+/*
+ * note [skeleton benchmark]
+ *
+ * With '--benchmark' skeleton program doesn't check the DFA: it measures
+ * how fast the DFA lexes skeleton data (or a user-supplied corpus in the
+ * same format). Since skeleton data is the same for all code generation
+ * options, programs generated with '-b', '-g', '-s' etc. can be compared
+ * on identical input.
+ *
+ * For each DFA there is a function 'pass_<name>' that lexes the whole
+ * input once and a function 'bench_<name>' that loads input, does one
+ * untimed warm-up pass and then N timed passes. With skeleton data,
+ * each token is advanced by its key exactly as in the checking program
+ * (so the token sequence is the same as in '--skeleton' tests); with a
+ * corpus, lexing is continuous (empty matches are forced to skip one
+ * code unit, so that the loop always terminates).
+ *
+ * Rule counters are indexed by the position of rule in the rule list
+ * (default and none rules go last). On Linux CPU cycles and branch
+ * misses are read with 'perf_event_open' if the kernel permits it.
+ */
+static uint32_t rule_index (const rules_t & rules, rule_rank_t rank)
+{
+	uint32_t n = 0;
+	for (rules_t::const_iterator i = rules.begin (); i != rules.end (); ++i)
+	{
+		const rule_rank_t r = i->first;
+		if (r.is_none () || r.is_def ())
+		{
+			continue;
+		}
+		if (r == rank)
+		{
+			return n;
+		}
+		++n;
+	}
+	return rank.is_none () ? n + 1 : n;
+}
+
+static void emit_bench_prolog (OutputFile & o)
+{
+	o.ws("\n#ifdef __linux__");
+	o.ws("\n#include <linux/perf_event.h>");
+	o.ws("\n#include <sys/ioctl.h>");
+	o.ws("\n#include <sys/syscall.h>");
+	o.ws("\n#include <unistd.h>");
+	o.ws("\n#endif");
+	o.ws("\n");
+	o.ws("\nstatic double bench_now()");
+	o.ws("\n{");
+	o.ws("\n#ifdef CLOCK_MONOTONIC");
+	o.ws("\n").wind(1).ws("struct timespec t;");
+	o.ws("\n").wind(1).ws("clock_gettime(CLOCK_MONOTONIC, &t);");
+	o.ws("\n").wind(1).ws("return (double) t.tv_sec + (double) t.tv_nsec * 1e-9;");
+	o.ws("\n#else");
+	o.ws("\n").wind(1).ws("return (double) clock() / CLOCKS_PER_SEC;");
+	o.ws("\n#endif");
+	o.ws("\n}");
+	o.ws("\n");
+	o.ws("\n/* CPU cycles and branch misses, -1 if not available */");
+	o.ws("\nstatic void counters_start(int *fd)");
+	o.ws("\n{");
+	o.ws("\n").wind(1).ws("int k;");
+	o.ws("\n#ifdef __linux__");
+	o.ws("\n").wind(1).ws("struct perf_event_attr attr;");
+	o.ws("\n#endif");
+	o.ws("\n").wind(1).ws("for (k = 0; k < 2; ++k) {");
+	o.ws("\n").wind(2).ws("fd[k] = -1;");
+	o.ws("\n#ifdef __linux__");
+	o.ws("\n").wind(2).ws("memset(&attr, 0, sizeof(attr));");
+	o.ws("\n").wind(2).ws("attr.type = PERF_TYPE_HARDWARE;");
+	o.ws("\n").wind(2).ws("attr.size = sizeof(attr);");
+	o.ws("\n").wind(2).ws("attr.config = k == 0");
+	o.ws("\n").wind(3).ws("? PERF_COUNT_HW_CPU_CYCLES");
+	o.ws("\n").wind(3).ws(": PERF_COUNT_HW_BRANCH_MISSES;");
+	o.ws("\n").wind(2).ws("attr.disabled = 1;");
+	o.ws("\n").wind(2).ws("attr.exclude_kernel = 1;");
+	o.ws("\n").wind(2).ws("attr.exclude_hv = 1;");
+	o.ws("\n").wind(2).ws("fd[k] = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);");
+	o.ws("\n").wind(2).ws("if (fd[k] != -1) {");
+	o.ws("\n").wind(3).ws("ioctl(fd[k], PERF_EVENT_IOC_RESET, 0);");
+	o.ws("\n").wind(3).ws("ioctl(fd[k], PERF_EVENT_IOC_ENABLE, 0);");
+	o.ws("\n").wind(2).ws("}");
+	o.ws("\n#endif");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n}");
+	o.ws("\n");
+	o.ws("\nstatic void counters_stop(const int *fd, double *events)");
+	o.ws("\n{");
+	o.ws("\n").wind(1).ws("int k;");
+	o.ws("\n").wind(1).ws("for (k = 0; k < 2; ++k) {");
+	o.ws("\n").wind(2).ws("events[k] = -1;");
+	o.ws("\n#ifdef __linux__");
+	o.ws("\n").wind(2).ws("if (fd[k] != -1) {");
+	o.ws("\n").wind(3).ws("unsigned long long n = 0;");
+	o.ws("\n").wind(3).ws("ioctl(fd[k], PERF_EVENT_IOC_DISABLE, 0);");
+	o.ws("\n").wind(3).ws("if (read(fd[k], &n, sizeof(n)) == sizeof(n)) {");
+	o.ws("\n").wind(4).ws("events[k] = (double) n;");
+	o.ws("\n").wind(3).ws("}");
+	o.ws("\n").wind(3).ws("close(fd[k]);");
+	o.ws("\n").wind(2).ws("}");
+	o.ws("\n#endif");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n}");
+	o.ws("\n");
+}
+
 void Skeleton::emit_prolog (OutputFile & o)
 {
+	if (opts->benchmark)
+	{
+		// for clock_gettime and syscall
+		o.ws("\n#if defined(__linux__) && !defined(_GNU_SOURCE)");
+		o.ws("\n#define _GNU_SOURCE");
+		o.ws("\n#endif");
+	}
 	o.ws("\n#include <stdio.h>");
 	o.ws("\n#include <stdlib.h> /* malloc, free */");
+	if (opts->benchmark)
+	{
+		o.ws("\n#include <string.h> /* memset */");
+		o.ws("\n#include <time.h>");
+	}
 	o.ws("\n");
 	o.ws("\nstatic void *read_file");
 	o.ws("\n").wind(1).ws("( const char *fname");
@@ -101,38 +221,17 @@ void Skeleton::emit_prolog (OutputFile & o)
 	o.ws("\n").wind(1).ws("return NULL;");
 	o.ws("\n}");
 	o.ws("\n");
+	if (opts->benchmark)
+	{
+		emit_bench_prolog (o);
+	}
 }
 
-void Skeleton::emit_start
-	( OutputFile & o
-	, size_t maxfill
-	, bool backup
-	, bool backupctx
-	, bool accept
-	) const
+void Skeleton::emit_check_start (OutputFile & o, size_t maxfill) const
 {
 	const size_t sizeof_cunit = opts->encoding.szCodeUnit();
 	const uint32_t default_rule = rule2key (rule_rank_t::none ());
 
-	o.ws("\n#define YYCTYPE ");
-	exact_uint (o, sizeof_cunit);
-	o.ws("\n#define YYKEYTYPE ");
-	exact_uint (o, sizeof_key);
-	o.ws("\n#define YYPEEK() *cursor");
-	o.ws("\n#define YYSKIP() ++cursor");
-	if (backup)
-	{
-		o.ws("\n#define YYBACKUP() marker = cursor");
-		o.ws("\n#define YYRESTORE() cursor = marker");
-	}
-	if (backupctx)
-	{
-		o.ws("\n#define YYBACKUPCTX() ctxmarker = cursor");
-		o.ws("\n#define YYRESTORECTX() cursor = ctxmarker");
-	}
-	o.ws("\n#define YYLESSTHAN(n) (limit - cursor) < n");
-	o.ws("\n#define YYFILL(n) { break; }");
-	o.ws("\n");
 	o.ws("\nstatic int action_").wstring(name);
 	o.ws("\n").wind(1).ws("( unsigned int i");
 	o.ws("\n").wind(1).ws(", const YYKEYTYPE *keys");
@@ -231,6 +330,84 @@ void Skeleton::emit_start
 	o.ws("\n");
 	o.ws("\n").wind(1).ws("for (i = 0; status == 0 && i < keys_count; ++i) {");
 	o.ws("\n").wind(2).ws("token = cursor;");
+}
+
+void Skeleton::emit_bench_start (OutputFile & o, size_t maxfill) const
+{
+	o.ws("\nstatic const size_t padding_").wstring(name).ws(" = ").wu64(maxfill).ws("; /* YYMAXFILL */");
+	o.ws("\n");
+	o.ws("\nstatic void action_").wstring(name);
+	o.ws("\n").wind(1).ws("( unsigned int i");
+	o.ws("\n").wind(1).ws(", const YYKEYTYPE *keys");
+	o.ws("\n").wind(1).ws(", const YYCTYPE *token");
+	o.ws("\n").wind(1).ws(", const YYCTYPE **cursor");
+	o.ws("\n").wind(1).ws(", unsigned int rule");
+	o.ws("\n").wind(1).ws(", unsigned long *counts");
+	o.ws("\n").wind(1).ws(")");
+	o.ws("\n{");
+	o.ws("\n").wind(1).ws("++counts[rule];");
+	o.ws("\n").wind(1).ws("if (keys != NULL) {");
+	o.ws("\n").wind(2).ws("*cursor = token + keys[3 * i];");
+	o.ws("\n").wind(1).ws("} else if (*cursor == token) {");
+	o.ws("\n").wind(2).ws("++*cursor;");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n}");
+	o.ws("\n");
+	o.ws("\nstatic const YYCTYPE *pass_").wstring(name);
+	o.ws("\n").wind(1).ws("( const YYCTYPE *input");
+	o.ws("\n").wind(1).ws(", const YYCTYPE *limit");
+	o.ws("\n").wind(1).ws(", const YYCTYPE *eof");
+	o.ws("\n").wind(1).ws(", const YYKEYTYPE *keys");
+	o.ws("\n").wind(1).ws(", size_t keys_count");
+	o.ws("\n").wind(1).ws(", unsigned long *counts");
+	o.ws("\n").wind(1).ws(")");
+	o.ws("\n{");
+	o.ws("\n").wind(1).ws("const YYCTYPE *cursor = input;");
+	o.ws("\n").wind(1).ws("const YYCTYPE *token = NULL;");
+	o.ws("\n").wind(1).ws("unsigned int i = 0;");
+	o.ws("\n");
+	o.ws("\n").wind(1).ws("for (i = 0; keys != NULL ? i < keys_count : cursor < eof; ++i) {");
+	o.ws("\n").wind(2).ws("token = cursor;");
+}
+
+void Skeleton::emit_start
+	( OutputFile & o
+	, size_t maxfill
+	, bool backup
+	, bool backupctx
+	, bool accept
+	, const bitmaps_t & bitmaps
+	) const
+{
+	const size_t sizeof_cunit = opts->encoding.szCodeUnit();
+
+	o.ws("\n#define YYCTYPE ");
+	exact_uint (o, sizeof_cunit);
+	o.ws("\n#define YYKEYTYPE ");
+	exact_uint (o, sizeof_key);
+	o.ws("\n#define YYPEEK() *cursor");
+	o.ws("\n#define YYSKIP() ++cursor");
+	if (backup)
+	{
+		o.ws("\n#define YYBACKUP() marker = cursor");
+		o.ws("\n#define YYRESTORE() cursor = marker");
+	}
+	if (backupctx)
+	{
+		o.ws("\n#define YYBACKUPCTX() ctxmarker = cursor");
+		o.ws("\n#define YYRESTORECTX() cursor = ctxmarker");
+	}
+	o.ws("\n#define YYLESSTHAN(n) (limit - cursor) < n");
+	o.ws("\n#define YYFILL(n) { break; }");
+	o.ws("\n");
+	if (opts->benchmark)
+	{
+		emit_bench_start (o, maxfill);
+	}
+	else
+	{
+		emit_check_start (o, maxfill);
+	}
 	if (backup)
 	{
 		o.ws("\n").wind(2).ws("const YYCTYPE *marker = NULL;");
@@ -245,18 +422,14 @@ void Skeleton::emit_start
 		o.ws("\n").wind(2).ws("unsigned int yyaccept = 0;");
 	}
 	o.ws("\n");
-	if (opts->bFlag && BitMap::first)
+	if (opts->bFlag && !bitmaps.empty ())
 	{
-		BitMap::gen (o, 2, 0, std::min (0x100u, opts->encoding.nCodeUnits ()));
+		bitmaps.gen (o, 2, 0, std::min (0x100u, opts->encoding.nCodeUnits ()));
 	}
 	o.ws("\n");
 }
 
-void Skeleton::emit_end
-	( OutputFile & o
-	, bool backup
-	, bool backupctx
-	) const
+void Skeleton::emit_check_end (OutputFile & o) const
 {
 	o.ws("\n").wind(1).ws("}");
 	o.ws("\n").wind(1).ws("if (status == 0) {");
@@ -277,6 +450,142 @@ void Skeleton::emit_end
 	o.ws("\n");
 	o.ws("\n").wind(1).ws("return status;");
 	o.ws("\n}");
+}
+
+void Skeleton::emit_bench_end (OutputFile & o) const
+{
+	const size_t sizeof_cunit = opts->encoding.szCodeUnit();
+	const uint32_t nrules = rule_index (rules, rule_rank_t::def ());
+
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n").wind(1).ws("return cursor;");
+	o.ws("\n}");
+	o.ws("\n");
+	o.ws("\nstatic int bench_").wstring(name).ws("(unsigned long repeat, const char *corpus)");
+	o.ws("\n{");
+	o.ws("\n").wind(1).ws("static const unsigned int lines[] = {");
+	for (rules_t::const_iterator i = rules.begin (); i != rules.end (); ++i)
+	{
+		if (!i->first.is_none () && !i->first.is_def ())
+		{
+			o.wu32(i->second.line).ws(", ");
+		}
+	}
+	o.ws("0};");
+	o.ws("\n").wind(1).ws("const unsigned int rules = ").wu32(nrules).ws(";");
+	o.ws("\n").wind(1).ws("const size_t padding = padding_").wstring(name).ws(";");
+	o.ws("\n").wind(1).ws("size_t input_len = 0;");
+	o.ws("\n").wind(1).ws("size_t keys_count = 0;");
+	o.ws("\n").wind(1).ws("YYCTYPE *input = NULL;");
+	o.ws("\n").wind(1).ws("YYKEYTYPE *keys = NULL;");
+	o.ws("\n").wind(1).ws("const YYCTYPE *limit = NULL;");
+	o.ws("\n").wind(1).ws("const YYCTYPE *eof = NULL;");
+	o.ws("\n").wind(1).ws("unsigned long counts[").wu32(nrules + 2).ws("];");
+	o.ws("\n").wind(1).ws("unsigned long tokens = 0;");
+	o.ws("\n").wind(1).ws("unsigned long r = 0;");
+	o.ws("\n").wind(1).ws("size_t consumed = 0;");
+	o.ws("\n").wind(1).ws("size_t i = 0;");
+	o.ws("\n").wind(1).ws("double bytes = 0;");
+	o.ws("\n").wind(1).ws("double time = 0;");
+	o.ws("\n").wind(1).ws("double events[2];");
+	o.ws("\n").wind(1).ws("int fd[2];");
+	o.ws("\n");
+	o.ws("\n").wind(1).ws("if (corpus == NULL) {");
+	o.ws("\n").wind(2).ws("corpus = \"").wstring(o.file_name).ws(".").wstring(name).ws(".input\";");
+	o.ws("\n").wind(2).ws("keys = (YYKEYTYPE *) read_file");
+	o.ws("\n").wind(3).ws("(\"").wstring(o.file_name).ws(".").wstring(name).ws(".keys\"");
+	o.ws("\n").wind(3).ws(", 3 * sizeof (YYKEYTYPE)");
+	o.ws("\n").wind(3).ws(", 0");
+	o.ws("\n").wind(3).ws(", &keys_count");
+	o.ws("\n").wind(3).ws(");");
+	o.ws("\n").wind(2).ws("if (keys == NULL) {");
+	o.ws("\n").wind(3).ws("return 1;");
+	o.ws("\n").wind(2).ws("}");
+	if (sizeof_key > 1)
+	{
+		o.ws("\n").wind(2).ws("for (i = 0; i < 3 * keys_count; ++i) {");
+		from_le(o, 3, sizeof_key, "keys[i]");
+		o.ws("\n").wind(2).ws("}");
+	}
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n");
+	o.ws("\n").wind(1).ws("input = (YYCTYPE *) read_file");
+	o.ws("\n").wind(2).ws("( corpus");
+	o.ws("\n").wind(2).ws(", sizeof (YYCTYPE)");
+	o.ws("\n").wind(2).ws(", padding");
+	o.ws("\n").wind(2).ws(", &input_len");
+	o.ws("\n").wind(2).ws(");");
+	o.ws("\n").wind(1).ws("if (input == NULL) {");
+	o.ws("\n").wind(2).ws("free(keys);");
+	o.ws("\n").wind(2).ws("return 1;");
+	o.ws("\n").wind(1).ws("}");
+	if (sizeof_cunit > 1)
+	{
+		o.ws("\n").wind(1).ws("for (i = 0; i < input_len; ++i) {");
+		from_le(o, 2, sizeof_cunit, "input[i]");
+		o.ws("\n").wind(1).ws("}");
+	}
+	o.ws("\n").wind(1).ws("limit = input + input_len + padding;");
+	o.ws("\n").wind(1).ws("eof = input + input_len;");
+	o.ws("\n");
+	o.ws("\n").wind(1).ws("/* warm-up pass: not timed and not counted */");
+	o.ws("\n").wind(1).ws("memset(counts, 0, sizeof(counts));");
+	o.ws("\n").wind(1).ws("pass_").wstring(name).ws("(input, limit, eof, keys, keys_count, counts);");
+	o.ws("\n").wind(1).ws("memset(counts, 0, sizeof(counts));");
+	o.ws("\n");
+	o.ws("\n").wind(1).ws("counters_start(fd);");
+	o.ws("\n").wind(1).ws("time = bench_now();");
+	o.ws("\n").wind(1).ws("for (r = 0; r < repeat; ++r) {");
+	o.ws("\n").wind(2).ws("consumed += (size_t) (pass_").wstring(name).ws("(input, limit, eof, keys, keys_count, counts) - input);");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n").wind(1).ws("time = bench_now() - time;");
+	o.ws("\n").wind(1).ws("counters_stop(fd, events);");
+	o.ws("\n");
+	o.ws("\n").wind(1).ws("for (i = 0; i < rules + 2; ++i) {");
+	o.ws("\n").wind(2).ws("tokens += counts[i];");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n").wind(1).ws("bytes = (double) consumed * sizeof (YYCTYPE);");
+	o.ws("\n").wind(1).ws("printf(\"").wstring(name).ws(": %lu passes over '%s': %.0f bytes, %lu tokens in %.3f s\\n\"");
+	o.ws("\n").wind(2).ws(", repeat, corpus, bytes, tokens, time);");
+	o.ws("\n").wind(1).ws("if (time > 0 && tokens > 0) {");
+	o.ws("\n").wind(2).ws("printf(\"    %.2f MB/s, %.2f ns/token\\n\", bytes / time / 1e6, time * 1e9 / (double) tokens);");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n").wind(1).ws("if (events[0] >= 0 && bytes > 0) {");
+	o.ws("\n").wind(2).ws("printf(\"    cycles: %.0f (%.2f per byte)\\n\", events[0], events[0] / bytes);");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n").wind(1).ws("if (events[1] >= 0 && tokens > 0) {");
+	o.ws("\n").wind(2).ws("printf(\"    branch-misses: %.0f (%.3f per token)\\n\", events[1], events[1] / (double) tokens);");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n").wind(1).ws("for (i = 0; i < rules; ++i) {");
+	o.ws("\n").wind(2).ws("printf(\"    rule at line %u: %lu tokens\\n\", lines[i], counts[i]);");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n").wind(1).ws("if (counts[rules] != 0) {");
+	o.ws("\n").wind(2).ws("printf(\"    default rule: %lu tokens\\n\", counts[rules]);");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n").wind(1).ws("if (counts[rules + 1] != 0) {");
+	o.ws("\n").wind(2).ws("printf(\"    undefined control flow: %lu tokens\\n\", counts[rules + 1]);");
+	o.ws("\n").wind(1).ws("}");
+	o.ws("\n");
+	o.ws("\n").wind(1).ws("free(input);");
+	o.ws("\n").wind(1).ws("free(keys);");
+	o.ws("\n").wind(1).ws("return 0;");
+	o.ws("\n}");
+}
+
+void Skeleton::emit_end
+	( OutputFile & o
+	, bool backup
+	, bool backupctx
+	) const
+{
+	if (opts->benchmark)
+	{
+		emit_bench_end (o);
+	}
+	else
+	{
+		emit_check_end (o);
+	}
 	o.ws("\n");
 	o.ws("\n#undef YYCTYPE");
 	o.ws("\n#undef YYKEYTYPE");
@@ -299,6 +608,25 @@ void Skeleton::emit_end
 
 void Skeleton::emit_epilog (OutputFile & o, const std::set<std::string> & names)
 {
+	if (opts->benchmark)
+	{
+		o.ws("\n").ws("int main(int argc, char **argv)");
+		o.ws("\n").ws("{");
+		o.ws("\n").wind(1).ws("const unsigned long repeat = argc > 1 ? strtoul(argv[1], NULL, 10) : 10;");
+		o.ws("\n").wind(1).ws("const char *corpus = argc > 2 ? argv[2] : NULL;");
+		o.ws("\n");
+		for (std::set<std::string>::const_iterator i = names.begin (); i != names.end (); ++i)
+		{
+			o.ws("\n").wind(1).ws("if(bench_").wstring(*i).ws("(repeat, corpus) != 0) {");
+			o.ws("\n").wind(2).ws("return 1;");
+			o.ws("\n").wind(1).ws("}");
+		}
+		o.ws("\n").wind(1).ws("return 0;");
+		o.ws("\n}");
+		o.ws("\n");
+		return;
+	}
+
 	o.ws("\n").ws("int main()");
 	o.ws("\n").ws("{");
 
@@ -316,6 +644,12 @@ void Skeleton::emit_epilog (OutputFile & o, const std::set<std::string> & names)
 
 void Skeleton::emit_action (OutputFile & o, uint32_t ind, rule_rank_t rank) const
 {
+	if (opts->benchmark)
+	{
+		o.wind(ind).ws("action_").wstring(name).ws("(i, keys, token, &cursor, ").wu32(rule_index (rules, rank)).ws(", counts);\n");
+		o.wind(ind).ws("continue;\n");
+		return;
+	}
 	o.wind(ind).ws("status = action_").wstring(name).ws("(i, keys, input, token, &cursor, ").wu32(rule2key (rank)).ws(");\n");
 	o.wind(ind).ws("continue;\n");
 }
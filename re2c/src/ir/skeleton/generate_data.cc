@@ -3,10 +3,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <algorithm>
-#include <map>
+#include <stack>
 #include <string>
 #include <utility>
 #include <vector>
+#if HAVE_PTHREAD_H
+#	include <pthread.h>
+#endif
 
 #include "src/conf/msg.h"
 #include "src/conf/opt.h"
@@ -15,22 +18,20 @@
 #include "src/ir/rule_rank.h"
 #include "src/ir/skeleton/path.h"
 #include "src/ir/skeleton/skeleton.h"
+#include "src/util/forbid_copy.h"
 #include "src/util/u32lim.h"
 
 namespace re2c
 {
 
-template <typename cunit_t, typename key_t>
-	static Node::covers_t cover_one (FILE * input, FILE * keys, const path_t & path);
-
 /*
  * note [generating skeleton path cover]
  *
  * With --skeleton switch we need to generate lots of data: strings that
  * correspond to various paths in DFA and match given regular expression.
  * We try to generate path cover (a set of paths that cover all skeleton
- * arcs at least once). Generation must stop as soon as the size of path
- * cover exceeds limit (in which case we'll only get a partial path cover).
+ * arcs at least once). The size of path cover must not exceed limit
+ * (otherwise we generate arc cover, see note [sampling skeleton path cover]).
  *
  * The algorithm walks graph nodes in deep-first order and assigns suffix
  * to each node (a path from this node to end node). In order to calculate
@@ -41,57 +42,551 @@ template <typename cunit_t, typename key_t>
  *
  * The algorithm calculates prefix (multipath to current node). If current
  * node has already been assigned suffix, the algorithm immediately
- * calculates path cover from prefix and suffix. Otherwise it recurses to
- * child nodes (updating prefix on the go).
+ * calculates path cover from prefix and suffix. Otherwise it descends to
+ * child nodes (updating prefix on the go). Instead of recursion the
+ * algorithm keeps an explicit stack of nodes with their prefixes.
  *
  * The algorithm avoids eternal loops by maintaining loop counter for each
- * node. Loop counter is incremented on recursive enter and decremented on
- * recursive return. If loop counter is greater than 1, current branch is
- * abandoned and recursion returns immediately.
+ * node. Loop counter is incremented when the node is pushed on stack and
+ * decremented when it is popped off stack. If loop counter is greater
+ * than 1, current branch is abandoned and the node is not entered.
  *
  * See also note [counting skeleton edges].
  *
  */
+
+/*
+ * note [sampling skeleton path cover]
+ *
+ * Before generating any data we walk the graph once with paths that only
+ * know their length and width (this is cheap: extending such path takes
+ * constant time) and find out if the full path cover fits into limit.
+ * If it does, the full cover is generated.
+ *
+ * Otherwise truncating the cover at the limit would leave untested all
+ * arcs that happen to be visited late, and it takes as long to generate
+ * as the limit allows. Instead we generate a sample of short paths that
+ * covers every arc: for each arc that is not covered yet we take the
+ * shortest path from start node to the arc and the shortest path from
+ * the arc to some end node (both found with breadth-first search). Arcs
+ * are taken in order and each path covers all arcs on it, so the size of
+ * data is bounded by the number of arcs times the depth of the graph.
+ * Arcs that cannot be reached from start node or cannot reach end node
+ * are never covered by path cover either.
+ */
+
+/*
+ * note [generating skeleton data in parallel]
+ *
+ * Graph walk is sequential (it depends on the order in which suffixes
+ * are assigned), but most of the time is spent on expanding paths into
+ * data. So paths are collected in batches; each batch is split into
+ * shards of roughly equal size, shards are expanded into memory buffers
+ * by up to '--jobs' threads and written to files in order. Data doesn't
+ * depend on the number of threads.
+ */
+
+// edges per thread in one batch, see note [generating skeleton data in parallel]
+static const uint32_t BATCH = 1024 * 1024;
+
+namespace {
+
+// path that only knows its size, see note [sampling skeleton path cover]
+class path_size_t
+{
+	size_t length;
+	size_t width;
+
+public:
+	path_size_t (rule_t, bool)
+		: length (0)
+		, width (0)
+	{}
+	void extend (rule_t, bool, const path_t::arc_t * a)
+	{
+		++length;
+		width = std::max (width, a->size ());
+	}
+	void append (const path_size_t * p)
+	{
+		length += p->length;
+		width = std::max (width, p->width);
+	}
+	covers_t size () const
+	{
+		return covers_t::from64(length) * covers_t::from64(width);
+	}
+};
+
+template <typename path_type>
+struct cover_frame_t
+{
+	size_t node;
+	uint32_t arc;
+	path_type prefix;
+
+	cover_frame_t (size_t n, uint32_t a, const path_type & p)
+		: node (n)
+		, arc (a)
+		, prefix (p)
+	{}
+};
+
+// sums up sizes of all paths in cover
+class size_sink_t
+{
+	covers_t total;
+
+public:
+	size_sink_t ()
+		: total (covers_t::from32(0u))
+	{}
+	bool stop () const
+	{
+		return total.overflow ();
+	}
+	void add (const path_size_t & path)
+	{
+		total = total + path.size ();
+	}
+};
+
+} // anonymous namespace
+
+template <typename uintn_t> static uintn_t to_le(uintn_t n)
+{
+	uintn_t m;
+	uint8_t *p = reinterpret_cast<uint8_t*>(&m);
+	for (size_t i = 0; i < sizeof(uintn_t); ++i)
+	{
+		p[i] = static_cast<uint8_t>(n >> (i * 8));
+	}
+	return m;
+}
+
+static covers_t path_size (const path_t & path)
+{
+	const size_t len = path.len ();
+	size_t count = 0;
+	for (size_t i = 0; i < len; ++i)
+	{
+		count = std::max (count, path[i]->size ());
+	}
+	return covers_t::from64(len) * covers_t::from64(count);
+}
+
+template <typename key_t>
+	static void keygen (std::vector<key_t> & keys, size_t count, size_t len, size_t len_match, rule_rank_t match)
+{
+	const key_t m = Skeleton::rule2key<key_t> (match);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		keys.push_back (to_le<key_t>(static_cast<key_t> (len)));
+		keys.push_back (to_le<key_t>(static_cast<key_t> (len_match)));
+		keys.push_back (to_le<key_t>(m));
+	}
+}
+
+template <typename cunit_t, typename key_t>
+	static void cover_one (std::vector<cunit_t> & input, std::vector<key_t> & keys, const path_t & path)
+{
+	const size_t len = path.len ();
+
+	size_t count = 0;
+	for (size_t i = 0; i < len; ++i)
+	{
+		count = std::max (count, path[i]->size ());
+	}
+
+	// input
+	const size_t start = input.size ();
+	input.resize (start + len * count);
+	for (size_t i = 0; i < len; ++i)
+	{
+		const path_t::arc_t & arc = *path[i];
+		const size_t width = arc.size ();
+		for (size_t j = 0; j < count; ++j)
+		{
+			const size_t k = j % width;
+			input[start + j * len + i] = to_le<cunit_t>(static_cast<cunit_t> (arc[k]));
+		}
+	}
+
+	// keys
+	keygen<key_t> (keys, count, len, path.len_matching (), path.match ());
+}
+
+namespace {
+
+// paths of one batch expanded into data, see note [generating skeleton data in parallel]
+template <typename cunit_t, typename key_t>
+struct shard_t
+{
+	const path_t * first;
+	const path_t * last;
+	std::vector<cunit_t> input;
+	std::vector<key_t> keys;
+
+	shard_t (const path_t * f, const path_t * l)
+		: first (f)
+		, last (l)
+		, input ()
+		, keys ()
+	{}
+
+	FORBID_COPY (shard_t);
+};
+
+template <typename cunit_t, typename key_t>
+	void * expand_shard (void * arg)
+{
+	shard_t<cunit_t, key_t> & s = *static_cast<shard_t<cunit_t, key_t> *> (arg);
+	for (const path_t * p = s.first; p != s.last; ++p)
+	{
+		cover_one<cunit_t, key_t> (s.input, s.keys, *p);
+	}
+	return NULL;
+}
+
+// collects paths in batches and writes their data to files
 template <typename cunit_t, typename key_t>
-	void Node::cover (path_t & prefix, FILE * input, FILE * keys, covers_t &size)
+class data_sink_t
+{
+	FILE * input;
+	FILE * keys;
+	const size_t jobs;
+	covers_t total;
+	std::vector<path_t> batch;
+	std::vector<uint32_t> sizes;
+	size_t batch_size;
+
+public:
+	data_sink_t (FILE * i, FILE * k, size_t j)
+		: input (i)
+		, keys (k)
+		, jobs (std::max<size_t> (j, 1))
+		, total (covers_t::from32(0u))
+		, batch ()
+		, sizes ()
+		, batch_size (0)
+	{}
+	bool stop () const
+	{
+		return total.overflow ();
+	}
+	void add (const path_t & path)
+	{
+		const covers_t size = path_size (path);
+		total = total + size;
+		if (!size.overflow ())
+		{
+			batch.push_back (path);
+			sizes.push_back (size.uint32 ());
+			batch_size += size.uint32 ();
+			if (batch_size >= BATCH * jobs)
+			{
+				flush ();
+			}
+		}
+	}
+	void flush ();
+
+	FORBID_COPY (data_sink_t);
+};
+
+template <typename cunit_t, typename key_t>
+	void data_sink_t<cunit_t, key_t>::flush ()
+{
+	if (batch.empty ())
+	{
+		return;
+	}
+
+	// split batch into shards of roughly equal size
+	const size_t nshards = std::min (jobs, batch.size ());
+	std::vector<shard_t<cunit_t, key_t> *> shards;
+	size_t done = 0, sum = 0;
+	for (size_t i = 0; i < nshards; ++i)
+	{
+		const path_t * first = &batch[0] + done;
+		const size_t limit = batch_size * (i + 1) / nshards;
+		for (; done < batch.size () && (sum < limit || i + 1 == nshards); ++done)
+		{
+			sum += sizes[done];
+		}
+		shards.push_back (new shard_t<cunit_t, key_t> (first, &batch[0] + done));
+	}
+
+#if HAVE_PTHREAD_H
+	// the calling thread expands the first shard
+	std::vector<pthread_t> threads;
+	for (size_t i = 1; i < nshards; ++i)
+	{
+		pthread_t t;
+		if (pthread_create (&t, NULL, expand_shard<cunit_t, key_t>, shards[i]) == 0)
+		{
+			threads.push_back (t);
+		}
+		else
+		{
+			expand_shard<cunit_t, key_t> (shards[i]);
+		}
+	}
+	expand_shard<cunit_t, key_t> (shards[0]);
+	for (size_t i = 0; i < threads.size (); ++i)
+	{
+		pthread_join (threads[i], NULL);
+	}
+#else
+	for (size_t i = 0; i < nshards; ++i)
+	{
+		expand_shard<cunit_t, key_t> (shards[i]);
+	}
+#endif
+
+	for (size_t i = 0; i < nshards; ++i)
+	{
+		const shard_t<cunit_t, key_t> * s = shards[i];
+		if (!s->input.empty ())
+		{
+			fwrite (&s->input[0], sizeof (cunit_t), s->input.size (), input);
+		}
+		if (!s->keys.empty ())
+		{
+			fwrite (&s->keys[0], sizeof (key_t), s->keys.size (), keys);
+		}
+		delete s;
+	}
+
+	batch.clear ();
+	sizes.clear ();
+	batch_size = 0;
+}
+
+} // anonymous namespace
+
+template <typename path_type, typename sink_t>
+	void Skeleton::cover (sink_t & sink) const
 {
-	if (end () && suffix == NULL)
+	const size_t count = nodes.size ();
+	std::vector<path_type*> suffix (count, NULL);
+	std::vector<uint8_t> loop (count, 0);
+
+	// stack of (node, next arc, prefix), see note [skeleton layout]
+	std::stack<cover_frame_t<path_type> > stack;
+	path_type prefix (nodes[0].rule, nodes[0].ctx);
+	if (end (0))
 	{
-		suffix = new path_t (rule, ctx);
+		suffix[0] = new path_type (nodes[0].rule, nodes[0].ctx);
+		prefix.append (suffix[0]);
+		sink.add (prefix);
 	}
-	if (suffix != NULL)
+	else
 	{
-		prefix.append (suffix);
-		size = size + cover_one<cunit_t, key_t> (input, keys, prefix);
+		loop[0] = 1;
+		stack.push (cover_frame_t<path_type> (0, arcs[0], prefix));
 	}
-	else if (loop < 2)
+
+	while (!stack.empty ())
 	{
-		local_inc _ (loop);
-		for (arcs_t::iterator i = arcs.begin ();
-			i != arcs.end () && !size.overflow(); ++i)
+		cover_frame_t<path_type> & f = stack.top ();
+		const size_t i = f.node;
+		const uint32_t a = f.arc++;
+		size_t j;
+		if (a == arcs[i + 1] || sink.stop ())
 		{
-			path_t new_prefix = prefix;
-			new_prefix.extend (i->first->rule, i->first->ctx, &i->second);
-			i->first->cover<cunit_t, key_t> (new_prefix, input, keys, size);
-			if (i->first->suffix != NULL && suffix == NULL)
+			// all arcs followed (or enough paths), return to parent
+			--loop[i];
+			stack.pop ();
+			if (stack.empty ())
 			{
-				suffix = new path_t (rule, ctx);
-				suffix->extend (i->first->rule, i->first->ctx, &i->second);
-				suffix->append (i->first->suffix);
+				break;
 			}
+			j = i;
+		}
+		else
+		{
+			// follow arc, either descend to child or use its suffix
+			j = targets[a];
+			const Node & n = nodes[j];
+			path_type new_prefix = f.prefix;
+			new_prefix.extend (n.rule, n.ctx, &samples[a]);
+			if (end (j) && suffix[j] == NULL)
+			{
+				suffix[j] = new path_type (n.rule, n.ctx);
+			}
+			if (suffix[j] != NULL)
+			{
+				new_prefix.append (suffix[j]);
+				sink.add (new_prefix);
+			}
+			else if (loop[j] < 2)
+			{
+				++loop[j];
+				stack.push (cover_frame_t<path_type> (j, arcs[j], new_prefix));
+				continue;
+			}
+		}
+
+		// child 'j' is done: if it has suffix, parent gets one too
+		const size_t k = stack.top ().node;
+		if (suffix[j] != NULL && suffix[k] == NULL)
+		{
+			const uint32_t b = stack.top ().arc - 1;
+			suffix[k] = new path_type (nodes[k].rule, nodes[k].ctx);
+			suffix[k]->extend (nodes[j].rule, nodes[j].ctx, &samples[b]);
+			suffix[k]->append (suffix[j]);
+		}
+	}
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		delete suffix[i];
+	}
+}
+
+// see note [sampling skeleton path cover]
+template <typename sink_t>
+	bool Skeleton::sample (sink_t & sink) const
+{
+	const size_t count = nodes.size ();
+	const size_t narcs = targets.size ();
+	const uint32_t NONE = ~0u;
+
+	std::vector<size_t> sources (narcs);
+	std::vector<uint32_t> incoming (count + 1, 0);
+	for (size_t i = 0; i < count; ++i)
+	{
+		for (uint32_t a = arcs[i]; a < arcs[i + 1]; ++a)
+		{
+			sources[a] = i;
+			++incoming[targets[a] + 1];
+		}
+	}
+
+	// shortest paths from start node: the last arc on path to each node
+	std::vector<uint32_t> pred (count, NONE);
+	std::vector<bool> reached (count, false);
+	std::vector<size_t> queue (1, 0);
+	reached[0] = true;
+	for (size_t k = 0; k < queue.size (); ++k)
+	{
+		const size_t i = queue[k];
+		for (uint32_t a = arcs[i]; a < arcs[i + 1]; ++a)
+		{
+			const size_t j = targets[a];
+			if (!reached[j])
+			{
+				reached[j] = true;
+				pred[j] = a;
+				queue.push_back (j);
+			}
+		}
+	}
+
+	// incoming arcs of each node (in the same form as outgoing arcs)
+	for (size_t i = 0; i < count; ++i)
+	{
+		incoming[i + 1] += incoming[i];
+	}
+	std::vector<uint32_t> back (narcs);
+	std::vector<uint32_t> fill (incoming.begin (), incoming.end () - 1);
+	for (uint32_t a = 0; a < narcs; ++a)
+	{
+		back[fill[targets[a]]++] = a;
+	}
+
+	// shortest paths to end nodes: the first arc on path from each node
+	std::vector<uint32_t> succ (count, NONE);
+	std::vector<bool> ending (count, false);
+	queue.clear ();
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (end (i))
+		{
+			ending[i] = true;
+			queue.push_back (i);
+		}
+	}
+	for (size_t k = 0; k < queue.size (); ++k)
+	{
+		const size_t j = queue[k];
+		for (uint32_t b = incoming[j]; b < incoming[j + 1]; ++b)
+		{
+			const uint32_t a = back[b];
+			const size_t i = sources[a];
+			if (!ending[i])
+			{
+				ending[i] = true;
+				succ[i] = a;
+				queue.push_back (i);
+			}
+		}
+	}
+
+	std::vector<bool> covered (narcs, false);
+	std::vector<uint32_t> way;
+	for (uint32_t a = 0; a < narcs && !sink.stop (); ++a)
+	{
+		if (covered[a] || !reached[sources[a]] || !ending[targets[a]])
+		{
+			continue;
+		}
+
+		way.clear ();
+		for (size_t i = sources[a]; i != 0; i = sources[pred[i]])
+		{
+			way.push_back (pred[i]);
+		}
+		std::reverse (way.begin (), way.end ());
+		way.push_back (a);
+		for (size_t j = targets[a]; !end (j); j = targets[succ[j]])
+		{
+			way.push_back (succ[j]);
+		}
+
+		path_t path (nodes[0].rule, nodes[0].ctx);
+		for (size_t k = 0; k < way.size (); ++k)
+		{
+			const uint32_t b = way[k];
+			const Node & n = nodes[targets[b]];
+			covered[b] = true;
+			path.extend (n.rule, n.ctx, &samples[b]);
 		}
+		sink.add (path);
 	}
+	return !sink.stop ();
 }
 
 template <typename cunit_t, typename key_t>
 	void Skeleton::generate_paths_cunit_key (FILE * input, FILE * keys)
 {
-	path_t prefix (nodes->rule, nodes->ctx);
-	Node::covers_t size = Node::covers_t::from32(0u);
+	data_sink_t<cunit_t, key_t> data (input, keys, opts->jobs);
 
-	nodes->cover<cunit_t, key_t> (prefix, input, keys, size);
+	// see note [sampling skeleton path cover]
+	size_sink_t size;
+	cover<path_size_t> (size);
+	if (!size.stop ())
+	{
+		cover<path_t> (data);
+		data.flush ();
+		return;
+	}
 
-	if (size.overflow ())
+	const bool complete = sample (data);
+	data.flush ();
+	if (complete)
+	{
+		warning
+			( NULL
+			, line
+			, false
+			, "DFA %sis too large: generating arc cover instead of path cover"
+			, incond (cond).c_str ()
+			);
+	}
+	else
 	{
 		warning
 			( NULL
@@ -147,69 +642,4 @@ void Skeleton::emit_data (const char * fname)
 	fclose (keys);
 }
 
-template <typename uintn_t> static uintn_t to_le(uintn_t n)
-{
-	uintn_t m;
-	uint8_t *p = reinterpret_cast<uint8_t*>(&m);
-	for (size_t i = 0; i < sizeof(uintn_t); ++i)
-	{
-		p[i] = static_cast<uint8_t>(n >> (i * 8));
-	}
-	return m;
-}
-
-template <typename key_t>
-	static void keygen (FILE * f, size_t count, size_t len, size_t len_match, rule_rank_t match)
-{
-	const key_t m = Skeleton::rule2key<key_t> (match);
-
-	const size_t keys_size = 3 * count;
-	key_t * keys = new key_t [keys_size];
-	for (uint32_t i = 0; i < keys_size;)
-	{
-		keys[i++] = to_le<key_t>(static_cast<key_t> (len));
-		keys[i++] = to_le<key_t>(static_cast<key_t> (len_match));
-		keys[i++] = to_le<key_t>(m);
-	}
-	fwrite (keys, sizeof (key_t), keys_size, f);
-	delete [] keys;
-}
-
-template <typename cunit_t, typename key_t>
-	static Node::covers_t cover_one (FILE * input, FILE * keys, const path_t & path)
-{
-	const size_t len = path.len ();
-
-	size_t count = 0;
-	for (size_t i = 0; i < len; ++i)
-	{
-		count = std::max (count, path[i]->size ());
-	}
-
-	const Node::covers_t size = Node::covers_t::from64(len) * Node::covers_t::from64(count);
-	if (!size.overflow ())
-	{
-		// input
-		const size_t buffer_size = size.uint32 ();
-		cunit_t * buffer = new cunit_t [buffer_size];
-		for (size_t i = 0; i < len; ++i)
-		{
-			const std::vector<uint32_t> & arc = *path[i];
-			const size_t width = arc.size ();
-			for (size_t j = 0; j < count; ++j)
-			{
-				const size_t k = j % width;
-				buffer[j * len + i] = to_le<cunit_t>(static_cast<cunit_t> (arc[k]));
-			}
-		}
-		fwrite (buffer, sizeof (cunit_t), buffer_size, input);
-		delete [] buffer;
-
-		// keys
-		keygen<key_t> (keys, count, len, path.len_matching (), path.match ());
-	}
-
-	return size;
-}
-
 } // namespace re2c
@@ -13,21 +13,21 @@ namespace re2c
 
 void Skeleton::warn_match_empty ()
 {
-	Node & head = nodes[0];
+	const Node & head = nodes[0];
 
-	head.calc_reachable ();
-	const std::set<rule_t> & reach = head.reachable;
+	calc_reachable ();
+	const std::set<rule_t> & reach = reachable[0];
 
 	// warn about rules that match empty string
 	if (!head.rule.rank.is_none ())
 	{
-		bool reachable = head.end ();
+		bool empty = end (0);
 		for (std::set<rule_t>::const_iterator i = reach.begin ();
-			!reachable && i != reach.end (); ++i)
+			!empty && i != reach.end (); ++i)
 		{
-			reachable |= i->rank.is_none ();
+			empty |= i->rank.is_none ();
 		}
-		if (reachable)
+		if (empty)
 		{
 			warn.match_empty_string (rules[head.rule.rank].line);
 		}
@@ -1,8 +1,9 @@
 #include "src/util/c99_stdint.h"
 #include <algorithm>
 #include <limits>
-#include <map>
+#include <stack>
 #include <utility>
+#include <vector>
 
 #include "src/ir/skeleton/skeleton.h"
 
@@ -10,41 +11,71 @@ namespace re2c
 {
 
 // 0 < DIST_MAX < DIST_ERROR <= std::numeric_limits<uint32_t>::max()
-const uint32_t Node::DIST_ERROR = std::numeric_limits<uint32_t>::max();
-const uint32_t Node::DIST_MAX = DIST_ERROR - 1;
+const uint32_t Skeleton::DIST_ERROR = std::numeric_limits<uint32_t>::max();
+const uint32_t Skeleton::DIST_MAX = DIST_ERROR - 1;
 
 // different from YYMAXFILL calculation
 // in the way it handles loops and empty regexp
-void Node::calc_dist ()
+uint32_t Skeleton::calc_maxlen () const
 {
-	if (dist != DIST_ERROR)
+	if (end (0))
 	{
-		return;
+		return 0;
 	}
-	else if (end ())
-	{
-		dist = 0;
-	}
-	else if (loop < 2)
+
+	const size_t size = nodes.size ();
+	std::vector<uint32_t> dist (size, DIST_ERROR);
+	std::vector<uint8_t> loop (size, 0);
+
+	// stack of (node, next arc), see note [skeleton layout]
+	std::stack<std::pair<size_t, uint32_t> > stack;
+	loop[0] = 1;
+	stack.push (std::make_pair (0, arcs[0]));
+	while (!stack.empty ())
 	{
-		local_inc _ (loop);
-		for (arcs_t::iterator i = arcs.begin (); i != arcs.end (); ++i)
+		const size_t i = stack.top ().first;
+		const uint32_t a = stack.top ().second++;
+		size_t j;
+		if (a == arcs[i + 1])
 		{
-			i->first->calc_dist ();
-			if (i->first->dist != DIST_ERROR)
+			// all arcs followed, return to parent
+			dist[i] = std::min (dist[i] + 1, DIST_MAX);
+			--loop[i];
+			stack.pop ();
+			if (stack.empty ())
 			{
-				if (dist == DIST_ERROR)
+				break;
+			}
+			j = i;
+		}
+		else
+		{
+			// follow arc, either descend to child or take its distance
+			j = targets[a];
+			if (dist[j] == DIST_ERROR)
+			{
+				if (end (j))
 				{
-					dist = i->first->dist;
+					dist[j] = 0;
 				}
-				else
+				else if (loop[j] < 2)
 				{
-					dist = std::max (dist, i->first->dist);
+					++loop[j];
+					stack.push (std::make_pair (j, arcs[j]));
+					continue;
 				}
 			}
 		}
-		dist = std::min (dist + 1, DIST_MAX);
+
+		uint32_t & d = dist[stack.top ().first];
+		if (dist[j] != DIST_ERROR)
+		{
+			d = d == DIST_ERROR
+				? dist[j]
+				: std::max (d, dist[j]);
+		}
 	}
+	return dist[0];
 }
 
 } // namespace re2c
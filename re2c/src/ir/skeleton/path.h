@@ -5,6 +5,7 @@
 
 #include "src/ir/rule_rank.h"
 #include "src/util/c99_stdint.h"
+#include "src/util/slice.h"
 
 namespace re2c
 {
@@ -31,7 +32,8 @@ struct rule_t
 class path_t
 {
 public:
-	typedef std::vector<uint32_t> arc_t;
+	// sample code units of skeleton arc (owned by skeleton)
+	typedef slice_t<uint32_t> arc_t;
 
 private:
 	std::vector<const arc_t *> arcs;
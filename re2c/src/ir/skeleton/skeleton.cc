@@ -1,9 +1,7 @@
-#include <stdlib.h>
 #include <algorithm>
 #include <utility>
 
 #include "src/codegen/go.h"
-#include "src/conf/msg.h"
 #include "src/ir/dfa/dfa.h"
 #include "src/ir/regexp/regexp.h"
 #include "src/ir/regexp/regexp_rule.h"
@@ -13,62 +11,10 @@ namespace re2c
 {
 
 Node::Node ()
-	: arcs ()
-	, arcsets ()
-	, loop (0)
-	, rule (rule_rank_t::none (), false)
+	: rule (rule_rank_t::none (), false)
 	, ctx (false)
-	, dist (DIST_ERROR)
-	, reachable ()
-	, suffix (NULL)
 {}
 
-void Node::init(bool c, RuleOp *r, const std::vector<std::pair<Node*, uint32_t> > &a)
-{
-	if (r)
-	{
-		rule.rank = r->rank;
-		rule.restorectx = r->ctx->fixedLength () != 0;
-	}
-
-	ctx = c;
-
-	uint32_t lb = 0;
-	std::vector<std::pair<Node*, uint32_t> >::const_iterator
-		i = a.begin(),
-		e = a.end();
-	for (; i != e; ++i)
-	{
-		Node *n = i->first;
-		const uint32_t ub = i->second - 1;
-
-		// pick at most 0x100 unique edges from this range
-		// (for 1-byte code units this covers the whole range: [0 - 0xFF])
-		//   - range bounds must be included
-		//   - values should be evenly distributed
-		//   - values should be deterministic
-		const uint32_t step = 1 + (ub - lb) / 0x100;
-		for (uint32_t c = lb; c < ub; c += step)
-		{
-			arcs[n].push_back (c);
-		}
-		arcs[n].push_back (ub);
-
-		arcsets[n].push_back (std::make_pair (lb, ub));
-		lb = ub + 1;
-	}
-}
-
-Node::~Node ()
-{
-	delete suffix;
-}
-
-bool Node::end () const
-{
-	return arcs.size () == 0;
-}
-
 Skeleton::Skeleton
 	( const dfa_t &dfa
 	, const charset_t &cs
@@ -81,44 +27,103 @@ Skeleton::Skeleton
 	, cond (dfa_cond)
 	, line (dfa_line)
 	, nodes_count (dfa.states.size())
-	, nodes (new Node [nodes_count + 1]) // +1 for default state
+	, nodes (nodes_count + 1) // +1 for default state
+	, arcs ()
+	, targets ()
+	, samples ()
+	, ranges ()
+	, sample_units ()
+	, range_units ()
 	, sizeof_key (4)
 	, rules (rs)
+	, too_long (false)
+	, reachable ()
 {
 	const size_t nc = cs.size() - 1;
+	const uint32_t nil = static_cast<uint32_t> (nodes_count);
 
-	// initialize skeleton nodes
-	Node *nil = &nodes[nodes_count];
+	// initialize skeleton nodes and arcs
+	std::vector<uint32_t> sample_offs (1, 0), range_offs (1, 0);
+	std::vector<std::pair<uint32_t, std::pair<uint32_t, uint32_t> > > to_ranges;
 	for (size_t i = 0; i < nodes_count; ++i)
 	{
 		dfa_state_t *s = dfa.states[i];
-		std::vector<std::pair<Node*, uint32_t> > arcs;
+		Node &node = nodes[i];
+		if (s->rule)
+		{
+			node.rule.rank = s->rule->rank;
+			node.rule.restorectx = s->rule->ctx->fixedLength () != 0;
+		}
+		node.ctx = s->ctx;
+		arcs.push_back (static_cast<uint32_t> (targets.size ()));
+
+		// pairs (target node, range), ordered by target
+		to_ranges.clear ();
 		for (size_t c = 0; c < nc;)
 		{
 			const size_t j = s->arcs[c];
+			const uint32_t lb = cs[c];
 			for (;++c < nc && s->arcs[c] == j;);
-			Node *to = j == dfa_t::NIL
+			const uint32_t to = j == dfa_t::NIL
 				? nil
-				: &nodes[j];
-			arcs.push_back(std::make_pair(to, cs[c]));
+				: static_cast<uint32_t> (j);
+			to_ranges.push_back (std::make_pair (to, std::make_pair (lb, cs[c] - 1)));
 		}
 		// all arcs go to default node => this node is final, drop arcs
-		if (arcs.size() == 1 && arcs[0].first == nil)
+		if (to_ranges.size () == 1 && to_ranges[0].first == nil)
 		{
-			arcs.clear();
+			continue;
 		}
-		nodes[i].init(s->ctx, s->rule, arcs);
-	}
+		std::sort (to_ranges.begin (), to_ranges.end ());
 
-	// calculate maximal path length, check overflow
-	nodes->calc_dist ();
-	const uint32_t maxlen = nodes->dist;
-	if (maxlen == Node::DIST_MAX)
+		for (size_t k = 0; k < to_ranges.size (); ++k)
+		{
+			const uint32_t to = to_ranges[k].first;
+			const uint32_t lb = to_ranges[k].second.first;
+			const uint32_t ub = to_ranges[k].second.second;
+
+			// pick at most 0x100 unique edges from this range
+			// (for 1-byte code units this covers the whole range: [0 - 0xFF])
+			//   - range bounds must be included
+			//   - values should be evenly distributed
+			//   - values should be deterministic
+			const uint32_t step = 1 + (ub - lb) / 0x100;
+			for (uint32_t c = lb; c < ub; c += step)
+			{
+				sample_units.push_back (c);
+			}
+			sample_units.push_back (ub);
+			range_units.push_back (std::make_pair (lb, ub));
+
+			// ranges to the same node make one arc
+			if (k + 1 == to_ranges.size () || to_ranges[k + 1].first != to)
+			{
+				targets.push_back (to);
+				sample_offs.push_back (static_cast<uint32_t> (sample_units.size ()));
+				range_offs.push_back (static_cast<uint32_t> (range_units.size ()));
+			}
+		}
+	}
+	// default node has no arcs
+	arcs.push_back (static_cast<uint32_t> (targets.size ()));
+	arcs.push_back (static_cast<uint32_t> (targets.size ()));
+
+	// flat arrays are complete: now it is safe to point into them
+	const size_t narcs = targets.size ();
+	samples.reserve (narcs);
+	ranges.reserve (narcs);
+	for (size_t i = 0; i < narcs; ++i)
 	{
-		error ("DFA path %sis too long", incond (cond).c_str ());
-		exit (1);
+		samples.push_back (path_t::arc_t (&sample_units[sample_offs[i]]
+			, sample_offs[i + 1] - sample_offs[i]));
+		ranges.push_back (way_arc_t (&range_units[range_offs[i]]
+			, range_offs[i + 1] - range_offs[i]));
 	}
 
+	// calculate maximal path length, check overflow
+	const uint32_t maxlen = calc_maxlen ();
+	too_long = maxlen == DIST_MAX;
+
 	// calculate maximal rule rank (disregarding default and none rules)
 	uint32_t maxrule = 0;
 	for (uint32_t i = 0; i < nodes_count; ++i)
@@ -144,9 +149,11 @@ Skeleton::Skeleton
 	}
 }
 
-Skeleton::~Skeleton ()
+Skeleton::~Skeleton () {}
+
+bool Skeleton::end (size_t i) const
 {
-	delete [] nodes;
+	return arcs[i] == arcs[i + 1];
 }
 
 uint32_t Skeleton::rule2key (rule_rank_t r) const
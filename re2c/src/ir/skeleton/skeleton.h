@@ -16,94 +16,78 @@
 #include "src/ir/skeleton/path.h"
 #include "src/ir/skeleton/way.h"
 #include "src/parse/rules.h"
-#include "src/util/local_increment.h"
 #include "src/util/forbid_copy.h"
 #include "src/util/u32lim.h"
 
 namespace re2c
 {
 
+class bitmaps_t;
 struct dfa_t;
 struct OutputFile;
 class RuleOp;
 
+/*
+ * note [counting skeleton edges]
+ *
+ * To avoid any possible overflows all size calculations are wrapped in
+ * a special truncated unsigned 32-bit integer type that checks overflow
+ * on each binary operation or conversion from another type.
+ *
+ * Two things contribute to size calculation: path length and the number
+ * of outgoing arcs in each node. Some considerations on why these values
+ * will not overflow before they are converted to truncated type:
+ *
+ *   - Maximal number of outgoing arcs in each node cannot exceed 32 bits:
+ *     it is bounded by the number of code units in current encoding, and
+ *     re2c doesn't support any encoding with more than 2^32 code units.
+ *     Conversion is safe.
+ *
+ *   - Maximal path length cannot exceed 32 bits: we estimate it right
+ *     after skeleton construction and check for overflow. If path length
+ *     does overflow, an error is reported and re2c aborts.
+ */
+
+// Type for calculating the size of path cover.
+// Paths are dumped to file as soon as generated and don't eat
+// heap space. The total size of path cover (measured in edges)
+// is O(N^2) where N is the number of edges in skeleton.
+typedef u32lim_t<1024 * 1024 * 1024> covers_t; // ~1Gb
+
+// Type for counting arcs in paths that cause undefined behaviour.
+// These paths are stored on heap, so the limit should be low.
+// Most real-world cases have only a few short paths.
+// We don't need all paths anyway, just some examples.
+typedef u32lim_t<1024> nakeds_t; // ~1Kb
+
 struct Node
 {
-	/*
-	 * note [counting skeleton edges]
-	 *
-	 * To avoid any possible overflows all size calculations are wrapped in
-	 * a special truncated unsigned 32-bit integer type that checks overflow
-	 * on each binary operation or conversion from another type.
-	 *
-	 * Two things contribute to size calculation: path length and the number
-	 * of outgoing arcs in each node. Some considerations on why these values
-	 * will not overflow before they are converted to truncated type:
-	 *
-	 *   - Maximal number of outgoing arcs in each node cannot exceed 32 bits:
-	 *     it is bounded by the number of code units in current encoding, and
-	 *     re2c doesn't support any encoding with more than 2^32 code units.
-	 *     Conversion is safe.
-	 *
-	 *   - Maximal path length cannot exceed 32 bits: we estimate it right
-	 *     after skeleton construction and check for overflow. If path length
-	 *     does overflow, an error is reported and re2c aborts.
-	 */
-
-	// Type for calculating the size of path cover.
-	// Paths are dumped to file as soon as generated and don't eat
-	// heap space. The total size of path cover (measured in edges)
-	// is O(N^2) where N is the number of edges in skeleton.
-	typedef u32lim_t<1024 * 1024 * 1024> covers_t; // ~1Gb
-
-	// Type for counting arcs in paths that cause undefined behaviour.
-	// These paths are stored on heap, so the limit should be low.
-	// Most real-world cases have only a few short paths.
-	// We don't need all paths anyway, just some examples.
-	typedef u32lim_t<1024> nakeds_t; // ~1Kb
-
-	typedef std::map<Node *, path_t::arc_t> arcs_t;
-	typedef std::map<Node *, way_arc_t> arcsets_t;
-	typedef local_increment_t<uint8_t> local_inc;
-
-	// outgoing arcs
-	arcs_t arcs;
-	arcsets_t arcsets;
-
-	// how many times this node has been visited
-	// (controls looping in graph traversals)
-	uint8_t loop;
-
 	// rule for corresponding DFA state (if any)
 	rule_t rule;
 
 	// start of trailing context
 	bool ctx;
 
-	// maximal distance to end node (assuming one iteration per loop)
-	static const uint32_t DIST_ERROR;
-	static const uint32_t DIST_MAX;
-	uint32_t dist;
-
-	// rules reachable from this node (including absent rule)
-	std::set<rule_t> reachable;
-
-	// path to end node (for constructing path cover)
-	path_t * suffix;
-
 	Node ();
-	void init(bool b, RuleOp *r, const std::vector<std::pair<Node*, uint32_t> > &arcs);
-	~Node ();
-	bool end () const;
-	void calc_dist ();
-	void calc_reachable ();
-	template <typename cunit_t, typename key_t>
-		void cover (path_t & prefix, FILE * input, FILE * keys, covers_t &size);
-	void naked_ways (way_t & prefix, std::vector<way_t> & ways, nakeds_t &size);
-
-	FORBID_COPY (Node);
 };
 
+/*
+ * note [skeleton layout]
+ *
+ * Skeleton is stored in compressed sparse row form: outgoing arcs of
+ * node 'i' are arcs '[arcs[i] .. arcs[i + 1])', ordered by target node.
+ * All ranges of DFA transitions that lead to the same node are merged
+ * into one arc. For each arc we store target node, sample code units
+ * (used to generate data for '--skeleton') and code unit ranges (used
+ * to report undefined control flow); samples and ranges of all arcs
+ * are kept in two flat arrays. There is one extra node (the last one)
+ * which stands for default state.
+ *
+ * Graph traversals are iterative: each of them keeps an explicit stack
+ * of (node, next arc) frames, so deep DFA don't overflow native stack.
+ * Loops are cut by per-node loop counter: a node may be on stack at
+ * most twice (one iteration per loop).
+ */
 struct Skeleton
 {
 	const std::string name;
@@ -111,10 +95,30 @@ struct Skeleton
 	const uint32_t line;
 
 	const size_t nodes_count;
-	Node * nodes;
+	std::vector<Node> nodes; // +1 for default state
+
+	// see note [skeleton layout]
+	std::vector<uint32_t> arcs; // +1 past the last node
+	std::vector<uint32_t> targets;
+	std::vector<path_t::arc_t> samples;
+	std::vector<way_arc_t> ranges;
+	std::vector<uint32_t> sample_units;
+	std::vector<std::pair<uint32_t, uint32_t> > range_units;
+
+	// maximal distance to end node (assuming one iteration per loop)
+	static const uint32_t DIST_ERROR;
+	static const uint32_t DIST_MAX;
+
 	size_t sizeof_key;
 	rules_t rules;
 
+	// some path is longer than DIST_MAX: skeleton is unusable, the
+	// error is reported by the caller (see note [compiling conditions in parallel])
+	bool too_long;
+
+	// rules reachable from each node (including absent rule)
+	std::vector<std::set<rule_t> > reachable;
+
 	Skeleton
 		( const dfa_t &dfa
 		, const charset_t &cs
@@ -135,6 +139,7 @@ struct Skeleton
 		, bool backup
 		, bool backupctx
 		, bool accept
+		, const bitmaps_t & bitmaps
 		) const;
 	void emit_end
 		( OutputFile & o
@@ -148,6 +153,18 @@ struct Skeleton
 	uint32_t rule2key (rule_rank_t r) const;
 
 private:
+	bool end (size_t i) const;
+	void emit_check_start (OutputFile & o, size_t maxfill) const;
+	void emit_check_end (OutputFile & o) const;
+	void emit_bench_start (OutputFile & o, size_t maxfill) const;
+	void emit_bench_end (OutputFile & o) const;
+	uint32_t calc_maxlen () const;
+	void calc_reachable ();
+	void naked_ways (std::vector<way_t> & ways, nakeds_t & size) const;
+	template <typename path_type, typename sink_t>
+		void cover (sink_t & sink) const;
+	template <typename sink_t>
+		bool sample (sink_t & sink) const;
 	template <typename cunit_t, typename key_t>
 		void generate_paths_cunit_key (FILE * input, FILE * keys);
 	template <typename cunit_t>
@@ -1,7 +1,9 @@
 #include "src/util/c99_stdint.h"
 #include <map>
 #include <set>
+#include <stack>
 #include <utility>
+#include <vector>
 
 #include "src/conf/warn.h"
 #include "src/globals.h"
@@ -13,34 +15,74 @@
 namespace re2c
 {
 
-void Node::calc_reachable ()
+void Skeleton::calc_reachable ()
 {
 	if (!reachable.empty ())
 	{
 		return;
 	}
-	else if (end ())
+
+	const size_t size = nodes.size ();
+	reachable.resize (size);
+	if (end (0))
 	{
-		reachable.insert (rule);
+		reachable[0].insert (nodes[0].rule);
+		return;
 	}
-	else if (loop < 2)
+
+	std::vector<uint8_t> loop (size, 0);
+
+	// stack of (node, next arc), see note [skeleton layout]
+	std::stack<std::pair<size_t, uint32_t> > stack;
+	loop[0] = 1;
+	stack.push (std::make_pair (0, arcs[0]));
+	while (!stack.empty ())
 	{
-		local_inc _ (loop);
-		for (arcs_t::iterator i = arcs.begin (); i != arcs.end (); ++i)
+		const size_t i = stack.top ().first;
+		const uint32_t a = stack.top ().second++;
+		size_t j;
+		if (a == arcs[i + 1])
 		{
-			i->first->calc_reachable ();
-			reachable.insert (i->first->reachable.begin (), i->first->reachable.end ());
+			// all arcs followed, return to parent
+			--loop[i];
+			stack.pop ();
+			if (stack.empty ())
+			{
+				break;
+			}
+			j = i;
 		}
+		else
+		{
+			// follow arc, either descend to child or take its rules
+			j = targets[a];
+			if (reachable[j].empty ())
+			{
+				if (end (j))
+				{
+					reachable[j].insert (nodes[j].rule);
+				}
+				else if (loop[j] < 2)
+				{
+					++loop[j];
+					stack.push (std::make_pair (j, arcs[j]));
+					continue;
+				}
+			}
+		}
+
+		std::set<rule_t> & r = reachable[stack.top ().first];
+		r.insert (reachable[j].begin (), reachable[j].end ());
 	}
 }
 
 void Skeleton::warn_unreachable_rules ()
 {
-	nodes->calc_reachable ();
+	calc_reachable ();
 	for (uint32_t i = 0; i < nodes_count; ++i)
 	{
 		const rule_rank_t r1 = nodes[i].rule.rank;
-		const std::set<rule_t> & rs = nodes[i].reachable;
+		const std::set<rule_t> & rs = reachable[i];
 		for (std::set<rule_t>::const_iterator j = rs.begin (); j != rs.end (); ++j)
 		{
 			const rule_rank_t r2 = j->rank;
@@ -6,10 +6,13 @@
 #include <utility>
 #include <vector>
 
+#include "src/util/slice.h"
+
 namespace re2c
 {
 
-typedef std::vector<std::pair<uint32_t, uint32_t> > way_arc_t;
+// code unit ranges of skeleton arc (owned by skeleton)
+typedef slice_t<std::pair<uint32_t, uint32_t> > way_arc_t;
 typedef std::vector<const way_arc_t *> way_t;
 
 bool cmp_ways (const way_t & w1, const way_t & w2);
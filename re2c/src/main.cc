@@ -13,7 +13,6 @@
 namespace re2c
 {
 
-bool bUsedYYBitmap  = false;
 bool bWroteGetState = false;
 bool bWroteCondCheck = false;
 uint32_t last_fill_index = 0;
@@ -32,6 +31,15 @@ int main(int, char *argv[])
 		case EXIT_FAIL: return 1;
 	}
 
+	if (opts->profile_file && !profile.load (opts->profile_file))
+	{
+		return 1;
+	}
+	if (opts->char_freq_model && !char_freq.load (opts->char_freq_model))
+	{
+		return 1;
+	}
+
 	// set up the source stream
 	re2c::Input input (opts.source_file);
 	if (!input.open ())
@@ -56,5 +64,11 @@ int main(int, char *argv[])
 	Scanner scanner (input, output.source);
 	parse (scanner, output);
 
+	if (opts->stats_file && !report.write (opts->stats_file, opts.source_file))
+	{
+		error ("cannot write statistics file: %s", opts->stats_file);
+		return 1;
+	}
+
 	return warn.error () ? 1 : 0;
 }
@@ -1,6 +1,9 @@
 #ifndef _RE2C_PARSE_SPEC_
 #define _RE2C_PARSE_SPEC_
 
+#include <vector>
+
+#include "src/ir/keywords/keywords.h"
 #include "src/ir/regexp/regexp_rule.h"
 #include "src/parse/rules.h"
 
@@ -11,19 +14,27 @@ struct Spec
 {
 	RegExp * re;
 	rules_t rules;
+	std::vector<RuleOp *> ruleops; // in order of addition
+	std::vector<keywords_t> keywords;
 
 	Spec ()
 		: re (NULL)
 		, rules ()
+		, ruleops ()
+		, keywords ()
 	{}
 	Spec (const Spec & spec)
 		: re (spec.re)
 		, rules (spec.rules)
+		, ruleops (spec.ruleops)
+		, keywords (spec.keywords)
 	{}
 	Spec & operator = (const Spec & spec)
 	{
 		re = spec.re;
 		rules = spec.rules;
+		ruleops = spec.ruleops;
+		keywords = spec.keywords;
 		return *this;
 	}
 	bool add_def (RuleOp * r)
@@ -41,12 +52,15 @@ struct Spec
 	void add (RuleOp * r)
 	{
 		rules[r->rank].line = r->loc.line;
+		ruleops.push_back (r);
 		re = mkAlt (re, r);
 	}
 	void clear ()
 	{
 		re = NULL;
 		rules.clear ();
+		ruleops.clear ();
+		keywords.clear ();
 	}
 };
 
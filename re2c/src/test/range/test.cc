@@ -79,7 +79,7 @@ static int32_t test ()
 			re2c::Range * r2 = range<BITS> (j);
 			ok |= diff (r1, r2, add<BITS> (i, j), re2c::Range::add (r1, r2), "U");
 			ok |= diff (r1, r2, sub<BITS> (i, j), re2c::Range::sub (r1, r2), "D");
-			re2c::Range::vFreeList.clear ();
+			re2c::Range::arena.clear ();
 		}
 	}
 
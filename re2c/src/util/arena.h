@@ -0,0 +1,86 @@
+#ifndef _RE2C_UTIL_ARENA_
+#define _RE2C_UTIL_ARENA_
+
+#include <stddef.h> // size_t
+#include <vector>
+
+#include "src/util/forbid_copy.h"
+#include "src/util/slab_allocator.h"
+
+namespace re2c
+{
+
+/*
+ * Arena for objects that live as long as one parse/compile unit
+ * (regexp AST nodes, character ranges, range suffixes).
+ *
+ * Memory is bump-allocated from slabs and released all at once
+ * on clear(); objects are never deleted individually. Classes
+ * that use the arena overload operator new to allocate from it
+ * and make operator delete a no-op.
+ *
+ * Objects with non-trivial destructors must be registered with
+ * 'track' (usually from the constructor of the base class, so
+ * that T has a virtual destructor): clear() runs destructors of
+ * tracked objects before releasing memory. Trivially destructible
+ * objects need no bookkeeping at all.
+ */
+template<class T>
+class arena_t
+{
+	slab_allocator_t<> slab;
+	std::vector<T*> tracked;
+	size_t peak;
+
+public:
+	arena_t()
+		: slab()
+		, tracked()
+		, peak(0)
+	{}
+
+	~arena_t()
+	{
+		clear();
+	}
+
+	void *alloc(size_t size)
+	{
+		return slab.alloc(size);
+	}
+
+	void track(T *p)
+	{
+		tracked.push_back(p);
+	}
+
+	// bytes allocated since the last clear()
+	size_t size() const
+	{
+		return slab.size();
+	}
+
+	// the largest size() ever reached (survives clear())
+	size_t peak_size() const
+	{
+		return peak > slab.size() ? peak : slab.size();
+	}
+
+	void clear()
+	{
+		peak = peak_size();
+		for (typename std::vector<T*>::const_iterator i = tracked.begin();
+			i != tracked.end(); ++i)
+		{
+			(*i)->~T();
+		}
+		tracked.clear();
+		slab.clear();
+	}
+
+	FORBID_COPY(arena_t);
+};
+
+} // namespace re2c
+
+#endif // _RE2C_UTIL_ARENA_
@@ -2,78 +2,128 @@
 #define _RE2C_UTIL_ORD_HASH_SET_
 
 #include "src/util/c99_stdint.h"
-#include <stdlib.h> // malloc, free
-#include <string.h> // memcpy
-#include <map>
+#include <stddef.h> // offsetof
+#include <string.h> // memcpy, memcmp
+#include <time.h>
 #include <vector>
 
+#include "src/util/forbid_copy.h"
+#include "src/util/slab_allocator.h"
+
 namespace re2c
 {
 
 /*
  * ordered hash set:
  *   - access element by index: O(1)
- *   - insert element (find existing or add new): O(log(n))
+ *   - insert element (find existing or add new): O(1) on average
  *
+ * Elements are copied into a slab arena and never move, so
+ * pointers obtained with 'deref' stay valid until the set dies.
+ * Lookup is done in an open-addressing table (linear probing,
+ * power-of-two capacity) that stores element indices together
+ * with cached hashes: most mismatches are rejected without
+ * touching element data.
  */
 class ord_hash_set_t
 {
+	typedef uint64_t hash_t;
+
 	struct elem_t
 	{
-		elem_t *next;
-		size_t index;
+		hash_t hash;
 		size_t size;
 		char data[1]; // inlined array of variable length
 	};
-	typedef size_t hash_t;
 
+	struct slot_t
+	{
+		hash_t hash;
+		size_t index; // 'EMPTY' if slot is unused
+	};
+
+	static const size_t EMPTY = ~static_cast<size_t>(0);
+	static const size_t INIT_CAPACITY = 1024;
+
+	slab_allocator_t<> arena;
 	std::vector<elem_t*> elems;
-	std::map<hash_t, elem_t*> lookup;
+	std::vector<slot_t> table;
+	size_t mask;
+	uint64_t nlookups;
+	uint64_t nprobes;
+#ifdef RE2C_DEBUG
+	clock_t ntime; // time spent in 'insert'
+#endif
 
 	static hash_t hash(const void *data, size_t size);
-	elem_t *make_elem(elem_t *next, size_t index, size_t size, const void *data);
+	void grow();
+	size_t find_or_add(const void *data, size_t size);
 
 public:
 	ord_hash_set_t();
-	~ord_hash_set_t();
 	size_t size() const;
 	size_t insert(const void *data, size_t size);
 	template<typename data_t> size_t deref(size_t i, data_t *&data);
+	uint64_t lookups() const { return nlookups; }
+	uint64_t probes() const { return nprobes; }
+#ifdef RE2C_DEBUG
+	clock_t time() const { return ntime; }
+#endif
+
+	FORBID_COPY(ord_hash_set_t);
 };
 
+/*
+ * Word-at-a-time hash: input is consumed in 8-byte words
+ * (read with 'memcpy', so alignment doesn't matter), the tail
+ * is packed into one more word. Each word is mixed in with
+ * multiply-rotate, the result gets a final avalanche so that
+ * low bits (used for table index) depend on all input bits.
+ */
 ord_hash_set_t::hash_t ord_hash_set_t::hash(const void *data, size_t size)
 {
-	const uint8_t *bytes = static_cast<const uint8_t*>(data);
-	hash_t h = size; // seed
-	for (size_t i = 0; i < size; ++i)
+	static const uint64_t K = UINT64_C(0x9e3779b97f4a7c15);
+	const char *p = static_cast<const char*>(data);
+	const char *e = p + size;
+	hash_t h = static_cast<hash_t>(size) * K;
+	uint64_t w;
+
+	for (; e - p >= 8; p += 8)
 	{
-		h = h ^ ((h << 5) + (h >> 2) + bytes[i]);
+		memcpy(&w, p, 8);
+		w *= K;
+		h ^= (w << 31) | (w >> 33);
+		h = ((h << 27) | (h >> 37)) * 5 + 0x52dce729;
+	}
+	if (p != e)
+	{
+		w = 0;
+		memcpy(&w, p, static_cast<size_t>(e - p));
+		w *= K;
+		h ^= (w << 31) | (w >> 33);
 	}
-	return h;
-}
 
-ord_hash_set_t::elem_t* ord_hash_set_t::make_elem(
-	elem_t *next,
-	size_t index,
-	size_t size,
-	const void *data)
-{
-	elem_t *e = static_cast<elem_t*>(malloc(offsetof(elem_t, data) + size));
-	e->next = next;
-	e->index = index;
-	e->size = size;
-	memcpy(e->data, data, size);
-	return e;
+	h ^= h >> 33;
+	h *= UINT64_C(0xff51afd7ed558ccd);
+	h ^= h >> 33;
+	h *= UINT64_C(0xc4ceb9fe1a85ec53);
+	h ^= h >> 33;
+	return h;
 }
 
 ord_hash_set_t::ord_hash_set_t()
-	: elems()
-	, lookup()
-{}
-
-ord_hash_set_t::~ord_hash_set_t()
+	: arena()
+	, elems()
+	, table()
+	, mask(INIT_CAPACITY - 1)
+	, nlookups(0)
+	, nprobes(0)
+#ifdef RE2C_DEBUG
+	, ntime(0)
+#endif
 {
-	std::for_each(elems.begin(), elems.end(), free);
+	const slot_t empty = {0, EMPTY};
+	table.resize(INIT_CAPACITY, empty);
 }
 
 size_t ord_hash_set_t::size() const
@@ -81,25 +131,69 @@ size_t ord_hash_set_t::size() const
 	return elems.size();
 }
 
+void ord_hash_set_t::grow()
+{
+	const slot_t empty = {0, EMPTY};
+	const size_t capacity = 2 * table.size();
+	table.assign(capacity, empty);
+	mask = capacity - 1;
+	for (size_t i = 0; i < elems.size(); ++i)
+	{
+		const hash_t h = elems[i]->hash;
+		size_t j = static_cast<size_t>(h) & mask;
+		for (; table[j].index != EMPTY; j = (j + 1) & mask);
+		table[j].hash = h;
+		table[j].index = i;
+	}
+}
+
 size_t ord_hash_set_t::insert(const void *data, size_t size)
+{
+#ifdef RE2C_DEBUG
+	const clock_t start = clock();
+	const size_t index = find_or_add(data, size);
+	ntime += clock() - start;
+	return index;
+#else
+	return find_or_add(data, size);
+#endif
+}
+
+size_t ord_hash_set_t::find_or_add(const void *data, size_t size)
 {
 	const hash_t h = hash(data, size);
 
-	std::map<hash_t, elem_t*>::const_iterator i = lookup.find(h);
-	if (i != lookup.end())
+	++nlookups;
+	size_t j = static_cast<size_t>(h) & mask;
+	for (; table[j].index != EMPTY; j = (j + 1) & mask)
 	{
-		for (elem_t *e = i->second; e; e = e->next)
+		++nprobes;
+		const slot_t &s = table[j];
+		if (s.hash == h)
 		{
+			const elem_t *e = elems[s.index];
 			if (e->size == size
 				&& memcmp(e->data, data, size) == 0)
 			{
-				return e->index;
+				return s.index;
 			}
 		}
 	}
 
 	const size_t index = elems.size();
-	elems.push_back(lookup[h] = make_elem(lookup[h], index, size, data));
+	elem_t *e = static_cast<elem_t*>(arena.alloc(offsetof(elem_t, data) + size));
+	e->hash = h;
+	e->size = size;
+	memcpy(e->data, data, size);
+	elems.push_back(e);
+	table[j].hash = h;
+	table[j].index = index;
+
+	// keep load factor below 1/2
+	if (2 * elems.size() > table.size())
+	{
+		grow();
+	}
 	return index;
 }
 
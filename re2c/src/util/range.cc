@@ -3,7 +3,7 @@
 namespace re2c
 {
 
-free_list<Range*> Range::vFreeList;
+arena_t<Range> Range::arena;
 
 void Range::append_overlapping (Range * & head, Range * & tail, const Range * r)
 {
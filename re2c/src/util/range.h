@@ -3,11 +3,11 @@
 
 #include "src/util/c99_stdint.h"
 #include <assert.h>
-#include <stddef.h> // NULL
+#include <stddef.h> // NULL, size_t
 
 #include "src/test/range/test.h"
+#include "src/util/arena.h"
 #include "src/util/forbid_copy.h"
-#include "src/util/free_list.h"
 
 namespace re2c
 {
@@ -15,7 +15,7 @@ namespace re2c
 class Range
 {
 public:
-	static free_list<Range*> vFreeList;
+	static arena_t<Range> arena;
 
 private:
 	Range * nx;
@@ -32,10 +32,11 @@ public:
 	{
 		return new Range (NULL, l, u);
 	}
-	~Range ()
+	static void * operator new (size_t size)
 	{
-		vFreeList.erase (this);
+		return arena.alloc (size);
 	}
+	static void operator delete (void *) {}
 	Range * next () const { return nx; }
 	uint32_t lower () const { return lb; }
 	uint32_t upper () const { return ub; }
@@ -49,7 +50,6 @@ private:
 		, ub (u)
 	{
 		assert (lb < ub);
-		vFreeList.insert (this);
 	}
 	static void append_overlapping (Range * & head, Range * & tail, const Range * r);
 	static void append (Range ** & ptail, uint32_t l, uint32_t u);
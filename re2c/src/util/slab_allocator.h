@@ -0,0 +1,85 @@
+#ifndef _RE2C_UTIL_SLAB_ALLOCATOR_
+#define _RE2C_UTIL_SLAB_ALLOCATOR_
+
+#include <stdlib.h> // malloc, free
+#include <algorithm> // std::for_each
+#include <vector>
+
+#include "src/util/forbid_copy.h"
+
+namespace re2c
+{
+
+/*
+ * Bump-pointer allocator: memory is carved out of big slabs
+ * and is never freed individually, only all at once on clear()
+ * or destruction. Allocated objects never move.
+ *
+ * Requests that don't fit into a slab get their own slab.
+ */
+template<size_t SLAB_SIZE = 1024 * 1024, size_t ALIGN = sizeof(void*)>
+class slab_allocator_t
+{
+	std::vector<char*> slabs;
+	char *current_slab;
+	char *current_slab_end;
+	size_t allocated;
+
+public:
+	slab_allocator_t()
+		: slabs()
+		, current_slab(NULL)
+		, current_slab_end(NULL)
+		, allocated(0)
+	{}
+
+	~slab_allocator_t()
+	{
+		clear();
+	}
+
+	void *alloc(size_t size)
+	{
+		size = (size + ALIGN - 1) & ~(ALIGN - 1);
+		char *result;
+		if (size > SLAB_SIZE)
+		{
+			result = static_cast<char*>(malloc(size));
+			slabs.push_back(result);
+		}
+		else
+		{
+			if (current_slab == NULL
+				|| size > static_cast<size_t>(current_slab_end - current_slab))
+			{
+				current_slab = static_cast<char*>(malloc(SLAB_SIZE));
+				current_slab_end = current_slab + SLAB_SIZE;
+				slabs.push_back(current_slab);
+			}
+			result = current_slab;
+			current_slab += size;
+		}
+		allocated += size;
+		return result;
+	}
+
+	// total number of bytes handed out since the last clear()
+	size_t size() const
+	{
+		return allocated;
+	}
+
+	void clear()
+	{
+		std::for_each(slabs.begin(), slabs.end(), free);
+		slabs.clear();
+		current_slab = current_slab_end = NULL;
+		allocated = 0;
+	}
+
+	FORBID_COPY(slab_allocator_t);
+};
+
+} // namespace re2c
+
+#endif // _RE2C_UTIL_SLAB_ALLOCATOR_
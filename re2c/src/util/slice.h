@@ -0,0 +1,42 @@
+#ifndef _RE2C_UTIL_SLICE_
+#define _RE2C_UTIL_SLICE_
+
+#include <stddef.h>
+
+namespace re2c
+{
+
+// read-only view of a contiguous part of some array
+// (the array is owned by someone else and must outlive the view)
+template <typename value_t>
+class slice_t
+{
+	const value_t * first;
+	size_t count;
+
+public:
+	slice_t (const value_t * p, size_t n)
+		: first (p)
+		, count (n)
+	{}
+	size_t size () const
+	{
+		return count;
+	}
+	const value_t & operator [] (size_t i) const
+	{
+		return first[i];
+	}
+	const value_t * begin () const
+	{
+		return first;
+	}
+	const value_t * end () const
+	{
+		return first + count;
+	}
+};
+
+} // namespace re2c
+
+#endif // _RE2C_UTIL_SLICE_
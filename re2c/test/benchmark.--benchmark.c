@@ -0,0 +1,390 @@
+/* Generated by re2c */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h> /* malloc, free */
+#include <string.h> /* memset */
+#include <time.h>
+
+static void *read_file
+    ( const char *fname
+    , size_t unit
+    , size_t padding
+    , size_t *pfsize
+    )
+{
+    void *buffer = NULL;
+    size_t fsize = 0;
+
+    /* open file */
+    FILE *f = fopen(fname, "rb");
+    if(f == NULL) {
+        goto error;
+    }
+
+    /* get file size */
+    fseek(f, 0, SEEK_END);
+    fsize = (size_t) ftell(f) / unit;
+    fseek(f, 0, SEEK_SET);
+
+    /* allocate memory for file and padding */
+    buffer = malloc(unit * (fsize + padding));
+    if (buffer == NULL) {
+        goto error;
+    }
+
+    /* read the whole file in memory */
+    if (fread(buffer, unit, fsize, f) != fsize) {
+        goto error;
+    }
+
+    fclose(f);
+    *pfsize = fsize;
+    return buffer;
+
+error:
+    fprintf(stderr, "error: cannot read file '%s'\n", fname);
+    free(buffer);
+    if (f != NULL) {
+        fclose(f);
+    }
+    return NULL;
+}
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static double bench_now()
+{
+#ifdef CLOCK_MONOTONIC
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double) t.tv_sec + (double) t.tv_nsec * 1e-9;
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/* CPU cycles and branch misses, -1 if not available */
+static void counters_start(int *fd)
+{
+    int k;
+#ifdef __linux__
+    struct perf_event_attr attr;
+#endif
+    for (k = 0; k < 2; ++k) {
+        fd[k] = -1;
+#ifdef __linux__
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = k == 0
+            ? PERF_COUNT_HW_CPU_CYCLES
+            : PERF_COUNT_HW_BRANCH_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd[k] = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        if (fd[k] != -1) {
+            ioctl(fd[k], PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd[k], PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+}
+
+static void counters_stop(const int *fd, double *events)
+{
+    int k;
+    for (k = 0; k < 2; ++k) {
+        events[k] = -1;
+#ifdef __linux__
+        if (fd[k] != -1) {
+            unsigned long long n = 0;
+            ioctl(fd[k], PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd[k], &n, sizeof(n)) == sizeof(n)) {
+                events[k] = (double) n;
+            }
+            close(fd[k]);
+        }
+#endif
+    }
+}
+
+#define YYCTYPE unsigned char
+#define YYKEYTYPE unsigned char
+#define YYPEEK() *cursor
+#define YYSKIP() ++cursor
+#define YYLESSTHAN(n) (limit - cursor) < n
+#define YYFILL(n) { break; }
+
+static const size_t padding_line6 = 1; /* YYMAXFILL */
+
+static void action_line6
+    ( unsigned int i
+    , const YYKEYTYPE *keys
+    , const YYCTYPE *token
+    , const YYCTYPE **cursor
+    , unsigned int rule
+    , unsigned long *counts
+    )
+{
+    ++counts[rule];
+    if (keys != NULL) {
+        *cursor = token + keys[3 * i];
+    } else if (*cursor == token) {
+        ++*cursor;
+    }
+}
+
+static const YYCTYPE *pass_line6
+    ( const YYCTYPE *input
+    , const YYCTYPE *limit
+    , const YYCTYPE *eof
+    , const YYKEYTYPE *keys
+    , size_t keys_count
+    , unsigned long *counts
+    )
+{
+    const YYCTYPE *cursor = input;
+    const YYCTYPE *token = NULL;
+    unsigned int i = 0;
+
+    for (i = 0; keys != NULL ? i < keys_count : cursor < eof; ++i) {
+        token = cursor;
+        YYCTYPE yych;
+
+        if (YYLESSTHAN (1)) YYFILL(1);
+        yych = YYPEEK ();
+        switch (yych) {
+        case ' ':    goto yy4;
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':    goto yy6;
+        case 'a':
+        case 'b':
+        case 'c':
+        case 'd':
+        case 'e':
+        case 'f':
+        case 'g':
+        case 'h':
+        case 'i':
+        case 'j':
+        case 'k':
+        case 'l':
+        case 'm':
+        case 'n':
+        case 'o':
+        case 'p':
+        case 'q':
+        case 'r':
+        case 's':
+        case 't':
+        case 'u':
+        case 'v':
+        case 'w':
+        case 'x':
+        case 'y':
+        case 'z':    goto yy9;
+        default:    goto yy2;
+        }
+yy2:
+        YYSKIP ();
+        action_line6(i, keys, token, &cursor, 3, counts);
+        continue;
+yy4:
+        YYSKIP ();
+        action_line6(i, keys, token, &cursor, 2, counts);
+        continue;
+yy6:
+        YYSKIP ();
+        if (YYLESSTHAN (1)) YYFILL(1);
+        yych = YYPEEK ();
+        switch (yych) {
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':    goto yy6;
+        default:    goto yy8;
+        }
+yy8:
+        action_line6(i, keys, token, &cursor, 1, counts);
+        continue;
+yy9:
+        YYSKIP ();
+        if (YYLESSTHAN (1)) YYFILL(1);
+        yych = YYPEEK ();
+        switch (yych) {
+        case 'a':
+        case 'b':
+        case 'c':
+        case 'd':
+        case 'e':
+        case 'f':
+        case 'g':
+        case 'h':
+        case 'i':
+        case 'j':
+        case 'k':
+        case 'l':
+        case 'm':
+        case 'n':
+        case 'o':
+        case 'p':
+        case 'q':
+        case 'r':
+        case 's':
+        case 't':
+        case 'u':
+        case 'v':
+        case 'w':
+        case 'x':
+        case 'y':
+        case 'z':    goto yy9;
+        default:    goto yy11;
+        }
+yy11:
+        action_line6(i, keys, token, &cursor, 0, counts);
+        continue;
+
+    }
+    return cursor;
+}
+
+static int bench_line6(unsigned long repeat, const char *corpus)
+{
+    static const unsigned int lines[] = {2, 3, 4, 0};
+    const unsigned int rules = 3;
+    const size_t padding = padding_line6;
+    size_t input_len = 0;
+    size_t keys_count = 0;
+    YYCTYPE *input = NULL;
+    YYKEYTYPE *keys = NULL;
+    const YYCTYPE *limit = NULL;
+    const YYCTYPE *eof = NULL;
+    unsigned long counts[5];
+    unsigned long tokens = 0;
+    unsigned long r = 0;
+    size_t consumed = 0;
+    size_t i = 0;
+    double bytes = 0;
+    double time = 0;
+    double events[2];
+    int fd[2];
+
+    if (corpus == NULL) {
+        corpus = "benchmark.--benchmark.c.line6.input";
+        keys = (YYKEYTYPE *) read_file
+            ("benchmark.--benchmark.c.line6.keys"
+            , 3 * sizeof (YYKEYTYPE)
+            , 0
+            , &keys_count
+            );
+        if (keys == NULL) {
+            return 1;
+        }
+    }
+
+    input = (YYCTYPE *) read_file
+        ( corpus
+        , sizeof (YYCTYPE)
+        , padding
+        , &input_len
+        );
+    if (input == NULL) {
+        free(keys);
+        return 1;
+    }
+    limit = input + input_len + padding;
+    eof = input + input_len;
+
+    /* warm-up pass: not timed and not counted */
+    memset(counts, 0, sizeof(counts));
+    pass_line6(input, limit, eof, keys, keys_count, counts);
+    memset(counts, 0, sizeof(counts));
+
+    counters_start(fd);
+    time = bench_now();
+    for (r = 0; r < repeat; ++r) {
+        consumed += (size_t) (pass_line6(input, limit, eof, keys, keys_count, counts) - input);
+    }
+    time = bench_now() - time;
+    counters_stop(fd, events);
+
+    for (i = 0; i < rules + 2; ++i) {
+        tokens += counts[i];
+    }
+    bytes = (double) consumed * sizeof (YYCTYPE);
+    printf("line6: %lu passes over '%s': %.0f bytes, %lu tokens in %.3f s\n"
+        , repeat, corpus, bytes, tokens, time);
+    if (time > 0 && tokens > 0) {
+        printf("    %.2f MB/s, %.2f ns/token\n", bytes / time / 1e6, time * 1e9 / (double) tokens);
+    }
+    if (events[0] >= 0 && bytes > 0) {
+        printf("    cycles: %.0f (%.2f per byte)\n", events[0], events[0] / bytes);
+    }
+    if (events[1] >= 0 && tokens > 0) {
+        printf("    branch-misses: %.0f (%.3f per token)\n", events[1], events[1] / (double) tokens);
+    }
+    for (i = 0; i < rules; ++i) {
+        printf("    rule at line %u: %lu tokens\n", lines[i], counts[i]);
+    }
+    if (counts[rules] != 0) {
+        printf("    default rule: %lu tokens\n", counts[rules]);
+    }
+    if (counts[rules + 1] != 0) {
+        printf("    undefined control flow: %lu tokens\n", counts[rules + 1]);
+    }
+
+    free(input);
+    free(keys);
+    return 0;
+}
+
+#undef YYCTYPE
+#undef YYKEYTYPE
+#undef YYPEEK
+#undef YYSKIP
+#undef YYLESSTHAN
+#undef YYFILL
+
+int main(int argc, char **argv)
+{
+    const unsigned long repeat = argc > 1 ? strtoul(argv[1], NULL, 10) : 10;
+    const char *corpus = argc > 2 ? argv[2] : NULL;
+
+    if(bench_line6(repeat, corpus) != 0) {
+        return 1;
+    }
+    return 0;
+}
+line6: 1 passes over 'benchmark.--benchmark.c.line6.input': 4504 bytes, 1648 tokens
+    rule at line 2: 690 tokens
+    rule at line 3: 738 tokens
+    rule at line 4: 1 tokens
+    default rule: 219 tokens
+line6: 2 passes over 'corpus.txt': 34 bytes, 24 tokens
+    rule at line 2: 6 tokens
+    rule at line 3: 4 tokens
+    rule at line 4: 8 tokens
+    default rule: 6 tokens
@@ -0,0 +1,14 @@
+# compile and run the benchmark on the generated data and on a corpus;
+# timings and hardware counters are not stable: keep token counts only
+$re2c $switches "$outx" || exit 1
+$cc -Wall -Wextra -o "$outc.out" "$outc" || exit 1
+printf 'abc 123 x9 !? zz\n' > corpus.txt
+for args in "1" "2 corpus.txt"
+do
+	./"$outc.out" $args | sed \
+		-e 's/ in [0-9.]* s$//' \
+		-e '/MB\/s/d' \
+		-e '/cycles:/d' \
+		-e '/branch-misses:/d'
+done
+rm -f "$outc.out" "$outc".line*.input "$outc".line*.keys corpus.txt
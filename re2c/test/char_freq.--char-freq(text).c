@@ -0,0 +1,125 @@
+/* Generated by re2c */
+#line 1 "char_freq.--char-freq(text).re"
+
+#line 5 "char_freq.--char-freq(text).c"
+{
+	YYCTYPE yych;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	if (yych <= '`') {
+		if (yych <= ' ') {
+			if (yych <= 0x1F) {
+				if (yych <= '\n') {
+					if (yych <= '\t') {
+						if (yych >= '\t') goto yy4;
+					} else {
+						goto yy7;
+					}
+				} else {
+					goto yy2;
+				}
+			} else {
+				goto yy4;
+			}
+		} else {
+			if (yych <= '@') {
+				if (yych <= '-') {
+					if (yych <= '+') {
+						if (yych <= '!') goto yy9;
+					} else {
+						if (yych <= ',') goto yy9;
+					}
+				} else {
+					if (yych <= '/') {
+						if (yych <= '.') goto yy9;
+					} else {
+						if (yych <= '9') {
+							goto yy11;
+						} else {
+							if (yych <= ';') {
+								goto yy9;
+							} else {
+								if (yych <= '>') {
+									goto yy2;
+								} else {
+									if (yych <= '?') goto yy9;
+								}
+							}
+						}
+					}
+				}
+			} else {
+				if (yych <= 'Z') goto yy14;
+			}
+		}
+	} else {
+		if (yych <= 'z') goto yy17;
+	}
+yy2:
+	++YYCURSOR;
+#line 8 "char_freq.--char-freq(text).re"
+	{ return -1; }
+#line 63 "char_freq.--char-freq(text).c"
+yy4:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	if (yych >= '!') goto yy6;
+	if (yych >= ' ') goto yy4;
+	if (yych == '\t') goto yy4;
+yy6:
+#line 5 "char_freq.--char-freq(text).re"
+	{ return 4; }
+#line 74 "char_freq.--char-freq(text).c"
+yy7:
+	++YYCURSOR;
+#line 7 "char_freq.--char-freq(text).re"
+	{ return 6; }
+#line 79 "char_freq.--char-freq(text).c"
+yy9:
+	++YYCURSOR;
+#line 6 "char_freq.--char-freq(text).re"
+	{ return 5; }
+#line 84 "char_freq.--char-freq(text).c"
+yy11:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	if (yych <= '9') {
+		if (yych >= '0') goto yy11;
+	} else {
+		goto yy13;
+	}
+yy13:
+#line 4 "char_freq.--char-freq(text).re"
+	{ return 3; }
+#line 97 "char_freq.--char-freq(text).c"
+yy14:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	if (yych <= '`') {
+		goto yy16;
+	} else {
+		if (yych <= 'z') goto yy14;
+	}
+yy16:
+#line 3 "char_freq.--char-freq(text).re"
+	{ return 2; }
+#line 110 "char_freq.--char-freq(text).c"
+yy17:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	if (yych <= '`') {
+		goto yy19;
+	} else {
+		if (yych <= 'z') goto yy17;
+	}
+yy19:
+#line 2 "char_freq.--char-freq(text).re"
+	{ return 1; }
+#line 123 "char_freq.--char-freq(text).c"
+}
+#line 9 "char_freq.--char-freq(text).re"
+
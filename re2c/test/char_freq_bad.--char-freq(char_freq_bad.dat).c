@@ -0,0 +1 @@
+re2c: error: bad character frequency file char_freq_bad.dat, line 3: expected '<code unit> <weight>'
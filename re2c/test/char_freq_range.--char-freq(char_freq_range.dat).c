@@ -0,0 +1 @@
+re2c: error: bad character frequency file char_freq_range.dat, line 3: code unit 0x100 is out of range 0x00 - 0xFF
@@ -0,0 +1,43 @@
+/* Generated by re2c */
+#line 1 "char_freq_wide.w--char-freq(text).re"
+// the first span runs from 0x00 past 0xFF: its weight is the weight
+// of all bytes, so it must be checked first
+
+#line 7 "char_freq_wide.w--char-freq(text).c"
+{
+	YYCTYPE yych;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	if (yych <= 0x02FF) {
+		goto yy2;
+	} else {
+		if (yych <= 0x03FF) {
+			goto yy4;
+		} else {
+			if (yych <= 0x04FF) goto yy6;
+			goto yy8;
+		}
+	}
+yy2:
+	++YYCURSOR;
+#line 4 "char_freq_wide.w--char-freq(text).re"
+	{ return 1; }
+#line 26 "char_freq_wide.w--char-freq(text).c"
+yy4:
+	++YYCURSOR;
+#line 5 "char_freq_wide.w--char-freq(text).re"
+	{ return 2; }
+#line 31 "char_freq_wide.w--char-freq(text).c"
+yy6:
+	++YYCURSOR;
+#line 6 "char_freq_wide.w--char-freq(text).re"
+	{ return 3; }
+#line 36 "char_freq_wide.w--char-freq(text).c"
+yy8:
+	++YYCURSOR;
+#line 7 "char_freq_wide.w--char-freq(text).re"
+	{ return 4; }
+#line 41 "char_freq_wide.w--char-freq(text).c"
+}
+#line 8 "char_freq_wide.w--char-freq(text).re"
+
@@ -0,0 +1,159 @@
+/* Generated by re2c */
+#line 1 "dfa_cache.c.re"
+
+#line 5 "dfa_cache.c.c"
+{
+	YYCTYPE yych;
+	switch (YYGETCONDITION()) {
+	case yycINIT: goto yyc_INIT;
+	case yycCOMMENT: goto yyc_COMMENT;
+	}
+/* *********************************** */
+yyc_COMMENT:
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '*':	goto yy5;
+	default:	goto yy3;
+	}
+yy3:
+	++YYCURSOR;
+yy4:
+	goto yyc_COMMENT;
+yy5:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case '/':	goto yy6;
+	default:	goto yy4;
+	}
+yy6:
+	++YYCURSOR;
+	YYSETCONDITION(yycINIT);
+	goto yyc_INIT;
+/* *********************************** */
+yyc_INIT:
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '/':	goto yy12;
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy13;
+	default:	goto yy10;
+	}
+yy10:
+	++YYCURSOR;
+yy11:
+#line 4 "dfa_cache.c.re"
+	{ return -1; }
+#line 73 "dfa_cache.c.c"
+yy12:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case '*':	goto yy16;
+	default:	goto yy11;
+	}
+yy13:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy18;
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy13;
+	default:	goto yy15;
+	}
+yy15:
+#line 2 "dfa_cache.c.re"
+	{ return 1; }
+#line 126 "dfa_cache.c.c"
+yy16:
+	++YYCURSOR;
+	YYSETCONDITION(yycCOMMENT);
+	goto yyc_COMMENT;
+yy18:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy18;
+	default:	goto yy15;
+	}
+}
+#line 7 "dfa_cache.c.re"
+
+"cond": "COMMENT", "cached": false
+"cond": "INIT", "cached": false
+"cond": "COMMENT", "cached": true
+"cond": "INIT", "cached": true
+cached: same output
+"cond": "COMMENT", "cached": false
+"cond": "INIT", "cached": false
+"cond": "COMMENT", "cached": true
+"cond": "INIT", "cached": true
+corrupted cache: same output
@@ -0,0 +1,24 @@
+# compile twice with the same cache: the second run must load all DFA
+# from the cache and give the same output
+cached () { grep -o '"cond": "[^"]*", "cached": [a-z]*' "$1"; }
+mkdir cache
+$re2c $switches --dfa-cache cache --stats 1.json "$outx" || exit 1
+mv "$outc" first.c
+$re2c $switches --dfa-cache cache --stats 2.json "$outx" || exit 1
+cached 1.json
+cached 2.json
+cmp first.c "$outc" && echo "cached: same output"
+
+# corrupt cached DFA: checksum does not match, so DFA is compiled again
+# (and cached anew)
+for f in cache/*.dfa
+do
+	printf 'X' | dd of="$f" bs=1 seek=$((`wc -c < "$f"` / 2)) conv=notrunc 2>/dev/null
+done
+$re2c $switches --dfa-cache cache --stats 3.json "$outx" || exit 1
+$re2c $switches --dfa-cache cache --stats 4.json "$outx" || exit 1
+cached 3.json
+cached 4.json
+cmp first.c "$outc" && echo "corrupted cache: same output"
+
+rm -rf cache first.c 1.json 2.json 3.json 4.json
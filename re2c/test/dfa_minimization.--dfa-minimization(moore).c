@@ -0,0 +1,340 @@
+/* Generated by re2c */
+#line 1 "dfa_minimization.--dfa-minimization(moore).re"
+
+#line 5 "dfa_minimization.--dfa-minimization(moore).c"
+{
+	YYCTYPE yych;
+	if ((YYLIMIT - YYCURSOR) < 6) YYFILL(6);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy4;
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy6;
+	case 'w':	goto yy8;
+	default:	goto yy2;
+	}
+yy2:
+	++YYCURSOR;
+#line 6 "dfa_minimization.--dfa-minimization(moore).re"
+	{ return 0; }
+#line 43 "dfa_minimization.--dfa-minimization(moore).c"
+yy4:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':	goto yy9;
+	default:	goto yy7;
+	}
+yy5:
+#line 5 "dfa_minimization.--dfa-minimization(moore).re"
+	{ return 4; }
+#line 54 "dfa_minimization.--dfa-minimization(moore).c"
+yy6:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+yy7:
+	switch (yych) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy6;
+	default:	goto yy5;
+	}
+yy8:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy10;
+	default:	goto yy7;
+	}
+yy9:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':
+	case 'b':	goto yy11;
+	default:	goto yy7;
+	}
+yy10:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy14;
+	case 'i':	goto yy15;
+	default:	goto yy13;
+	}
+yy11:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':
+	case 'b':	goto yy16;
+	default:	goto yy7;
+	}
+yy12:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+yy13:
+	switch (yych) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy12;
+	case 'e':	goto yy18;
+	default:	goto yy5;
+	}
+yy14:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy20;
+	default:	goto yy13;
+	}
+yy15:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy22;
+	default:	goto yy13;
+	}
+yy16:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy6;
+	default:	goto yy17;
+	}
+yy17:
+#line 2 "dfa_minimization.--dfa-minimization(moore).re"
+	{ return 1; }
+#line 196 "dfa_minimization.--dfa-minimization(moore).c"
+yy18:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy12;
+	case 'e':	goto yy18;
+	case 'n':	goto yy23;
+	default:	goto yy5;
+	}
+yy20:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy13;
+	default:	goto yy21;
+	}
+yy21:
+#line 3 "dfa_minimization.--dfa-minimization(moore).re"
+	{ return 2; }
+#line 264 "dfa_minimization.--dfa-minimization(moore).c"
+yy22:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy25;
+	default:	goto yy13;
+	}
+yy23:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy12;
+	case 'e':	goto yy18;
+	default:	goto yy24;
+	}
+yy24:
+#line 4 "dfa_minimization.--dfa-minimization(moore).re"
+	{ return 3; }
+#line 307 "dfa_minimization.--dfa-minimization(moore).c"
+yy25:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy13;
+	case 'n':	goto yy23;
+	default:	goto yy21;
+	}
+}
+#line 7 "dfa_minimization.--dfa-minimization(moore).re"
+
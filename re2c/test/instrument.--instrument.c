@@ -0,0 +1,244 @@
+/* Generated by re2c */
+#line 1 "instrument.--instrument.re"
+static unsigned long yystats[13];
+static const char * const yystatsname[13] = {
+	"state yy1",
+	"state yy2",
+	"rule instrument.--instrument.re:8",
+	"state yy4",
+	"rule instrument.--instrument.re:7",
+	"state yy7",
+	"rule instrument.--instrument.re:6",
+	"state yy9",
+	"rule instrument.--instrument.re:4",
+	"state yy12",
+	"rule instrument.--instrument.re:3",
+	"state yy15",
+	"rule instrument.--instrument.re:5",
+};
+static void yystatsdump (FILE * f)
+{
+	unsigned int i;
+	for (i = 0; i < 13; ++i) {
+		fprintf (f, "%s\t%lu\n", yystatsname[i], yystats[i]);
+	}
+}
+
+#line 28 "instrument.--instrument.c"
+{
+	YYCTYPE yych;
+	++yystats[0];
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '\t':
+	case ' ':	goto yy4;
+	case '-':	goto yy7;
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy9;
+	case 'A':
+	case 'B':
+	case 'C':
+	case 'D':
+	case 'E':
+	case 'F':
+	case 'G':
+	case 'H':
+	case 'I':
+	case 'J':
+	case 'K':
+	case 'L':
+	case 'M':
+	case 'N':
+	case 'O':
+	case 'P':
+	case 'Q':
+	case 'R':
+	case 'S':
+	case 'T':
+	case 'U':
+	case 'V':
+	case 'W':
+	case 'X':
+	case 'Y':
+	case 'Z':
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy12;
+	default:	goto yy2;
+	}
+yy2:
+	++yystats[1];
+	++YYCURSOR;
+	++yystats[2];
+#line 8 "instrument.--instrument.re"
+	{ return -1; }
+#line 109 "instrument.--instrument.c"
+yy4:
+	++yystats[3];
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '\t':
+	case ' ':	goto yy4;
+	default:	goto yy6;
+	}
+yy6:
+	++yystats[4];
+#line 7 "instrument.--instrument.re"
+	{ return 5; }
+#line 124 "instrument.--instrument.c"
+yy7:
+	++yystats[5];
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case '>':	goto yy15;
+	default:	goto yy8;
+	}
+yy8:
+	++yystats[6];
+#line 6 "instrument.--instrument.re"
+	{ return 4; }
+#line 136 "instrument.--instrument.c"
+yy9:
+	++yystats[7];
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy9;
+	default:	goto yy11;
+	}
+yy11:
+	++yystats[8];
+#line 4 "instrument.--instrument.re"
+	{ return 2; }
+#line 159 "instrument.--instrument.c"
+yy12:
+	++yystats[9];
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':
+	case 'A':
+	case 'B':
+	case 'C':
+	case 'D':
+	case 'E':
+	case 'F':
+	case 'G':
+	case 'H':
+	case 'I':
+	case 'J':
+	case 'K':
+	case 'L':
+	case 'M':
+	case 'N':
+	case 'O':
+	case 'P':
+	case 'Q':
+	case 'R':
+	case 'S':
+	case 'T':
+	case 'U':
+	case 'V':
+	case 'W':
+	case 'X':
+	case 'Y':
+	case 'Z':
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy12;
+	default:	goto yy14;
+	}
+yy14:
+	++yystats[10];
+#line 3 "instrument.--instrument.re"
+	{ return 1; }
+#line 235 "instrument.--instrument.c"
+yy15:
+	++yystats[11];
+	++YYCURSOR;
+	++yystats[12];
+#line 5 "instrument.--instrument.re"
+	{ return 3; }
+#line 242 "instrument.--instrument.c"
+}
+#line 9 "instrument.--instrument.re"
+
@@ -0,0 +1,326 @@
+/* Generated by re2c */
+#line 1 "keywords.re"
+
+#line 5 "keywords.c"
+{
+	YYCTYPE yych;
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy4;
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'y':
+	case 'z':	goto yy7;
+	case 'e':	goto yy17;
+	case 'i':	goto yy18;
+	case 'x':	goto yy19;
+	default:	goto yy2;
+	}
+yy2:
+	++YYCURSOR;
+#line 27 "keywords.re"
+	{ return ERR; }
+#line 53 "keywords.c"
+yy4:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy4;
+	default:	goto yy6;
+	}
+yy6:
+#line 26 "keywords.re"
+	{ return NUM; }
+#line 73 "keywords.c"
+yy7:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+yy8:
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy7;
+	default:	goto yy9;
+	}
+yy9:
+	{
+		static const unsigned char yykwdisp[2] = {
+			16, 2
+		};
+		static const unsigned char yykwslot[8] = {
+			1, 0, 5, 6, 3, 2, 4, 7
+		};
+		static const unsigned char yykwoff[8] = {
+			0, 4, 9, 13, 21, 23, 29, 34
+		};
+		static const YYCTYPE yykwstr[34] = {
+			'a', 'u', 't', 'o', 'b', 'r', 'e', 'a', 'k', 'c', 'a', 's', 'e', 'c', 'o', 'n',
+			't', 'i', 'n', 'u', 'e', 'd', 'o', 'd', 'o', 'u', 'b', 'l', 'e', 'w', 'h', 'i',
+			'l', 'e'
+		};
+		const YYCTYPE *yykwtok = (const YYCTYPE *) (s->tok);
+		const unsigned long yykwlen = (unsigned long) ((const YYCTYPE *) (YYCURSOR) - yykwtok);
+		if (yykwlen >= 2 && yykwlen <= 8) {
+			unsigned long yykwh = 2166136261ul;
+			unsigned long yykwi;
+			for (yykwi = 0; yykwi < yykwlen; ++yykwi) {
+				yykwh = ((yykwh ^ yykwtok[yykwi]) * 16777619ul) & 0xFFFFFFFFul;
+			}
+			yykwh = (((yykwh ^ yykwdisp[yykwh & 1]) * 2654435761ul) & 0xFFFFFFFFul) >> 29;
+			yykwh = yykwslot[yykwh];
+			if (yykwh != 0 && yykwlen == (unsigned long) (yykwoff[yykwh] - yykwoff[yykwh - 1])) {
+				const YYCTYPE *yykwp = yykwstr + yykwoff[yykwh - 1];
+				for (yykwi = 0; yykwi < yykwlen; ++yykwi) {
+					if (yykwtok[yykwi] != yykwp[yykwi]) break;
+				}
+				if (yykwi == yykwlen) {
+					switch (yykwh) {
+					case 1: goto yy10;
+					case 2: goto yy11;
+					case 3: goto yy12;
+					case 4: goto yy13;
+					case 5: goto yy14;
+					case 6: goto yy15;
+					case 7: goto yy16;
+					}
+				}
+			}
+		}
+	}
+#line 21 "keywords.re"
+	{ return ID; }
+#line 165 "keywords.c"
+yy10:
+#line 5 "keywords.re"
+	{ return AUTO; }
+#line 169 "keywords.c"
+yy11:
+#line 6 "keywords.re"
+	{ return BREAK; }
+#line 173 "keywords.c"
+yy12:
+#line 7 "keywords.re"
+	{ return CASE; }
+#line 177 "keywords.c"
+yy13:
+#line 8 "keywords.re"
+	{ return CONTINUE; }
+#line 181 "keywords.c"
+yy14:
+#line 9 "keywords.re"
+	{ return DO; }
+#line 185 "keywords.c"
+yy15:
+#line 10 "keywords.re"
+	{ return DOUBLE; }
+#line 189 "keywords.c"
+yy16:
+#line 11 "keywords.re"
+	{ return WHILE; }
+#line 193 "keywords.c"
+yy17:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy21;
+	default:	goto yy8;
+	}
+yy18:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy22;
+	default:	goto yy8;
+	}
+yy19:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy7;
+	default:	goto yy20;
+	}
+yy20:
+#line 16 "keywords.re"
+	{ return X; }
+#line 251 "keywords.c"
+yy21:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 's':	goto yy23;
+	default:	goto yy8;
+	}
+yy22:
+	yych = *++YYCURSOR;
+	YYCTXMARKER = YYCURSOR;
+	switch (yych) {
+	case '(':	goto yy24;
+	default:	goto yy8;
+	}
+yy23:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy26;
+	default:	goto yy8;
+	}
+yy24:
+	++YYCURSOR;
+	YYCURSOR = YYCTXMARKER;
+#line 14 "keywords.re"
+	{ return IF; }
+#line 276 "keywords.c"
+yy26:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy7;
+	default:	goto yy27;
+	}
+yy27:
+#line 18 "keywords.re"
+	{ return ELSE; }
+#line 322 "keywords.c"
+}
+#line 28 "keywords.re"
+
+re2c: warning: line 19: unreachable rule (shadowed by rule at line 18) [-Wunreachable-rules]
+re2c: warning: line 24: unreachable rule (shadowed by rule at line 21) [-Wunreachable-rules]
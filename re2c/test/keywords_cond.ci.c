@@ -0,0 +1,258 @@
+/* Generated by re2c */
+
+enum YYCONDTYPE {
+	yycINIT,
+	yycBODY,
+};
+
+
+{
+	YYCTYPE yych;
+	switch (YYGETCONDITION()) {
+	case yycINIT: goto yyc_INIT;
+	case yycBODY: goto yyc_BODY;
+	}
+/* *********************************** */
+yyc_BODY:
+	yych = *YYCURSOR;
+	switch (yych) {
+	case ' ':	goto yy5;
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	default:	goto yy3;
+	}
+yy3:
+	++YYCURSOR;
+	{ return ERR; }
+yy5:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	switch (yych) {
+	case ' ':	goto yy5;
+	default:	goto yy7;
+	}
+yy7:
+	{ goto yyc_INIT; }
+yy8:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	switch (yych) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	default:	goto yy10;
+	}
+yy10:
+	{
+		static const unsigned char yykwdisp[1] = {
+			1
+		};
+		static const unsigned char yykwslot[2] = {
+			1, 2
+		};
+		static const unsigned char yykwoff[3] = {
+			0, 5, 8
+		};
+		static const YYCTYPE yykwstr[8] = {
+			'b', 'e', 'g', 'i', 'n', 'e', 'n', 'd'
+		};
+		const YYCTYPE *yykwtok = (const YYCTYPE *) (tok);
+		const unsigned long yykwlen = (unsigned long) ((const YYCTYPE *) (YYCURSOR) - yykwtok);
+		if (yykwlen >= 3 && yykwlen <= 5) {
+			unsigned long yykwh = 2166136261ul;
+			unsigned long yykwi;
+			for (yykwi = 0; yykwi < yykwlen; ++yykwi) {
+				yykwh = ((yykwh ^ yykwtok[yykwi]) * 16777619ul) & 0xFFFFFFFFul;
+			}
+			yykwh = (((yykwh ^ yykwdisp[yykwh & 0]) * 2654435761ul) & 0xFFFFFFFFul) >> 31;
+			yykwh = yykwslot[yykwh];
+			if (yykwh != 0 && yykwlen == (unsigned long) (yykwoff[yykwh] - yykwoff[yykwh - 1])) {
+				const YYCTYPE *yykwp = yykwstr + yykwoff[yykwh - 1];
+				for (yykwi = 0; yykwi < yykwlen; ++yykwi) {
+					if (yykwtok[yykwi] != yykwp[yykwi]) break;
+				}
+				if (yykwi == yykwlen) {
+					switch (yykwh) {
+					case 1: goto yy11;
+					case 2: goto yy12;
+					}
+				}
+			}
+		}
+	}
+	{ return ID; }
+yy11:
+	{ return BEGIN; }
+yy12:
+	YYSETCONDITION(yycINIT);
+	{ return END; }
+/* *********************************** */
+yyc_INIT:
+	yych = *YYCURSOR;
+	switch (yych) {
+	case ' ':	goto yy17;
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy20;
+	default:	goto yy15;
+	}
+yy15:
+	++YYCURSOR;
+	{ return ERR; }
+yy17:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	switch (yych) {
+	case ' ':	goto yy17;
+	default:	goto yy19;
+	}
+yy19:
+	{ goto yyc_INIT; }
+yy20:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	switch (yych) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy20;
+	default:	goto yy22;
+	}
+yy22:
+	{
+		static const unsigned char yykwdisp[1] = {
+			0
+		};
+		static const unsigned char yykwslot[2] = {
+			1, 2
+		};
+		static const unsigned char yykwoff[3] = {
+			0, 6, 12
+		};
+		static const YYCTYPE yykwstr[12] = {
+			'm', 'o', 'd', 'u', 'l', 'e', 'i', 'm', 'p', 'o', 'r', 't'
+		};
+		const YYCTYPE *yykwtok = (const YYCTYPE *) (tok);
+		const unsigned long yykwlen = (unsigned long) ((const YYCTYPE *) (YYCURSOR) - yykwtok);
+		if (yykwlen >= 6 && yykwlen <= 6) {
+			unsigned long yykwh = 2166136261ul;
+			unsigned long yykwi;
+			for (yykwi = 0; yykwi < yykwlen; ++yykwi) {
+				yykwh = ((yykwh ^ yykwtok[yykwi]) * 16777619ul) & 0xFFFFFFFFul;
+			}
+			yykwh = (((yykwh ^ yykwdisp[yykwh & 0]) * 2654435761ul) & 0xFFFFFFFFul) >> 31;
+			yykwh = yykwslot[yykwh];
+			if (yykwh != 0 && yykwlen == (unsigned long) (yykwoff[yykwh] - yykwoff[yykwh - 1])) {
+				const YYCTYPE *yykwp = yykwstr + yykwoff[yykwh - 1];
+				for (yykwi = 0; yykwi < yykwlen; ++yykwi) {
+					if (yykwtok[yykwi] != yykwp[yykwi]) break;
+				}
+				if (yykwi == yykwlen) {
+					switch (yykwh) {
+					case 1: goto yy23;
+					case 2: goto yy24;
+					}
+				}
+			}
+		}
+	}
+	{ return ID; }
+yy23:
+	YYSETCONDITION(yycBODY);
+	{ return MODULE; }
+yy24:
+	{ return IMPORT; }
+}
+
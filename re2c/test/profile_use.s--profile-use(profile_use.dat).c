@@ -0,0 +1,133 @@
+/* Generated by re2c */
+#line 1 "profile_use.s--profile-use(profile_use.dat).re"
+
+#line 5 "profile_use.s--profile-use(profile_use.dat).c"
+{
+	YYCTYPE yych;
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	if (yych <= '`') {
+		if (yych <= 0x1F) {
+			if (yych <= '\t') {
+				if (yych <= 0x08) goto yy2;
+				goto yy4;
+			} else {
+				if (yych <= '\n') goto yy7;
+				goto yy2;
+			}
+		} else {
+			if (yych <= ' ') {
+				goto yy4;
+			} else {
+				if (yych <= '9') {
+					if (yych <= '/') {
+						if (yych <= '!') {
+							goto yy9;
+						} else {
+							if (yych <= '\'') {
+								goto yy2;
+							} else {
+								if (yych <= ')') goto yy11;
+								goto yy2;
+							}
+						}
+					} else {
+						goto yy13;
+					}
+				} else {
+					if (yych <= '<') {
+						if (yych <= ';') goto yy2;
+						goto yy16;
+					} else {
+						if (yych <= '=') {
+							goto yy9;
+						} else {
+							if (yych <= '>') goto yy17;
+							goto yy2;
+						}
+					}
+				}
+			}
+		}
+	} else {
+		if (yych >= '{') goto yy2;
+	}
+yy18:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	if (yych <= '`') {
+		goto yy20;
+	} else {
+		if (yych <= 'z') goto yy18;
+	}
+yy20:
+#line 2 "profile_use.s--profile-use(profile_use.dat).re"
+	{ return 1; }
+#line 68 "profile_use.s--profile-use(profile_use.dat).c"
+yy2:
+	++YYCURSOR;
+#line 10 "profile_use.s--profile-use(profile_use.dat).re"
+	{ return -1; }
+#line 73 "profile_use.s--profile-use(profile_use.dat).c"
+yy4:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	if (yych == '\t') goto yy4;
+	if (yych == ' ') goto yy4;
+#line 4 "profile_use.s--profile-use(profile_use.dat).re"
+	{ return 3; }
+#line 82 "profile_use.s--profile-use(profile_use.dat).c"
+yy7:
+	++YYCURSOR;
+#line 5 "profile_use.s--profile-use(profile_use.dat).re"
+	{ return 4; }
+#line 87 "profile_use.s--profile-use(profile_use.dat).c"
+yy9:
+	++YYCURSOR;
+yy10:
+#line 8 "profile_use.s--profile-use(profile_use.dat).re"
+	{ return 7; }
+#line 93 "profile_use.s--profile-use(profile_use.dat).c"
+yy11:
+	++YYCURSOR;
+#line 9 "profile_use.s--profile-use(profile_use.dat).re"
+	{ return 8; }
+#line 98 "profile_use.s--profile-use(profile_use.dat).c"
+yy13:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	if (yych <= '/') {
+		goto yy15;
+	} else {
+		if (yych <= '9') goto yy13;
+	}
+yy15:
+#line 3 "profile_use.s--profile-use(profile_use.dat).re"
+	{ return 2; }
+#line 111 "profile_use.s--profile-use(profile_use.dat).c"
+yy16:
+	yych = *++YYCURSOR;
+	if (yych == '=') goto yy23;
+	if (yych == '<') goto yy21;
+	goto yy10;
+yy23:
+	++YYCURSOR;
+#line 6 "profile_use.s--profile-use(profile_use.dat).re"
+	{ return 5; }
+#line 121 "profile_use.s--profile-use(profile_use.dat).c"
+yy17:
+	yych = *++YYCURSOR;
+	if (yych == '=') goto yy23;
+	if (yych == '>') goto yy21;
+	goto yy10;
+yy21:
+	++YYCURSOR;
+#line 7 "profile_use.s--profile-use(profile_use.dat).re"
+	{ return 6; }
+#line 131 "profile_use.s--profile-use(profile_use.dat).c"
+}
+#line 11 "profile_use.s--profile-use(profile_use.dat).re"
+
@@ -0,0 +1 @@
+re2c: error: bad profile file profile_use_bad.dat, line 6: expected '<counter name>\t<count>'
@@ -0,0 +1 @@
+re2c: error: cannot open profile file: profile_use_missing.dat
@@ -0,0 +1,259 @@
+/* Generated by re2c */
+#line 1 "sentinel.re"
+
+#line 5 "sentinel.c"
+{
+	YYCTYPE yych;
+	yych = *YYCURSOR;
+yy2:
+	switch (yych) {
+	case 0x00:	goto yy21;
+	case '\t':
+	case ' ':	goto yy7;
+	case '-':	goto yy10;
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy13;
+	case 'A':
+	case 'B':
+	case 'C':
+	case 'D':
+	case 'E':
+	case 'F':
+	case 'G':
+	case 'H':
+	case 'I':
+	case 'J':
+	case 'K':
+	case 'L':
+	case 'M':
+	case 'N':
+	case 'O':
+	case 'P':
+	case 'Q':
+	case 'R':
+	case 'S':
+	case 'T':
+	case 'U':
+	case 'V':
+	case 'W':
+	case 'X':
+	case 'Y':
+	case 'Z':
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy16;
+	default:	goto yy5;
+	}
+yy3:
+	++YYCURSOR;
+#line 4 "sentinel.re"
+	{ return 0; }
+#line 84 "sentinel.c"
+yy5:
+	++YYCURSOR;
+#line 10 "sentinel.re"
+	{ return -1; }
+#line 89 "sentinel.c"
+yy7:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+yy8:
+	switch (yych) {
+	case 0x00:	goto yy22;
+	case '\t':
+	case ' ':	goto yy7;
+	default:	goto yy9;
+	}
+yy9:
+#line 9 "sentinel.re"
+	{ return 5; }
+#line 103 "sentinel.c"
+yy10:
+	yych = *++YYCURSOR;
+yy11:
+	switch (yych) {
+	case 0x00:	goto yy23;
+	case '>':	goto yy19;
+	default:	goto yy12;
+	}
+yy12:
+#line 8 "sentinel.re"
+	{ return 4; }
+#line 115 "sentinel.c"
+yy13:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+yy14:
+	switch (yych) {
+	case 0x00:	goto yy24;
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy13;
+	default:	goto yy15;
+	}
+yy15:
+#line 6 "sentinel.re"
+	{ return 2; }
+#line 137 "sentinel.c"
+yy16:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+yy17:
+	switch (yych) {
+	case 0x00:	goto yy25;
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':
+	case 'A':
+	case 'B':
+	case 'C':
+	case 'D':
+	case 'E':
+	case 'F':
+	case 'G':
+	case 'H':
+	case 'I':
+	case 'J':
+	case 'K':
+	case 'L':
+	case 'M':
+	case 'N':
+	case 'O':
+	case 'P':
+	case 'Q':
+	case 'R':
+	case 'S':
+	case 'T':
+	case 'U':
+	case 'V':
+	case 'W':
+	case 'X':
+	case 'Y':
+	case 'Z':
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy16;
+	default:	goto yy18;
+	}
+yy18:
+#line 5 "sentinel.re"
+	{ return 1; }
+#line 212 "sentinel.c"
+yy19:
+	++YYCURSOR;
+#line 7 "sentinel.re"
+	{ return 3; }
+#line 217 "sentinel.c"
+yy21:
+	if (YYLIMIT <= YYCURSOR) {
+		YYFILL(1);
+		if (YYLIMIT <= YYCURSOR) goto yy3;
+		yych = *YYCURSOR;
+		goto yy2;
+	}
+	goto yy3;
+yy22:
+	if (YYLIMIT <= YYCURSOR) {
+		YYFILL(1);
+		if (YYLIMIT <= YYCURSOR) goto yy9;
+		yych = *YYCURSOR;
+		goto yy8;
+	}
+	goto yy9;
+yy23:
+	if (YYLIMIT <= YYCURSOR) {
+		YYFILL(1);
+		if (YYLIMIT <= YYCURSOR) goto yy12;
+		yych = *YYCURSOR;
+		goto yy11;
+	}
+	goto yy12;
+yy24:
+	if (YYLIMIT <= YYCURSOR) {
+		YYFILL(1);
+		if (YYLIMIT <= YYCURSOR) goto yy15;
+		yych = *YYCURSOR;
+		goto yy14;
+	}
+	goto yy15;
+yy25:
+	if (YYLIMIT <= YYCURSOR) {
+		YYFILL(1);
+		if (YYLIMIT <= YYCURSOR) goto yy18;
+		yych = *YYCURSOR;
+		goto yy17;
+	}
+	goto yy18;
+}
+#line 11 "sentinel.re"
+
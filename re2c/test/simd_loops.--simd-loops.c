@@ -0,0 +1,386 @@
+/* Generated by re2c */
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#endif
+#line 1 "simd_loops.--simd-loops.re"
+
+#line 8 "simd_loops.--simd-loops.c"
+{
+	YYCTYPE yych;
+	if ((YYLIMIT - YYCURSOR) < 3) YYFILL(3);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '\t':
+	case ' ':	goto yy4;
+	case '"':	goto yy7;
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy8;
+	case 'A':
+	case 'B':
+	case 'C':
+	case 'D':
+	case 'E':
+	case 'F':
+	case 'G':
+	case 'H':
+	case 'I':
+	case 'J':
+	case 'K':
+	case 'L':
+	case 'M':
+	case 'N':
+	case 'O':
+	case 'P':
+	case 'Q':
+	case 'R':
+	case 'S':
+	case 'T':
+	case 'U':
+	case 'V':
+	case 'W':
+	case 'X':
+	case 'Y':
+	case 'Z':
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy11;
+	default:	goto yy2;
+	}
+yy2:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	goto yy15;
+#line 7 "simd_loops.--simd-loops.re"
+	{ return 0; }
+#line 88 "simd_loops.--simd-loops.c"
+yy4:
+	++YYCURSOR;
+#if defined(__SSE2__) && defined(__GNUC__)
+	while (sizeof (YYCTYPE) == 1 && (YYLIMIT - YYCURSOR) >= 16) {
+		const __m128i yysv = _mm_loadu_si128 ((const __m128i *) YYCURSOR);
+		__m128i yysm = _mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) 0x09));
+		unsigned int yysk;
+		yysm = _mm_or_si128 (yysm, _mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) 0x20)));
+		yysk = (unsigned int) _mm_movemask_epi8 (yysm) ^ 0xFFFF;
+		if (yysk != 0) {
+			YYCURSOR += __builtin_ctz (yysk);
+			break;
+		}
+		YYCURSOR += 16;
+	}
+#endif
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '\t':
+	case ' ':	goto yy4;
+	case '$':	goto yy16;
+	default:	goto yy14;
+	}
+#line 4 "simd_loops.--simd-loops.re"
+	{ return 3; }
+#line 115 "simd_loops.--simd-loops.c"
+yy7:
+	yych = *++YYCURSOR;
+	goto yy20;
+yy8:
+	++YYCURSOR;
+#if defined(__SSE2__) && defined(__GNUC__)
+	while (sizeof (YYCTYPE) == 1 && (YYLIMIT - YYCURSOR) >= 16) {
+		const __m128i yysv = _mm_loadu_si128 ((const __m128i *) YYCURSOR);
+		__m128i yysm = _mm_cmpeq_epi8 (_mm_subs_epu8 (_mm_sub_epi8 (yysv, _mm_set1_epi8 ((char) 0x30)), _mm_set1_epi8 ((char) 0x09)), _mm_setzero_si128 ());
+		unsigned int yysk;
+		yysk = (unsigned int) _mm_movemask_epi8 (yysm) ^ 0xFFFF;
+		if (yysk != 0) {
+			YYCURSOR += __builtin_ctz (yysk);
+			break;
+		}
+		YYCURSOR += 16;
+	}
+#endif
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '$':	goto yy16;
+	case '.':	goto yy25;
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy8;
+	default:	goto yy14;
+	}
+#line 5 "simd_loops.--simd-loops.re"
+	{ return 4; }
+#line 153 "simd_loops.--simd-loops.c"
+yy11:
+	++YYCURSOR;
+#if defined(__SSE2__) && defined(__GNUC__)
+	while (sizeof (YYCTYPE) == 1 && (YYLIMIT - YYCURSOR) >= 16) {
+		const __m128i yysv = _mm_loadu_si128 ((const __m128i *) YYCURSOR);
+		__m128i yysm = _mm_cmpeq_epi8 (_mm_subs_epu8 (_mm_sub_epi8 (yysv, _mm_set1_epi8 ((char) 0x30)), _mm_set1_epi8 ((char) 0x09)), _mm_setzero_si128 ());
+		unsigned int yysk;
+		yysm = _mm_or_si128 (yysm, _mm_cmpeq_epi8 (_mm_subs_epu8 (_mm_sub_epi8 (yysv, _mm_set1_epi8 ((char) 0x41)), _mm_set1_epi8 ((char) 0x19)), _mm_setzero_si128 ()));
+		yysm = _mm_or_si128 (yysm, _mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) 0x5F)));
+		yysm = _mm_or_si128 (yysm, _mm_cmpeq_epi8 (_mm_subs_epu8 (_mm_sub_epi8 (yysv, _mm_set1_epi8 ((char) 0x61)), _mm_set1_epi8 ((char) 0x19)), _mm_setzero_si128 ()));
+		yysk = (unsigned int) _mm_movemask_epi8 (yysm) ^ 0xFFFF;
+		if (yysk != 0) {
+			YYCURSOR += __builtin_ctz (yysk);
+			break;
+		}
+		YYCURSOR += 16;
+	}
+#endif
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '$':	goto yy16;
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':
+	case 'A':
+	case 'B':
+	case 'C':
+	case 'D':
+	case 'E':
+	case 'F':
+	case 'G':
+	case 'H':
+	case 'I':
+	case 'J':
+	case 'K':
+	case 'L':
+	case 'M':
+	case 'N':
+	case 'O':
+	case 'P':
+	case 'Q':
+	case 'R':
+	case 'S':
+	case 'T':
+	case 'U':
+	case 'V':
+	case 'W':
+	case 'X':
+	case 'Y':
+	case 'Z':
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy11;
+	default:	goto yy14;
+	}
+#line 2 "simd_loops.--simd-loops.re"
+	{ return 1; }
+#line 243 "simd_loops.--simd-loops.c"
+yy14:
+	++YYCURSOR;
+#if defined(__SSE2__) && defined(__GNUC__)
+	while (sizeof (YYCTYPE) == 1 && (YYLIMIT - YYCURSOR) >= 16) {
+		const __m128i yysv = _mm_loadu_si128 ((const __m128i *) YYCURSOR);
+		__m128i yysm = _mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) 0x24));
+		unsigned int yysk;
+		yysk = (unsigned int) _mm_movemask_epi8 (yysm);
+		if (yysk != 0) {
+			YYCURSOR += __builtin_ctz (yysk);
+			break;
+		}
+		YYCURSOR += 16;
+	}
+#endif
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+yy15:
+	switch (yych) {
+	case '$':	goto yy16;
+	default:	goto yy14;
+	}
+yy16:
+	++YYCURSOR;
+#if defined(__SSE2__) && defined(__GNUC__)
+	while (sizeof (YYCTYPE) == 1 && (YYLIMIT - YYCURSOR) >= 16) {
+		const __m128i yysv = _mm_loadu_si128 ((const __m128i *) YYCURSOR);
+		__m128i yysm = _mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) 0x24));
+		unsigned int yysk;
+		yysk = (unsigned int) _mm_movemask_epi8 (yysm) ^ 0xFFFF;
+		if (yysk != 0) {
+			YYCURSOR += __builtin_ctz (yysk);
+			break;
+		}
+		YYCURSOR += 16;
+	}
+#endif
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '$':	goto yy16;
+	default:	goto yy14;
+	}
+#line 6 "simd_loops.--simd-loops.re"
+	{ return 5; }
+#line 289 "simd_loops.--simd-loops.c"
+yy19:
+	++YYCURSOR;
+#if defined(__SSE2__) && defined(__GNUC__)
+	while (sizeof (YYCTYPE) == 1 && (YYLIMIT - YYCURSOR) >= 17) {
+		const __m128i yysv = _mm_loadu_si128 ((const __m128i *) YYCURSOR);
+		__m128i yysm = _mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) 0x0A));
+		unsigned int yysk;
+		yysm = _mm_or_si128 (yysm, _mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) 0x22)));
+		yysm = _mm_or_si128 (yysm, _mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) 0x24)));
+		yysm = _mm_or_si128 (yysm, _mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) 0x5C)));
+		yysk = (unsigned int) _mm_movemask_epi8 (yysm);
+		if (yysk != 0) {
+			YYCURSOR += __builtin_ctz (yysk);
+			break;
+		}
+		YYCURSOR += 16;
+	}
+#endif
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+yy20:
+	switch (yych) {
+	case '\n':
+	case '\\':	goto yy14;
+	case '"':	goto yy21;
+	case '$':	goto yy23;
+	default:	goto yy19;
+	}
+yy21:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	goto yy15;
+#line 3 "simd_loops.--simd-loops.re"
+	{ return 2; }
+#line 324 "simd_loops.--simd-loops.c"
+yy23:
+	++YYCURSOR;
+#if defined(__SSE2__) && defined(__GNUC__)
+	while (sizeof (YYCTYPE) == 1 && (YYLIMIT - YYCURSOR) >= 17) {
+		const __m128i yysv = _mm_loadu_si128 ((const __m128i *) YYCURSOR);
+		__m128i yysm = _mm_cmpeq_epi8 (yysv, _mm_set1_epi8 ((char) 0x24));
+		unsigned int yysk;
+		yysk = (unsigned int) _mm_movemask_epi8 (yysm) ^ 0xFFFF;
+		if (yysk != 0) {
+			YYCURSOR += __builtin_ctz (yysk);
+			break;
+		}
+		YYCURSOR += 16;
+	}
+#endif
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '\n':
+	case '\\':	goto yy14;
+	case '"':	goto yy21;
+	case '$':	goto yy23;
+	default:	goto yy19;
+	}
+yy25:
+	++YYCURSOR;
+#if defined(__SSE2__) && defined(__GNUC__)
+	while (sizeof (YYCTYPE) == 1 && (YYLIMIT - YYCURSOR) >= 16) {
+		const __m128i yysv = _mm_loadu_si128 ((const __m128i *) YYCURSOR);
+		__m128i yysm = _mm_cmpeq_epi8 (_mm_subs_epu8 (_mm_sub_epi8 (yysv, _mm_set1_epi8 ((char) 0x30)), _mm_set1_epi8 ((char) 0x09)), _mm_setzero_si128 ());
+		unsigned int yysk;
+		yysk = (unsigned int) _mm_movemask_epi8 (yysm) ^ 0xFFFF;
+		if (yysk != 0) {
+			YYCURSOR += __builtin_ctz (yysk);
+			break;
+		}
+		YYCURSOR += 16;
+	}
+#endif
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '$':	goto yy16;
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy25;
+	default:	goto yy14;
+	}
+}
+#line 8 "simd_loops.--simd-loops.re"
+
+re2c: warning: line 2: unreachable rule  [-Wunreachable-rules]
+re2c: warning: line 3: unreachable rule  [-Wunreachable-rules]
+re2c: warning: line 4: unreachable rule  [-Wunreachable-rules]
+re2c: warning: line 5: unreachable rule  [-Wunreachable-rules]
+re2c: warning: line 6: unreachable rule  [-Wunreachable-rules]
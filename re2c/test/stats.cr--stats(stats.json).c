@@ -0,0 +1,495 @@
+/* Generated by re2c */
+#line 1 "stats.cr--stats(stats.json).re"
+#line 6 "stats.cr--stats(stats.json).re"
+
+
+// both 'use' blocks emit DFA compiled in 'rules' block:
+// --stats has one record for each of its conditions
+
+#line 10 "stats.cr--stats(stats.json).c"
+{
+	YYCTYPE yych;
+	switch (YYGETCONDITION()) {
+	case yycINIT: goto yyc_INIT;
+	case yycSTR: goto yyc_STR;
+	}
+/* *********************************** */
+yyc_INIT:
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy5;
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	default:	goto yy3;
+	}
+yy3:
+	++YYCURSOR;
+#line 5 "stats.cr--stats(stats.json).re"
+	{ return -1; }
+#line 64 "stats.cr--stats(stats.json).c"
+yy5:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy5;
+	default:	goto yy7;
+	}
+yy7:
+#line 3 "stats.cr--stats(stats.json).re"
+	{ return 2; }
+#line 85 "stats.cr--stats(stats.json).c"
+yy8:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	default:	goto yy10;
+	}
+yy10:
+#line 2 "stats.cr--stats(stats.json).re"
+	{ return 1; }
+#line 122 "stats.cr--stats(stats.json).c"
+/* *********************************** */
+yyc_STR:
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '"':	goto yy15;
+	default:	goto yy13;
+	}
+yy13:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	goto yy18;
+#line 5 "stats.cr--stats(stats.json).re"
+	{ return -1; }
+#line 137 "stats.cr--stats(stats.json).c"
+yy15:
+	++YYCURSOR;
+#line 4 "stats.cr--stats(stats.json).re"
+	{ return 3; }
+#line 142 "stats.cr--stats(stats.json).c"
+yy17:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+yy18:
+	switch (yych) {
+	case '"':	goto yy15;
+	default:	goto yy17;
+	}
+}
+#line 10 "stats.cr--stats(stats.json).re"
+
+
+#line 156 "stats.cr--stats(stats.json).c"
+{
+	YYCTYPE yych;
+	switch (YYGETCONDITION()) {
+	case yycINIT: goto yyc_INIT;
+	case yycSTR: goto yyc_STR;
+	}
+/* *********************************** */
+yyc_INIT:
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy5;
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	default:	goto yy3;
+	}
+yy3:
+	++YYCURSOR;
+#line 5 "stats.cr--stats(stats.json).re"
+	{ return -1; }
+#line 210 "stats.cr--stats(stats.json).c"
+yy5:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy5;
+	default:	goto yy7;
+	}
+yy7:
+#line 3 "stats.cr--stats(stats.json).re"
+	{ return 2; }
+#line 231 "stats.cr--stats(stats.json).c"
+yy8:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	default:	goto yy10;
+	}
+yy10:
+#line 2 "stats.cr--stats(stats.json).re"
+	{ return 1; }
+#line 268 "stats.cr--stats(stats.json).c"
+/* *********************************** */
+yyc_STR:
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '"':	goto yy15;
+	default:	goto yy13;
+	}
+yy13:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	goto yy18;
+#line 5 "stats.cr--stats(stats.json).re"
+	{ return -1; }
+#line 283 "stats.cr--stats(stats.json).c"
+yy15:
+	++YYCURSOR;
+#line 4 "stats.cr--stats(stats.json).re"
+	{ return 3; }
+#line 288 "stats.cr--stats(stats.json).c"
+yy17:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+yy18:
+	switch (yych) {
+	case '"':	goto yy15;
+	default:	goto yy17;
+	}
+}
+#line 11 "stats.cr--stats(stats.json).re"
+
+
+// new rule: DFA is compiled again and reported in this block
+
+#line 304 "stats.cr--stats(stats.json).c"
+{
+	YYCTYPE yych;
+	switch (YYGETCONDITION()) {
+	case yycINIT: goto yyc_INIT;
+	case yycSTR: goto yyc_STR;
+	}
+/* *********************************** */
+yyc_INIT:
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '"':	goto yy5;
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy7;
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy10;
+	default:	goto yy3;
+	}
+yy3:
+	++YYCURSOR;
+#line 5 "stats.cr--stats(stats.json).re"
+	{ return -1; }
+#line 359 "stats.cr--stats(stats.json).c"
+yy5:
+	++YYCURSOR;
+	YYSETCONDITION(yycSTR);
+#line 15 "stats.cr--stats(stats.json).re"
+	{ return 4; }
+#line 365 "stats.cr--stats(stats.json).c"
+yy7:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy7;
+	default:	goto yy9;
+	}
+yy9:
+#line 3 "stats.cr--stats(stats.json).re"
+	{ return 2; }
+#line 386 "stats.cr--stats(stats.json).c"
+yy10:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy10;
+	default:	goto yy12;
+	}
+yy12:
+#line 2 "stats.cr--stats(stats.json).re"
+	{ return 1; }
+#line 423 "stats.cr--stats(stats.json).c"
+/* *********************************** */
+yyc_STR:
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '"':	goto yy17;
+	default:	goto yy15;
+	}
+yy15:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	goto yy20;
+#line 5 "stats.cr--stats(stats.json).re"
+	{ return -1; }
+#line 438 "stats.cr--stats(stats.json).c"
+yy17:
+	++YYCURSOR;
+#line 4 "stats.cr--stats(stats.json).re"
+	{ return 3; }
+#line 443 "stats.cr--stats(stats.json).c"
+yy19:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+yy20:
+	switch (yych) {
+	case '"':	goto yy17;
+	default:	goto yy19;
+	}
+}
+#line 16 "stats.cr--stats(stats.json).re"
+
+{
+	"version": "X",
+	"input": "stats.cr--stats(stats.json).re",
+	"peak_memory_kib": 0,
+	"blocks": [
+		{
+			"line": 6,
+			"time": {"parse": 0.0},
+			"dfas": [
+				{"cond": "INIT", "cached": false,
+					"time": {"nfa": 0.0, "determinization": 0.0, "skeleton": 0.0, "minimization": 0.0, "fillpoints": 0.0, "prepare": 0.0, "analyses": 0.0, "codegen": 0.0},
+					"charset": 5, "nfa_states": 12, "dfa_states": 6, "min_states": 4, "adfa_states": 9, "spans": 14, "bytes": 3071},
+				{"cond": "STR", "cached": false,
+					"time": {"nfa": 0.0, "determinization": 0.0, "skeleton": 0.0, "minimization": 0.0, "fillpoints": 0.0, "prepare": 0.0, "analyses": 0.0, "codegen": 0.0},
+					"charset": 3, "nfa_states": 7, "dfa_states": 5, "min_states": 4, "adfa_states": 7, "spans": 9, "bytes": 1006}
+			]
+		},
+		{
+			"line": 10,
+			"time": {"parse": 0.0},
+			"dfas": []
+		},
+		{
+			"line": 11,
+			"time": {"parse": 0.0},
+			"dfas": []
+		},
+		{
+			"line": 16,
+			"time": {"parse": 0.0},
+			"dfas": [
+				{"cond": "INIT", "cached": false,
+					"time": {"nfa": 0.0, "determinization": 0.0, "skeleton": 0.0, "minimization": 0.0, "fillpoints": 0.0, "prepare": 0.0, "analyses": 0.0, "codegen": 0.0},
+					"charset": 7, "nfa_states": 15, "dfa_states": 7, "min_states": 5, "adfa_states": 11, "spans": 17, "bytes": 1639},
+				{"cond": "STR", "cached": false,
+					"time": {"nfa": 0.0, "determinization": 0.0, "skeleton": 0.0, "minimization": 0.0, "fillpoints": 0.0, "prepare": 0.0, "analyses": 0.0, "codegen": 0.0},
+					"charset": 3, "nfa_states": 7, "dfa_states": 5, "min_states": 4, "adfa_states": 7, "spans": 9, "bytes": 503}
+			]
+		}
+	]
+}
@@ -0,0 +1 @@
+re2c: error: line 80, column 17: newline in character class
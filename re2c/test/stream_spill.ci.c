@@ -0,0 +1,7248 @@
+/* Generated by re2c */
+#define YYMAXFILL 10
+
+enum YYCONDTYPE {
+	yycKW,
+	yycNUM,
+};
+
+
+// code of this block is well over the flush threshold (64K), and it
+// precedes yyaccept initialization, YYMAXFILL and condition types
+
+{
+	YYCTYPE yych;
+	unsigned int yyaccept = 0;
+	switch (YYGETCONDITION()) {
+	case yycKW: goto yyc_KW;
+	case yycNUM: goto yyc_NUM;
+	}
+/* *********************************** */
+yyc_KW:
+	if ((YYLIMIT - YYCURSOR) < 10) YYFILL(10);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy5;
+	case 'b':	goto yy7;
+	case 'c':	goto yy8;
+	case 'd':	goto yy9;
+	case 'e':	goto yy10;
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy3;
+	}
+yy3:
+	++YYCURSOR;
+	{ return -1; }
+yy5:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':	goto yy13;
+	case 'b':	goto yy14;
+	case 'c':
+	case 'd':
+	case 'f':
+	case 'j':
+	case 'l':	goto yy11;
+	case 'e':	goto yy15;
+	case 'g':	goto yy16;
+	case 'h':	goto yy17;
+	case 'i':	goto yy18;
+	case 'k':	goto yy19;
+	case 'm':	goto yy20;
+	case 'n':	goto yy21;
+	case 'o':	goto yy22;
+	case 'p':	goto yy23;
+	default:	goto yy6;
+	}
+yy6:
+	{ return 0; }
+yy7:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy24;
+	case 'e':	goto yy25;
+	case 'f':	goto yy26;
+	case 'g':	goto yy27;
+	case 'h':	goto yy28;
+	case 'i':	goto yy29;
+	case 'j':	goto yy30;
+	case 'k':	goto yy31;
+	case 'l':	goto yy32;
+	case 'm':	goto yy33;
+	case 'n':	goto yy34;
+	default:	goto yy12;
+	}
+yy8:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy35;
+	case 'b':	goto yy36;
+	case 'c':	goto yy37;
+	case 'd':	goto yy38;
+	case 'e':	goto yy39;
+	case 'f':	goto yy40;
+	case 'g':	goto yy41;
+	case 'h':	goto yy42;
+	case 'i':
+	case 'n':
+	case 'o':	goto yy11;
+	case 'j':	goto yy43;
+	case 'k':	goto yy44;
+	case 'l':	goto yy45;
+	case 'm':	goto yy46;
+	case 'p':	goto yy47;
+	default:	goto yy6;
+	}
+yy9:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy48;
+	case 'b':	goto yy49;
+	case 'c':	goto yy50;
+	case 'd':
+	case 'e':
+	case 'g':
+	case 'l':
+	case 'm':
+	case 'n':	goto yy11;
+	case 'f':	goto yy51;
+	case 'h':	goto yy52;
+	case 'i':	goto yy53;
+	case 'j':	goto yy54;
+	case 'k':	goto yy55;
+	case 'o':	goto yy56;
+	case 'p':	goto yy57;
+	default:	goto yy6;
+	}
+yy10:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy58;
+	case 'b':	goto yy59;
+	case 'c':	goto yy60;
+	case 'd':	goto yy61;
+	case 'e':	goto yy62;
+	case 'f':	goto yy63;
+	case 'i':	goto yy64;
+	case 'j':	goto yy65;
+	default:	goto yy12;
+	}
+yy11:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+yy12:
+	switch (yych) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy6;
+	}
+yy13:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy66;
+	default:	goto yy12;
+	}
+yy14:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy67;
+	default:	goto yy12;
+	}
+yy15:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy68;
+	case 'h':	goto yy69;
+	default:	goto yy12;
+	}
+yy16:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy70;
+	default:	goto yy12;
+	}
+yy17:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy71;
+	case 'g':	goto yy72;
+	case 'k':	goto yy73;
+	default:	goto yy12;
+	}
+yy18:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy74;
+	default:	goto yy12;
+	}
+yy19:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy75;
+	default:	goto yy12;
+	}
+yy20:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy76;
+	default:	goto yy12;
+	}
+yy21:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy78;
+	case 'j':	goto yy79;
+	default:	goto yy12;
+	}
+yy22:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy81;
+	default:	goto yy12;
+	}
+yy23:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy82;
+	default:	goto yy12;
+	}
+yy24:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy83;
+	default:	goto yy12;
+	}
+yy25:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy84;
+	default:	goto yy12;
+	}
+yy26:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy85;
+	default:	goto yy12;
+	}
+yy27:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy86;
+	case 'n':	goto yy87;
+	default:	goto yy12;
+	}
+yy28:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy88;
+	default:	goto yy12;
+	}
+yy29:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy89;
+	default:	goto yy12;
+	}
+yy30:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy90;
+	default:	goto yy12;
+	}
+yy31:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy91;
+	default:	goto yy12;
+	}
+yy32:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy92;
+	case 'm':	goto yy93;
+	default:	goto yy12;
+	}
+yy33:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy94;
+	case 'i':	goto yy95;
+	case 'k':	goto yy97;
+	default:	goto yy12;
+	}
+yy34:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy98;
+	default:	goto yy12;
+	}
+yy35:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy99;
+	default:	goto yy12;
+	}
+yy36:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy100;
+	case 'l':	goto yy102;
+	default:	goto yy12;
+	}
+yy37:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy104;
+	default:	goto yy12;
+	}
+yy38:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy105;
+	default:	goto yy12;
+	}
+yy39:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy107;
+	case 'n':	goto yy108;
+	default:	goto yy12;
+	}
+yy40:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy109;
+	default:	goto yy12;
+	}
+yy41:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy111;
+	default:	goto yy12;
+	}
+yy42:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy112;
+	default:	goto yy12;
+	}
+yy43:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy113;
+	default:	goto yy12;
+	}
+yy44:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy114;
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':	goto yy11;
+	case 'p':	goto yy116;
+	default:	goto yy6;
+	}
+yy45:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'k':	goto yy117;
+	default:	goto yy12;
+	}
+yy46:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy118;
+	default:	goto yy12;
+	}
+yy47:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy119;
+	default:	goto yy12;
+	}
+yy48:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy120;
+	default:	goto yy12;
+	}
+yy49:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy121;
+	default:	goto yy12;
+	}
+yy50:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy122;
+	case 'i':	goto yy124;
+	default:	goto yy12;
+	}
+yy51:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy125;
+	case 'm':	goto yy126;
+	default:	goto yy12;
+	}
+yy52:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy127;
+	default:	goto yy12;
+	}
+yy53:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy128;
+	default:	goto yy12;
+	}
+yy54:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy129;
+	case 'm':	goto yy130;
+	default:	goto yy12;
+	}
+yy55:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy131;
+	default:	goto yy12;
+	}
+yy56:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy132;
+	default:	goto yy12;
+	}
+yy57:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy133;
+	default:	goto yy12;
+	}
+yy58:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy134;
+	default:	goto yy12;
+	}
+yy59:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy135;
+	default:	goto yy12;
+	}
+yy60:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy136;
+	default:	goto yy12;
+	}
+yy61:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy137;
+	default:	goto yy12;
+	}
+yy62:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy139;
+	default:	goto yy12;
+	}
+yy63:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy140;
+	default:	goto yy12;
+	}
+yy64:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy141;
+	case 'k':	goto yy143;
+	case 'p':	goto yy144;
+	default:	goto yy12;
+	}
+yy65:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy145;
+	default:	goto yy12;
+	}
+yy66:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy146;
+	default:	goto yy12;
+	}
+yy67:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy147;
+	default:	goto yy12;
+	}
+yy68:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy148;
+	default:	goto yy12;
+	}
+yy69:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy149;
+	default:	goto yy12;
+	}
+yy70:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy150;
+	default:	goto yy12;
+	}
+yy71:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy151;
+	default:	goto yy12;
+	}
+yy72:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy152;
+	default:	goto yy12;
+	}
+yy73:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy153;
+	default:	goto yy12;
+	}
+yy74:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy154;
+	default:	goto yy12;
+	}
+yy75:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy155;
+	default:	goto yy12;
+	}
+yy76:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy77;
+	}
+yy77:
+	{ return 11; }
+yy78:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy156;
+	default:	goto yy12;
+	}
+yy79:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy80;
+	}
+yy80:
+	{ return 13; }
+yy81:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy157;
+	default:	goto yy12;
+	}
+yy82:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy158;
+	default:	goto yy12;
+	}
+yy83:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy159;
+	default:	goto yy12;
+	}
+yy84:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy160;
+	default:	goto yy12;
+	}
+yy85:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy161;
+	default:	goto yy12;
+	}
+yy86:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy162;
+	default:	goto yy12;
+	}
+yy87:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy164;
+	default:	goto yy12;
+	}
+yy88:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy165;
+	default:	goto yy12;
+	}
+yy89:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy166;
+	default:	goto yy12;
+	}
+yy90:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy167;
+	default:	goto yy12;
+	}
+yy91:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy168;
+	default:	goto yy12;
+	}
+yy92:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy169;
+	default:	goto yy12;
+	}
+yy93:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy170;
+	default:	goto yy12;
+	}
+yy94:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy171;
+	default:	goto yy12;
+	}
+yy95:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy96;
+	}
+yy96:
+	{ return 28; }
+yy97:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy172;
+	default:	goto yy12;
+	}
+yy98:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy173;
+	default:	goto yy12;
+	}
+yy99:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy174;
+	default:	goto yy12;
+	}
+yy100:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy101;
+	}
+yy101:
+	{ return 32; }
+yy102:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy103;
+	}
+yy103:
+	{ return 33; }
+yy104:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy175;
+	default:	goto yy12;
+	}
+yy105:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy106;
+	}
+yy106:
+	{ return 35; }
+yy107:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy176;
+	default:	goto yy12;
+	}
+yy108:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy177;
+	default:	goto yy12;
+	}
+yy109:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy110;
+	}
+yy110:
+	{ return 38; }
+yy111:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy178;
+	default:	goto yy12;
+	}
+yy112:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy179;
+	default:	goto yy12;
+	}
+yy113:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy180;
+	default:	goto yy12;
+	}
+yy114:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy115;
+	}
+yy115:
+	{ return 42; }
+yy116:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy181;
+	default:	goto yy12;
+	}
+yy117:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy182;
+	default:	goto yy12;
+	}
+yy118:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy184;
+	default:	goto yy12;
+	}
+yy119:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy185;
+	default:	goto yy12;
+	}
+yy120:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy186;
+	default:	goto yy12;
+	}
+yy121:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy187;
+	default:	goto yy12;
+	}
+yy122:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy123;
+	}
+yy123:
+	{ return 49; }
+yy124:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy188;
+	default:	goto yy12;
+	}
+yy125:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy189;
+	default:	goto yy12;
+	}
+yy126:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy190;
+	default:	goto yy12;
+	}
+yy127:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy192;
+	default:	goto yy12;
+	}
+yy128:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy193;
+	default:	goto yy12;
+	}
+yy129:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy194;
+	default:	goto yy12;
+	}
+yy130:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy195;
+	case 'n':	goto yy196;
+	default:	goto yy12;
+	}
+yy131:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy197;
+	default:	goto yy12;
+	}
+yy132:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy198;
+	default:	goto yy12;
+	}
+yy133:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy199;
+	default:	goto yy12;
+	}
+yy134:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy200;
+	default:	goto yy12;
+	}
+yy135:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy201;
+	default:	goto yy12;
+	}
+yy136:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy202;
+	default:	goto yy12;
+	}
+yy137:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy138;
+	}
+yy138:
+	{ return 64; }
+yy139:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy203;
+	default:	goto yy12;
+	}
+yy140:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy204;
+	default:	goto yy12;
+	}
+yy141:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy142;
+	}
+yy142:
+	{ return 67; }
+yy143:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy206;
+	default:	goto yy12;
+	}
+yy144:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy207;
+	default:	goto yy12;
+	}
+yy145:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'k':	goto yy209;
+	default:	goto yy12;
+	}
+yy146:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy210;
+	default:	goto yy12;
+	}
+yy147:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy212;
+	default:	goto yy12;
+	}
+yy148:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy213;
+	default:	goto yy12;
+	}
+yy149:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy215;
+	default:	goto yy12;
+	}
+yy150:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy216;
+	default:	goto yy12;
+	}
+yy151:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy217;
+	default:	goto yy12;
+	}
+yy152:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy219;
+	default:	goto yy12;
+	}
+yy153:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy220;
+	default:	goto yy12;
+	}
+yy154:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy221;
+	default:	goto yy12;
+	}
+yy155:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy222;
+	default:	goto yy12;
+	}
+yy156:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy223;
+	default:	goto yy12;
+	}
+yy157:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy224;
+	default:	goto yy12;
+	}
+yy158:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy225;
+	default:	goto yy12;
+	}
+yy159:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy226;
+	default:	goto yy12;
+	}
+yy160:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy227;
+	default:	goto yy12;
+	}
+yy161:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy228;
+	default:	goto yy12;
+	}
+yy162:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy163;
+	}
+yy163:
+	{ return 19; }
+yy164:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy230;
+	default:	goto yy12;
+	}
+yy165:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy231;
+	default:	goto yy12;
+	}
+yy166:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy232;
+	default:	goto yy12;
+	}
+yy167:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy233;
+	default:	goto yy12;
+	}
+yy168:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy234;
+	default:	goto yy12;
+	}
+yy169:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy235;
+	default:	goto yy12;
+	}
+yy170:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy236;
+	default:	goto yy12;
+	}
+yy171:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy237;
+	default:	goto yy12;
+	}
+yy172:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy238;
+	default:	goto yy12;
+	}
+yy173:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy239;
+	default:	goto yy12;
+	}
+yy174:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy240;
+	default:	goto yy12;
+	}
+yy175:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'k':	goto yy241;
+	default:	goto yy12;
+	}
+yy176:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy242;
+	default:	goto yy12;
+	}
+yy177:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy243;
+	default:	goto yy12;
+	}
+yy178:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy244;
+	default:	goto yy12;
+	}
+yy179:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy245;
+	default:	goto yy12;
+	}
+yy180:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy246;
+	default:	goto yy12;
+	}
+yy181:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy248;
+	default:	goto yy12;
+	}
+yy182:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy183;
+	}
+yy183:
+	{ return 44; }
+yy184:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy250;
+	default:	goto yy12;
+	}
+yy185:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy251;
+	default:	goto yy12;
+	}
+yy186:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy252;
+	default:	goto yy12;
+	}
+yy187:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy253;
+	default:	goto yy12;
+	}
+yy188:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy254;
+	default:	goto yy12;
+	}
+yy189:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy255;
+	default:	goto yy12;
+	}
+yy190:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy191;
+	}
+yy191:
+	{ return 52; }
+yy192:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy256;
+	default:	goto yy12;
+	}
+yy193:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy257;
+	default:	goto yy12;
+	}
+yy194:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy258;
+	default:	goto yy12;
+	}
+yy195:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy259;
+	default:	goto yy12;
+	}
+yy196:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy260;
+	default:	goto yy12;
+	}
+yy197:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy261;
+	default:	goto yy12;
+	}
+yy198:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy262;
+	default:	goto yy12;
+	}
+yy199:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy263;
+	default:	goto yy12;
+	}
+yy200:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy264;
+	default:	goto yy12;
+	}
+yy201:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy265;
+	default:	goto yy12;
+	}
+yy202:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy266;
+	default:	goto yy12;
+	}
+yy203:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy267;
+	default:	goto yy12;
+	}
+yy204:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy205;
+	}
+yy205:
+	{ return 66; }
+yy206:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy268;
+	default:	goto yy12;
+	}
+yy207:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy208;
+	}
+yy208:
+	{ return 69; }
+yy209:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy269;
+	default:	goto yy12;
+	}
+yy210:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy211;
+	}
+yy211:
+	{ return 1; }
+yy212:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'k':	goto yy270;
+	default:	goto yy12;
+	}
+yy213:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy214;
+	}
+yy214:
+	{ return 3; }
+yy215:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy271;
+	default:	goto yy12;
+	}
+yy216:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy273;
+	default:	goto yy12;
+	}
+yy217:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy218;
+	}
+yy218:
+	{ return 6; }
+yy219:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy275;
+	default:	goto yy12;
+	}
+yy220:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy276;
+	default:	goto yy12;
+	}
+yy221:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy277;
+	default:	goto yy12;
+	}
+yy222:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'k':	goto yy279;
+	default:	goto yy12;
+	}
+yy223:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy280;
+	default:	goto yy12;
+	}
+yy224:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy282;
+	default:	goto yy12;
+	}
+yy225:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy283;
+	default:	goto yy12;
+	}
+yy226:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy284;
+	default:	goto yy12;
+	}
+yy227:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy286;
+	default:	goto yy12;
+	}
+yy228:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy229;
+	}
+yy229:
+	{ return 18; }
+yy230:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy288;
+	default:	goto yy12;
+	}
+yy231:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy289;
+	default:	goto yy12;
+	}
+yy232:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy291;
+	default:	goto yy12;
+	}
+yy233:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy292;
+	default:	goto yy12;
+	}
+yy234:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy293;
+	default:	goto yy12;
+	}
+yy235:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy294;
+	default:	goto yy12;
+	}
+yy236:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy295;
+	default:	goto yy12;
+	}
+yy237:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy296;
+	default:	goto yy12;
+	}
+yy238:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy297;
+	default:	goto yy12;
+	}
+yy239:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy298;
+	default:	goto yy12;
+	}
+yy240:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy299;
+	default:	goto yy12;
+	}
+yy241:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy300;
+	default:	goto yy12;
+	}
+yy242:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy301;
+	default:	goto yy12;
+	}
+yy243:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy302;
+	default:	goto yy12;
+	}
+yy244:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy303;
+	default:	goto yy12;
+	}
+yy245:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy305;
+	default:	goto yy12;
+	}
+yy246:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy247;
+	}
+yy247:
+	{ return 41; }
+yy248:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy249;
+	}
+yy249:
+	{ return 43; }
+yy250:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy307;
+	default:	goto yy12;
+	}
+yy251:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy308;
+	default:	goto yy12;
+	}
+yy252:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy309;
+	default:	goto yy12;
+	}
+yy253:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy310;
+	default:	goto yy12;
+	}
+yy254:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy312;
+	default:	goto yy12;
+	}
+yy255:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy313;
+	default:	goto yy12;
+	}
+yy256:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy314;
+	default:	goto yy12;
+	}
+yy257:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy315;
+	default:	goto yy12;
+	}
+yy258:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy316;
+	default:	goto yy12;
+	}
+yy259:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'k':	goto yy317;
+	default:	goto yy12;
+	}
+yy260:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy319;
+	default:	goto yy12;
+	}
+yy261:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy320;
+	default:	goto yy12;
+	}
+yy262:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy321;
+	default:	goto yy12;
+	}
+yy263:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy322;
+	default:	goto yy12;
+	}
+yy264:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy323;
+	default:	goto yy12;
+	}
+yy265:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy324;
+	default:	goto yy12;
+	}
+yy266:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy325;
+	default:	goto yy12;
+	}
+yy267:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy326;
+	default:	goto yy12;
+	}
+yy268:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy327;
+	default:	goto yy12;
+	}
+yy269:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy328;
+	default:	goto yy12;
+	}
+yy270:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy330;
+	default:	goto yy12;
+	}
+yy271:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy272;
+	}
+yy272:
+	{ return 4; }
+yy273:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy274;
+	}
+yy274:
+	{ return 5; }
+yy275:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy331;
+	default:	goto yy12;
+	}
+yy276:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy333;
+	default:	goto yy12;
+	}
+yy277:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy278;
+	}
+yy278:
+	{ return 9; }
+yy279:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy334;
+	default:	goto yy12;
+	}
+yy280:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy281;
+	}
+yy281:
+	{ return 12; }
+yy282:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy335;
+	default:	goto yy12;
+	}
+yy283:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy336;
+	default:	goto yy12;
+	}
+yy284:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy285;
+	}
+yy285:
+	{ return 16; }
+yy286:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy287;
+	}
+yy287:
+	{ return 17; }
+yy288:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy337;
+	default:	goto yy12;
+	}
+yy289:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy290;
+	}
+yy290:
+	{ return 21; }
+yy291:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy339;
+	default:	goto yy12;
+	}
+yy292:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy340;
+	default:	goto yy12;
+	}
+yy293:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'k':	goto yy342;
+	default:	goto yy12;
+	}
+yy294:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy343;
+	default:	goto yy12;
+	}
+yy295:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy344;
+	default:	goto yy12;
+	}
+yy296:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy346;
+	default:	goto yy12;
+	}
+yy297:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'k':	goto yy347;
+	default:	goto yy12;
+	}
+yy298:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy349;
+	default:	goto yy12;
+	}
+yy299:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy351;
+	default:	goto yy12;
+	}
+yy300:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy353;
+	default:	goto yy12;
+	}
+yy301:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy354;
+	default:	goto yy12;
+	}
+yy302:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy356;
+	default:	goto yy12;
+	}
+yy303:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy304;
+	}
+yy304:
+	{ return 39; }
+yy305:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy306;
+	}
+yy306:
+	{ return 40; }
+yy307:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy358;
+	default:	goto yy12;
+	}
+yy308:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy359;
+	default:	goto yy12;
+	}
+yy309:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy360;
+	default:	goto yy12;
+	}
+yy310:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy311;
+	}
+yy311:
+	{ return 48; }
+yy312:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy362;
+	default:	goto yy12;
+	}
+yy313:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy364;
+	default:	goto yy12;
+	}
+yy314:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'f':	goto yy365;
+	default:	goto yy12;
+	}
+yy315:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy367;
+	default:	goto yy12;
+	}
+yy316:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy368;
+	default:	goto yy12;
+	}
+yy317:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy318;
+	}
+yy318:
+	{ return 56; }
+yy319:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy369;
+	default:	goto yy12;
+	}
+yy320:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy371;
+	default:	goto yy12;
+	}
+yy321:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy373;
+	default:	goto yy12;
+	}
+yy322:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy374;
+	default:	goto yy12;
+	}
+yy323:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy375;
+	default:	goto yy12;
+	}
+yy324:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'k':	goto yy377;
+	default:	goto yy12;
+	}
+yy325:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy378;
+	default:	goto yy12;
+	}
+yy326:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy379;
+	default:	goto yy12;
+	}
+yy327:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy381;
+	default:	goto yy12;
+	}
+yy328:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy329;
+	}
+yy329:
+	{ return 70; }
+yy330:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'j':	goto yy382;
+	default:	goto yy12;
+	}
+yy331:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy332;
+	}
+yy332:
+	{ return 7; }
+yy333:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy383;
+	default:	goto yy12;
+	}
+yy334:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy385;
+	default:	goto yy12;
+	}
+yy335:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy386;
+	default:	goto yy12;
+	}
+yy336:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy388;
+	default:	goto yy12;
+	}
+yy337:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy338;
+	}
+yy338:
+	{ return 20; }
+yy339:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy389;
+	default:	goto yy12;
+	}
+yy340:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy341;
+	}
+yy341:
+	{ return 23; }
+yy342:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy391;
+	default:	goto yy12;
+	}
+yy343:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy392;
+	default:	goto yy12;
+	}
+yy344:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy345;
+	}
+yy345:
+	{ return 26; }
+yy346:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy393;
+	default:	goto yy12;
+	}
+yy347:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy348;
+	}
+yy348:
+	{ return 29; }
+yy349:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy350;
+	}
+yy350:
+	{ return 30; }
+yy351:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy352;
+	}
+yy352:
+	{ return 31; }
+yy353:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'a':	goto yy395;
+	default:	goto yy12;
+	}
+yy354:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy355;
+	}
+yy355:
+	{ return 36; }
+yy356:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy357;
+	}
+yy357:
+	{ return 37; }
+yy358:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'p':	goto yy397;
+	default:	goto yy12;
+	}
+yy359:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'k':	goto yy399;
+	default:	goto yy12;
+	}
+yy360:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy361;
+	}
+yy361:
+	{ return 47; }
+yy362:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy363;
+	}
+yy363:
+	{ return 50; }
+yy364:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy400;
+	default:	goto yy12;
+	}
+yy365:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy366;
+	}
+yy366:
+	{ return 53; }
+yy367:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy402;
+	default:	goto yy12;
+	}
+yy368:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy403;
+	default:	goto yy12;
+	}
+yy369:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy370;
+	}
+yy370:
+	{ return 57; }
+yy371:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy372;
+	}
+yy372:
+	{ return 58; }
+yy373:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy404;
+	default:	goto yy12;
+	}
+yy374:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy406;
+	default:	goto yy12;
+	}
+yy375:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy376;
+	}
+yy376:
+	{ return 61; }
+yy377:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'c':	goto yy408;
+	default:	goto yy12;
+	}
+yy378:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy410;
+	default:	goto yy12;
+	}
+yy379:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy380;
+	}
+yy380:
+	{ return 65; }
+yy381:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy411;
+	default:	goto yy12;
+	}
+yy382:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy412;
+	default:	goto yy12;
+	}
+yy383:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy384;
+	}
+yy384:
+	{ return 8; }
+yy385:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy414;
+	default:	goto yy12;
+	}
+yy386:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy387;
+	}
+yy387:
+	{ return 14; }
+yy388:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy416;
+	default:	goto yy12;
+	}
+yy389:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy390;
+	}
+yy390:
+	{ return 22; }
+yy391:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy418;
+	default:	goto yy12;
+	}
+yy392:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy420;
+	default:	goto yy12;
+	}
+yy393:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy394;
+	}
+yy394:
+	{ return 27; }
+yy395:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy396;
+	}
+yy396:
+	{ return 34; }
+yy397:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy398;
+	}
+yy398:
+	{ return 45; }
+yy399:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy422;
+	default:	goto yy12;
+	}
+yy400:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy401;
+	}
+yy401:
+	{ return 51; }
+yy402:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy424;
+	default:	goto yy12;
+	}
+yy403:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'b':	goto yy426;
+	default:	goto yy12;
+	}
+yy404:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy405;
+	}
+yy405:
+	{ return 59; }
+yy406:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy407;
+	}
+yy407:
+	{ return 60; }
+yy408:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy409;
+	}
+yy409:
+	{ return 62; }
+yy410:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'm':	goto yy428;
+	default:	goto yy12;
+	}
+yy411:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy430;
+	default:	goto yy12;
+	}
+yy412:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy413;
+	}
+yy413:
+	{ return 2; }
+yy414:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy415;
+	}
+yy415:
+	{ return 10; }
+yy416:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy417;
+	}
+yy417:
+	{ return 15; }
+yy418:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy419;
+	}
+yy419:
+	{ return 24; }
+yy420:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy421;
+	}
+yy421:
+	{ return 25; }
+yy422:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy423;
+	}
+yy423:
+	{ return 46; }
+yy424:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy425;
+	}
+yy425:
+	{ return 54; }
+yy426:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy427;
+	}
+yy427:
+	{ return 55; }
+yy428:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy429;
+	}
+yy429:
+	{ return 63; }
+yy430:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':	goto yy11;
+	default:	goto yy431;
+	}
+yy431:
+	{ return 68; }
+/* *********************************** */
+yyc_NUM:
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy436;
+	default:	goto yy434;
+	}
+yy434:
+	++YYCURSOR;
+	{ return -1; }
+yy436:
+	yyaccept = 0;
+	YYMARKER = ++YYCURSOR;
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '.':	goto yy439;
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy436;
+	case 'e':	goto yy441;
+	default:	goto yy438;
+	}
+yy438:
+	{ return 1; }
+yy439:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy442;
+	default:	goto yy440;
+	}
+yy440:
+	YYCURSOR = YYMARKER;
+	if (yyaccept == 0) {
+		goto yy438;
+	} else {
+		goto yy444;
+	}
+yy441:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy445;
+	default:	goto yy440;
+	}
+yy442:
+	yyaccept = 1;
+	YYMARKER = ++YYCURSOR;
+	if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy442;
+	case 'e':	goto yy447;
+	default:	goto yy444;
+	}
+yy444:
+	{ return 2; }
+yy445:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy445;
+	default:	goto yy438;
+	}
+yy447:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy448;
+	default:	goto yy440;
+	}
+yy448:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9':	goto yy448;
+	default:	goto yy444;
+	}
+}
+
+
+/* *********************************** */
+yyc_KW:
+if ((YYLIMIT - YYCURSOR) < 10) YYFILL(10);
+yych = *YYCURSOR;
+switch (yych) {
+case 'a':	goto yy454;
+case 'b':	goto yy456;
+case 'c':	goto yy457;
+case 'd':	goto yy458;
+case 'e':	goto yy459;
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+case 'x':	goto yy462;
+default:	goto yy452;
+}
+yy452:
+++YYCURSOR;
+{ return -1; }
+yy454:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':	goto yy464;
+case 'b':	goto yy465;
+case 'c':
+case 'd':
+case 'f':
+case 'j':
+case 'l':	goto yy460;
+case 'e':	goto yy466;
+case 'g':	goto yy467;
+case 'h':	goto yy468;
+case 'i':	goto yy469;
+case 'k':	goto yy470;
+case 'm':	goto yy471;
+case 'n':	goto yy472;
+case 'o':	goto yy473;
+case 'p':	goto yy474;
+default:	goto yy455;
+}
+yy455:
+{ return 0; }
+yy456:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy475;
+case 'e':	goto yy476;
+case 'f':	goto yy477;
+case 'g':	goto yy478;
+case 'h':	goto yy479;
+case 'i':	goto yy480;
+case 'j':	goto yy481;
+case 'k':	goto yy482;
+case 'l':	goto yy483;
+case 'm':	goto yy484;
+case 'n':	goto yy485;
+default:	goto yy461;
+}
+yy457:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy486;
+case 'b':	goto yy487;
+case 'c':	goto yy488;
+case 'd':	goto yy489;
+case 'e':	goto yy490;
+case 'f':	goto yy491;
+case 'g':	goto yy492;
+case 'h':	goto yy493;
+case 'i':
+case 'n':
+case 'o':	goto yy460;
+case 'j':	goto yy494;
+case 'k':	goto yy495;
+case 'l':	goto yy496;
+case 'm':	goto yy497;
+case 'p':	goto yy498;
+default:	goto yy455;
+}
+yy458:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy499;
+case 'b':	goto yy500;
+case 'c':	goto yy501;
+case 'd':
+case 'e':
+case 'g':
+case 'l':
+case 'm':
+case 'n':	goto yy460;
+case 'f':	goto yy502;
+case 'h':	goto yy503;
+case 'i':	goto yy504;
+case 'j':	goto yy505;
+case 'k':	goto yy506;
+case 'o':	goto yy507;
+case 'p':	goto yy508;
+default:	goto yy455;
+}
+yy459:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy509;
+case 'b':	goto yy510;
+case 'c':	goto yy511;
+case 'd':	goto yy512;
+case 'e':	goto yy513;
+case 'f':	goto yy514;
+case 'i':	goto yy515;
+case 'j':	goto yy516;
+default:	goto yy461;
+}
+yy460:
+++YYCURSOR;
+if (YYLIMIT <= YYCURSOR) YYFILL(1);
+yych = *YYCURSOR;
+yy461:
+switch (yych) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy455;
+}
+yy462:
+++YYCURSOR;
+yy463:
+{ return 2; }
+yy464:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy517;
+default:	goto yy461;
+}
+yy465:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy518;
+default:	goto yy461;
+}
+yy466:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy519;
+case 'h':	goto yy520;
+default:	goto yy461;
+}
+yy467:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy521;
+default:	goto yy461;
+}
+yy468:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy522;
+case 'g':	goto yy523;
+case 'k':	goto yy524;
+default:	goto yy461;
+}
+yy469:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy525;
+default:	goto yy461;
+}
+yy470:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy526;
+default:	goto yy461;
+}
+yy471:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy527;
+default:	goto yy461;
+}
+yy472:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy529;
+case 'j':	goto yy530;
+default:	goto yy461;
+}
+yy473:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy532;
+default:	goto yy461;
+}
+yy474:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy533;
+default:	goto yy461;
+}
+yy475:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy534;
+default:	goto yy461;
+}
+yy476:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy535;
+default:	goto yy461;
+}
+yy477:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy536;
+default:	goto yy461;
+}
+yy478:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy537;
+case 'n':	goto yy538;
+default:	goto yy461;
+}
+yy479:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy539;
+default:	goto yy461;
+}
+yy480:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy540;
+default:	goto yy461;
+}
+yy481:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy541;
+default:	goto yy461;
+}
+yy482:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy542;
+default:	goto yy461;
+}
+yy483:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy543;
+case 'm':	goto yy544;
+default:	goto yy461;
+}
+yy484:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy545;
+case 'i':	goto yy546;
+case 'k':	goto yy548;
+default:	goto yy461;
+}
+yy485:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy549;
+default:	goto yy461;
+}
+yy486:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy550;
+default:	goto yy461;
+}
+yy487:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy551;
+case 'l':	goto yy553;
+default:	goto yy461;
+}
+yy488:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy555;
+default:	goto yy461;
+}
+yy489:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy556;
+default:	goto yy461;
+}
+yy490:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy558;
+case 'n':	goto yy559;
+default:	goto yy461;
+}
+yy491:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy560;
+default:	goto yy461;
+}
+yy492:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy562;
+default:	goto yy461;
+}
+yy493:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy563;
+default:	goto yy461;
+}
+yy494:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy564;
+default:	goto yy461;
+}
+yy495:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy565;
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':	goto yy460;
+case 'p':	goto yy567;
+default:	goto yy455;
+}
+yy496:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'k':	goto yy568;
+default:	goto yy461;
+}
+yy497:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy569;
+default:	goto yy461;
+}
+yy498:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy570;
+default:	goto yy461;
+}
+yy499:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy571;
+default:	goto yy461;
+}
+yy500:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy572;
+default:	goto yy461;
+}
+yy501:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy573;
+case 'i':	goto yy575;
+default:	goto yy461;
+}
+yy502:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy576;
+case 'm':	goto yy577;
+default:	goto yy461;
+}
+yy503:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy578;
+default:	goto yy461;
+}
+yy504:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy579;
+default:	goto yy461;
+}
+yy505:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy580;
+case 'm':	goto yy581;
+default:	goto yy461;
+}
+yy506:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy582;
+default:	goto yy461;
+}
+yy507:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy583;
+default:	goto yy461;
+}
+yy508:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy584;
+default:	goto yy461;
+}
+yy509:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy585;
+default:	goto yy461;
+}
+yy510:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy586;
+default:	goto yy461;
+}
+yy511:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy587;
+default:	goto yy461;
+}
+yy512:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy588;
+default:	goto yy461;
+}
+yy513:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy590;
+default:	goto yy461;
+}
+yy514:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy591;
+default:	goto yy461;
+}
+yy515:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy592;
+case 'k':	goto yy594;
+case 'p':	goto yy595;
+default:	goto yy461;
+}
+yy516:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy596;
+default:	goto yy461;
+}
+yy517:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy597;
+default:	goto yy461;
+}
+yy518:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy598;
+default:	goto yy461;
+}
+yy519:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy599;
+default:	goto yy461;
+}
+yy520:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy600;
+default:	goto yy461;
+}
+yy521:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy601;
+default:	goto yy461;
+}
+yy522:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy602;
+default:	goto yy461;
+}
+yy523:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy603;
+default:	goto yy461;
+}
+yy524:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy604;
+default:	goto yy461;
+}
+yy525:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy605;
+default:	goto yy461;
+}
+yy526:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy606;
+default:	goto yy461;
+}
+yy527:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy528;
+}
+yy528:
+{ return 11; }
+yy529:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy607;
+default:	goto yy461;
+}
+yy530:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy531;
+}
+yy531:
+{ return 13; }
+yy532:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy608;
+default:	goto yy461;
+}
+yy533:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy609;
+default:	goto yy461;
+}
+yy534:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy610;
+default:	goto yy461;
+}
+yy535:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy611;
+default:	goto yy461;
+}
+yy536:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy612;
+default:	goto yy461;
+}
+yy537:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy613;
+default:	goto yy461;
+}
+yy538:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy615;
+default:	goto yy461;
+}
+yy539:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy616;
+default:	goto yy461;
+}
+yy540:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy617;
+default:	goto yy461;
+}
+yy541:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy618;
+default:	goto yy461;
+}
+yy542:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy619;
+default:	goto yy461;
+}
+yy543:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy620;
+default:	goto yy461;
+}
+yy544:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy621;
+default:	goto yy461;
+}
+yy545:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy622;
+default:	goto yy461;
+}
+yy546:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy547;
+}
+yy547:
+{ return 28; }
+yy548:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy623;
+default:	goto yy461;
+}
+yy549:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy624;
+default:	goto yy461;
+}
+yy550:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy625;
+default:	goto yy461;
+}
+yy551:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy552;
+}
+yy552:
+{ return 32; }
+yy553:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy554;
+}
+yy554:
+{ return 33; }
+yy555:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy626;
+default:	goto yy461;
+}
+yy556:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy557;
+}
+yy557:
+{ return 35; }
+yy558:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy627;
+default:	goto yy461;
+}
+yy559:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy628;
+default:	goto yy461;
+}
+yy560:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy561;
+}
+yy561:
+{ return 38; }
+yy562:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy629;
+default:	goto yy461;
+}
+yy563:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy630;
+default:	goto yy461;
+}
+yy564:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy631;
+default:	goto yy461;
+}
+yy565:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy566;
+}
+yy566:
+{ return 42; }
+yy567:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy632;
+default:	goto yy461;
+}
+yy568:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy633;
+default:	goto yy461;
+}
+yy569:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy635;
+default:	goto yy461;
+}
+yy570:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy636;
+default:	goto yy461;
+}
+yy571:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy637;
+default:	goto yy461;
+}
+yy572:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy638;
+default:	goto yy461;
+}
+yy573:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy574;
+}
+yy574:
+{ return 49; }
+yy575:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy639;
+default:	goto yy461;
+}
+yy576:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy640;
+default:	goto yy461;
+}
+yy577:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy641;
+default:	goto yy461;
+}
+yy578:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy643;
+default:	goto yy461;
+}
+yy579:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy644;
+default:	goto yy461;
+}
+yy580:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy645;
+default:	goto yy461;
+}
+yy581:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy646;
+case 'n':	goto yy647;
+default:	goto yy461;
+}
+yy582:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy648;
+default:	goto yy461;
+}
+yy583:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy649;
+default:	goto yy461;
+}
+yy584:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy650;
+default:	goto yy461;
+}
+yy585:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy651;
+default:	goto yy461;
+}
+yy586:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy652;
+default:	goto yy461;
+}
+yy587:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy653;
+default:	goto yy461;
+}
+yy588:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy589;
+}
+yy589:
+{ return 64; }
+yy590:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy654;
+default:	goto yy461;
+}
+yy591:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy655;
+default:	goto yy461;
+}
+yy592:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy593;
+}
+yy593:
+{ return 67; }
+yy594:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy657;
+default:	goto yy461;
+}
+yy595:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy658;
+default:	goto yy461;
+}
+yy596:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'k':	goto yy660;
+default:	goto yy461;
+}
+yy597:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy661;
+default:	goto yy461;
+}
+yy598:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy662;
+default:	goto yy461;
+}
+yy599:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy663;
+default:	goto yy461;
+}
+yy600:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy665;
+default:	goto yy461;
+}
+yy601:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy666;
+default:	goto yy461;
+}
+yy602:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy667;
+default:	goto yy461;
+}
+yy603:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy669;
+default:	goto yy461;
+}
+yy604:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy670;
+default:	goto yy461;
+}
+yy605:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy671;
+default:	goto yy461;
+}
+yy606:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy672;
+default:	goto yy461;
+}
+yy607:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy673;
+default:	goto yy461;
+}
+yy608:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy674;
+default:	goto yy461;
+}
+yy609:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy675;
+default:	goto yy461;
+}
+yy610:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy676;
+default:	goto yy461;
+}
+yy611:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy677;
+default:	goto yy461;
+}
+yy612:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy678;
+default:	goto yy461;
+}
+yy613:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy614;
+}
+yy614:
+{ return 19; }
+yy615:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy680;
+default:	goto yy461;
+}
+yy616:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy681;
+default:	goto yy461;
+}
+yy617:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy682;
+default:	goto yy461;
+}
+yy618:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy683;
+default:	goto yy461;
+}
+yy619:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy684;
+default:	goto yy461;
+}
+yy620:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy685;
+default:	goto yy461;
+}
+yy621:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy686;
+default:	goto yy461;
+}
+yy622:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy687;
+default:	goto yy461;
+}
+yy623:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy688;
+default:	goto yy461;
+}
+yy624:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy689;
+default:	goto yy461;
+}
+yy625:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy690;
+default:	goto yy461;
+}
+yy626:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'k':	goto yy691;
+default:	goto yy461;
+}
+yy627:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy692;
+default:	goto yy461;
+}
+yy628:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy693;
+default:	goto yy461;
+}
+yy629:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy694;
+default:	goto yy461;
+}
+yy630:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy695;
+default:	goto yy461;
+}
+yy631:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy696;
+default:	goto yy461;
+}
+yy632:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy698;
+default:	goto yy461;
+}
+yy633:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy634;
+}
+yy634:
+{ return 44; }
+yy635:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy700;
+default:	goto yy461;
+}
+yy636:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy701;
+default:	goto yy461;
+}
+yy637:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy702;
+default:	goto yy461;
+}
+yy638:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy703;
+default:	goto yy461;
+}
+yy639:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy704;
+default:	goto yy461;
+}
+yy640:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy705;
+default:	goto yy461;
+}
+yy641:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy642;
+}
+yy642:
+{ return 52; }
+yy643:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy706;
+default:	goto yy461;
+}
+yy644:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy707;
+default:	goto yy461;
+}
+yy645:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy708;
+default:	goto yy461;
+}
+yy646:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy709;
+default:	goto yy461;
+}
+yy647:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy710;
+default:	goto yy461;
+}
+yy648:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy711;
+default:	goto yy461;
+}
+yy649:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy712;
+default:	goto yy461;
+}
+yy650:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy713;
+default:	goto yy461;
+}
+yy651:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy714;
+default:	goto yy461;
+}
+yy652:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy715;
+default:	goto yy461;
+}
+yy653:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy716;
+default:	goto yy461;
+}
+yy654:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy717;
+default:	goto yy461;
+}
+yy655:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy656;
+}
+yy656:
+{ return 66; }
+yy657:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy718;
+default:	goto yy461;
+}
+yy658:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy659;
+}
+yy659:
+{ return 69; }
+yy660:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy719;
+default:	goto yy461;
+}
+yy661:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy463;
+}
+yy662:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'k':	goto yy720;
+default:	goto yy461;
+}
+yy663:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy664;
+}
+yy664:
+{ return 3; }
+yy665:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy721;
+default:	goto yy461;
+}
+yy666:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy723;
+default:	goto yy461;
+}
+yy667:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy668;
+}
+yy668:
+{ return 6; }
+yy669:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy725;
+default:	goto yy461;
+}
+yy670:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy726;
+default:	goto yy461;
+}
+yy671:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy727;
+default:	goto yy461;
+}
+yy672:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'k':	goto yy729;
+default:	goto yy461;
+}
+yy673:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy730;
+default:	goto yy461;
+}
+yy674:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy732;
+default:	goto yy461;
+}
+yy675:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy733;
+default:	goto yy461;
+}
+yy676:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy734;
+default:	goto yy461;
+}
+yy677:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy736;
+default:	goto yy461;
+}
+yy678:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy679;
+}
+yy679:
+{ return 18; }
+yy680:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy738;
+default:	goto yy461;
+}
+yy681:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy739;
+default:	goto yy461;
+}
+yy682:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy741;
+default:	goto yy461;
+}
+yy683:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy742;
+default:	goto yy461;
+}
+yy684:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy743;
+default:	goto yy461;
+}
+yy685:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy744;
+default:	goto yy461;
+}
+yy686:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy745;
+default:	goto yy461;
+}
+yy687:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy746;
+default:	goto yy461;
+}
+yy688:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy747;
+default:	goto yy461;
+}
+yy689:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy748;
+default:	goto yy461;
+}
+yy690:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy749;
+default:	goto yy461;
+}
+yy691:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy750;
+default:	goto yy461;
+}
+yy692:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy751;
+default:	goto yy461;
+}
+yy693:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy752;
+default:	goto yy461;
+}
+yy694:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy753;
+default:	goto yy461;
+}
+yy695:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy755;
+default:	goto yy461;
+}
+yy696:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy697;
+}
+yy697:
+{ return 41; }
+yy698:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy699;
+}
+yy699:
+{ return 43; }
+yy700:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy757;
+default:	goto yy461;
+}
+yy701:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy758;
+default:	goto yy461;
+}
+yy702:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy759;
+default:	goto yy461;
+}
+yy703:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy760;
+default:	goto yy461;
+}
+yy704:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy762;
+default:	goto yy461;
+}
+yy705:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy763;
+default:	goto yy461;
+}
+yy706:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy764;
+default:	goto yy461;
+}
+yy707:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy765;
+default:	goto yy461;
+}
+yy708:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy766;
+default:	goto yy461;
+}
+yy709:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'k':	goto yy767;
+default:	goto yy461;
+}
+yy710:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy769;
+default:	goto yy461;
+}
+yy711:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy770;
+default:	goto yy461;
+}
+yy712:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy771;
+default:	goto yy461;
+}
+yy713:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy772;
+default:	goto yy461;
+}
+yy714:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy773;
+default:	goto yy461;
+}
+yy715:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy774;
+default:	goto yy461;
+}
+yy716:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy775;
+default:	goto yy461;
+}
+yy717:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy776;
+default:	goto yy461;
+}
+yy718:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy777;
+default:	goto yy461;
+}
+yy719:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy778;
+default:	goto yy461;
+}
+yy720:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy780;
+default:	goto yy461;
+}
+yy721:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy722;
+}
+yy722:
+{ return 4; }
+yy723:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy724;
+}
+yy724:
+{ return 5; }
+yy725:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy781;
+default:	goto yy461;
+}
+yy726:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy783;
+default:	goto yy461;
+}
+yy727:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy728;
+}
+yy728:
+{ return 9; }
+yy729:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy784;
+default:	goto yy461;
+}
+yy730:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy731;
+}
+yy731:
+{ return 12; }
+yy732:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy785;
+default:	goto yy461;
+}
+yy733:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy786;
+default:	goto yy461;
+}
+yy734:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy735;
+}
+yy735:
+{ return 16; }
+yy736:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy737;
+}
+yy737:
+{ return 17; }
+yy738:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy787;
+default:	goto yy461;
+}
+yy739:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy740;
+}
+yy740:
+{ return 21; }
+yy741:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy789;
+default:	goto yy461;
+}
+yy742:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy790;
+default:	goto yy461;
+}
+yy743:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'k':	goto yy792;
+default:	goto yy461;
+}
+yy744:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy793;
+default:	goto yy461;
+}
+yy745:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy794;
+default:	goto yy461;
+}
+yy746:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy796;
+default:	goto yy461;
+}
+yy747:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'k':	goto yy797;
+default:	goto yy461;
+}
+yy748:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy799;
+default:	goto yy461;
+}
+yy749:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy801;
+default:	goto yy461;
+}
+yy750:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy803;
+default:	goto yy461;
+}
+yy751:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy804;
+default:	goto yy461;
+}
+yy752:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy806;
+default:	goto yy461;
+}
+yy753:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy754;
+}
+yy754:
+{ return 39; }
+yy755:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy756;
+}
+yy756:
+{ return 40; }
+yy757:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy808;
+default:	goto yy461;
+}
+yy758:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy809;
+default:	goto yy461;
+}
+yy759:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy810;
+default:	goto yy461;
+}
+yy760:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy761;
+}
+yy761:
+{ return 48; }
+yy762:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy812;
+default:	goto yy461;
+}
+yy763:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy814;
+default:	goto yy461;
+}
+yy764:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'f':	goto yy815;
+default:	goto yy461;
+}
+yy765:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy817;
+default:	goto yy461;
+}
+yy766:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy818;
+default:	goto yy461;
+}
+yy767:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy768;
+}
+yy768:
+{ return 56; }
+yy769:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy819;
+default:	goto yy461;
+}
+yy770:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy821;
+default:	goto yy461;
+}
+yy771:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy823;
+default:	goto yy461;
+}
+yy772:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy824;
+default:	goto yy461;
+}
+yy773:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy825;
+default:	goto yy461;
+}
+yy774:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'k':	goto yy827;
+default:	goto yy461;
+}
+yy775:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy828;
+default:	goto yy461;
+}
+yy776:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy829;
+default:	goto yy461;
+}
+yy777:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy831;
+default:	goto yy461;
+}
+yy778:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy779;
+}
+yy779:
+{ return 70; }
+yy780:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'j':	goto yy832;
+default:	goto yy461;
+}
+yy781:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy782;
+}
+yy782:
+{ return 7; }
+yy783:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy833;
+default:	goto yy461;
+}
+yy784:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy835;
+default:	goto yy461;
+}
+yy785:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy836;
+default:	goto yy461;
+}
+yy786:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy838;
+default:	goto yy461;
+}
+yy787:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy788;
+}
+yy788:
+{ return 20; }
+yy789:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy839;
+default:	goto yy461;
+}
+yy790:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy791;
+}
+yy791:
+{ return 23; }
+yy792:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy841;
+default:	goto yy461;
+}
+yy793:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy842;
+default:	goto yy461;
+}
+yy794:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy795;
+}
+yy795:
+{ return 26; }
+yy796:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy843;
+default:	goto yy461;
+}
+yy797:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy798;
+}
+yy798:
+{ return 29; }
+yy799:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy800;
+}
+yy800:
+{ return 30; }
+yy801:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy802;
+}
+yy802:
+{ return 31; }
+yy803:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'a':	goto yy845;
+default:	goto yy461;
+}
+yy804:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy805;
+}
+yy805:
+{ return 36; }
+yy806:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy807;
+}
+yy807:
+{ return 37; }
+yy808:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'p':	goto yy847;
+default:	goto yy461;
+}
+yy809:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'k':	goto yy849;
+default:	goto yy461;
+}
+yy810:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy811;
+}
+yy811:
+{ return 47; }
+yy812:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy813;
+}
+yy813:
+{ return 50; }
+yy814:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy850;
+default:	goto yy461;
+}
+yy815:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy816;
+}
+yy816:
+{ return 53; }
+yy817:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy852;
+default:	goto yy461;
+}
+yy818:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy853;
+default:	goto yy461;
+}
+yy819:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy820;
+}
+yy820:
+{ return 57; }
+yy821:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy822;
+}
+yy822:
+{ return 58; }
+yy823:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy854;
+default:	goto yy461;
+}
+yy824:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'e':	goto yy856;
+default:	goto yy461;
+}
+yy825:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy826;
+}
+yy826:
+{ return 61; }
+yy827:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'c':	goto yy858;
+default:	goto yy461;
+}
+yy828:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'd':	goto yy860;
+default:	goto yy461;
+}
+yy829:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy830;
+}
+yy830:
+{ return 65; }
+yy831:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'n':	goto yy861;
+default:	goto yy461;
+}
+yy832:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy862;
+default:	goto yy461;
+}
+yy833:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy834;
+}
+yy834:
+{ return 8; }
+yy835:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy864;
+default:	goto yy461;
+}
+yy836:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy837;
+}
+yy837:
+{ return 14; }
+yy838:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'h':	goto yy866;
+default:	goto yy461;
+}
+yy839:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy840;
+}
+yy840:
+{ return 22; }
+yy841:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'o':	goto yy868;
+default:	goto yy461;
+}
+yy842:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'g':	goto yy870;
+default:	goto yy461;
+}
+yy843:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy844;
+}
+yy844:
+{ return 27; }
+yy845:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy846;
+}
+yy846:
+{ return 34; }
+yy847:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy848;
+}
+yy848:
+{ return 45; }
+yy849:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'i':	goto yy872;
+default:	goto yy461;
+}
+yy850:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy851;
+}
+yy851:
+{ return 51; }
+yy852:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy874;
+default:	goto yy461;
+}
+yy853:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'b':	goto yy876;
+default:	goto yy461;
+}
+yy854:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy855;
+}
+yy855:
+{ return 59; }
+yy856:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy857;
+}
+yy857:
+{ return 60; }
+yy858:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy859;
+}
+yy859:
+{ return 62; }
+yy860:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'm':	goto yy878;
+default:	goto yy461;
+}
+yy861:
+yych = *++YYCURSOR;
+switch (yych) {
+case 'l':	goto yy880;
+default:	goto yy461;
+}
+yy862:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy863;
+}
+yy863:
+{ return 2; }
+yy864:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy865;
+}
+yy865:
+{ return 10; }
+yy866:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy867;
+}
+yy867:
+{ return 15; }
+yy868:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy869;
+}
+yy869:
+{ return 24; }
+yy870:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy871;
+}
+yy871:
+{ return 25; }
+yy872:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy873;
+}
+yy873:
+{ return 46; }
+yy874:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy875;
+}
+yy875:
+{ return 54; }
+yy876:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy877;
+}
+yy877:
+{ return 55; }
+yy878:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy879;
+}
+yy879:
+{ return 63; }
+yy880:
+++YYCURSOR;
+switch ((yych = *YYCURSOR)) {
+case 'a':
+case 'b':
+case 'c':
+case 'd':
+case 'e':
+case 'f':
+case 'g':
+case 'h':
+case 'i':
+case 'j':
+case 'k':
+case 'l':
+case 'm':
+case 'n':
+case 'o':
+case 'p':	goto yy460;
+default:	goto yy881;
+}
+yy881:
+{ return 68; }
+/* *********************************** */
+yyc_NUM:
+if (YYLIMIT <= YYCURSOR) YYFILL(1);
+yych = *YYCURSOR;
+switch (yych) {
+case '0':
+case '1':
+case '2':
+case '3':
+case '4':
+case '5':
+case '6':
+case '7':
+case '8':
+case '9':	goto yy886;
+case 'y':	goto yy889;
+default:	goto yy884;
+}
+yy884:
+++YYCURSOR;
+{ return -1; }
+yy886:
+yyaccept = 0;
+YYMARKER = ++YYCURSOR;
+if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+yych = *YYCURSOR;
+switch (yych) {
+case '.':	goto yy891;
+case '0':
+case '1':
+case '2':
+case '3':
+case '4':
+case '5':
+case '6':
+case '7':
+case '8':
+case '9':	goto yy886;
+case 'e':	goto yy893;
+default:	goto yy888;
+}
+yy888:
+{ return 1; }
+yy889:
+++YYCURSOR;
+{ return 3; }
+yy891:
+yych = *++YYCURSOR;
+switch (yych) {
+case '0':
+case '1':
+case '2':
+case '3':
+case '4':
+case '5':
+case '6':
+case '7':
+case '8':
+case '9':	goto yy894;
+default:	goto yy892;
+}
+yy892:
+YYCURSOR = YYMARKER;
+if (yyaccept == 0) {
+	goto yy888;
+} else {
+	goto yy896;
+}
+yy893:
+yych = *++YYCURSOR;
+switch (yych) {
+case '0':
+case '1':
+case '2':
+case '3':
+case '4':
+case '5':
+case '6':
+case '7':
+case '8':
+case '9':	goto yy897;
+default:	goto yy892;
+}
+yy894:
+yyaccept = 1;
+YYMARKER = ++YYCURSOR;
+if ((YYLIMIT - YYCURSOR) < 2) YYFILL(2);
+yych = *YYCURSOR;
+switch (yych) {
+case '0':
+case '1':
+case '2':
+case '3':
+case '4':
+case '5':
+case '6':
+case '7':
+case '8':
+case '9':	goto yy894;
+case 'e':	goto yy899;
+default:	goto yy896;
+}
+yy896:
+{ return 2; }
+yy897:
+++YYCURSOR;
+if (YYLIMIT <= YYCURSOR) YYFILL(1);
+yych = *YYCURSOR;
+switch (yych) {
+case '0':
+case '1':
+case '2':
+case '3':
+case '4':
+case '5':
+case '6':
+case '7':
+case '8':
+case '9':	goto yy897;
+default:	goto yy888;
+}
+yy899:
+yych = *++YYCURSOR;
+switch (yych) {
+case '0':
+case '1':
+case '2':
+case '3':
+case '4':
+case '5':
+case '6':
+case '7':
+case '8':
+case '9':	goto yy900;
+default:	goto yy892;
+}
+yy900:
+++YYCURSOR;
+if (YYLIMIT <= YYCURSOR) YYFILL(1);
+yych = *YYCURSOR;
+switch (yych) {
+case '0':
+case '1':
+case '2':
+case '3':
+case '4':
+case '5':
+case '6':
+case '7':
+case '8':
+case '9':	goto yy900;
+default:	goto yy896;
+}
+
+streamed output: same as stdout
+over 64K
@@ -0,0 +1,9 @@
+# output to a file is streamed (and here spilled to a temporary file,
+# as YYMAXFILL is needed at the top); output to stdout is not streamed
+# and must be the same
+$re2c $switches "$outx" || exit 1
+$re2c `echo $switches | sed "s/-o $outc//"` "$outx" \
+	| sed "s/<stdout>/$outc/" > stdout.c
+cmp stdout.c "$outc" && echo "streamed output: same as stdout"
+wc -c < "$outc" | awk '{ print ($1 > 65536 ? "over" : "under") " 64K" }'
+rm stdout.c
@@ -0,0 +1,1250 @@
+/* Generated by re2c */
+#line 1 "table_01.--table.re"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define	ADDEQ	257
+#define	ANDAND	258
+#define	ANDEQ	259
+#define	ARRAY	260
+#define	ASM	261
+#define	AUTO	262
+#define	BREAK	263
+#define	CASE	264
+#define	CHAR	265
+#define	CONST	266
+#define	CONTINUE	267
+#define	DECR	268
+#define	DEFAULT	269
+#define	DEREF	270
+#define	DIVEQ	271
+#define	DO	272
+#define	DOUBLE	273
+#define	ELLIPSIS	274
+#define	ELSE	275
+#define	ENUM	276
+#define	EQL	277
+#define	EXTERN	278
+#define	FCON	279
+#define	FLOAT	280
+#define	FOR	281
+#define	FUNCTION	282
+#define	GEQ	283
+#define	GOTO	284
+#define	ICON	285
+#define	ID	286
+#define	IF	287
+#define	INCR	288
+#define	INT	289
+#define	LEQ	290
+#define	LONG	291
+#define	LSHIFT	292
+#define	LSHIFTEQ	293
+#define	MODEQ	294
+#define	MULEQ	295
+#define	NEQ	296
+#define	OREQ	297
+#define	OROR	298
+#define	POINTER	299
+#define	REGISTER	300
+#define	RETURN	301
+#define	RSHIFT	302
+#define	RSHIFTEQ	303
+#define	SCON	304
+#define	SHORT	305
+#define	SIGNED	306
+#define	SIZEOF	307
+#define	STATIC	308
+#define	STRUCT	309
+#define	SUBEQ	310
+#define	SWITCH	311
+#define	TYPEDEF	312
+#define	UNION	313
+#define	UNSIGNED	314
+#define	VOID	315
+#define	VOLATILE	316
+#define	WHILE	317
+#define	XOREQ	318
+#define	EOI	319
+
+typedef unsigned int uint;
+typedef unsigned char uchar;
+
+#define	BSIZE	8192
+
+#define	YYCTYPE		uchar
+#define	YYCURSOR	cursor
+#define	YYLIMIT		s->lim
+#define	YYMARKER	s->ptr
+#define	YYFILL(n)	{cursor = fill(s, cursor);}
+
+#define	RET(i)	{s->cur = cursor; return i;}
+
+typedef struct Scanner {
+    int			fd;
+    uchar		*bot, *tok, *ptr, *cur, *pos, *lim, *top, *eof;
+    uint		line;
+} Scanner;
+
+uchar *fill(Scanner *s, uchar *cursor){
+	if(!s->eof) {
+		uint cnt = s->tok - s->bot;
+		if(cnt){
+			memcpy(s->bot, s->tok, s->lim - s->tok);
+			s->tok = s->bot;
+			s->ptr -= cnt;
+			cursor -= cnt;
+			s->pos -= cnt;
+			s->lim -= cnt;
+		}
+		if((s->top - s->lim) < BSIZE){
+			uchar *buf = (uchar*) malloc(((s->lim - s->bot) + BSIZE)*sizeof(uchar));
+			memcpy(buf, s->tok, s->lim - s->tok);
+			s->tok = buf;
+			s->ptr = &buf[s->ptr - s->bot];
+			cursor = &buf[cursor - s->bot];
+			s->pos = &buf[s->pos - s->bot];
+			s->lim = &buf[s->lim - s->bot];
+			s->top = &s->lim[BSIZE];
+			free(s->bot);
+			s->bot = buf;
+		}
+		if((cnt = read(s->fd, (char*) s->lim, BSIZE)) != BSIZE){
+			s->eof = &s->lim[cnt]; *(s->eof)++ = '\n';
+		}
+		s->lim += cnt;
+	}
+	return cursor;
+}
+
+int scan(Scanner *s){
+	uchar *cursor = s->cur;
+std:
+	s->tok = cursor;
+#line 133 "table_01.--table.re"
+
+
+
+#line 130 "table_01.--table.c"
+{
+	YYCTYPE yych;
+	unsigned int yyaccept = 0;
+	{
+		static const unsigned char yytcls[256] = {
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 4, 4, 4,
+			4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+			5, 6, 7, 8, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+			20, 21, 21, 21, 21, 21, 21, 21, 22, 22, 23, 24, 25, 26, 27, 28,
+			29, 30, 30, 30, 30, 31, 32, 33, 33, 33, 33, 33, 34, 35, 35, 35,
+			35, 35, 35, 35, 35, 36, 37, 37, 38, 39, 39, 40, 41, 42, 43, 44,
+			45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60,
+			61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+			76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+			76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+			76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+			76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+			76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+			76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+			76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+			76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+		};
+		static const unsigned char yytact[310] = {
+			1, 129, 16, 129, 0, 16, 129, 16, 1, 16, 7, 1, 16, 1, 16, 7,
+			129, 16, 129, 16, 1, 16, 1, 16, 129, 16, 1, 16, 7, 16, 1, 16,
+			7, 16, 135, 0, 129, 16, 129, 16, 1, 16, 1, 16, 1, 16, 129, 16,
+			129, 0, 16, 129, 16, 129, 16, 1, 16, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1, 129, 16, 1, 16, 129, 16, 129, 16,
+			129, 16, 129, 0, 8, 129, 16, 1, 129, 16, 129, 16, 129, 16, 129, 0,
+			129, 1, 129, 16, 129, 16, 129, 16, 129, 16, 129, 16, 129, 16, 1, 135,
+			0, 16, 129, 16, 129, 16, 1, 129, 0, 1, 1, 16, 129, 16, 129, 16,
+			129, 16, 1, 16, 129, 16, 1, 1, 1, 1, 1, 1, 1, 16, 1, 1,
+			1, 1, 1, 1, 1, 16, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 129, 16, 129, 16, 1, 1, 129, 16, 129, 1, 129, 0, 129, 0, 129,
+			16, 129, 16, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 16,
+			1, 1, 16, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 16, 1, 1, 16, 1, 16, 1, 1, 1, 1, 1, 16, 1,
+			16, 1, 1, 1, 16, 1, 16, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 16, 1, 1, 1, 16, 1, 16, 1, 1, 1, 1, 1, 16,
+			1, 1, 1, 16, 1, 1, 1, 1, 1, 1, 1, 16, 1, 1, 1, 16,
+			1, 1, 1, 16, 1, 16, 1, 1, 16, 1, 16, 1, 16, 1, 16, 1,
+			16, 1, 16, 1, 1, 1, 1, 1, 16, 1, 1, 16, 1, 1, 1, 16,
+			1, 16, 1, 16, 1, 16,
+		};
+		static const unsigned char yytfill[310] = {
+			9, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0,
+			0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+			0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0,
+		};
+		static const unsigned char yytsave[310] = {
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+			2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0,
+		};
+		static const unsigned char yytaccept[4] = {
+			2, 29, 33, 113,
+		};
+		static const unsigned char yytdef[310] = {
+			48, 2, 0, 4, 5, 0, 7, 0, 9, 0, 83, 12, 0, 14, 0, 95,
+			17, 0, 19, 0, 21, 0, 23, 0, 25, 0, 27, 0, 29, 0, 31, 0,
+			33, 0, 35, 33, 37, 0, 39, 0, 41, 0, 43, 0, 45, 0, 47, 0,
+			49, 48, 0, 52, 0, 54, 0, 56, 0, 49, 49, 49, 49, 49, 49, 49,
+			49, 49, 49, 49, 49, 49, 49, 49, 73, 0, 75, 0, 77, 0, 79, 0,
+			81, 0, 83, 82, 0, 86, 0, 84, 89, 0, 91, 0, 93, 0, 95, 94,
+			33, 84, 99, 0, 101, 0, 103, 0, 105, 0, 107, 0, 109, 0, 84, 112,
+			113, 0, 115, 0, 117, 0, 84, 120, 33, 84, 123, 0, 125, 0, 127, 0,
+			129, 0, 131, 0, 133, 0, 49, 49, 49, 49, 49, 49, 48, 0, 49, 49,
+			49, 49, 49, 49, 48, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+			49, 162, 0, 164, 0, 84, 84, 168, 0, 113, 84, 172, 113, 174, 33, 176,
+			0, 178, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 48, 0,
+			49, 48, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+			49, 49, 48, 0, 49, 48, 0, 48, 0, 49, 49, 49, 49, 48, 0, 48,
+			0, 49, 49, 48, 0, 48, 0, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+			49, 49, 48, 0, 49, 49, 48, 0, 48, 0, 49, 49, 49, 49, 48, 0,
+			49, 49, 48, 0, 49, 49, 49, 49, 49, 49, 48, 0, 49, 49, 48, 0,
+			49, 49, 48, 0, 48, 0, 49, 48, 0, 48, 0, 48, 0, 48, 0, 48,
+			0, 48, 0, 49, 49, 49, 49, 48, 0, 49, 48, 0, 49, 49, 48, 0,
+			48, 0, 48, 0, 48, 0,
+		};
+		static const unsigned short yytbase[310] = {
+			0, 0, 0, 0, 110, 0, 0, 0, 5, 0, 32, 27, 0, 106, 0, 112,
+			0, 0, 0, 0, 163, 0, 18, 0, 0, 0, 44, 0, 38, 0, 121, 0,
+			2631, 0, 0, 2637, 0, 0, 0, 0, 13, 0, 190, 0, 165, 0, 0, 0,
+			0, 154, 0, 0, 0, 0, 0, 191, 0, 152, 159, 9, 71, 77, 88, 163,
+			147, 165, 214, 76, 195, 207, 207, 215, 0, 0, 114, 0, 0, 0, 0, 0,
+			0, 0, 0, 413, 0, 0, 0, 2578, 0, 0, 0, 0, 0, 0, 0, 490,
+			0, 2581, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 251, 0,
+			385, 0, 0, 0, 0, 0, 15, 0, 76, 77, 244, 0, 0, 0, 0, 0,
+			0, 0, 249, 0, 0, 0, 218, 234, 221, 240, 228, 237, 77, 0, 225, 224,
+			226, 232, 230, 229, 231, 0, 230, 237, 156, 237, 141, 161, 244, 238, 155, 156,
+			246, 0, 0, 0, 0, 231, 308, 0, 0, 0, 117, 0, 462, 0, 154, 0,
+			0, 0, 0, 241, 256, 291, 279, 150, 297, 297, 295, 288, 297, 306, 308, 0,
+			300, 385, 0, 309, 308, 297, 301, 306, 316, 302, 302, 304, 320, 311, 318, 324,
+			328, 318, 462, 0, 320, 539, 0, 616, 0, 312, 324, 313, 361, 693, 0, 770,
+			0, 358, 357, 847, 0, 924, 0, 359, 361, 364, 381, 372, 379, 386, 389, 389,
+			380, 388, 1001, 0, 376, 393, 1078, 0, 1155, 0, 385, 388, 396, 388, 1232, 0,
+			383, 390, 1309, 0, 401, 400, 404, 388, 402, 406, 1386, 0, 434, 441, 1463, 0,
+			431, 433, 1540, 0, 1617, 0, 449, 1694, 0, 1771, 0, 1848, 0, 1925, 0, 2002,
+			0, 2079, 0, 449, 456, 451, 459, 2156, 0, 447, 2233, 0, 462, 462, 2310, 0,
+			2387, 0, 2464, 0, 2541, 0,
+		};
+		static const unsigned short yytnext[2714] = {
+			1, 3, 6, 3, 1, 3, 8, 10, 1, 11, 13, 15, 16, 18, 20, 22,
+			24, 26, 28, 30, 32, 34, 34, 36, 38, 40, 42, 44, 46, 1, 170, 80,
+			170, 100, 2, 171, 171, 171, 122, 124, 51, 1, 53, 55, 102, 1, 57, 58,
+			59, 60, 61, 62, 63, 88, 64, 136, 110, 65, 111, 111, 111, 104, 137, 66,
+			67, 68, 69, 70, 71, 138, 106, 108, 72, 74, 76, 78, 1, 141, 141, 141,
+			141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+			141, 173, 173, 173, 141, 141, 141, 141, 141, 141, 141, 173, 173, 173, 119, 3,
+			119, 3, 2, 3, 90, 141, 141, 141, 141, 139, 141, 173, 173, 173, 173, 173,
+			173, 153, 154, 140, 92, 119, 142, 114, 143, 171, 171, 171, 161, 155, 119, 185,
+			156, 145, 144, 116, 146, 141, 141, 141, 141, 141, 50, 50, 50, 50, 50, 50,
+			50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 173, 173,
+			173, 50, 50, 50, 50, 50, 50, 50, 173, 173, 173, 163, 119, 98, 119, 128,
+			130, 199, 50, 50, 50, 50, 148, 50, 173, 173, 173, 173, 173, 173, 150, 201,
+			196, 205, 207, 119, 200, 208, 217, 218, 126, 132, 134, 206, 119, 197, 135, 147,
+			202, 151, 50, 50, 50, 50, 50, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+			149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 82, 82, 82, 149, 149,
+			149, 149, 149, 149, 149, 82, 82, 82, 152, 157, 158, 159, 160, 167, 175, 149,
+			149, 149, 149, 177, 149, 82, 82, 82, 82, 82, 82, 179, 180, 181, 182, 183,
+			184, 186, 187, 188, 189, 190, 192, 193, 195, 198, 203, 204, 209, 210, 212, 149,
+			149, 149, 149, 149, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191, 191,
+			191, 191, 191, 191, 191, 191, 191, 191, 94, 94, 94, 191, 191, 191, 191, 191,
+			191, 191, 94, 94, 94, 213, 215, 219, 220, 221, 223, 225, 191, 191, 191, 191,
+			226, 191, 94, 94, 94, 94, 94, 94, 227, 229, 231, 232, 233, 234, 235, 236,
+			237, 238, 239, 240, 241, 242, 244, 245, 246, 248, 250, 251, 191, 191, 191, 191,
+			191, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+			194, 194, 194, 194, 194, 111, 111, 111, 194, 194, 194, 194, 194, 194, 194, 84,
+			118, 169, 252, 169, 85, 253, 254, 256, 257, 194, 194, 194, 194, 258, 194, 260,
+			261, 262, 263, 118, 169, 264, 265, 266, 268, 269, 169, 270, 272, 273, 274, 276,
+			278, 279, 281, 283, 285, 287, 87, 289, 291, 194, 194, 194, 194, 194, 211, 211,
+			211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+			211, 211, 171, 171, 171, 211, 211, 211, 211, 211, 211, 211, 84, 292, 169, 293,
+			169, 294, 295, 297, 298, 96, 211, 211, 211, 211, 300, 211, 301, 302, 304, 306,
+			308, 169, 0, 0, 0, 0, 0, 169, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 97, 0, 0, 211, 211, 211, 211, 211, 214, 214, 214, 214, 214,
+			214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 0,
+			0, 0, 214, 214, 214, 214, 214, 214, 214, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 214, 214, 214, 214, 0, 214, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 214, 214, 214, 214, 214, 216, 216, 216, 216, 216, 216, 216, 216,
+			216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 0, 0, 0, 216,
+			216, 216, 216, 216, 216, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			216, 216, 216, 216, 0, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			216, 216, 216, 216, 216, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+			222, 222, 222, 222, 222, 222, 222, 222, 222, 0, 0, 0, 222, 222, 222, 222,
+			222, 222, 222, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 222, 222,
+			222, 0, 222, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 222, 222,
+			222, 222, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+			224, 224, 224, 224, 224, 224, 0, 0, 0, 224, 224, 224, 224, 224, 224, 224,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 224, 224, 224, 0, 224,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 224, 224, 224, 224, 228,
+			228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+			228, 228, 228, 0, 0, 0, 228, 228, 228, 228, 228, 228, 228, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 228, 228, 228, 228, 0, 228, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 228, 228, 228, 228, 228, 230, 230, 230, 230,
+			230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+			0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 230, 230, 230, 230, 0, 230, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 230, 230, 230, 230, 230, 243, 243, 243, 243, 243, 243, 243,
+			243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 0, 0, 0,
+			243, 243, 243, 243, 243, 243, 243, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 243, 243, 243, 243, 0, 243, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 243, 243, 243, 243, 243, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+			247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 0, 0, 0, 247, 247, 247,
+			247, 247, 247, 247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 247, 247,
+			247, 247, 0, 247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 247, 247,
+			247, 247, 247, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+			249, 249, 249, 249, 249, 249, 249, 0, 0, 0, 249, 249, 249, 249, 249, 249,
+			249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 249, 249, 249, 0,
+			249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 249, 249, 249, 249,
+			255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+			255, 255, 255, 255, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 255, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 259, 259, 259,
+			259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259,
+			259, 0, 0, 0, 259, 259, 259, 259, 259, 259, 259, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 259, 259, 259, 259, 0, 259, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 259, 259, 259, 259, 259, 267, 267, 267, 267, 267, 267,
+			267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 267, 0, 0,
+			0, 267, 267, 267, 267, 267, 267, 267, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 267, 267, 267, 267, 0, 267, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 267, 267, 267, 267, 267, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+			271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 0, 0, 0, 271, 271,
+			271, 271, 271, 271, 271, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 271,
+			271, 271, 271, 0, 271, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 271,
+			271, 271, 271, 271, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+			275, 275, 275, 275, 275, 275, 275, 275, 0, 0, 0, 275, 275, 275, 275, 275,
+			275, 275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 275, 275, 275, 275,
+			0, 275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 275, 275, 275, 275,
+			275, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+			277, 277, 277, 277, 277, 0, 0, 0, 277, 277, 277, 277, 277, 277, 277, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 277, 277, 277, 277, 0, 277, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 277, 277, 277, 277, 277, 280, 280,
+			280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280,
+			280, 280, 0, 0, 0, 280, 280, 280, 280, 280, 280, 280, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 280, 280, 280, 280, 0, 280, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 280, 280, 280, 280, 280, 282, 282, 282, 282, 282,
+			282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 0,
+			0, 0, 282, 282, 282, 282, 282, 282, 282, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 282, 282, 282, 282, 0, 282, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 282, 282, 282, 282, 282, 284, 284, 284, 284, 284, 284, 284, 284,
+			284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 0, 0, 0, 284,
+			284, 284, 284, 284, 284, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			284, 284, 284, 284, 0, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			284, 284, 284, 284, 284, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286,
+			286, 286, 286, 286, 286, 286, 286, 286, 286, 0, 0, 0, 286, 286, 286, 286,
+			286, 286, 286, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 286, 286, 286,
+			286, 0, 286, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 286, 286, 286,
+			286, 286, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+			288, 288, 288, 288, 288, 288, 0, 0, 0, 288, 288, 288, 288, 288, 288, 288,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 288, 288, 288, 0, 288,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 288, 288, 288, 288, 288, 290,
+			290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290,
+			290, 290, 290, 0, 0, 0, 290, 290, 290, 290, 290, 290, 290, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 290, 290, 290, 290, 0, 290, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 290, 290, 290, 290, 290, 296, 296, 296, 296,
+			296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296, 296,
+			0, 0, 0, 296, 296, 296, 296, 296, 296, 296, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 296, 296, 296, 296, 0, 296, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 296, 296, 296, 296, 296, 299, 299, 299, 299, 299, 299, 299,
+			299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 0, 0, 0,
+			299, 299, 299, 299, 299, 299, 299, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 299, 299, 299, 299, 0, 299, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 299, 299, 299, 299, 299, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303,
+			303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 0, 0, 0, 303, 303, 303,
+			303, 303, 303, 303, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 303, 303,
+			303, 303, 0, 303, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 303, 303,
+			303, 303, 303, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+			305, 305, 305, 305, 305, 305, 305, 0, 0, 0, 305, 305, 305, 305, 305, 305,
+			305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 0,
+			305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305,
+			307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307, 307,
+			307, 307, 307, 307, 0, 0, 0, 307, 307, 307, 307, 307, 307, 307, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 307, 307, 307, 307, 0, 307, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 307, 307, 307, 307, 307, 309, 309, 309,
+			309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309,
+			309, 0, 0, 0, 309, 309, 309, 309, 309, 309, 309, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 309, 309, 309, 309, 82, 309, 0, 94, 82, 0, 0,
+			94, 0, 0, 0, 0, 0, 82, 82, 0, 94, 94, 0, 0, 0, 82, 0,
+			0, 94, 0, 0, 0, 309, 309, 309, 309, 309, 0, 82, 0, 0, 94, 0,
+			82, 82, 0, 94, 94, 82, 0, 0, 94, 0, 0, 0, 0, 82, 0, 0,
+			94, 82, 0, 82, 94, 82, 94, 165, 94, 111, 166, 34, 34, 34, 0, 111,
+			0, 34, 34, 34, 0, 0, 118, 0, 0, 119, 0, 119, 118, 121, 0, 119,
+			0, 119, 0, 0, 0, 0, 0, 0, 0, 118, 0, 0, 0, 0, 0, 118,
+			119, 0, 0, 0, 0, 0, 119, 0, 0, 119, 0, 0, 121, 0, 0, 119,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		};
+		static const unsigned short yytcheck[2714] = {
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 8,
+			118, 22, 10, 118, 118, 118, 40, 40, 0, 0, 0, 0, 22, 0, 0, 0,
+			0, 0, 0, 0, 0, 11, 0, 59, 28, 0, 28, 28, 28, 26, 59, 0,
+			0, 0, 0, 0, 0, 59, 26, 26, 0, 0, 0, 0, 0, 140, 140, 140,
+			140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+			140, 121, 121, 121, 140, 140, 140, 140, 140, 140, 140, 121, 121, 121, 120, 4,
+			120, 4, 15, 4, 13, 140, 140, 140, 140, 60, 140, 121, 121, 121, 121, 121,
+			121, 67, 67, 60, 13, 120, 61, 30, 61, 170, 170, 170, 74, 67, 120, 140,
+			67, 62, 61, 30, 62, 140, 140, 140, 140, 140, 49, 49, 49, 49, 49, 49,
+			49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 174, 174,
+			174, 49, 49, 49, 49, 49, 49, 49, 174, 174, 174, 74, 174, 20, 174, 44,
+			44, 154, 49, 49, 49, 49, 64, 49, 174, 174, 174, 174, 174, 174, 64, 155,
+			152, 158, 159, 174, 154, 159, 183, 183, 42, 55, 57, 158, 174, 152, 58, 63,
+			155, 65, 49, 49, 49, 49, 49, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+			148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 165, 165, 165, 148, 148,
+			148, 148, 148, 148, 148, 165, 165, 165, 66, 68, 69, 70, 71, 110, 122, 148,
+			148, 148, 148, 130, 148, 165, 165, 165, 165, 165, 165, 134, 135, 136, 137, 138,
+			139, 142, 143, 144, 145, 146, 147, 150, 151, 153, 156, 157, 160, 179, 180, 148,
+			148, 148, 148, 148, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+			190, 190, 190, 190, 190, 190, 190, 190, 166, 166, 166, 190, 190, 190, 190, 190,
+			190, 190, 166, 166, 166, 181, 182, 184, 185, 186, 187, 188, 190, 190, 190, 190,
+			189, 190, 166, 166, 166, 166, 166, 166, 192, 195, 196, 197, 198, 199, 200, 201,
+			202, 203, 204, 205, 206, 207, 208, 209, 212, 217, 218, 219, 190, 190, 190, 190,
+			190, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+			193, 193, 193, 193, 193, 112, 112, 112, 193, 193, 193, 193, 193, 193, 193, 83,
+			112, 112, 220, 112, 83, 225, 226, 231, 232, 193, 193, 193, 193, 233, 193, 234,
+			235, 236, 237, 112, 112, 238, 239, 240, 241, 244, 112, 245, 250, 251, 252, 253,
+			256, 257, 260, 261, 262, 263, 83, 264, 265, 193, 193, 193, 193, 193, 210, 210,
+			210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+			210, 210, 172, 172, 172, 210, 210, 210, 210, 210, 210, 210, 95, 268, 172, 269,
+			172, 272, 273, 278, 291, 95, 210, 210, 210, 210, 292, 210, 293, 294, 297, 300,
+			301, 172, 310, 310, 310, 310, 310, 172, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 95, 310, 310, 210, 210, 210, 210, 210, 213, 213, 213, 213, 213,
+			213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 310,
+			310, 310, 213, 213, 213, 213, 213, 213, 213, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 213, 213, 213, 213, 310, 213, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 213, 213, 213, 213, 213, 215, 215, 215, 215, 215, 215, 215, 215,
+			215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 310, 310, 310, 215,
+			215, 215, 215, 215, 215, 215, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			215, 215, 215, 215, 310, 215, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			215, 215, 215, 215, 215, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+			221, 221, 221, 221, 221, 221, 221, 221, 221, 310, 310, 310, 221, 221, 221, 221,
+			221, 221, 221, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 221, 221, 221,
+			221, 310, 221, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 221, 221, 221,
+			221, 221, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+			223, 223, 223, 223, 223, 223, 310, 310, 310, 223, 223, 223, 223, 223, 223, 223,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 223, 223, 223, 223, 310, 223,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 223, 223, 223, 223, 223, 227,
+			227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+			227, 227, 227, 310, 310, 310, 227, 227, 227, 227, 227, 227, 227, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 227, 227, 227, 227, 310, 227, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 227, 227, 227, 227, 227, 229, 229, 229, 229,
+			229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+			310, 310, 310, 229, 229, 229, 229, 229, 229, 229, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 229, 229, 229, 229, 310, 229, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 229, 229, 229, 229, 229, 242, 242, 242, 242, 242, 242, 242,
+			242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 310, 310, 310,
+			242, 242, 242, 242, 242, 242, 242, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 242, 242, 242, 242, 310, 242, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 242, 242, 242, 242, 242, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246,
+			246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 310, 310, 310, 246, 246, 246,
+			246, 246, 246, 246, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 246, 246,
+			246, 246, 310, 246, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 246, 246,
+			246, 246, 246, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+			248, 248, 248, 248, 248, 248, 248, 310, 310, 310, 248, 248, 248, 248, 248, 248,
+			248, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 248, 248, 248, 248, 310,
+			248, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 248, 248, 248, 248, 248,
+			254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+			254, 254, 254, 254, 310, 310, 310, 254, 254, 254, 254, 254, 254, 254, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 254, 254, 254, 254, 310, 254, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 254, 254, 254, 254, 254, 258, 258, 258,
+			258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+			258, 310, 310, 310, 258, 258, 258, 258, 258, 258, 258, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 258, 258, 258, 258, 310, 258, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 258, 258, 258, 258, 258, 266, 266, 266, 266, 266, 266,
+			266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 310, 310,
+			310, 266, 266, 266, 266, 266, 266, 266, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 266, 266, 266, 266, 310, 266, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 266, 266, 266, 266, 266, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+			270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 310, 310, 310, 270, 270,
+			270, 270, 270, 270, 270, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 270,
+			270, 270, 270, 310, 270, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 270,
+			270, 270, 270, 270, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+			274, 274, 274, 274, 274, 274, 274, 274, 310, 310, 310, 274, 274, 274, 274, 274,
+			274, 274, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 274, 274, 274, 274,
+			310, 274, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 274, 274, 274, 274,
+			274, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+			276, 276, 276, 276, 276, 310, 310, 310, 276, 276, 276, 276, 276, 276, 276, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 276, 276, 276, 276, 310, 276, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 276, 276, 276, 276, 276, 279, 279,
+			279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279,
+			279, 279, 310, 310, 310, 279, 279, 279, 279, 279, 279, 279, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 279, 279, 279, 279, 310, 279, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 279, 279, 279, 279, 279, 281, 281, 281, 281, 281,
+			281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 310,
+			310, 310, 281, 281, 281, 281, 281, 281, 281, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 281, 281, 281, 281, 310, 281, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 281, 281, 281, 281, 281, 283, 283, 283, 283, 283, 283, 283, 283,
+			283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 310, 310, 310, 283,
+			283, 283, 283, 283, 283, 283, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			283, 283, 283, 283, 310, 283, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			283, 283, 283, 283, 283, 285, 285, 285, 285, 285, 285, 285, 285, 285, 285, 285,
+			285, 285, 285, 285, 285, 285, 285, 285, 285, 310, 310, 310, 285, 285, 285, 285,
+			285, 285, 285, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 285, 285, 285,
+			285, 310, 285, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 285, 285, 285,
+			285, 285, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287,
+			287, 287, 287, 287, 287, 287, 310, 310, 310, 287, 287, 287, 287, 287, 287, 287,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 287, 287, 287, 287, 310, 287,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 287, 287, 287, 287, 287, 289,
+			289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289, 289,
+			289, 289, 289, 310, 310, 310, 289, 289, 289, 289, 289, 289, 289, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 289, 289, 289, 289, 310, 289, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 289, 289, 289, 289, 289, 295, 295, 295, 295,
+			295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295,
+			310, 310, 310, 295, 295, 295, 295, 295, 295, 295, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 295, 295, 295, 295, 310, 295, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 295, 295, 295, 295, 295, 298, 298, 298, 298, 298, 298, 298,
+			298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 310, 310, 310,
+			298, 298, 298, 298, 298, 298, 298, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 298, 298, 298, 298, 310, 298, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 298, 298, 298, 298, 298, 302, 302, 302, 302, 302, 302, 302, 302, 302, 302,
+			302, 302, 302, 302, 302, 302, 302, 302, 302, 302, 310, 310, 310, 302, 302, 302,
+			302, 302, 302, 302, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 302, 302,
+			302, 302, 310, 302, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 302, 302,
+			302, 302, 302, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304,
+			304, 304, 304, 304, 304, 304, 304, 310, 310, 310, 304, 304, 304, 304, 304, 304,
+			304, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 304, 304, 304, 304, 310,
+			304, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 304, 304, 304, 304, 304,
+			306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+			306, 306, 306, 306, 310, 310, 310, 306, 306, 306, 306, 306, 306, 306, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 306, 306, 306, 306, 310, 306, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 310, 310, 310, 306, 306, 306, 306, 306, 308, 308, 308,
+			308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+			308, 310, 310, 310, 308, 308, 308, 308, 308, 308, 308, 310, 310, 310, 310, 310,
+			310, 310, 310, 310, 310, 308, 308, 308, 308, 87, 308, 310, 97, 87, 310, 310,
+			97, 310, 310, 310, 310, 310, 87, 87, 310, 97, 97, 310, 310, 310, 87, 310,
+			310, 97, 310, 310, 310, 308, 308, 308, 308, 308, 310, 87, 310, 310, 97, 310,
+			87, 87, 310, 97, 97, 87, 310, 310, 97, 310, 310, 310, 310, 87, 310, 310,
+			97, 87, 310, 87, 97, 87, 97, 87, 97, 32, 97, 32, 32, 32, 310, 35,
+			310, 35, 35, 35, 310, 310, 32, 310, 310, 32, 310, 32, 35, 32, 310, 35,
+			310, 35, 310, 310, 310, 310, 310, 310, 310, 32, 310, 310, 310, 310, 310, 35,
+			32, 310, 310, 310, 310, 310, 35, 310, 310, 32, 310, 310, 32, 310, 310, 35,
+			310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+		};
+		unsigned int yytstate = 0, yyti;
+		for (;;) {
+			if (yytfill[yytstate] != 0) {
+				if ((YYLIMIT - YYCURSOR) < yytfill[yytstate]) YYFILL(yytfill[yytstate]);
+			}
+			if (yytact[yytstate] & 128) {
+				yytstate = yytdef[yytstate];
+			} else {
+				yych = *YYCURSOR;
+				yyti = yytbase[yytstate] + yytcls[yych];
+				yytstate = yytcheck[yyti] == yytstate ? yytnext[yyti] : yytdef[yytstate];
+			}
+			if (yytact[yytstate] & 1) ++YYCURSOR;
+			if (yytact[yytstate] & 2) yyaccept = yytsave[yytstate];
+			if (yytact[yytstate] & 4) YYMARKER = YYCURSOR;
+			if (yytact[yytstate] & 8) {
+				YYCURSOR = YYMARKER;
+				yytstate = yytaccept[yyaccept];
+				break;
+			}
+			if (yytact[yytstate] & 16) break;
+		}
+		if (yytstate <= 117) {
+			if (yytstate <= 50) {
+				if (yytstate <= 25) {
+					if (yytstate <= 14) {
+						if (yytstate <= 7) {
+							if (yytstate <= 5) {
+								if (yytstate == 2) {
+#line 241 "table_01.--table.re"
+									{
+		printf("unexpected character: %c\n", *s->tok);
+		goto std;
+	    }
+#line 644 "table_01.--table.c"
+								} else {
+#line 231 "table_01.--table.re"
+									{ goto std; }
+#line 648 "table_01.--table.c"
+								}
+							} else {
+#line 234 "table_01.--table.re"
+								{
+		if(cursor == s->eof) RET(EOI);
+		s->pos = cursor; s->line++;
+		goto std;
+	    }
+#line 657 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate <= 12) {
+								if (yytstate == 9) {
+#line 217 "table_01.--table.re"
+									{ RET('!'); }
+#line 664 "table_01.--table.c"
+								} else {
+#line 223 "table_01.--table.re"
+									{ RET('%'); }
+#line 668 "table_01.--table.c"
+								}
+							} else {
+#line 216 "table_01.--table.re"
+								{ RET('&'); }
+#line 673 "table_01.--table.c"
+							}
+						}
+					} else {
+						if (yytstate <= 21) {
+							if (yytstate <= 19) {
+								if (yytstate == 17) {
+#line 211 "table_01.--table.re"
+									{ RET('('); }
+#line 682 "table_01.--table.c"
+								} else {
+#line 212 "table_01.--table.re"
+									{ RET(')'); }
+#line 686 "table_01.--table.c"
+								}
+							} else {
+#line 221 "table_01.--table.re"
+								{ RET('*'); }
+#line 691 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate == 23) {
+#line 220 "table_01.--table.re"
+								{ RET('+'); }
+#line 697 "table_01.--table.c"
+							} else {
+#line 208 "table_01.--table.re"
+								{ RET(','); }
+#line 701 "table_01.--table.c"
+							}
+						}
+					}
+				} else {
+					if (yytstate <= 39) {
+						if (yytstate <= 31) {
+							if (yytstate <= 29) {
+								if (yytstate == 27) {
+#line 219 "table_01.--table.re"
+									{ RET('-'); }
+#line 712 "table_01.--table.c"
+								} else {
+#line 215 "table_01.--table.re"
+									{ RET('.'); }
+#line 716 "table_01.--table.c"
+								}
+							} else {
+#line 222 "table_01.--table.re"
+								{ RET('/'); }
+#line 721 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate <= 37) {
+								if (yytstate == 33) {
+#line 175 "table_01.--table.re"
+									{ RET(ICON); }
+#line 728 "table_01.--table.c"
+								} else {
+#line 209 "table_01.--table.re"
+									{ RET(':'); }
+#line 732 "table_01.--table.c"
+								}
+							} else {
+#line 205 "table_01.--table.re"
+								{ RET(';'); }
+#line 737 "table_01.--table.c"
+							}
+						}
+					} else {
+						if (yytstate <= 45) {
+							if (yytstate <= 43) {
+								if (yytstate == 41) {
+#line 224 "table_01.--table.re"
+									{ RET('<'); }
+#line 746 "table_01.--table.c"
+								} else {
+#line 210 "table_01.--table.re"
+									{ RET('='); }
+#line 750 "table_01.--table.c"
+								}
+							} else {
+#line 225 "table_01.--table.re"
+								{ RET('>'); }
+#line 755 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate == 47) {
+#line 228 "table_01.--table.re"
+								{ RET('?'); }
+#line 761 "table_01.--table.c"
+							} else {
+#line 171 "table_01.--table.re"
+								{ RET(ID); }
+#line 765 "table_01.--table.c"
+							}
+						}
+					}
+				}
+			} else {
+				if (yytstate <= 91) {
+					if (yytstate <= 77) {
+						if (yytstate <= 56) {
+							if (yytstate <= 54) {
+								if (yytstate == 52) {
+#line 213 "table_01.--table.re"
+									{ RET('['); }
+#line 778 "table_01.--table.c"
+								} else {
+#line 214 "table_01.--table.re"
+									{ RET(']'); }
+#line 782 "table_01.--table.c"
+								}
+							} else {
+#line 226 "table_01.--table.re"
+								{ RET('^'); }
+#line 787 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate <= 75) {
+								if (yytstate == 73) {
+#line 206 "table_01.--table.re"
+									{ RET('{'); }
+#line 794 "table_01.--table.c"
+								} else {
+#line 227 "table_01.--table.re"
+									{ RET('|'); }
+#line 798 "table_01.--table.c"
+								}
+							} else {
+#line 207 "table_01.--table.re"
+								{ RET('}'); }
+#line 803 "table_01.--table.c"
+							}
+						}
+					} else {
+						if (yytstate <= 86) {
+							if (yytstate <= 81) {
+								if (yytstate == 79) {
+#line 218 "table_01.--table.re"
+									{ RET('~'); }
+#line 812 "table_01.--table.c"
+								} else {
+#line 204 "table_01.--table.re"
+									{ RET(NEQ); }
+#line 816 "table_01.--table.c"
+								}
+							} else {
+#line 181 "table_01.--table.re"
+								{ RET(SCON); }
+#line 821 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate == 89) {
+#line 190 "table_01.--table.re"
+								{ RET(MODEQ); }
+#line 827 "table_01.--table.c"
+							} else {
+#line 199 "table_01.--table.re"
+								{ RET(ANDAND); }
+#line 831 "table_01.--table.c"
+							}
+						}
+					}
+				} else {
+					if (yytstate <= 105) {
+						if (yytstate <= 101) {
+							if (yytstate <= 99) {
+								if (yytstate == 93) {
+#line 191 "table_01.--table.re"
+									{ RET(ANDEQ); }
+#line 842 "table_01.--table.c"
+								} else {
+#line 188 "table_01.--table.re"
+									{ RET(MULEQ); }
+#line 846 "table_01.--table.c"
+								}
+							} else {
+#line 196 "table_01.--table.re"
+								{ RET(INCR); }
+#line 851 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate == 103) {
+#line 186 "table_01.--table.re"
+								{ RET(ADDEQ); }
+#line 857 "table_01.--table.c"
+							} else {
+#line 197 "table_01.--table.re"
+								{ RET(DECR); }
+#line 861 "table_01.--table.c"
+							}
+						}
+					} else {
+						if (yytstate <= 113) {
+							if (yytstate <= 109) {
+								if (yytstate == 107) {
+#line 187 "table_01.--table.re"
+									{ RET(SUBEQ); }
+#line 870 "table_01.--table.c"
+								} else {
+#line 198 "table_01.--table.re"
+									{ RET(DEREF); }
+#line 874 "table_01.--table.c"
+								}
+							} else {
+#line 178 "table_01.--table.re"
+								{ RET(FCON); }
+#line 879 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate == 115) {
+#line 136 "table_01.--table.re"
+								{ goto comment; }
+#line 885 "table_01.--table.c"
+							} else {
+#line 189 "table_01.--table.re"
+								{ RET(DIVEQ); }
+#line 889 "table_01.--table.c"
+							}
+						}
+					}
+				}
+			}
+		} else {
+			if (yytstate <= 230) {
+				if (yytstate <= 168) {
+					if (yytstate <= 133) {
+						if (yytstate <= 127) {
+							if (yytstate <= 125) {
+								if (yytstate == 123) {
+#line 195 "table_01.--table.re"
+									{ RET(LSHIFT); }
+#line 904 "table_01.--table.c"
+								} else {
+#line 201 "table_01.--table.re"
+									{ RET(LEQ); }
+#line 908 "table_01.--table.c"
+								}
+							} else {
+#line 203 "table_01.--table.re"
+								{ RET(EQL); }
+#line 913 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate <= 131) {
+								if (yytstate == 129) {
+#line 202 "table_01.--table.re"
+									{ RET(GEQ); }
+#line 920 "table_01.--table.c"
+								} else {
+#line 194 "table_01.--table.re"
+									{ RET(RSHIFT); }
+#line 924 "table_01.--table.c"
+								}
+							} else {
+#line 192 "table_01.--table.re"
+								{ RET(XOREQ); }
+#line 929 "table_01.--table.c"
+							}
+						}
+					} else {
+						if (yytstate <= 162) {
+							if (yytstate <= 149) {
+								if (yytstate == 141) {
+#line 145 "table_01.--table.re"
+									{ RET(DO); }
+#line 938 "table_01.--table.c"
+								} else {
+#line 153 "table_01.--table.re"
+									{ RET(IF); }
+#line 942 "table_01.--table.c"
+								}
+							} else {
+#line 193 "table_01.--table.re"
+								{ RET(OREQ); }
+#line 947 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate == 164) {
+#line 200 "table_01.--table.re"
+								{ RET(OROR); }
+#line 953 "table_01.--table.c"
+							} else {
+#line 183 "table_01.--table.re"
+								{ RET(ELLIPSIS); }
+#line 957 "table_01.--table.c"
+							}
+						}
+					}
+				} else {
+					if (yytstate <= 214) {
+						if (yytstate <= 191) {
+							if (yytstate <= 178) {
+								if (yytstate == 176) {
+#line 185 "table_01.--table.re"
+									{ RET(LSHIFTEQ); }
+#line 968 "table_01.--table.c"
+								} else {
+#line 184 "table_01.--table.re"
+									{ RET(RSHIFTEQ); }
+#line 972 "table_01.--table.c"
+								}
+							} else {
+#line 151 "table_01.--table.re"
+								{ RET(FOR); }
+#line 977 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate <= 211) {
+								if (yytstate == 194) {
+#line 154 "table_01.--table.re"
+									{ RET(INT); }
+#line 984 "table_01.--table.c"
+								} else {
+#line 138 "table_01.--table.re"
+									{ RET(AUTO); }
+#line 988 "table_01.--table.c"
+								}
+							} else {
+#line 140 "table_01.--table.re"
+								{ RET(CASE); }
+#line 993 "table_01.--table.c"
+							}
+						}
+					} else {
+						if (yytstate <= 224) {
+							if (yytstate <= 222) {
+								if (yytstate == 216) {
+#line 141 "table_01.--table.re"
+									{ RET(CHAR); }
+#line 1002 "table_01.--table.c"
+								} else {
+#line 147 "table_01.--table.re"
+									{ RET(ELSE); }
+#line 1006 "table_01.--table.c"
+								}
+							} else {
+#line 148 "table_01.--table.re"
+								{ RET(ENUM); }
+#line 1011 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate == 228) {
+#line 152 "table_01.--table.re"
+								{ RET(GOTO); }
+#line 1017 "table_01.--table.c"
+							} else {
+#line 155 "table_01.--table.re"
+								{ RET(LONG); }
+#line 1021 "table_01.--table.c"
+							}
+						}
+					}
+				}
+			} else {
+				if (yytstate <= 282) {
+					if (yytstate <= 267) {
+						if (yytstate <= 249) {
+							if (yytstate <= 247) {
+								if (yytstate == 243) {
+#line 167 "table_01.--table.re"
+									{ RET(VOID); }
+#line 1034 "table_01.--table.c"
+								} else {
+#line 139 "table_01.--table.re"
+									{ RET(BREAK); }
+#line 1038 "table_01.--table.c"
+								}
+							} else {
+#line 142 "table_01.--table.re"
+								{ RET(CONST); }
+#line 1043 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate <= 259) {
+								if (yytstate == 255) {
+#line 150 "table_01.--table.re"
+									{ RET(FLOAT); }
+#line 1050 "table_01.--table.c"
+								} else {
+#line 158 "table_01.--table.re"
+									{ RET(SHORT); }
+#line 1054 "table_01.--table.c"
+								}
+							} else {
+#line 165 "table_01.--table.re"
+								{ RET(UNION); }
+#line 1059 "table_01.--table.c"
+							}
+						}
+					} else {
+						if (yytstate <= 277) {
+							if (yytstate <= 275) {
+								if (yytstate == 271) {
+#line 169 "table_01.--table.re"
+									{ RET(WHILE); }
+#line 1068 "table_01.--table.c"
+								} else {
+#line 146 "table_01.--table.re"
+									{ RET(DOUBLE); }
+#line 1072 "table_01.--table.c"
+								}
+							} else {
+#line 149 "table_01.--table.re"
+								{ RET(EXTERN); }
+#line 1077 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate == 280) {
+#line 157 "table_01.--table.re"
+								{ RET(RETURN); }
+#line 1083 "table_01.--table.c"
+							} else {
+#line 159 "table_01.--table.re"
+								{ RET(SIGNED); }
+#line 1087 "table_01.--table.c"
+							}
+						}
+					}
+				} else {
+					if (yytstate <= 296) {
+						if (yytstate <= 288) {
+							if (yytstate <= 286) {
+								if (yytstate == 284) {
+#line 160 "table_01.--table.re"
+									{ RET(SIZEOF); }
+#line 1098 "table_01.--table.c"
+								} else {
+#line 161 "table_01.--table.re"
+									{ RET(STATIC); }
+#line 1102 "table_01.--table.c"
+								}
+							} else {
+#line 162 "table_01.--table.re"
+								{ RET(STRUCT); }
+#line 1107 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate == 290) {
+#line 163 "table_01.--table.re"
+								{ RET(SWITCH); }
+#line 1113 "table_01.--table.c"
+							} else {
+#line 144 "table_01.--table.re"
+								{ RET(DEFAULT); }
+#line 1117 "table_01.--table.c"
+							}
+						}
+					} else {
+						if (yytstate <= 305) {
+							if (yytstate <= 303) {
+								if (yytstate == 299) {
+#line 164 "table_01.--table.re"
+									{ RET(TYPEDEF); }
+#line 1126 "table_01.--table.c"
+								} else {
+#line 143 "table_01.--table.re"
+									{ RET(CONTINUE); }
+#line 1130 "table_01.--table.c"
+								}
+							} else {
+#line 156 "table_01.--table.re"
+								{ RET(REGISTER); }
+#line 1135 "table_01.--table.c"
+							}
+						} else {
+							if (yytstate == 307) {
+#line 166 "table_01.--table.re"
+								{ RET(UNSIGNED); }
+#line 1141 "table_01.--table.c"
+							} else {
+#line 168 "table_01.--table.re"
+								{ RET(VOLATILE); }
+#line 1145 "table_01.--table.c"
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
+#line 245 "table_01.--table.re"
+
+
+comment:
+
+#line 1159 "table_01.--table.c"
+{
+	YYCTYPE yych;
+	{
+		static const unsigned char yytcls[256] = {
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+			2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+			2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 4, 4, 4, 5,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+			6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+		};
+		static const unsigned char yytact[8] = {
+			1, 129, 16, 129, 16, 1, 129, 16,
+		};
+		static const unsigned char yytfill[8] = {
+			2, 0, 0, 0, 0, 0, 0, 0,
+		};
+		static const unsigned char yytdef[8] = {
+			1, 2, 0, 4, 0, 2, 7, 0,
+		};
+		static const unsigned char yytbase[8] = {
+			0, 0, 0, 0, 0, 0, 0, 0,
+		};
+		static const unsigned char yytnext[7] = {
+			0, 3, 0, 5, 0, 6, 0,
+		};
+		static const unsigned char yytcheck[7] = {
+			8, 0, 8, 0, 8, 5, 8,
+		};
+		unsigned int yytstate = 0, yyti;
+		for (;;) {
+			if (yytfill[yytstate] != 0) {
+				if ((YYLIMIT - YYCURSOR) < yytfill[yytstate]) YYFILL(yytfill[yytstate]);
+			}
+			if (yytact[yytstate] & 128) {
+				yytstate = yytdef[yytstate];
+			} else {
+				yych = *YYCURSOR;
+				yyti = yytbase[yytstate] + yytcls[yych];
+				yytstate = yytcheck[yyti] == yytstate ? yytnext[yyti] : yytdef[yytstate];
+			}
+			if (yytact[yytstate] & 1) ++YYCURSOR;
+			if (yytact[yytstate] & 16) break;
+		}
+		if (yytstate <= 4) {
+			if (yytstate == 2) {
+#line 256 "table_01.--table.re"
+				{ goto comment; }
+#line 1218 "table_01.--table.c"
+			} else {
+#line 251 "table_01.--table.re"
+				{
+		if(cursor == s->eof) RET(EOI);
+		s->tok = s->pos = cursor; s->line++;
+		goto comment;
+	    }
+#line 1226 "table_01.--table.c"
+			}
+		} else {
+#line 249 "table_01.--table.re"
+			{ goto std; }
+#line 1231 "table_01.--table.c"
+		}
+	}
+}
+#line 257 "table_01.--table.re"
+
+}
+
+main(){
+    Scanner in;
+    int t;
+    memset((char*) &in, 0, sizeof(in));
+    in.fd = 0;
+    while((t = scan(&in)) != EOI){
+/*
+	printf("%d\t%.*s\n", t, in.cur - in.tok, in.tok);
+	printf("%d\n", t);
+*/
+    }
+    close(in.fd);
+}
@@ -0,0 +1,241 @@
+/* Generated by re2c */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define	BSIZE	8192
+
+typedef struct Scanner
+{
+	FILE			*fp;
+	unsigned char	*cur, *tok, *lim, *eof;
+	unsigned char 	buffer[BSIZE];
+} Scanner;
+
+int fill(Scanner *s, int len)
+{
+	if (!len)
+	{
+		s->cur = s->tok = s->lim = s->buffer;
+		s->eof = 0;
+	}
+	if (!s->eof)
+	{
+		int got, cnt = s->tok - s->buffer;
+
+		if (cnt > 0)
+		{
+			memcpy(s->buffer, s->tok, s->lim - s->tok);
+			s->tok -= cnt;
+			s->cur -= cnt;
+			s->lim -= cnt;
+		}
+		cnt = BSIZE - cnt;
+		if ((got = fread(s->lim, 1, cnt, s->fp)) != cnt)
+		{
+			s->eof = &s->lim[got];
+		}
+		s->lim += got;
+	}
+	else if (s->cur + len > s->eof)
+	{
+		return 0; /* not enough input data */
+	}
+	return -1;
+}
+
+void fputl(const char *s, size_t len, FILE *stream)
+{
+	while(len-- > 0)
+	{
+		fputc(*s++, stream);
+	}
+}
+
+
+enum YYCONDTYPE {
+	EStateR1,
+	EStateR2,
+};
+
+
+void scan(Scanner *s)
+{
+	int cond = EStateR1;
+	
+	fill(s, 0);
+
+	for(;;)
+	{
+		s->tok = s->cur;
+
+		{
+			unsigned char yych;
+			switch (cond) {
+			case EStateR1: goto yyc_R1;
+			case EStateR2: goto yyc_R2;
+			}
+/* *********************************** */
+yyc_R1:
+			{
+				static const unsigned char yytcls[256] = {
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+					2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+					3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+					4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+					5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+				};
+				static const unsigned char yytact[6] = {
+					1, 129, 16, 129, 0, 16,
+				};
+				static const unsigned char yytfill[6] = {
+					1, 0, 0, 1, 0, 0,
+				};
+				static const unsigned char yytdef[6] = {
+					1, 2, 0, 4, 5, 0,
+				};
+				static const unsigned char yytbase[6] = {
+					0, 0, 0, 0, 1, 0,
+				};
+				static const unsigned char yytnext[8] = {
+					0, 3, 3, 3, 3, 3, 3, 0,
+				};
+				static const unsigned char yytcheck[8] = {
+					6, 0, 4, 0, 4, 0, 4, 6,
+				};
+				unsigned int yytstate = 0, yyti;
+				for (;;) {
+					if (yytfill[yytstate] != 0) {
+						if ((s->lim - s->cur) < yytfill[yytstate]) { if(fill(s, yytfill[yytstate]) >= 0) break; }
+					}
+					if (yytact[yytstate] & 128) {
+						yytstate = yytdef[yytstate];
+					} else {
+						yych = *s->cur;
+						yyti = yytbase[yytstate] + yytcls[yych];
+						yytstate = yytcheck[yyti] == yytstate ? yytnext[yyti] : yytdef[yytstate];
+					}
+					if (yytact[yytstate] & 1) ++s->cur;
+					if (yytact[yytstate] & 16) break;
+				}
+				if (yytstate == 2) {
+					{
+					continue;
+				}
+				} else {
+					{
+					continue;
+				}
+				}
+			}
+/* *********************************** */
+yyc_R2:
+			{
+				static const unsigned char yytcls[256] = {
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+					1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+					2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+					3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+					4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+					5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+					6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+				};
+				static const unsigned char yytact[6] = {
+					1, 129, 16, 129, 0, 16,
+				};
+				static const unsigned char yytfill[6] = {
+					1, 0, 0, 1, 0, 0,
+				};
+				static const unsigned char yytdef[6] = {
+					1, 2, 0, 4, 5, 0,
+				};
+				static const unsigned char yytbase[6] = {
+					0, 0, 0, 0, 1, 0,
+				};
+				static const unsigned char yytnext[8] = {
+					0, 3, 3, 3, 3, 3, 3, 0,
+				};
+				static const unsigned char yytcheck[8] = {
+					6, 0, 4, 0, 4, 0, 4, 6,
+				};
+				unsigned int yytstate = 0, yyti;
+				for (;;) {
+					if (yytfill[yytstate] != 0) {
+						if ((s->lim - s->cur) < yytfill[yytstate]) { if(fill(s, yytfill[yytstate]) >= 0) break; }
+					}
+					if (yytact[yytstate] & 128) {
+						yytstate = yytdef[yytstate];
+					} else {
+						yych = *s->cur;
+						yyti = yytbase[yytstate] + yytcls[yych];
+						yytstate = yytcheck[yyti] == yytstate ? yytnext[yyti] : yytdef[yytstate];
+					}
+					if (yytact[yytstate] & 1) ++s->cur;
+					if (yytact[yytstate] & 16) break;
+				}
+				if (yytstate == 2) {
+					{
+					continue;
+				}
+				} else {
+					{
+					continue;
+				}
+				}
+			}
+		}
+
+	}
+}
+
+int main(int argc, char **argv)
+{
+	Scanner in;
+	char c;
+
+	if (argc != 2)
+	{
+		fprintf(stderr, "%s <file>\n", argv[0]);
+		return 1;;
+	}
+
+	memset((char*) &in, 0, sizeof(in));
+
+	if (!strcmp(argv[1], "-"))
+	{
+		in.fp = stdin;
+	}
+	else if ((in.fp = fopen(argv[1], "r")) == NULL)
+	{
+		fprintf(stderr, "Cannot open file '%s'\n", argv[1]);
+		return 1;
+	}
+
+	scan(&in);
+
+	if (in.fp != stdin)
+	{
+		fclose(in.fp);
+	}
+	return 0;
+}
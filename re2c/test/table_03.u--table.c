@@ -0,0 +1,163 @@
+/* Generated by re2c */
+#line 1 "table_03.u--table.re"
+
+#define YYFILL(n) if (cursor >= limit) break;
+#define YYCTYPE unsigned int
+#define YYCURSOR cursor
+#define YYLIMIT limit
+#define YYMARKER marker
+
+#line 16 "table_03.u--table.re"
+
+
+#define APPEND(text) \
+	append(output, outsize, text, sizeof(text) - sizeof(YYCTYPE))
+
+inline void append(YYCTYPE *output, size_t & outsize, const YYCTYPE * text, size_t len)
+{
+	memcpy(output + outsize, text, len);
+	outsize += (len / sizeof(YYCTYPE));
+}
+
+void scan(YYCTYPE *pText, size_t *pSize, int *pbChanged)
+{
+	// rule
+	// scan lines
+	// find $ in lines
+	//   compact $<keyword>: .. $ to $<keyword>$
+  
+	YYCTYPE *output;
+	const YYCTYPE *cursor, *limit, *marker;
+
+	cursor = marker = output = *pText;
+
+	size_t insize = *pSize;
+	size_t outsize = 0;
+
+	limit = cursor + insize;
+
+	while(1) {
+loop:
+
+#line 43 "table_03.u--table.c"
+{
+	YYCTYPE yych;
+	{
+		static const unsigned int yytbound[35] = {
+			10, 11, 36, 37, 58, 59, 68, 69, 73, 74, 76, 77, 82, 83, 84, 97,
+			98, 99, 100, 101, 102, 103, 104, 105, 106, 110, 111, 112, 114, 115, 116, 117,
+			118, 119, 1114112,
+		};
+		static const unsigned char yytact[53] = {
+			1, 129, 16, 5, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+			129, 16, 1, 1, 1, 1, 1, 129, 0, 129, 16, 1, 1, 1, 129, 16,
+			1, 129, 0, 1, 1, 129, 0, 1, 1, 1, 129, 16, 1, 1, 129, 0,
+			129, 16, 1, 129, 0,
+		};
+		static const unsigned char yytfill[53] = {
+			11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+			0, 0, 0, 1, 0,
+		};
+		static const unsigned char yytdef[53] = {
+			1, 2, 0, 2, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+			17, 0, 24, 5, 5, 5, 5, 24, 23, 26, 0, 34, 5, 5, 31, 0,
+			38, 34, 33, 5, 5, 38, 37, 5, 5, 5, 43, 0, 47, 5, 47, 46,
+			49, 0, 52, 52, 51,
+		};
+		static const unsigned char yytbase[53] = {
+			9, 0, 0, 0, 12, 0, 11, 4, 12, 6, 3, 0, 13, 3, 5, 18,
+			0, 0, 36, 1, 16, 12, 5, 0, 14, 0, 0, 39, 13, 26, 0, 0,
+			42, 0, 15, 22, 27, 0, 18, 21, 17, 23, 0, 0, 47, 20, 0, 23,
+			0, 0, 48, 0, 26,
+		};
+		static const unsigned char yytnext[83] = {
+			0, 0, 0, 16, 25, 18, 27, 4, 30, 6, 32, 7, 3, 8, 9, 5,
+			5, 16, 25, 5, 42, 30, 44, 48, 5, 50, 42, 5, 10, 48, 11, 12,
+			13, 14, 15, 19, 20, 21, 22, 5, 28, 29, 5, 35, 36, 5, 39, 40,
+			41, 45, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+			0, 0, 0,
+		};
+		static const unsigned char yytcheck[83] = {
+			53, 53, 53, 11, 19, 11, 19, 3, 22, 3, 22, 3, 0, 3, 3, 24,
+			34, 24, 34, 38, 40, 38, 40, 45, 47, 45, 47, 52, 4, 52, 6, 7,
+			8, 9, 10, 12, 13, 14, 15, 18, 20, 21, 27, 28, 29, 32, 35, 36,
+			39, 41, 44, 50, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+			53, 53, 53,
+		};
+		unsigned int yytstate = 0, yyti, yytl, yytu, yytm;
+		for (;;) {
+			if (yytfill[yytstate] != 0) {
+				if ((YYLIMIT - YYCURSOR) < yytfill[yytstate]) YYFILL(yytfill[yytstate]);
+			}
+			if (yytact[yytstate] & 128) {
+				yytstate = yytdef[yytstate];
+			} else {
+				yych = *YYCURSOR;
+				yytl = 0;
+				yytu = 34;
+				while (yytl < yytu) {
+					yytm = (yytl + yytu) / 2;
+					if (yych < yytbound[yytm]) yytu = yytm;
+					else yytl = yytm + 1;
+				}
+				yyti = yytbase[yytstate] + yytl;
+				yytstate = yytcheck[yyti] == yytstate ? yytnext[yyti] : yytdef[yytstate];
+			}
+			if (yytact[yytstate] & 1) ++YYCURSOR;
+			if (yytact[yytstate] & 4) YYMARKER = YYCURSOR;
+			if (yytact[yytstate] & 8) {
+				YYCURSOR = YYMARKER;
+				yytstate = 2;
+				break;
+			}
+			if (yytact[yytstate] & 16) break;
+		}
+		if (yytstate <= 26) {
+			if (yytstate <= 17) {
+				if (yytstate == 2) {
+#line 53 "table_03.u--table.re"
+					{ output[outsize++] = cursor[-1]; if (cursor >= limit) break; goto loop; }
+#line 125 "table_03.u--table.c"
+				} else {
+#line 49 "table_03.u--table.re"
+					{ APPEND(L"$" L"Id$"); goto loop; }
+#line 129 "table_03.u--table.c"
+				}
+			} else {
+#line 50 "table_03.u--table.re"
+				{ APPEND(L"$" L"Log$"); goto loop; }
+#line 134 "table_03.u--table.c"
+			}
+		} else {
+			if (yytstate <= 43) {
+				if (yytstate == 31) {
+#line 48 "table_03.u--table.re"
+					{ APPEND(L"$" L"Date$"); goto loop; }
+#line 141 "table_03.u--table.c"
+				} else {
+#line 52 "table_03.u--table.re"
+					{ APPEND(L"$" L"Source$"); goto loop; }
+#line 145 "table_03.u--table.c"
+				}
+			} else {
+#line 51 "table_03.u--table.re"
+				{ APPEND(L"$" L"Revision$"); goto loop; }
+#line 150 "table_03.u--table.c"
+			}
+		}
+	}
+}
+#line 55 "table_03.u--table.re"
+
+	}
+	output[outsize] = '\0';
+
+	// set the new size
+	*pSize = outsize;
+	
+	*pbChanged = (insize == outsize) ? 0 : 1;
+}
@@ -25507,9 +25507,8 @@ int main()
  	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~豈論廬遼宅海惘難龜雷力溜兀祉搜𢡊蘿陋漣陸﨔突殺𧻓落陵連率靖艹爵﫟鸞率廉泥﨤贈益﫧廊數寧匿館舘类﫯擄辰零麟勤冀襁﫷露凉了炙屮墳諭﫿 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                 	
@@ -25545,47 +25544,24 @@ int main()
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~￰￱￲￳￴￵￶￷￸￹￺￻￼�￾￿ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~￀￁ￂￃￄￅￆￇ￈￉ￊￋￌￍￎￏ￐￑ￒￓￔￕￖￗ￘￙ￚￛￜ￝￞￟￠￡￢￣￤￥￦￧￨￩￪￫￬￭￮￯ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ÁĂŃƄǅȆɇʈˉ̊͋ΌύЎяҐӑԒՓ֔וؖٗژۙܚÜĝŞƟǠȡɢʣˤ̥ͦΧϨЩѪҫӬԭծ֯װرٲڳ۴ܵ¶÷ĸŹƺǻȼɽʾ˿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~݂݄݆݈݀݁݃݅݇݉݊݋݌ݍݎݏ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ݐݑݒݓݔݕݖݗݘݙݚݛݜݝݞݟݠݡݢݣݤݥݦݧݨݩݪݫݬݭݮݯݰݱݲݳݴݵݶݷݸݹݺݻݼݽݾݿހށނރބޅކއވމފދތލގޏސޑޒޓޔޕޖޗޘޙޚޛޜޝޞޟޠޡޢޣޤޥަާިީުޫެޭޮޯްޱ޲޳޴޵޶޷޸޹޺޻޼޽޾޿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ऀुংৃ਄੅આેଈ୉ஊோఌ్ಎ೏ഐ൑ඒීด๕ຖ໗༘ཙྚ࿛जढ़ঞয়ਠ੡ઢૣତ୥஦௧న౩ಪ೫ബ൭ථ෯ะ๱າ໳༴ཱུྶ࿷सॹ঺৻਼੽ા૿ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ÁĂŃƄǅȆɇʈˉ̊͋ΌύЎяҐӑԒՓ֔וؖٗژۙܚޛÝĞşƠǡȢɣʤ˥̦ͧΨϩЪѫҬӭԮկְױزٳڴ۵ܶ޷¸ùĺŻƼǽȾɿ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~݂݄݆݈݀݁݃݅݇݉݊݋݌ݍݎݏ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ݐݑݒݓݔݕݖݗݘݙݚݛݜݝݞݟݠݡݢݣݤݥݦݧݨݩݪݫݬݭݮݯݰݱݲݳݴݵݶݷݸݹݺݻݼݽݾݿऀुংৃ਄੅આેଈ୉ஊோఌ్ಎ೏ഐ൑ඒීด๕ຖ໗༘ཙྚ࿛जढ़ঞয়ਠ੡ઢૣତ୥஦௧న౩ಪ೫ബ൭ථ෯ะ๱າ໳༴ཱུྶ࿷सॹ঺৻਼੽ા૿ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~က၁ႂჃᄄᅅᆆᇇለ቉ኊዋጌፍဎ၏႐ბᄒᅓᆔᇕሖ቗ኘዙጚ፛လၝ႞ჟᄠᅡᆢᇣሤብኦዧጨ፩ဪၫႬჭᄮᅯᆰᇱሲታኴድጶ፷းၹႺ჻ᄼᅽᆾᇿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ᎠᎡᎢᎣᎤᎥᎦᎧᎨᎩᎪᎫᎬᎭᎮᎯᎰᎱᎲᎳᎴᎵᎶᎷᎸᎹᎺᎻᎼᎽᎾᎿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ᎀᎁᎂᎃᎄᎅᎆᎇᎈᎉᎊᎋᎌᎍᎎᎏ᎐᎑᎒᎓᎔᎕᎖᎗᎘᎙᎚᎛᎜᎝᎞᎟Ꮐᐁᑂᒃᓄᔅᕆᖇᗈᘉᙊᚋᛌᜍᝎត័᠑ᡒᏓᐔᑕᒖᓗᔘᕙᖚᗛᘜᙝ᚞ᛟᜠᝡអ៣ᠤᡥᏦᐧᑨᒩᓪᔫᕬᖭᗮᘯᙰᚱᛲᜳ᝴឵៶ᠷᡸᏹᐺᑻᒼᓽᔾᕿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ᢀᢁᢂᢃᢄᢅᢆᢇᢈᢉᢊᢋᢌᢍᢎᢏᢐᢑᢒᢓᢔᢕᢖᢗᢘᢙᢚᢛᢜᢝᢞᢟᢠᢡᢢᢣᢤᢥᢦᢧᢨᢩᢪ᢫᢬᢭᢮᢯ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ᢰᢱᢲᢳᢴᢵᢶᢷᢸᢹᢺᢻᢼᢽᢾᢿᤀ᥁ᤂ᥃ᤄ᥅ᤆ᥇ᤈ᥉ᤊ᥋ᤌ᥍ᤎ᥏ᤐᥑᤒᥓᤔᥕᤖᥗᤘᥙᤚᥛᤜᥝᤞᥟᤠᥡᤢᥣᤤᥥᤦᥧᤨᥩᤪᥫ᤬ᥭ᤮᥯ᤰᥱᤲᥳᤴ᥵ᤶ᥷ᤸ᥹᤺᥻᤼᥽᤾᥿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~᧠᧡᧢᧣᧤᧥᧦᧧᧨᧩᧪᧫᧬᧭᧮᧯᧰᧱᧲᧳᧴᧵᧶᧷᧸᧹᧺᧻᧼᧽᧾᧿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ᧀᧁᧂᧃᧄᧅᧆᧇᧈᧉ᧊᧋᧌᧍᧎᧏᧐᧑᧒᧓᧔᧕᧖᧗᧘᧙᧚᧛᧜᧝᧞᧟ᴀᵁᴂᵃᴄᵅᴆᵇᴈᵉᴊᵋᴌᵍᴎᵏᴐᵑᴒᵓᴔᵕᴖᵗᴘᵙᴚᵛᴜᵝᴞᵟᴠᵡᴢᵣᴤᵥᴦᵧᴨᵩᴪᵫᴬᵭᴮᵯᴰᵱᴲᵳᴴᵵᴶᵷᴸᵹᴺᵻᴼᵽᴾᵿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ḀṁẂểἄὅᾆῇḈṉẊịἌὍᾎ῏ḐṑẒồἔὕᾖῗḘṙẚớἜὝᾞ῟ḠṡẢợἤὥᾦῧḨṩẪừἬὭᾮ`ḰṱẲỳἴήᾶῷḸṹẺỻἼώι῿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ ⁁₂⃃℄ⅅↆ⇇∈≉⊊⋋⌌⍍⎎⏏␐⑑⒒ⓓ└╕▖◗☘♙⚚⛛✜❝➞⟟⠠⡡⢢⣣⤤⥥⦦⧧⨨⩩⪪⫫⬬⭭⮮⯯‰ⁱ₲⃳ℴⅵ↶⇷∸≹⊺⋻⌼⍽⎾⏿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~⺀⻁⼂⽃⾄⺅⻆⼇⽈⾉⺊⻋⼌⽍⾎⺏⻐⼑⽒⾓⺔⻕⼖⽗⾘⺙⻚⼛⽜⾝⺞⻟⼠⽡⾢⺣⻤⼥⽦⾧⺨⻩⼪⽫⾬⺭⻮⼯⽰⾱⺲⻳⼴⽵⾶⺷⻸⼹⽺⾻⺼⻽⼾⽿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~⿀⿁⿂⿃⿄⿅⿆⿇⿈⿉⿊⿋⿌⿍⿎⿏⿐⿑⿒⿓⿔⿕⿖⿗⿘⿙⿚⿛⿜⿝⿞⿟⿰⿱⿲⿳⿴⿵⿶⿷⿸⿹⿺⿻⿼⿽⿾⿿ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~က၁ႂჃᄄᅅᆆᇇለ቉ኊዋጌፍᏎᐏᑐᒑᓒᔓᕔᖕᗖᘗᙘᚙᛚ᜛᝜ឝ៞᠟ᡠᤡᥢᴣᵤḥṦầỨἩὪᾫῬိၮႯჰᄱᅲᆳᇴስቶ኷ዸጹ፺ᏻᐼᑽᒾᓿᎠ᧡Ꭲ᧣Ꭴ᧥Ꭶ᧧Ꭸ᧩Ꭺ᧫Ꭼ᧭Ꭾ᧯Ꮀ᧱Ꮂ᧳Ꮄ᧵Ꮆ᧷Ꮈ᧹Ꮊ᧻Ꮌ᧽Ꮎ᧿ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ᎀᧁᎂᧃᎄᧅᎆᧇᎈᧉᎊ᧋ᎌ᧍ᎎ᧏᎐᧑᎒᧓᎔᧕᎖᧗᎘᧙᎚᧛᎜᧝᎞᧟ᢀᢁᢂᢃᢄᢅᢆᢇᢈᢉᢊᢋᢌᢍᢎᢏᢐᢑᢒᢓᢔᢕᢖᢗᢘᢙᢚᢛᢜᢝᢞᢟᢠᢡᢢᢣᢤᢥᢦᢧᢨᢩᢪ᢫᢬᢭᢮᢯ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ᢰᢱᢲᢳᢴᢵᢶᢷᢸᢹᢺᢻᢼᢽᢾᢿ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ ⁁₂⃃℄ⅅↆ⇇∈≉⊊⋋⌌⍍⎎⏏␐⑑⒒ⓓ└╕▖◗☘♙⚚⛛✜❝➞⟟⠠⡡⢢⣣⤤⥥⦦⧧⨨⩩⪪⫫⬬⭭⮮⯯⺰⻱⼲⽳⾴‵⁶₷⃸ℹⅺ↻⇼∽≾⊿⿀⿁⿂⿃⿄⿅⿆⿇⿈⿉⿊⿋⿌⿍⿎⿏⿐⿑⿒⿓⿔⿕⿖⿗⿘⿙⿚⿛⿜⿝⿞⿟⿰⿱⿲⿳⿴⿵⿶⿷⿸⿹⿺⿻⿼⿽⿾⿿ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~⿠⿡⿢⿣⿤⿥⿦⿧⿨⿩⿪⿫⿬⿭⿮⿯ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~　ぁもッ㄄ㅅㆆ〇えらナㄋㅌㆍ『くゐパㄒㅓ㆔〕ざ゗ヘㄙㅚ㆛〜そゞミㄠㅡㆢ〣つゥユㄧㅨㆩ〪にガロㄮㅯㆰ〱ひコヴㄵㅶㆷ〸べズ・ㄼㅽㆾ〿 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ㇰㇱㇲㇳㇴㇵㇶㇷㇸㇹㇺㇻㇼㇽㇾㇿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~㇀㇁㇂㇃㇄㇅㇆㇇㇈㇉㇊㇋㇌㇍㇎㇏㇐㇑㇒㇓㇔㇕㇖㇗㇘㇙㇚㇛㇜㇝㇞㇟㇠㇡㇢㇣㇤㇥㇦㇧㇨㇩㇪㇫㇬㇭㇮㇯㈀㉁㊂㋃㌄㍅㎆㏇㐈㑉㒊㓋㔌㕍㖎㗏㘐㙑㚒㛓㜔㝕㞖㟗㠘㡙㢚㣛㤜㥝㦞㧟㨠㩡㪢㫣㬤㭥㮦㯧㰨㱩㲪㳫㴬㵭㶮㷯㸰㹱㺲㻳㼴㽵㾶㿷㈸㉹㊺㋻㌼㍽㎾㏿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~䀀偁悂烃脄酅䆆凇戈牉芊鋋䌌卍掎珏萐鑑䒒哓攔畕薖闗䘘噙暚盛蜜靝䞞域栠硡袢飣䤤奥榦秧訨驩䪪嫫欬筭议鯯䰰山沲糳贴鵵䶶巷游繹躺黻似彽澾翿 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ꀀꁁꂂꃃꄄꅅꆆꇇꈈꉉꊊꋋꌌꍍꎎꏏꐐꑑ꒒ꀓꁔꂕꃖꄗꅘꆙꇚꈛꉜꊝꋞꌟꍠꎡꏢꐣꑤ꒥ꀦꁧꂨꃩꄪꅫꆬꇭꈮꉯꊰꋱꌲꍳꎴꏵꐶꑷ꒸ꀹꁺꂻꃼꄽꅾꆿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~꓀꓁꓂꓃꓄꓅꓆꓇꓈꓉꓊꓋꓌꓍꓎꓏ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ꓐꓑꓒꓓꓔꓕꓖꓗꓘꓙꓚꓛꓜꓝꓞꓟꓠꓡꓢꓣꓤꓥꓦꓧꓨꓩꓪꓫꓬꓭꓮꓯꓰꓱꓲꓳꓴꓵꓶꓷꓸꓹꓺꓻꓼꓽ꓾꓿가걁겂곃괄굅궆귇금깉꺊껋꼌꽍꾎꿏감걑겒곓괔굕궖귗긘깙꺚껛꼜꽝꾞꿟갠걡겢곣괤굥궦귧긨깩꺪껫꼬꽭꾮꿯갰걱겲곳괴굵궶귷길깹꺺껻꼼꽽꾾꿿 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~뀀쁁낂샃넄셅놆쇇눈쉉늊싋댌썍뎎쏏됐쑑뒒쓓디압떖엗똘왙뚚웛뜜읝랞쟟렠졡뢢죣뤤쥥릦짧먨쩩몪쫫묬쭭뮮쯯배챱벲쳳봴쵵붶췷븸칹뺺컻뼼콽뾾쿿 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~퀀큁킂탃턄텅톆퇇툈퉉튊틋파퍍펎폏퐐푑풒퓓픔핕햖헗혘홙횚훛휜흝퀞큟킠탡턢텣톤퇥툦퉧튨틩팪퍫펬폭퐮푯풰퓱픲핳햴헵혶홷횸훹휺흻퀼큽킾탿 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~힀힁힂힃힄힅힆힇히힉힊힋힌힍힎힏힐힑힒힓힔힕힖힗힘힙힚힛힜힝힞힟힠힡힢힣힤힥힦힧힨힩힪힫힬힭힮힯 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ힰힱힲힳힴힵힶힷힸힹힺힻힼힽힾힿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~襤便簾裏﨨響着﫫שּׁﭭﮮﯯﰰﱱﲲﳳﴴﵵﶶﷷ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~︀︁︂︃︄︅︆︇︈︉︊︋︌︍︎️︧︨︩︪︫︬︭︠︡︢︣︤︥︦︮︯︰︱︲︳︴︵︶︷︸︹︺︻︼︽︾︿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~︐︑︒︓︔︕︖︗︘︙︚︛︜︝︞︟﹀ﺁﻂ＃ｄﾅￆ﹇ﺈﻉ＊ｋﾌￍ﹎ﺏﻐ１ｒﾓￔ﹕ﺖﻗ８ｙﾚￛ﹜ﺝﻞ？｠ﾡ￢﹣ﺤﻥＦｧﾨ￩﹪ﺫﻬＭｮﾯ￰ﹱﺲﻳＴｵﾶ￷ﹸﺹﻺ［ｼﾽ￾ﹿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~　ぁもッ㄄ㅅㆆ㈇㉈㊉㋊㌋㍌㎍㏎㐏㑐㒑㓒㔓㕔㖕㗖㘗㙘㚙㛚㜛㝜㞝㟞㠟㡠㢡㣢㤣㥤㦥㧦㨧㩨㪩㫪㬫㭬㮭㯮㰯㱰㲱㳲㴳㵴㶵㷶㸷㹸㺹㻺㼻㽼㾽㿾〿ㇰㇱㇲㇳㇴㇵㇶㇷㇸㇹㇺㇻㇼㇽㇾㇿ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~㇀㇁㇂㇃㇄㇅㇆㇇㇈㇉㇊㇋㇌㇍㇎㇏㇐㇑㇒㇓㇔㇕㇖㇗㇘㇙㇚㇛㇜㇝㇞㇟㇠㇡㇢㇣㇤㇥㇦㇧㇨㇩㇪㇫㇬㇭㇮㇯ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~䀀偁悂烃脄酅놆쇇䉉劊拋猌荍鎎돏쐐䒒哓攔畕薖闗똘왙䛛圜杝瞞蟟頠롡좢䤤奥榦秧訨驩몪쫫䭭宮毯簰豱鲲볳촴䶶巷游繹躺黻뼼콽俿 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ꀀꁁꂂꃃꄄꅅꆆꇇꈈꉉꊊꋋꌌꍍꎎꏏꐐꑑ꒒갓걔겕곖괗굘궙귚긛깜꺝껞꼟꽠꾡꿢ꀣꁤꂥꃦꄧꅨꆩꇪꈫꉬꊭꋮꌯꍰꎱꏲꐳꑴ꒵갶걷겸곹괺굻궼귽긾깿꓀꓁꓂꓃꓄꓅꓆꓇꓈꓉꓊꓋꓌꓍꓎꓏ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ꓐꓑꓒꓓꓔꓕꓖꓗꓘꓙꓚꓛꓜꓝꓞꓟꓠꓡꓢꓣꓤꓥꓦꓧꓨꓩꓪꓫꓬꓭꓮꓯꓰꓱꓲꓳꓴꓵꓶꓷꓸꓹꓺꓻꓼꓽ꓾꓿ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~퀀큁킂탃턄텅톆퇇툈퉉튊틋파퍍펎폏퐐푑풒퓓픔핕햖헗혘홙횚훛휜흝퀾큿힀힁힂힃힄힅힆힇히힉힊힋힌힍힎힏힐힑힒힓힔힕힖힗힘힙힚힛힜힝힞힟힠힡힢힣힤힥힦힧힨힩힪힫힬힭힮힯 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~襤便簾裏﨨響着﫫שּׁﭭﮮﯯﰰﱱﲲﳳﴴﵵﶶﷷﹸﺹﻺ［ｼﾽ￾︀︁︂︃︄︅︆︇︈︉︊︋︌︍︎️︧︨︩︪︫︬︭︠︡︢︣︤︥︦︮︯︰︱︲︳︴︵︶︷︸︹︺︻︼︽︾︿ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~︐︑︒︓︔︕︖︗︘︙︚︛︜︝︞︟ 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ÁÃÅÇÉËÍÏÑÓÕ×ÙÛÝß á¢ã¤å¦ç¨éªë¬í®ï°ñ²ó´õ¶÷¸ùºû¼ý¾ÿ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                 	
@@ -25855,17 +25831,15 @@ int main()
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~㐀㑁㒂㓃㔄㕅㖆㗇㘈㙉㚊㛋㜌㝍㞎㟏㠐㡑㢒㣓㤔㥕㦖㧗㨘㩙㪚㫛㬜㭝㮞㯟㰠㱡㲢㳣㴤㵥㶦㷧㸨㹩㺪㻫㼬㽭㾮㿯㐰㑱㒲㓳㔴㕵㖶㗷㘸㙹㚺㛻㜼㝽㞾㟿 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~䀀䁁䂂䃃䄄䅅䆆䇇䈈䉉䊊䋋䌌䍍䎎䏏䐐䑑䒒䓓䔔䕕䖖䗗䘘䙙䚚䛛䜜䝝䞞䟟䠠䡡䢢䣣䤤䥥䦦䧧䨨䩩䪪䫫䬬䭭䮮䯯䰰䱱䲲䳳䴴䵵䶶䀷䁸䂹䃺䄻䅼䆽䇾䈿 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~䀀䁁䂂䃃䄄䅅䆆䇇䈈䉉䊊䋋䌌䍍䎎䏏䐐䑑䒒䓓䔔䕕䖖䗗䘘䙙䚚䛛䜜䝝䞞䟟䠠䡡䢢䣣䤤䥥䦦䧧䨨䩩䪪䫫䬬䭭䮮䯯䰰䱱䲲䳳䴴䵵䶶䀷䁸䂹䃺䄻䅼䆽䇾䈿 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~䷀䷁䷂䷃䷄䷅䷆䷇䷈䷉䷊䷋䷌䷍䷎䷏䷐䷑䷒䷓䷔䷕䷖䷗䷘䷙䷚䷛䷜䷝䷞䷟䷠䷡䷢䷣䷤䷥䷦䷧䷨䷩䷪䷫䷬䷭䷮䷯䷰䷱䷲䷳䷴䷵䷶䷷䷸䷹䷺䷻䷼䷽䷾䷿ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~一乁亂仃伄佅來俇丈义亊介伌位侎俏丐乑互仓伔何侖俗丘乙亚仛伜佝侞俟丠乡亢代伤佥侦俧丨乩亪仫伬佭侮俯丰乱亲仳伴併侶俷丸乹人任似佽侾俿 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~倀恁炂胃鄄充憆燇興鉉劊拋猌荍鎎叏搐瑑蒒铓唔敕疖藗阘噙暚盛蜜靝垞柟砠衡颢壣椤祥覦駧娨橩窪諫鬬孭殮篯谰鱱岲泳紴赵鶶巷游繹躺黻弼潽羾迿 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~倀恁炂胃鄄充憆燇興鉉劊拋猌荍鎎叏搐瑑蒒铓唔敕疖藗阘噙暚盛蜜靝垞柟砠衡颢壣椤祥覦駧娨橩窪諫鬬孭殮篯谰鱱岲泳紴赵鶶巷游繹躺黻弼潽羾迿 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ꀀꁁꂂꃃꄄꅅꆆꇇꈈꉉꊊꋋꌌꍍꎎꏏꐐꑑꀒꁓꂔꃕꄖꅗꆘꇙꈚꉛꊜꋝꌞꍟꎠꏡꐢꑣꀤꁥꂦꃧꄨꅩꆪꇫꈬꉭꊮꋯꌰꍱꎲꏳꐴꑵꀶꁷꂸꃹꄺꅻꆼꇽꈾꉿ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ꒀꒁꒂꒃꒄꒅꒆꒇꒈꒉꒊꒋꒌ꒍꒎꒏ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~꒐꒑꒒꒓꒔꒕꒖꒗꒘꒙꒚꒛꒜꒝꒞꒟꒠꒡꒢꒣꒤꒥꒦꒧꒨꒩꒪꒫꒬꒭꒮꒯꒰꒱꒲꒳꒴꒵꒶꒷꒸꒹꒺꒻꒼꒽꒾꒿ 	
@@ -25876,12 +25850,10 @@ int main()
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~가걁겂곃괄굅궆귇금깉꺊껋꼌꽍꾎꿏감걑겒곓괔굕궖귗긘깙꺚껛꼜꽝꾞꿟갠걡겢곣괤굥궦귧긨깩꺪껫꼬꽭꾮꿯갰걱겲곳괴굵궶귷길깹꺺껻꼼꽽꾾꿿 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~뀀쁁낂샃넄셅놆쇇눈쉉늊싋댌썍뎎쏏됐쑑뒒쓓디압떖엗똘왙뚚웛뜜읝랞쟟렠졡뢢죣뤤쥥릦짧먨쩩몪쫫묬쭭뮮쯯배챱벲쳳봴쵵붶췷븸칹뺺컻뼼콽뾾쿿 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~퀀큁킂탃턄텅톆퇇툈퉉튊틋파퍍펎폏퐐푑풒퓓픔핕햖헗혘홙횚훛휜흝퀞큟킠탡턢텣톤퇥툦퉧튨틩팪퍫펬폭퐮푯풰퓱픲핳햴헵혶홷횸훹휺흻퀼큽킾탿 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~힀힁힂힃힄힅힆힇히힉힊힋힌힍힎힏힐힑힒힓힔힕힖힗힘힙힚힛힜힝힞힟힠힡힢힣힤힥힦힧힨힩힪힫힬힭힮힯 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~뀀쁁낂샃넄셅놆쇇눈쉉늊싋댌썍뎎쏏됐쑑뒒쓓디압떖엗똘왙뚚웛뜜읝랞쟟렠졡뢢죣뤤쥥릦짧먨쩩몪쫫묬쭭뮮쯯배챱벲쳳봴쵵붶췷븸칹뺺컻뼼콽뾾쿿 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~퀀큁킂탃턄텅톆퇇툈퉉튊틋파퍍펎폏퐐푑풒퓓픔핕햖헗혘홙횚훛휜흝퀞큟킠탡턢텣톤퇥툦퉧튨틩팪퍫펬폭퐮푯풰퓱픲핳햴헵혶홷횸훹휺흻퀼큽킾탿힀힁힂힃힄힅힆힇히힉힊힋힌힍힎힏힐힑힒힓힔힕힖힗힘힙힚힛힜힝힞힟힠힡힢힣힤힥힦힧힨힩힪힫힬힭힮힯 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ힰힱힲힳힴힵힶힷힸힹힺힻힼힽힾힿ 	
- !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                                                                                                                                 	
+ !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                                                                                                                                                                                                 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~ 	
  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~                                                                 	
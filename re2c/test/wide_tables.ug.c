@@ -0,0 +1,1878 @@
+/* Generated by re2c */
+#line 1 "wide_tables.ug.re"
+// identifiers in several scripts: many spans above 0xFF
+// are classified with two-level jump tables (see note [wide tables])
+#define YYCTYPE unsigned int
+
+int lex(const YYCTYPE *YYCURSOR)
+{
+	const YYCTYPE *YYMARKER;
+
+#line 12 "wide_tables.ug.c"
+{
+	YYCTYPE yych;
+	static const unsigned char yytarget_map[] = {
+		  0,   0,   1,   2,   3,   4,   5,   6, 
+		  6,   6,   6,   6,   6,   6,   7,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  8,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   9, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  0,   0,  10,  11,  12,  13,  14,  15, 
+		 15,  15,  15,  15,  15,  15,  16,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 17,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,  18, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+	};
+	static void *yytarget_pages[] = {
+		/* page 0 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		/* page 1 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 2 */
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy7, &&yy2,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 3 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		/* page 4 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 5 */
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4,
+		&&yy4, &&yy4, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 6 */
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 7 */
+		&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4,
+		&&yy4, &&yy4, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 8 */
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 9 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 10 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 11 */
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy7, &&yy9,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 12 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		/* page 13 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 14 */
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 15 */
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 16 */
+		&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 17 */
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 18 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+	};
+	yych = *YYCURSOR;
+	if (yych & ~0xFF) {
+		if (yych > 0x0010FFFF) goto yy2;
+		goto *yytarget_pages[(yytarget_map[0 + (yych >> 8)] << 8) + (yych & 0xFF)];
+	} else {
+		static void *yytarget[256] = {
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4,
+			&&yy4, &&yy4, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy7,
+			&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy2,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy2,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7
+		};
+		goto *yytarget[yych];
+	}
+yy2:
+	++YYCURSOR;
+#line 16 "wide_tables.ug.re"
+	{ return 0; }
+#line 1779 "wide_tables.ug.c"
+yy4:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	if (yych & ~0xFF) {
+		if (yych <= 0x0000065F) goto yy6;
+		if (yych <= 0x00000669) goto yy4;
+		if (yych <= 0x00000E4F) goto yy6;
+		if (yych <= 0x00000E59) goto yy4;
+	} else {
+		static void *yytarget[256] = {
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4,
+			&&yy4, &&yy4, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6
+		};
+		goto *yytarget[yych];
+	}
+yy6:
+#line 15 "wide_tables.ug.re"
+	{ return 2; }
+#line 1828 "wide_tables.ug.c"
+yy7:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	if (yych & ~0xFF) {
+		if (yych > 0x0010FFFF) goto yy9;
+		goto *yytarget_pages[(yytarget_map[4352 + (yych >> 8)] << 8) + (yych & 0xFF)];
+	} else {
+		static void *yytarget[256] = {
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy7,
+			&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy9,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy9,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7
+		};
+		goto *yytarget[yych];
+	}
+yy9:
+#line 14 "wide_tables.ug.re"
+	{ return 1; }
+#line 1875 "wide_tables.ug.c"
+}
+#line 17 "wide_tables.ug.re"
+
+}
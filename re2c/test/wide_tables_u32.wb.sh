@@ -0,0 +1,4 @@
+# compile and run the scanner with code units above 0xFFFF
+$re2c $switches "$outx" || exit 1
+$cc -Wall -o "$outc.out" "$outc" && ./"$outc.out" && echo "run: ok"
+rm -f "$outc.out"
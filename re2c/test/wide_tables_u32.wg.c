@@ -0,0 +1,870 @@
+/* Generated by re2c */
+#line 1 "wide_tables_u32.wg.re"
+// YYCTYPE is wider than 16-bit code units: values above 0xFFFF must
+// not index two-level tables (see note [wide tables])
+#include <stdio.h>
+
+#define YYCTYPE unsigned int
+
+static int lex(const YYCTYPE *YYCURSOR)
+{
+
+#line 13 "wide_tables_u32.wg.c"
+{
+	YYCTYPE yych;
+	static const unsigned char yytarget_map[] = {
+		  0,   0,   1,   2,   3,   4,   5,   6, 
+		  6,   6,   6,   6,   6,   6,   7,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  8,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   9, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  6,   6,   6,   6,   6,   6,   6,   6, 
+		  0,   0,  10,  11,  12,  13,  14,  15, 
+		 15,  15,  15,  15,  15,  15,  16,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 17,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,   0, 
+		  0,   0,   0,   0,   0,   0,   0,  18, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+		 15,  15,  15,  15,  15,  15,  15,  15, 
+	};
+	static void *yytarget_pages[] = {
+		/* page 0 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		/* page 1 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 2 */
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy7, &&yy2,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 3 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		/* page 4 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 5 */
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4,
+		&&yy4, &&yy4, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 6 */
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 7 */
+		&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4,
+		&&yy4, &&yy4, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 8 */
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 9 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+		/* page 10 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 11 */
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy7, &&yy9,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 12 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		/* page 13 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 14 */
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 15 */
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 16 */
+		&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 17 */
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		/* page 18 */
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+		&&yy7, &&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+		&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+	};
+	yych = *YYCURSOR;
+	if (yych & ~0xFF) {
+		if (yych > 0xFFFF) goto yy2;
+		goto *yytarget_pages[(yytarget_map[0 + (yych >> 8)] << 8) + (yych & 0xFF)];
+	} else {
+		static void *yytarget[256] = {
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4,
+			&&yy4, &&yy4, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy7,
+			&&yy2, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2, &&yy2,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy2,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy2,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7
+		};
+		goto *yytarget[yych];
+	}
+yy2:
+	++YYCURSOR;
+#line 17 "wide_tables_u32.wg.re"
+	{ return 0; }
+#line 756 "wide_tables_u32.wg.c"
+yy4:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	if (yych & ~0xFF) {
+		if (yych <= 0x065F) goto yy6;
+		if (yych <= 0x0669) goto yy4;
+		if (yych <= 0x0E4F) goto yy6;
+		if (yych <= 0x0E59) goto yy4;
+	} else {
+		static void *yytarget[256] = {
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4, &&yy4,
+			&&yy4, &&yy4, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6,
+			&&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6, &&yy6
+		};
+		goto *yytarget[yych];
+	}
+yy6:
+#line 16 "wide_tables_u32.wg.re"
+	{ return 2; }
+#line 805 "wide_tables_u32.wg.c"
+yy7:
+	++YYCURSOR;
+	yych = *YYCURSOR;
+	if (yych & ~0xFF) {
+		if (yych > 0xFFFF) goto yy9;
+		goto *yytarget_pages[(yytarget_map[256 + (yych >> 8)] << 8) + (yych & 0xFF)];
+	} else {
+		static void *yytarget[256] = {
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy7,
+			&&yy9, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9, &&yy9,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy9,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy9,
+			&&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7, &&yy7
+		};
+		goto *yytarget[yych];
+	}
+yy9:
+#line 15 "wide_tables_u32.wg.re"
+	{ return 1; }
+#line 852 "wide_tables_u32.wg.c"
+}
+#line 18 "wide_tables_u32.wg.re"
+
+}
+
+int main()
+{
+	static const YYCTYPE s1[] = {0x12345, 0};
+	static const YYCTYPE s2[] = {'a', 0x4E00, 0x12345, 0};
+	static const YYCTYPE s3[] = {0xFFFFFFF0u, 0};
+	static const YYCTYPE s4[] = {0x0E50, 0x12345, 0};
+	if (lex(s1) != 0 || lex(s2) != 1 || lex(s3) != 0 || lex(s4) != 2)
+	{
+		fprintf(stderr, "error\n");
+		return 1;
+	}
+	return 0;
+}
+run: ok
@@ -0,0 +1,560 @@
+/* Generated by re2c */
+#include <string.h>
+#line 1 "word_compare.--word-compare.re"
+
+#line 6 "word_compare.--word-compare.c"
+{
+	YYCTYPE yych;
+	if ((YYLIMIT - YYCURSOR) < 23) YYFILL(23);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '\t':
+	case ' ':	goto yy4;
+	case 'C':	goto yy7;
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 's':
+	case 't':
+	case 'v':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	case 'r':	goto yy11;
+	case 'u':	goto yy12;
+	case 'w':	goto yy13;
+	default:	goto yy2;
+	}
+yy2:
+	++YYCURSOR;
+yy3:
+#line 8 "word_compare.--word-compare.re"
+	{ return 0; }
+#line 49 "word_compare.--word-compare.c"
+yy4:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+	switch (yych) {
+	case '\t':
+	case ' ':	goto yy4;
+	default:	goto yy6;
+	}
+yy6:
+#line 7 "word_compare.--word-compare.re"
+	{ return 6; }
+#line 62 "word_compare.--word-compare.c"
+yy7:
+	yych = *(YYMARKER = ++YYCURSOR);
+	{
+		static const YYCTYPE yyword[] = {'o', 'n', 't', 'e', 'n', 't', '-', 'L'};
+#if defined(__GNUC__)
+		if (__builtin_expect (memcmp (YYCURSOR, yyword, sizeof (yyword)) == 0, 1)) {
+#else
+		if (memcmp (YYCURSOR, yyword, sizeof (yyword)) == 0) {
+#endif
+			YYCURSOR += 7;
+			goto yy40;
+		}
+	}
+	switch (yych) {
+	case 'o':	goto yy14;
+	default:	goto yy3;
+	}
+yy8:
+	++YYCURSOR;
+	if (YYLIMIT <= YYCURSOR) YYFILL(1);
+	yych = *YYCURSOR;
+yy9:
+	switch (yych) {
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	default:	goto yy10;
+	}
+yy10:
+#line 6 "word_compare.--word-compare.re"
+	{ return 5; }
+#line 118 "word_compare.--word-compare.c"
+yy11:
+	yych = *++YYCURSOR;
+	{
+		static const YYCTYPE yyword[] = {'e', 't', 'u', 'r', 'n'};
+#if defined(__GNUC__)
+		if (__builtin_expect (memcmp (YYCURSOR, yyword, 4 * sizeof (yyword[0])) == 0 && memcmp (YYCURSOR + 1, yyword + 1, 4 * sizeof (yyword[0])) == 0, 1)) {
+#else
+		if (memcmp (YYCURSOR, yyword, 4 * sizeof (yyword[0])) == 0 && memcmp (YYCURSOR + 1, yyword + 1, 4 * sizeof (yyword[0])) == 0) {
+#endif
+			YYCURSOR += 4;
+			goto yy33;
+		}
+	}
+	switch (yych) {
+	case 'e':	goto yy16;
+	default:	goto yy9;
+	}
+yy12:
+	yych = *++YYCURSOR;
+	{
+		static const YYCTYPE yyword[] = {'n', 's', 'i', 'g', 'n', 'e', 'd', '_'};
+#if defined(__GNUC__)
+		if (__builtin_expect (memcmp (YYCURSOR, yyword, sizeof (yyword)) == 0, 1)) {
+#else
+		if (memcmp (YYCURSOR, yyword, sizeof (yyword)) == 0) {
+#endif
+			YYCURSOR += 7;
+			goto yy41;
+		}
+	}
+	switch (yych) {
+	case 'n':	goto yy17;
+	default:	goto yy9;
+	}
+yy13:
+	yych = *++YYCURSOR;
+	{
+		static const YYCTYPE yyword[] = {'h', 'i', 'l', 'e'};
+#if defined(__GNUC__)
+		if (__builtin_expect (memcmp (YYCURSOR, yyword, sizeof (yyword)) == 0, 1)) {
+#else
+		if (memcmp (YYCURSOR, yyword, sizeof (yyword)) == 0) {
+#endif
+			YYCURSOR += 3;
+			goto yy30;
+		}
+	}
+	switch (yych) {
+	case 'h':	goto yy18;
+	default:	goto yy9;
+	}
+yy14:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy19;
+	default:	goto yy15;
+	}
+yy15:
+	YYCURSOR = YYMARKER;
+	goto yy3;
+yy16:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 't':	goto yy20;
+	default:	goto yy9;
+	}
+yy17:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 's':	goto yy21;
+	default:	goto yy9;
+	}
+yy18:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy22;
+	default:	goto yy9;
+	}
+yy19:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 't':	goto yy23;
+	default:	goto yy15;
+	}
+yy20:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'u':	goto yy24;
+	default:	goto yy9;
+	}
+yy21:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy25;
+	default:	goto yy9;
+	}
+yy22:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy26;
+	default:	goto yy9;
+	}
+yy23:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy27;
+	default:	goto yy15;
+	}
+yy24:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'r':	goto yy28;
+	default:	goto yy9;
+	}
+yy25:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy29;
+	default:	goto yy9;
+	}
+yy26:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy30;
+	default:	goto yy9;
+	}
+yy27:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy32;
+	default:	goto yy15;
+	}
+yy28:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy33;
+	default:	goto yy9;
+	}
+yy29:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy35;
+	default:	goto yy9;
+	}
+yy30:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	default:	goto yy31;
+	}
+yy31:
+#line 2 "word_compare.--word-compare.re"
+	{ return 1; }
+#line 298 "word_compare.--word-compare.c"
+yy32:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 't':	goto yy36;
+	default:	goto yy15;
+	}
+yy33:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	default:	goto yy34;
+	}
+yy34:
+#line 3 "word_compare.--word-compare.re"
+	{ return 2; }
+#line 340 "word_compare.--word-compare.c"
+yy35:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'e':	goto yy37;
+	default:	goto yy9;
+	}
+yy36:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case '-':	goto yy38;
+	default:	goto yy15;
+	}
+yy37:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'd':	goto yy39;
+	default:	goto yy9;
+	}
+yy38:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'L':	goto yy40;
+	default:	goto yy15;
+	}
+yy39:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case '_':	goto yy41;
+	default:	goto yy9;
+	}
+yy40:
+	yych = *++YYCURSOR;
+	{
+		static const YYCTYPE yyword[] = {'e', 'n', 'g', 't', 'h', ':'};
+#if defined(__GNUC__)
+		if (__builtin_expect (memcmp (YYCURSOR, yyword, 4 * sizeof (yyword[0])) == 0 && memcmp (YYCURSOR + 2, yyword + 2, 4 * sizeof (yyword[0])) == 0, 1)) {
+#else
+		if (memcmp (YYCURSOR, yyword, 4 * sizeof (yyword[0])) == 0 && memcmp (YYCURSOR + 2, yyword + 2, 4 * sizeof (yyword[0])) == 0) {
+#endif
+			YYCURSOR += 5;
+			goto yy52;
+		}
+	}
+	switch (yych) {
+	case 'e':	goto yy42;
+	default:	goto yy15;
+	}
+yy41:
+	yych = *++YYCURSOR;
+	{
+		static const YYCTYPE yyword[] = {'l', 'o', 'n', 'g', '_', 'l', 'o', 'n'};
+#if defined(__GNUC__)
+		if (__builtin_expect (memcmp (YYCURSOR, yyword, sizeof (yyword)) == 0, 1)) {
+#else
+		if (memcmp (YYCURSOR, yyword, sizeof (yyword)) == 0) {
+#endif
+			YYCURSOR += 7;
+			goto yy56;
+		}
+	}
+	switch (yych) {
+	case 'l':	goto yy43;
+	default:	goto yy9;
+	}
+yy42:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy44;
+	default:	goto yy15;
+	}
+yy43:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy45;
+	default:	goto yy9;
+	}
+yy44:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy46;
+	default:	goto yy15;
+	}
+yy45:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy47;
+	default:	goto yy9;
+	}
+yy46:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 't':	goto yy48;
+	default:	goto yy15;
+	}
+yy47:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'g':	goto yy49;
+	default:	goto yy9;
+	}
+yy48:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'h':	goto yy50;
+	default:	goto yy15;
+	}
+yy49:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case '_':	goto yy51;
+	default:	goto yy9;
+	}
+yy50:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case ':':	goto yy52;
+	default:	goto yy15;
+	}
+yy51:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'l':	goto yy54;
+	default:	goto yy9;
+	}
+yy52:
+	++YYCURSOR;
+#line 4 "word_compare.--word-compare.re"
+	{ return 3; }
+#line 469 "word_compare.--word-compare.c"
+yy54:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'o':	goto yy55;
+	default:	goto yy9;
+	}
+yy55:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy56;
+	default:	goto yy9;
+	}
+yy56:
+	yych = *++YYCURSOR;
+	{
+		static const YYCTYPE yyword[] = {'g', '_', 'i', 'n', 't'};
+#if defined(__GNUC__)
+		if (__builtin_expect (memcmp (YYCURSOR, yyword, 4 * sizeof (yyword[0])) == 0 && memcmp (YYCURSOR + 1, yyword + 1, 4 * sizeof (yyword[0])) == 0, 1)) {
+#else
+		if (memcmp (YYCURSOR, yyword, 4 * sizeof (yyword[0])) == 0 && memcmp (YYCURSOR + 1, yyword + 1, 4 * sizeof (yyword[0])) == 0) {
+#endif
+			YYCURSOR += 4;
+			goto yy61;
+		}
+	}
+	switch (yych) {
+	case 'g':	goto yy57;
+	default:	goto yy9;
+	}
+yy57:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case '_':	goto yy58;
+	default:	goto yy9;
+	}
+yy58:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'i':	goto yy59;
+	default:	goto yy9;
+	}
+yy59:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 'n':	goto yy60;
+	default:	goto yy9;
+	}
+yy60:
+	yych = *++YYCURSOR;
+	switch (yych) {
+	case 't':	goto yy61;
+	default:	goto yy9;
+	}
+yy61:
+	++YYCURSOR;
+	switch ((yych = *YYCURSOR)) {
+	case '_':
+	case 'a':
+	case 'b':
+	case 'c':
+	case 'd':
+	case 'e':
+	case 'f':
+	case 'g':
+	case 'h':
+	case 'i':
+	case 'j':
+	case 'k':
+	case 'l':
+	case 'm':
+	case 'n':
+	case 'o':
+	case 'p':
+	case 'q':
+	case 'r':
+	case 's':
+	case 't':
+	case 'u':
+	case 'v':
+	case 'w':
+	case 'x':
+	case 'y':
+	case 'z':	goto yy8;
+	default:	goto yy62;
+	}
+yy62:
+#line 5 "word_compare.--word-compare.re"
+	{ return 4; }
+#line 558 "word_compare.--word-compare.c"
+}
+#line 9 "word_compare.--word-compare.re"
+